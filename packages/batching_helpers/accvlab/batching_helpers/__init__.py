@@ -29,6 +29,10 @@ from .batched_indexing_ops import (
 from .batched_index_mapping_op import batched_index_mapping
 from .batched_mask_from_indices import get_mask_from_indices
 from .batched_bool_indexing import batched_bool_indexing, batched_bool_indexing_write
+from .batched_linear_assignment import batched_linear_sum_assignment
+from .batched_box_overlap import batched_pairwise_box_overlap
+from .batched_sort import batched_sort, batched_argsort, batched_topk
+from .batched_nms import batched_nms, batched_soft_nms
 from .batched_processing_py import (
     average_over_targets,
     sum_over_targets,
@@ -52,6 +56,13 @@ __all__ = [
             'batched_index_mapping',
             'batched_bool_indexing',
             'batched_bool_indexing_write',
+            'batched_linear_sum_assignment',
+            'batched_pairwise_box_overlap',
+            'batched_sort',
+            'batched_argsort',
+            'batched_topk',
+            'batched_nms',
+            'batched_soft_nms',
             'average_over_targets',
             'sum_over_targets',
             'apply_mask_to_tensor',
@@ -0,0 +1,133 @@
+# Copyright (c) 2025, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+from typing import Union
+
+import torch
+
+from .data_format import RaggedBatch
+import accvlab.batching_helpers.batched_indexing_access_cuda as batched_indexing_access_cuda
+import accvlab.batching_helpers.batched_indexing_access_cpu as batched_indexing_access_cpu
+
+# Must match `BoxOverlapMode` in `cpp_impl/box_overlap_helpers.h`
+_BOX_OVERLAP_MODES = {"iou": 0, "giou": 1, "diou": 2}
+
+
+def _get_flat_boxes_and_sizes(boxes: Union[RaggedBatch, torch.Tensor], num_batch_dims: int, name: str):
+    if isinstance(boxes, RaggedBatch):
+        assert (
+            boxes.num_batch_dims == num_batch_dims
+        ), "`boxes_a` and `boxes_b` need to have the same number of batch dimensions"
+        assert (
+            boxes.non_uniform_dim == num_batch_dims
+        ), f"The non-uniform dimension of `{name}` needs to be the box dimension"
+        boxes = boxes.flatten_batch_dims()
+        tensor = boxes.tensor
+        sample_sizes = boxes.sample_sizes
+    else:
+        tensor = boxes.flatten(0, num_batch_dims - 1)
+        sample_sizes = torch.full(
+            (tensor.shape[0],), tensor.shape[1], dtype=torch.int64, device=tensor.device
+        )
+    assert (
+        tensor.dim() == 3 and tensor.shape[2] == 4
+    ), f"`{name}` needs to have the shape (*batch_shape, num_boxes, 4)"
+    return tensor, sample_sizes
+
+
+def batched_pairwise_box_overlap(
+    boxes_a: Union[RaggedBatch, torch.Tensor],
+    boxes_b: Union[RaggedBatch, torch.Tensor],
+    mode: str = "iou",
+    as_cost: bool = False,
+    fill_value: float = 0.0,
+    eps: float = 1e-6,
+) -> RaggedBatch:
+    """Compute the pair-wise overlap (IoU, GIoU or DIoU) between two sets of axis-aligned 2D boxes per sample.
+
+    :gpu:
+
+    For each sample, the overlap is computed for all pairs of valid boxes, i.e. for
+    ``result[i, a, b]`` with ``a < num_boxes_a[i]`` and ``b < num_boxes_b[i]``. All other entries of the
+    result are set to ``fill_value``, so that no computations are performed for filler boxes and the
+    result is directly usable as a padded cost matrix (e.g. for :func:`batched_linear_sum_assignment`).
+
+    Boxes are given as ``(x1, y1, x2, y2)``, where ``(x1, y1)`` is the upper-left corner. The union (IoU),
+    the enclosing box area (GIoU), and the squared enclosing box diagonal (DIoU) are clamped to ``eps``
+    to avoid division by zero for degenerate boxes.
+
+    On the CPU, the samples are processed in parallel and the computation is vectorized. On the GPU, one
+    thread is used per box pair.
+
+    Note:
+        The operation is not differentiable (it is intended for cost matrices used in matching).
+
+    Args:
+        boxes_a: First set of boxes. Shape: (\\*batch_shape, max_num_boxes_a, 4). Can be a tensor (all boxes
+            valid) or a :class:`RaggedBatch` instance (non-uniform in the box dimension).
+        boxes_b: Second set of boxes. Shape: (\\*batch_shape, max_num_boxes_b, 4). Same format as ``boxes_a``.
+        mode: One of ``"iou"``, ``"giou"`` or ``"diou"``
+        as_cost: If ``True``, ``1 - overlap`` is computed for valid pairs (i.e. a cost for matching)
+        fill_value: Value to set for pairs involving at least one filler box
+        eps: Lower bound used for the denominators
+
+    Returns:
+        Pair-wise overlaps. Shape: (\\*batch_shape, max_num_boxes_a, max_num_boxes_b).
+        If ``boxes_b`` is a :class:`RaggedBatch`, the result has the same sample sizes as ``boxes_b``
+        (with non-uniform dimension ``num_batch_dims + 1``). Otherwise, if ``boxes_a`` is a
+        :class:`RaggedBatch`, the result has the same sample sizes as ``boxes_a`` (with non-uniform
+        dimension ``num_batch_dims``).
+
+    Example:
+
+        IoU-based matching cost of predictions (uniform number per sample) vs. GT boxes (ragged):
+
+        >>> # rects_pred: (batch_size, num_preds, 4) tensor; rects_gt: RaggedBatch (batch_size, max_num_gt, 4)
+        >>> cost = batched_pairwise_box_overlap(rects_pred, rects_gt, mode="giou", as_cost=True)
+        >>> cost.tensor.shape
+        torch.Size([batch_size, num_preds, max_num_gt])
+        >>> matched_pred_indices, matched_gt_indices = batched_linear_sum_assignment(cost)
+
+    """
+    assert mode in _BOX_OVERLAP_MODES, f"Unknown mode '{mode}'; supported: {list(_BOX_OVERLAP_MODES)}"
+
+    if isinstance(boxes_a, RaggedBatch):
+        num_batch_dims = boxes_a.num_batch_dims
+    elif isinstance(boxes_b, RaggedBatch):
+        num_batch_dims = boxes_b.num_batch_dims
+    else:
+        num_batch_dims = boxes_a.dim() - 2
+    batch_shape = boxes_a.shape[:num_batch_dims]
+    assert (
+        boxes_b.shape[:num_batch_dims] == batch_shape
+    ), "`boxes_a` and `boxes_b` need to have the same batch shape"
+
+    data_a, sizes_a = _get_flat_boxes_and_sizes(boxes_a, num_batch_dims, "boxes_a")
+    data_b, sizes_b = _get_flat_boxes_and_sizes(boxes_b, num_batch_dims, "boxes_b")
+    data_a = data_a.detach().contiguous()
+    data_b = data_b.detach().to(dtype=data_a.dtype).contiguous()
+    sizes_a = sizes_a.to(dtype=torch.int64).contiguous()
+    sizes_b = sizes_b.to(dtype=torch.int64).contiguous()
+
+    ext = batched_indexing_access_cuda if data_a.is_cuda else batched_indexing_access_cpu
+    res = ext.batched_pairwise_box_overlap(
+        data_a, sizes_a, data_b, sizes_b, _BOX_OVERLAP_MODES[mode], as_cost, fill_value, eps
+    )
+    res = res.reshape(*batch_shape, *res.shape[1:])
+
+    if isinstance(boxes_b, RaggedBatch):
+        return boxes_b.create_with_sample_sizes_like_self(res, non_uniform_dim=num_batch_dims + 1)
+    if isinstance(boxes_a, RaggedBatch):
+        return boxes_a.create_with_sample_sizes_like_self(res, non_uniform_dim=num_batch_dims)
+    return RaggedBatch.FromFullTensor(res, non_uniform_dim=num_batch_dims + 1, num_batch_dims=num_batch_dims)
@@ -0,0 +1,108 @@
+# Copyright (c) 2025, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+from typing import Optional, Tuple
+
+import torch
+
+from .data_format import RaggedBatch
+import accvlab.batching_helpers.batched_indexing_access_cpu as batched_indexing_access_cpu
+
+
+def batched_linear_sum_assignment(
+    cost_matrices: RaggedBatch,
+    other_sample_sizes: Optional[torch.Tensor] = None,
+    maximize: bool = False,
+) -> Tuple[RaggedBatch, RaggedBatch]:
+    """Solve the linear sum assignment problem (Hungarian matching) for a batch of cost matrices.
+
+    The matching itself is performed on the CPU using a shortest augmenting path (Jonker-Volgenant style)
+    solver, with the samples processed in parallel. This replaces the common pattern of splitting the
+    batch, calling :func:`scipy.optimize.linear_sum_assignment` per sample and combining the results
+    with :func:`combine_data`. Inputs may reside on the GPU; the results are returned on the device of the
+    input.
+
+    For each sample, the valid part of the cost matrix is ``cost_matrices.tensor[i, :num_rows[i], :num_cols[i]]``,
+    where the size along the non-uniform dimension of ``cost_matrices`` is given by
+    ``cost_matrices.sample_sizes`` and the size along the other matrix dimension by ``other_sample_sizes``.
+    Filler values are never read. Rectangular matrices are supported; in this case, ``min(num_rows, num_cols)``
+    matches are returned for the sample.
+
+    The results are equivalent to the ones of :func:`scipy.optimize.linear_sum_assignment`, i.e. the
+    matches of each sample are ordered by increasing row index. Note that if several optimal assignments
+    exist, a different (but equally optimal) assignment may be returned.
+
+    Args:
+        cost_matrices: Cost matrices. Shape: (\\*batch_shape, max_num_rows, max_num_cols). The non-uniform
+            dimension needs to be one of the two matrix dimensions.
+        other_sample_sizes: Number of valid entries along the matrix dimension which is not the non-uniform
+            dimension of ``cost_matrices``. Shape: batch_shape. If not set, all entries along this dimension
+            are valid.
+        maximize: Whether to maximize (instead of minimize) the total cost
+
+    Returns:
+        Tuple of
+
+        - Matched row indices. Shape: (\\*batch_shape, min(max_num_rows, max_num_cols))
+        - Matched column indices, with the same sample sizes as the row indices
+
+        The sample sizes of both correspond to the number of matches of the individual samples.
+
+    Raises:
+        ValueError: If a cost matrix does not allow for a complete assignment with finite cost
+
+    Example:
+
+        Matching predictions (rows) to a variable number of GT objects (columns) per sample:
+
+        >>> # costs.tensor: (batch_size, num_preds, max_num_gt); non-uniform along the GT dimension
+        >>> costs = gt_classes.create_with_sample_sizes_like_self(cost_tensor, non_uniform_dim=2)
+        >>> matched_pred_indices, matched_gt_indices = batched_linear_sum_assignment(costs)
+
+    """
+    num_batch_dims = cost_matrices.num_batch_dims
+    assert (
+        cost_matrices.dim() == num_batch_dims + 2
+    ), "`cost_matrices` needs to contain one matrix per sample (i.e. 2 non-batch dimensions)"
+
+    batch_shape = cost_matrices.batch_shape
+    device = cost_matrices.device
+    cost_matrices = cost_matrices.flatten_batch_dims()
+    non_uniform_is_rows = cost_matrices.non_uniform_dim == 1
+
+    sample_sizes = cost_matrices.sample_sizes.to(device="cpu", dtype=torch.int64).contiguous()
+    if other_sample_sizes is None:
+        other_dim_size = cost_matrices.shape[2 if non_uniform_is_rows else 1]
+        other_sample_sizes = torch.full_like(sample_sizes, other_dim_size)
+    else:
+        other_sample_sizes = other_sample_sizes.reshape(-1).to(device="cpu", dtype=torch.int64).contiguous()
+    nums_rows, nums_cols = (
+        (sample_sizes, other_sample_sizes) if non_uniform_is_rows else (other_sample_sizes, sample_sizes)
+    )
+
+    cost = cost_matrices.tensor.detach().to(device="cpu")
+    if cost.dtype not in (torch.float32, torch.float64):
+        cost = cost.to(dtype=torch.float32)
+    cost = cost.contiguous()
+
+    row_indices, col_indices, nums_matches = batched_indexing_access_cpu.batched_linear_sum_assignment(
+        cost, nums_rows, nums_cols, maximize
+    )
+
+    row_indices = RaggedBatch(row_indices.to(device=device), sample_sizes=nums_matches.to(device=device))
+    col_indices = row_indices.create_with_sample_sizes_like_self(col_indices, device=device)
+    if num_batch_dims != 1:
+        row_indices = row_indices.reshape_batch_dims(batch_shape)
+        col_indices = col_indices.reshape_batch_dims(batch_shape)
+    return row_indices, col_indices
@@ -0,0 +1,198 @@
+# Copyright (c) 2025, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+from typing import Optional, Tuple, Union
+
+import torch
+
+from .data_format import RaggedBatch
+import accvlab.batching_helpers.batched_indexing_access_cpu as batched_indexing_access_cpu
+
+# Must match `NmsMethod` in `cpp_impl/batched_nms_cpu_impl.cpp`
+_NMS_METHODS = {"hard": 0, "linear": 1, "gaussian": 2}
+
+
+def _batched_ragged_nms(
+    boxes: RaggedBatch,
+    scores: Union[RaggedBatch, torch.Tensor],
+    labels: Optional[Union[RaggedBatch, torch.Tensor]],
+    method: str,
+    iou_threshold: float,
+    sigma: float,
+    score_threshold: float,
+    max_num_kept: Optional[int],
+) -> Tuple[RaggedBatch, RaggedBatch]:
+    num_batch_dims = boxes.num_batch_dims
+    assert (
+        boxes.dim() == num_batch_dims + 2 and boxes.shape[-1] == 4
+    ), "`boxes` needs to have the shape (*batch_shape, max_num_boxes, 4)"
+    assert (
+        boxes.non_uniform_dim == num_batch_dims
+    ), "The non-uniform dimension of `boxes` needs to be the box dimension"
+
+    batch_shape = boxes.batch_shape
+    device = boxes.device
+    flat_boxes = boxes.flatten_batch_dims()
+
+    def to_flat_cpu_tensor(data, name):
+        if isinstance(data, RaggedBatch):
+            data = data.tensor
+        assert (
+            data.shape == boxes.shape[:-1]
+        ), f"`{name}` needs to have the shape (*batch_shape, max_num_boxes) matching `boxes`"
+        return data.detach().reshape(flat_boxes.shape[:-1]).to(device="cpu")
+
+    boxes_data = flat_boxes.tensor.detach().to(device="cpu")
+    if not boxes_data.is_floating_point():
+        boxes_data = boxes_data.to(dtype=torch.float32)
+    boxes_data = boxes_data.contiguous()
+    scores_data = to_flat_cpu_tensor(scores, "scores").to(dtype=boxes_data.dtype).contiguous()
+    if labels is not None:
+        labels = to_flat_cpu_tensor(labels, "labels").to(dtype=torch.int64).contiguous()
+    nums_boxes = flat_boxes.sample_sizes.to(device="cpu", dtype=torch.int64).contiguous()
+
+    kept_indices, kept_scores, nums_kept = batched_indexing_access_cpu.batched_ragged_nms(
+        boxes_data,
+        scores_data,
+        labels,
+        nums_boxes,
+        _NMS_METHODS[method],
+        iou_threshold,
+        sigma,
+        score_threshold,
+        -1 if max_num_kept is None else max_num_kept,
+    )
+
+    max_num_out = int(nums_kept.max()) if nums_kept.numel() > 0 else 0
+    kept_indices = kept_indices[:, :max_num_out].to(device=device)
+    kept_scores = kept_scores[:, :max_num_out].to(device=device)
+
+    kept_indices = RaggedBatch(kept_indices, sample_sizes=nums_kept.to(device=device))
+    kept_scores = kept_indices.create_with_sample_sizes_like_self(kept_scores)
+    if num_batch_dims != 1:
+        kept_indices = kept_indices.reshape_batch_dims(batch_shape)
+        kept_scores = kept_scores.reshape_batch_dims(batch_shape)
+    return kept_indices, kept_scores
+
+
+def batched_nms(
+    boxes: RaggedBatch,
+    scores: Union[RaggedBatch, torch.Tensor],
+    iou_threshold: float,
+    labels: Optional[Union[RaggedBatch, torch.Tensor]] = None,
+    score_threshold: Optional[float] = None,
+    max_num_kept: Optional[int] = None,
+) -> RaggedBatch:
+    """Non-maximum suppression (NMS), applied to each sample individually.
+
+    Only the valid boxes of each sample are considered, i.e. there is no need to filter filler boxes or to
+    offset the boxes of different samples (as would be needed when using :func:`torchvision.ops.batched_nms`
+    on the flattened padded predictions). If ``labels`` is given, the suppression is class-aware, i.e. boxes
+    only suppress other boxes with the same label.
+
+    The suppression is performed on the CPU, with the samples processed in parallel. For each sample, the
+    boxes are sorted by score and swept in this order, tracking the suppressed boxes in a bitmask. Each kept
+    box is only compared to the remaining candidates, which is a vectorized loop over contiguous memory.
+    Inputs may reside on the GPU; the results are returned on the device of the input.
+
+    The result is the same as for :func:`torchvision.ops.nms` (or :func:`torchvision.ops.batched_nms` if
+    ``labels`` is given) applied to each sample individually, with ties in the scores resolved in favor of
+    the box with the lower index. A box is suppressed if its IoU with a kept box is larger than
+    ``iou_threshold``.
+
+    Args:
+        boxes: Boxes as ``(x1, y1, x2, y2)``. Shape: (\\*batch_shape, max_num_boxes, 4). The non-uniform
+            dimension needs to be the box dimension.
+        scores: Scores of the boxes. Shape: (\\*batch_shape, max_num_boxes). The sample sizes of ``boxes``
+            are used, also if ``scores`` is a :class:`RaggedBatch`.
+        iou_threshold: IoU above which boxes are suppressed
+        labels: Class labels of the boxes for class-aware NMS. Shape: (\\*batch_shape, max_num_boxes).
+            If not set, all boxes are treated as belonging to the same class.
+        score_threshold: If set, boxes with a score below this value are discarded before the suppression
+        max_num_kept: If set, at most this many (highest scoring) boxes are kept per sample
+
+    Returns:
+        Indices of the kept boxes, sorted by decreasing score. Shape: (\\*batch_shape, max_num_kept_boxes),
+        where ``max_num_kept_boxes`` is the maximum number of kept boxes over all samples. Can be used
+        directly with :func:`batched_indexing_access` to obtain the kept boxes, scores, etc.
+
+    Example:
+
+        >>> # boxes: RaggedBatch (batch_size, max_num_preds, 4); scores & labels: (batch_size, max_num_preds)
+        >>> kept = batched_nms(boxes, scores, iou_threshold=0.5, labels=labels, max_num_kept=100)
+        >>> kept_boxes = batched_indexing_access(boxes, kept)
+        >>> kept_labels = batched_indexing_access(labels, kept)
+
+    """
+    if score_threshold is None:
+        score_threshold = -float("inf")
+    kept_indices, _ = _batched_ragged_nms(
+        boxes, scores, labels, "hard", iou_threshold, 0.0, score_threshold, max_num_kept
+    )
+    return kept_indices
+
+
+def batched_soft_nms(
+    boxes: RaggedBatch,
+    scores: Union[RaggedBatch, torch.Tensor],
+    method: str = "gaussian",
+    sigma: float = 0.5,
+    iou_threshold: float = 0.3,
+    score_threshold: float = 1e-3,
+    labels: Optional[Union[RaggedBatch, torch.Tensor]] = None,
+    max_num_kept: Optional[int] = None,
+) -> Tuple[RaggedBatch, RaggedBatch]:
+    """Soft-NMS, applied to each sample individually.
+
+    Instead of removing boxes which overlap with a kept box, their scores are decayed depending on the
+    overlap (see `Bodla et al., "Soft-NMS -- Improving Object Detection With One Line of Code"
+    <https://arxiv.org/abs/1704.04503>`_). Boxes are kept in order of their (decayed) score, with ties
+    resolved in favor of the box with the lower index, and boxes with a decayed score below
+    ``score_threshold`` are discarded. If ``labels`` is given, only boxes with the same label affect each
+    other.
+
+    The decay applied to the score of a box with IoU ``iou`` to the kept box is:
+
+        - ``"linear"``: ``1 - iou`` if ``iou > iou_threshold``, no decay otherwise
+        - ``"gaussian"``: ``exp(-iou^2 / sigma)``
+
+    The computation is performed on the CPU, with the samples processed in parallel. Inputs may reside on
+    the GPU; the results are returned on the device of the input.
+
+    Args:
+        boxes: Boxes as ``(x1, y1, x2, y2)``. Shape: (\\*batch_shape, max_num_boxes, 4). The non-uniform
+            dimension needs to be the box dimension.
+        scores: Scores of the boxes. Shape: (\\*batch_shape, max_num_boxes). The sample sizes of ``boxes``
+            are used, also if ``scores`` is a :class:`RaggedBatch`.
+        method: One of ``"linear"`` or ``"gaussian"``
+        sigma: Parameter of the Gaussian decay (only used for ``method="gaussian"``)
+        iou_threshold: IoU above which scores are decayed (only used for ``method="linear"``)
+        score_threshold: Boxes with a (decayed) score below this value are discarded
+        labels: Class labels of the boxes for class-aware Soft-NMS. Shape: (\\*batch_shape, max_num_boxes).
+            If not set, all boxes are treated as belonging to the same class.
+        max_num_kept: If set, at most this many boxes are kept per sample
+
+    Returns:
+        Tuple of
+
+        - Indices of the kept boxes, in the order in which they were selected (i.e. by decreasing decayed
+          score). Shape: (\\*batch_shape, max_num_kept_boxes). Can be used directly with
+          :func:`batched_indexing_access`.
+        - Decayed scores of the kept boxes, with the same shape & sample sizes as the indices
+
+    """
+    assert method in ("linear", "gaussian"), f"Unknown Soft-NMS method '{method}'"
+    return _batched_ragged_nms(
+        boxes, scores, labels, method, iou_threshold, sigma, score_threshold, max_num_kept
+    )
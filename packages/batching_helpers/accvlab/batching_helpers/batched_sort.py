@@ -0,0 +1,141 @@
+# Copyright (c) 2025, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+from typing import Tuple
+
+from .data_format import RaggedBatch
+import accvlab.batching_helpers.batched_indexing_access_cuda as batched_indexing_access_cuda
+import accvlab.batching_helpers.batched_indexing_access_cpu as batched_indexing_access_cpu
+
+
+def _batched_ragged_sort(data: RaggedBatch, descending: bool, k: int) -> Tuple[RaggedBatch, RaggedBatch]:
+    num_batch_dims = data.num_batch_dims
+    assert (
+        data.dim() == num_batch_dims + 1
+    ), "`data` needs to contain one 1D sequence per sample (i.e. shape (*batch_shape, max_sample_size))"
+
+    batch_shape = data.batch_shape
+    flat_data = data.flatten_batch_dims()
+    values_data = flat_data.tensor.detach().contiguous()
+    nums_entries = flat_data.sample_sizes.contiguous()
+
+    ext = batched_indexing_access_cuda if values_data.is_cuda else batched_indexing_access_cpu
+    values, indices, nums_out = ext.batched_ragged_sort(values_data, nums_entries, descending, k)
+
+    values = RaggedBatch(values, sample_sizes=nums_out)
+    indices = values.create_with_sample_sizes_like_self(indices)
+    if num_batch_dims != 1:
+        values = values.reshape_batch_dims(batch_shape)
+        indices = indices.reshape_batch_dims(batch_shape)
+    return values, indices
+
+
+def batched_sort(data: RaggedBatch, descending: bool = False) -> Tuple[RaggedBatch, RaggedBatch]:
+    """Sort the valid entries of each sample.
+
+    :gpu:
+
+    Only the valid entries of each sample are considered, i.e. no filling of the padded entries with
+    ``+/-inf`` is needed (as would be the case when using :func:`torch.sort` on the padded tensor).
+    The sort is stable and ``NaN`` is treated as the largest value, i.e. the result is the same as when
+    applying ``torch.sort(..., stable=True)`` to each sample individually.
+
+    On the CPU, the samples are processed in parallel. On the GPU, each sample is sorted by a single block
+    in shared memory (bitonic sort) if ``max_sample_size <= 2048``; larger samples fall back to a sort of
+    the padded tensor.
+
+    Note:
+        The operation is not differentiable. If gradients are needed for the sorted values, use the
+        returned indices with :func:`batched_indexing_access` instead of the returned values.
+
+    Args:
+        data: Data to sort. Shape: (\\*batch_shape, max_sample_size)
+        descending: Whether to sort in descending order
+
+    Returns:
+        Tuple of
+
+        - Sorted values. Same shape & sample sizes as ``data``.
+        - Indices of the sorted values in ``data``, with the same shape & sample sizes as the values.
+          Can be used directly with :func:`batched_indexing_access`.
+
+        Filler entries of both are set to ``0``.
+
+    Example:
+
+        >>> scores: RaggedBatch  # shape (batch_size, max_num_objects)
+        >>> _, order = batched_sort(scores, descending=True)
+        >>> boxes_sorted = batched_indexing_access(boxes, order)
+
+    """
+    return _batched_ragged_sort(data, descending, -1)
+
+
+def batched_argsort(data: RaggedBatch, descending: bool = False) -> RaggedBatch:
+    """Get the indices which sort the valid entries of each sample.
+
+    :gpu:
+
+    Equivalent to the indices returned by :func:`batched_sort` (see there for details).
+
+    Args:
+        data: Data to sort. Shape: (\\*batch_shape, max_sample_size)
+        descending: Whether to sort in descending order
+
+    Returns:
+        Indices of the sorted entries. Same shape & sample sizes as ``data``. Filler entries are set to ``0``.
+    """
+    return _batched_ragged_sort(data, descending, -1)[1]
+
+
+def batched_topk(data: RaggedBatch, k: int, largest: bool = True) -> Tuple[RaggedBatch, RaggedBatch]:
+    """Get the ``k`` largest (or smallest) valid entries of each sample.
+
+    :gpu:
+
+    Samples with less than ``k`` valid entries return all their entries (in sorted order), i.e. the
+    sample sizes of the result are ``min(sample_sizes, k)``. The entries are sorted in the same way as
+    for :func:`batched_sort` (stable, ``NaN`` treated as the largest value), i.e. for samples with at least
+    ``k`` valid entries, the result corresponds to the first ``k`` entries of the sorted sample.
+
+    On the CPU, only the first ``k`` entries of each sample are fully sorted (partial sort).
+
+    Note:
+        The operation is not differentiable. If gradients are needed for the selected values, use the
+        returned indices with :func:`batched_indexing_access` instead of the returned values.
+
+    Args:
+        data: Data to select from. Shape: (\\*batch_shape, max_sample_size)
+        k: Maximum number of entries to select per sample
+        largest: Whether to select the largest (``True``) or smallest (``False``) entries
+
+    Returns:
+        Tuple of
+
+        - Selected values. Shape: (\\*batch_shape, min(k, max_sample_size))
+        - Indices of the selected values in ``data``, with the same shape & sample sizes as the values.
+          Can be used directly with :func:`batched_indexing_access`.
+
+        Filler entries of both are set to ``0``.
+
+    Example:
+
+        Keeping the (up to) 100 highest scoring predictions of each sample:
+
+        >>> top_scores, top_indices = batched_topk(scores, 100)
+        >>> top_boxes = batched_indexing_access(boxes, top_indices)
+
+    """
+    assert k >= 0, "`k` needs to be non-negative"
+    return _batched_ragged_sort(data, largest, k)
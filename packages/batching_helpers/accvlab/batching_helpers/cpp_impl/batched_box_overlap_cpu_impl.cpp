@@ -0,0 +1,112 @@
+/*
+ * Copyright (c) 2025, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <algorithm>
+#include <vector>
+
+#include <torch/torch.h>
+
+#include <ATen/ATen.h>
+#include <ATen/OpMathType.h>
+#include <ATen/Parallel.h>
+#include <torch/extension.h>
+
+#include "batched_indexing_access_helpers.h"
+#include "box_overlap_helpers.h"
+
+// Minimum number of box pairs per task when parallelizing over the rows of the output
+constexpr int64_t kMinPairsPerTask = 16384;
+
+template <BoxOverlapMode mode, typename scalar_t, typename index_t>
+void batched_pairwise_box_overlap_cpu_impl(const scalar_t* boxes_a, const index_t* nums_a,
+                                           const at::opmath_type<scalar_t>* boxes_b_planar,
+                                           const index_t* nums_b, int64_t batch_size, int64_t max_num_a,
+                                           int64_t max_num_b, bool as_cost, double fill_value, double eps,
+                                           scalar_t* result) {
+    using opmath_t = at::opmath_type<scalar_t>;
+
+    // `result = offset + sign * overlap`, so that the cost variant does not need a separate inner loop
+    const opmath_t offset = as_cost ? opmath_t(1) : opmath_t(0);
+    const opmath_t sign = as_cost ? opmath_t(-1) : opmath_t(1);
+    const opmath_t eps_t = static_cast<opmath_t>(eps);
+    const scalar_t fill = static_cast<scalar_t>(fill_value);
+
+    const int64_t grain_size = std::max<int64_t>(1, kMinPairsPerTask / std::max<int64_t>(max_num_b, 1));
+    at::parallel_for(0, batch_size * max_num_a, grain_size, [&](int64_t start, int64_t end) {
+        for (int64_t row = start; row < end; ++row) {
+            const int64_t sample = row / max_num_a;
+            const int64_t i = row % max_num_a;
+            scalar_t* result_row = result + row * max_num_b;
+
+            // Clamp the sample size to `[0, max_num_b]`, so that out-of-range sizes cannot lead to
+            // out-of-bounds accesses
+            const int64_t num_b =
+                i < static_cast<int64_t>(nums_a[sample])
+                    ? std::min<int64_t>(std::max<int64_t>(nums_b[sample], 0), max_num_b)
+                    : 0;
+
+            if (num_b > 0) {
+                const scalar_t* box_a = boxes_a + row * 4;
+                const opmath_t a_x1 = static_cast<opmath_t>(box_a[0]);
+                const opmath_t a_y1 = static_cast<opmath_t>(box_a[1]);
+                const opmath_t a_x2 = static_cast<opmath_t>(box_a[2]);
+                const opmath_t a_y2 = static_cast<opmath_t>(box_a[3]);
+
+                // The boxes of the second set are stored as separate coordinate planes (x1, y1, x2, y2) per
+                // sample, so that this loop is a plain element-wise operation which the compiler vectorizes.
+                const opmath_t* b_x1 = boxes_b_planar + sample * 4 * max_num_b;
+                const opmath_t* b_y1 = b_x1 + max_num_b;
+                const opmath_t* b_x2 = b_y1 + max_num_b;
+                const opmath_t* b_y2 = b_x2 + max_num_b;
+                for (int64_t j = 0; j < num_b; ++j) {
+                    const opmath_t overlap = box_overlap<mode, opmath_t>(a_x1, a_y1, a_x2, a_y2, b_x1[j],
+                                                                         b_y1[j], b_x2[j], b_y2[j], eps_t);
+                    result_row[j] = static_cast<scalar_t>(offset + sign * overlap);
+                }
+            }
+            std::fill(result_row + num_b, result_row + max_num_b, fill);
+        }
+    });
+}
+
+void batched_pairwise_box_overlap_cpu(const torch::Tensor& boxes_a, const torch::Tensor& nums_a,
+                                      const torch::Tensor& boxes_b, const torch::Tensor& nums_b, int64_t mode,
+                                      bool as_cost, double fill_value, double eps, torch::Tensor& result) {
+    if (result.numel() == 0) {
+        return;
+    }
+
+    const int64_t batch_size = result.size(0);
+    const int64_t max_num_a = result.size(1);
+    const int64_t max_num_b = result.size(2);
+
+    DISPATCH_INDEX_TYPES(nums_a.scalar_type(), "batched_pairwise_box_overlap_cpu [for: nums]", [&] {
+        using index_scalar_t = scalar_t;
+        AT_DISPATCH_FLOATING_TYPES_AND2(
+            at::ScalarType::Half, at::ScalarType::BFloat16, boxes_a.scalar_type(),
+            "batched_pairwise_box_overlap_cpu [for: boxes]", [&] {
+                using opmath_t = at::opmath_type<scalar_t>;
+                const torch::Tensor boxes_b_planar =
+                    boxes_b.to(c10::CppTypeToScalarType<opmath_t>::value).transpose(1, 2).contiguous();
+                DISPATCH_BOX_OVERLAP_MODE(mode, [&] {
+                    batched_pairwise_box_overlap_cpu_impl<overlap_mode, scalar_t, index_scalar_t>(
+                        boxes_a.data_ptr<scalar_t>(), nums_a.data_ptr<index_scalar_t>(),
+                        boxes_b_planar.data_ptr<opmath_t>(), nums_b.data_ptr<index_scalar_t>(), batch_size,
+                        max_num_a, max_num_b, as_cost, fill_value, eps, result.data_ptr<scalar_t>());
+                });
+            });
+    });
+}
@@ -0,0 +1,109 @@
+/*
+ * Copyright (c) 2025, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <vector>
+
+#include <torch/torch.h>
+
+#include <cuda.h>
+
+#include <ATen/ATen.h>
+#include <ATen/OpMathType.h>
+#include <ATen/cuda/CUDAContext.h>
+#include <torch/extension.h>
+
+#include "batched_indexing_access_helpers.h"
+#include "box_overlap_helpers.h"
+
+// Threads of a block along the second box set (x; coalesced output writes) and the first box set (y)
+constexpr unsigned int kBlockSizeB = 32;
+constexpr unsigned int kBlockSizeA = 8;
+
+template <BoxOverlapMode mode, typename scalar_t, typename index_t>
+__global__ static void batched_pairwise_box_overlap_kernel(const scalar_t* boxes_a, const index_t* nums_a,
+                                                           const scalar_t* boxes_b, const index_t* nums_b,
+                                                           int64_t max_num_a, int64_t max_num_b, bool as_cost,
+                                                           scalar_t fill_value, at::opmath_type<scalar_t> eps,
+                                                           scalar_t* result) {
+    using opmath_t = at::opmath_type<scalar_t>;
+
+    const int64_t j = static_cast<int64_t>(blockDim.x) * blockIdx.x + threadIdx.x;
+    const int64_t i = static_cast<int64_t>(blockDim.y) * blockIdx.y + threadIdx.y;
+    const int64_t sample = blockIdx.z;
+
+    if (i >= max_num_a || j >= max_num_b) {
+        return;
+    }
+
+    const int64_t idx_a = sample * max_num_a + i;
+    const int64_t idx_b = sample * max_num_b + j;
+    scalar_t& res = result[idx_a * max_num_b + j];
+
+    // Clamp the sample sizes to `[0, padded size]` (as in the CPU implementation), so that out-of-range
+    // sizes cannot lead to out-of-bounds accesses
+    const int64_t num_a = min(max(static_cast<int64_t>(nums_a[sample]), int64_t(0)), max_num_a);
+    const int64_t num_b = min(max(static_cast<int64_t>(nums_b[sample]), int64_t(0)), max_num_b);
+    if (i >= num_a || j >= num_b) {
+        res = fill_value;
+        return;
+    }
+
+    const scalar_t* box_a = boxes_a + idx_a * 4;
+    const scalar_t* box_b = boxes_b + idx_b * 4;
+    const opmath_t overlap = box_overlap<mode, opmath_t>(
+        static_cast<opmath_t>(box_a[0]), static_cast<opmath_t>(box_a[1]), static_cast<opmath_t>(box_a[2]),
+        static_cast<opmath_t>(box_a[3]), static_cast<opmath_t>(box_b[0]), static_cast<opmath_t>(box_b[1]),
+        static_cast<opmath_t>(box_b[2]), static_cast<opmath_t>(box_b[3]), eps);
+    res = static_cast<scalar_t>(as_cost ? opmath_t(1) - overlap : overlap);
+}
+
+void batched_pairwise_box_overlap_cuda(const torch::Tensor& boxes_a, const torch::Tensor& nums_a,
+                                       const torch::Tensor& boxes_b, const torch::Tensor& nums_b,
+                                       int64_t mode, bool as_cost, double fill_value, double eps,
+                                       torch::Tensor& result) {
+    if (result.numel() == 0) {
+        return;
+    }
+
+    const int64_t batch_size = result.size(0);
+    const int64_t max_num_a = result.size(1);
+    const int64_t max_num_b = result.size(2);
+    TORCH_CHECK(batch_size <= 65535, "Batch size (", batch_size, ") exceeds the supported maximum of 65535");
+
+    const dim3 block_size(kBlockSizeB, kBlockSizeA, 1);
+    const dim3 grid_size((max_num_b + kBlockSizeB - 1) / kBlockSizeB,
+                         (max_num_a + kBlockSizeA - 1) / kBlockSizeA, batch_size);
+
+    cudaStream_t stream = at::cuda::getCurrentCUDAStream();
+
+    DISPATCH_INDEX_TYPES(nums_a.scalar_type(), "batched_pairwise_box_overlap_cuda [for: nums]", [&] {
+        using index_scalar_t = scalar_t;
+        AT_DISPATCH_FLOATING_TYPES_AND2(
+            at::ScalarType::Half, at::ScalarType::BFloat16, boxes_a.scalar_type(),
+            "batched_pairwise_box_overlap_cuda [for: boxes]", [&] {
+                using opmath_t = at::opmath_type<scalar_t>;
+                DISPATCH_BOX_OVERLAP_MODE(mode, [&] {
+                    batched_pairwise_box_overlap_kernel<overlap_mode, scalar_t, index_scalar_t>
+                        <<<grid_size, block_size, 0, stream>>>(
+                            boxes_a.data_ptr<scalar_t>(), nums_a.data_ptr<index_scalar_t>(),
+                            boxes_b.data_ptr<scalar_t>(), nums_b.data_ptr<index_scalar_t>(), max_num_a,
+                            max_num_b, as_cost, static_cast<scalar_t>(fill_value), static_cast<opmath_t>(eps),
+                            result.data_ptr<scalar_t>());
+                    C10_CUDA_CHECK(cudaGetLastError());
+                });
+            });
+    });
+}
@@ -14,6 +14,7 @@
  * limitations under the License.
  */
 
+#include <algorithm>
 #include <vector>
 
 #include <torch/torch.h>
@@ -23,6 +24,23 @@
 void set_ragged_batch_padded_to_filler_value_cpu(torch::Tensor& data, const torch::Tensor& nums_valid_entries,
                                                  double filler_value);
 
+void batched_pairwise_box_overlap_cpu(const torch::Tensor& boxes_a, const torch::Tensor& nums_a,
+                                      const torch::Tensor& boxes_b, const torch::Tensor& nums_b, int64_t mode,
+                                      bool as_cost, double fill_value, double eps, torch::Tensor& result);
+
+void batched_ragged_sort_cpu(const torch::Tensor& data, const torch::Tensor& nums_entries, bool descending,
+                             torch::Tensor& values, torch::Tensor& indices);
+
+std::vector<torch::Tensor> batched_linear_sum_assignment_cpu(const torch::Tensor& cost,
+                                                             const torch::Tensor& nums_rows,
+                                                             const torch::Tensor& nums_cols, bool maximize);
+
+std::vector<torch::Tensor> batched_ragged_nms_cpu(const torch::Tensor& boxes, const torch::Tensor& scores,
+                                                  const c10::optional<torch::Tensor>& labels,
+                                                  const torch::Tensor& nums_boxes, int64_t method,
+                                                  double iou_threshold, double sigma, double score_threshold,
+                                                  int64_t max_num_kept);
+
 void set_ragged_batch_padded_to_filler_value_in_place(torch::Tensor& data,
                                                       const torch::Tensor& nums_valid_entries,
                                                       double filler_value) {
@@ -40,8 +58,126 @@ void set_ragged_batch_padded_to_filler_value_in_place(torch::Tensor& data,
     set_ragged_batch_padded_to_filler_value_cpu(data, nums_valid_entries, filler_value);
 }
 
+std::vector<torch::Tensor> batched_linear_sum_assignment(const torch::Tensor& cost,
+                                                         const torch::Tensor& nums_rows,
+                                                         const torch::Tensor& nums_cols, bool maximize) {
+    CHECK_CONTIGUOUS(cost);
+    CHECK_CONTIGUOUS(nums_rows);
+    CHECK_CONTIGUOUS(nums_cols);
+    CHECK_CPU(cost);
+    CHECK_CPU(nums_rows);
+    CHECK_CPU(nums_cols);
+
+    CHECK_NUM_DIMS(cost, 3);
+    CHECK_NUM_DIMS(nums_rows, 1);
+    CHECK_NUM_DIMS(nums_cols, 1);
+
+    CHECK_SIZE_MATCH_FIRST_DIMS(cost, nums_rows, 1);
+    CHECK_SIZE_MATCH(nums_rows, nums_cols);
+    CHECK_SAME_DTYPE("`nums_rows` and `nums_cols` need to have the same dtype", nums_rows, nums_cols);
+
+    return batched_linear_sum_assignment_cpu(cost, nums_rows, nums_cols, maximize);
+}
+
+torch::Tensor batched_pairwise_box_overlap(const torch::Tensor& boxes_a, const torch::Tensor& nums_a,
+                                           const torch::Tensor& boxes_b, const torch::Tensor& nums_b,
+                                           int64_t mode, bool as_cost, double fill_value, double eps) {
+    CHECK_CONTIGUOUS(boxes_a);
+    CHECK_CONTIGUOUS(nums_a);
+    CHECK_CONTIGUOUS(boxes_b);
+    CHECK_CONTIGUOUS(nums_b);
+    CHECK_CPU(boxes_a);
+    CHECK_CPU(nums_a);
+    CHECK_CPU(boxes_b);
+    CHECK_CPU(nums_b);
+    CHECK_SAME_DTYPE("Same dtype required for `boxes_a` and `boxes_b`", boxes_a, boxes_b);
+    CHECK_SAME_DTYPE("Same dtype required for `nums_a` and `nums_b`", nums_a, nums_b);
+
+    TORCH_CHECK(boxes_a.dim() == 3 && boxes_a.size(2) == 4,
+                "boxes_a must have the shape (batch_size, num_boxes, 4)");
+    TORCH_CHECK(boxes_b.dim() == 3 && boxes_b.size(2) == 4,
+                "boxes_b must have the shape (batch_size, num_boxes, 4)");
+    CHECK_NUM_DIMS(nums_a, 1);
+    CHECK_NUM_DIMS(nums_b, 1);
+    CHECK_SIZE_MATCH_FIRST_DIMS(boxes_a, boxes_b, 1);
+    CHECK_SIZE_MATCH_FIRST_DIMS(boxes_a, nums_a, 1);
+    CHECK_SIZE_MATCH_FIRST_DIMS(boxes_b, nums_b, 1);
+
+    torch::TensorOptions options =
+        torch::TensorOptions().dtype(boxes_a.scalar_type()).device(boxes_a.device());
+    torch::Tensor res = torch::empty({boxes_a.size(0), boxes_a.size(1), boxes_b.size(1)}, options);
+
+    batched_pairwise_box_overlap_cpu(boxes_a, nums_a, boxes_b, nums_b, mode, as_cost, fill_value, eps, res);
+    return res;
+}
+
+std::vector<torch::Tensor> batched_ragged_sort(const torch::Tensor& data, const torch::Tensor& nums_entries,
+                                               bool descending, int64_t k) {
+    CHECK_CONTIGUOUS(data);
+    CHECK_CONTIGUOUS(nums_entries);
+    CHECK_CPU(data);
+    CHECK_CPU(nums_entries);
+
+    CHECK_NUM_DIMS(data, 2);
+    CHECK_NUM_DIMS(nums_entries, 1);
+    CHECK_SIZE_MATCH_FIRST_DIMS(data, nums_entries, 1);
+
+    // `k < 0` means that all entries are sorted
+    const int64_t num_out = k < 0 ? data.size(1) : std::min(k, data.size(1));
+
+    torch::Tensor values = torch::empty({data.size(0), num_out}, data.options());
+    torch::Tensor indices = torch::empty({data.size(0), num_out}, data.options().dtype(torch::kInt64));
+    torch::Tensor nums_out = nums_entries.to(torch::kInt64).clamp(0, num_out);
+
+    batched_ragged_sort_cpu(data, nums_entries, descending, values, indices);
+    return {values, indices, nums_out};
+}
+
+std::vector<torch::Tensor> batched_ragged_nms(const torch::Tensor& boxes, const torch::Tensor& scores,
+                                              const c10::optional<torch::Tensor>& labels,
+                                              const torch::Tensor& nums_boxes, int64_t method,
+                                              double iou_threshold, double sigma, double score_threshold,
+                                              int64_t max_num_kept) {
+    CHECK_CONTIGUOUS(boxes);
+    CHECK_CONTIGUOUS(scores);
+    CHECK_CONTIGUOUS(nums_boxes);
+    CHECK_CPU(boxes);
+    CHECK_CPU(scores);
+    CHECK_CPU(nums_boxes);
+    CHECK_SAME_DTYPE("Same dtype required for `boxes` and `scores`", boxes, scores);
+
+    TORCH_CHECK(boxes.dim() == 3 && boxes.size(2) == 4,
+                "boxes must have the shape (batch_size, num_boxes, 4)");
+    CHECK_NUM_DIMS(scores, 2);
+    CHECK_NUM_DIMS(nums_boxes, 1);
+    CHECK_SIZE_MATCH_FIRST_DIMS(boxes, scores, 2);
+    CHECK_SIZE_MATCH_FIRST_DIMS(boxes, nums_boxes, 1);
+    if (labels.has_value()) {
+        const torch::Tensor& labels_tensor = labels.value();
+        CHECK_CONTIGUOUS(labels_tensor);
+        CHECK_CPU(labels_tensor);
+        TORCH_CHECK(labels_tensor.scalar_type() == torch::kInt64, "labels must be of type int64");
+        CHECK_SIZE_MATCH(labels_tensor, scores);
+    }
+
+    return batched_ragged_nms_cpu(boxes, scores, labels, nums_boxes, method, iou_threshold, sigma,
+                                  score_threshold, max_num_kept);
+}
+
 PYBIND11_MODULE(TORCH_EXTENSION_NAME, m) {
     m.def("set_ragged_batch_padded_to_filler_value_in_place",
           &set_ragged_batch_padded_to_filler_value_in_place, "", py::arg("data"),
           py::arg("nums_valid_entries"), py::arg("filler_value"));
-}
\ No newline at end of file
+    m.def("batched_linear_sum_assignment", &batched_linear_sum_assignment, "", py::arg("cost"),
+          py::arg("nums_rows"), py::arg("nums_cols"), py::arg("maximize"),
+          py::call_guard<py::gil_scoped_release>());
+    m.def("batched_pairwise_box_overlap", &batched_pairwise_box_overlap, "", py::arg("boxes_a"),
+          py::arg("nums_a"), py::arg("boxes_b"), py::arg("nums_b"), py::arg("mode"), py::arg("as_cost"),
+          py::arg("fill_value"), py::arg("eps"), py::call_guard<py::gil_scoped_release>());
+    m.def("batched_ragged_sort", &batched_ragged_sort, "", py::arg("data"), py::arg("nums_entries"),
+          py::arg("descending"), py::arg("k"));
+    m.def("batched_ragged_nms", &batched_ragged_nms, "", py::arg("boxes"), py::arg("scores"),
+          py::arg("labels"), py::arg("nums_boxes"), py::arg("method"), py::arg("iou_threshold"),
+          py::arg("sigma"), py::arg("score_threshold"), py::arg("max_num_kept"),
+          py::call_guard<py::gil_scoped_release>());
+}
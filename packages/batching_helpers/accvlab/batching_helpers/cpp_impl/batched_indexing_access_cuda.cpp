@@ -14,6 +14,7 @@
  * limitations under the License.
  */
 
+#include <algorithm>
 #include <vector>
 
 #include <torch/torch.h>
@@ -45,6 +46,14 @@ void set_ragged_batch_padded_to_filler_value_cuda(torch::Tensor& data,
                                                   const torch::Tensor& nums_valid_entries,
                                                   double filler_value);
 
+void batched_pairwise_box_overlap_cuda(const torch::Tensor& boxes_a, const torch::Tensor& nums_a,
+                                       const torch::Tensor& boxes_b, const torch::Tensor& nums_b,
+                                       int64_t mode, bool as_cost, double fill_value, double eps,
+                                       torch::Tensor& result);
+
+void batched_ragged_sort_cuda(const torch::Tensor& data, const torch::Tensor& nums_entries, bool descending,
+                              torch::Tensor& values, torch::Tensor& indices);
+
 static inline std::vector<int64_t> get_size_as_vec(const torch::Tensor& tensor) {
     const torch::IntArrayRef size = tensor.sizes();
     std::vector<int64_t> size_as_vec(size.begin(), size.end());
@@ -244,6 +253,56 @@ void set_ragged_batch_padded_to_filler_value_in_place(torch::Tensor& data,
     set_ragged_batch_padded_to_filler_value_cuda(data, nums_valid_entries, filler_value);
 }
 
+torch::Tensor batched_pairwise_box_overlap(const torch::Tensor& boxes_a, const torch::Tensor& nums_a,
+                                           const torch::Tensor& boxes_b, const torch::Tensor& nums_b,
+                                           int64_t mode, bool as_cost, double fill_value, double eps) {
+    CHECK_CONTIGUOUS(boxes_a);
+    CHECK_CONTIGUOUS(nums_a);
+    CHECK_CONTIGUOUS(boxes_b);
+    CHECK_CONTIGUOUS(nums_b);
+    CHECK_SAME_CUDA_DEVICE(boxes_a, nums_a, boxes_b, nums_b);
+    CHECK_SAME_DTYPE("Same dtype required for `boxes_a` and `boxes_b`", boxes_a, boxes_b);
+    CHECK_SAME_DTYPE("Same dtype required for `nums_a` and `nums_b`", nums_a, nums_b);
+
+    TORCH_CHECK(boxes_a.dim() == 3 && boxes_a.size(2) == 4,
+                "boxes_a must have the shape (batch_size, num_boxes, 4)");
+    TORCH_CHECK(boxes_b.dim() == 3 && boxes_b.size(2) == 4,
+                "boxes_b must have the shape (batch_size, num_boxes, 4)");
+    CHECK_NUM_DIMS(nums_a, 1);
+    CHECK_NUM_DIMS(nums_b, 1);
+    CHECK_SIZE_MATCH_FIRST_DIMS(boxes_a, boxes_b, 1);
+    CHECK_SIZE_MATCH_FIRST_DIMS(boxes_a, nums_a, 1);
+    CHECK_SIZE_MATCH_FIRST_DIMS(boxes_b, nums_b, 1);
+
+    torch::TensorOptions options =
+        torch::TensorOptions().dtype(boxes_a.scalar_type()).device(boxes_a.device());
+    torch::Tensor res = torch::empty({boxes_a.size(0), boxes_a.size(1), boxes_b.size(1)}, options);
+
+    batched_pairwise_box_overlap_cuda(boxes_a, nums_a, boxes_b, nums_b, mode, as_cost, fill_value, eps, res);
+    return res;
+}
+
+std::vector<torch::Tensor> batched_ragged_sort(const torch::Tensor& data, const torch::Tensor& nums_entries,
+                                               bool descending, int64_t k) {
+    CHECK_CONTIGUOUS(data);
+    CHECK_CONTIGUOUS(nums_entries);
+    CHECK_SAME_CUDA_DEVICE(data, nums_entries);
+
+    CHECK_NUM_DIMS(data, 2);
+    CHECK_NUM_DIMS(nums_entries, 1);
+    CHECK_SIZE_MATCH_FIRST_DIMS(data, nums_entries, 1);
+
+    // `k < 0` means that all entries are sorted
+    const int64_t num_out = k < 0 ? data.size(1) : std::min(k, data.size(1));
+
+    torch::Tensor values = torch::empty({data.size(0), num_out}, data.options());
+    torch::Tensor indices = torch::empty({data.size(0), num_out}, data.options().dtype(torch::kInt64));
+    torch::Tensor nums_out = nums_entries.to(torch::kInt64).clamp(0, num_out);
+
+    batched_ragged_sort_cuda(data, nums_entries, descending, values, indices);
+    return {values, indices, nums_out};
+}
+
 PYBIND11_MODULE(TORCH_EXTENSION_NAME, m) {
     m.def("forward", &indexing_forward, "Batched Indexing (CUDA)", py::arg("input_data"),
           py::arg("input_indices"), py::arg("input_nums_indices"), py::arg("fill_value") = 0.0);
@@ -262,4 +321,9 @@ PYBIND11_MODULE(TORCH_EXTENSION_NAME, m) {
     m.def("set_ragged_batch_padded_to_filler_value_in_place",
           &set_ragged_batch_padded_to_filler_value_in_place, "", py::arg("data"),
           py::arg("nums_valid_entries"), py::arg("filler_value"));
+    m.def("batched_pairwise_box_overlap", &batched_pairwise_box_overlap, "", py::arg("boxes_a"),
+          py::arg("nums_a"), py::arg("boxes_b"), py::arg("nums_b"), py::arg("mode"), py::arg("as_cost"),
+          py::arg("fill_value"), py::arg("eps"));
+    m.def("batched_ragged_sort", &batched_ragged_sort, "", py::arg("data"), py::arg("nums_entries"),
+          py::arg("descending"), py::arg("k"));
 }
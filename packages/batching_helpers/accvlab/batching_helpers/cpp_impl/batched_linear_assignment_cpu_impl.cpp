@@ -0,0 +1,235 @@
+/*
+ * Copyright (c) 2025, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <numeric>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <torch/torch.h>
+
+#include <ATen/ATen.h>
+#include <ATen/Parallel.h>
+#include <torch/extension.h>
+
+#include "batched_indexing_access_helpers.h"
+
+namespace {
+
+// Per-thread working memory, reused across the samples processed by one thread.
+struct LsapWorkspace {
+    std::vector<double> cost;
+    std::vector<double> u;
+    std::vector<double> v;
+    std::vector<double> shortest_path_costs;
+    std::vector<int64_t> path;
+    std::vector<int64_t> col4row;
+    std::vector<int64_t> row4col;
+    std::vector<int64_t> remaining;
+    std::vector<char> sr;
+    std::vector<char> sc;
+};
+
+// Find a shortest augmenting path from free row `i` (Dijkstra on reduced costs). Returns the sink column,
+// or -1 if no finite path exists.
+int64_t find_augmenting_path(LsapWorkspace& ws, int64_t nc, int64_t i, double& min_val) {
+    const double inf = std::numeric_limits<double>::infinity();
+    const double* cost = ws.cost.data();
+    int64_t num_remaining = nc;
+    for (int64_t it = 0; it < nc; ++it) {
+        // Reverse order gives better performance on the frequently occurring square-ish cases.
+        ws.remaining[it] = nc - it - 1;
+    }
+    std::fill(ws.sr.begin(), ws.sr.end(), 0);
+    std::fill(ws.sc.begin(), ws.sc.end(), 0);
+    std::fill(ws.shortest_path_costs.begin(), ws.shortest_path_costs.begin() + nc, inf);
+
+    min_val = 0.0;
+    int64_t sink = -1;
+    while (sink == -1) {
+        int64_t index = -1;
+        double lowest = inf;
+        ws.sr[i] = 1;
+        for (int64_t it = 0; it < num_remaining; ++it) {
+            const int64_t j = ws.remaining[it];
+            const double r = min_val + cost[i * nc + j] - ws.u[i] - ws.v[j];
+            if (r < ws.shortest_path_costs[j]) {
+                ws.path[j] = i;
+                ws.shortest_path_costs[j] = r;
+            }
+            // Prefer unassigned columns on ties; this finishes the search earlier.
+            if (ws.shortest_path_costs[j] < lowest ||
+                (ws.shortest_path_costs[j] == lowest && ws.row4col[j] == -1)) {
+                lowest = ws.shortest_path_costs[j];
+                index = it;
+            }
+        }
+        min_val = lowest;
+        if (min_val == inf) {
+            return -1;
+        }
+        const int64_t j = ws.remaining[index];
+        if (ws.row4col[j] == -1) {
+            sink = j;
+        } else {
+            i = ws.row4col[j];
+        }
+        ws.sc[j] = 1;
+        ws.remaining[index] = ws.remaining[--num_remaining];
+    }
+    return sink;
+}
+
+// Solve the rectangular assignment problem for `ws.cost` (nr x nc, nr <= nc). Fills `ws.col4row`.
+void solve_lsap(LsapWorkspace& ws, int64_t nr, int64_t nc) {
+    ws.u.assign(nr, 0.0);
+    ws.v.assign(nc, 0.0);
+    ws.shortest_path_costs.resize(nc);
+    ws.path.assign(nc, -1);
+    ws.col4row.assign(nr, -1);
+    ws.row4col.assign(nc, -1);
+    ws.remaining.resize(nc);
+    ws.sr.resize(nr);
+    ws.sc.resize(nc);
+
+    for (int64_t cur_row = 0; cur_row < nr; ++cur_row) {
+        double min_val;
+        const int64_t sink = find_augmenting_path(ws, nc, cur_row, min_val);
+        if (sink < 0) {
+            throw std::invalid_argument("Cost matrix is infeasible (no finite-cost complete assignment)");
+        }
+
+        // Update dual variables.
+        ws.u[cur_row] += min_val;
+        for (int64_t i = 0; i < nr; ++i) {
+            if (ws.sr[i] && i != cur_row) {
+                ws.u[i] += min_val - ws.shortest_path_costs[ws.col4row[i]];
+            }
+        }
+        for (int64_t j = 0; j < nc; ++j) {
+            if (ws.sc[j]) {
+                ws.v[j] -= min_val - ws.shortest_path_costs[j];
+            }
+        }
+
+        // Augment the previous solution along the path.
+        int64_t j = sink;
+        while (true) {
+            const int64_t i = ws.path[j];
+            ws.row4col[j] = i;
+            std::swap(ws.col4row[i], j);
+            if (i == cur_row) {
+                break;
+            }
+        }
+    }
+}
+
+template <typename scalar_t, typename index_t>
+void batched_linear_sum_assignment_cpu_impl(const scalar_t* cost, const index_t* nums_rows,
+                                            const index_t* nums_cols, int64_t batch_size, int64_t max_rows,
+                                            int64_t max_cols, bool maximize, int64_t* row_indices,
+                                            int64_t* col_indices, int64_t* nums_matches) {
+    const int64_t max_matches = std::min(max_rows, max_cols);
+    at::parallel_for(0, batch_size, 1, [&](int64_t start, int64_t end) {
+        LsapWorkspace ws;
+        for (int64_t b = start; b < end; ++b) {
+            const int64_t nr = nums_rows[b];
+            const int64_t nc = nums_cols[b];
+            TORCH_CHECK(nr >= 0 && nr <= max_rows && nc >= 0 && nc <= max_cols,
+                        "Sample sizes of sample " + std::to_string(b) + " exceed the cost matrix size");
+            int64_t* rows_out = row_indices + b * max_matches;
+            int64_t* cols_out = col_indices + b * max_matches;
+            std::fill(rows_out, rows_out + max_matches, 0);
+            std::fill(cols_out, cols_out + max_matches, 0);
+            const int64_t num_matches = std::min(nr, nc);
+            nums_matches[b] = num_matches;
+            if (num_matches == 0) {
+                continue;
+            }
+
+            // Copy the valid block, transposed if needed so that the solver always sees nr <= nc.
+            const bool transpose = nc < nr;
+            const int64_t solver_nr = transpose ? nc : nr;
+            const int64_t solver_nc = transpose ? nr : nc;
+            const scalar_t* sample_cost = cost + b * max_rows * max_cols;
+            ws.cost.resize(solver_nr * solver_nc);
+            for (int64_t r = 0; r < nr; ++r) {
+                for (int64_t c = 0; c < nc; ++c) {
+                    double value = static_cast<double>(sample_cost[r * max_cols + c]);
+                    TORCH_CHECK(!std::isnan(value), "Cost matrix contains NaN values");
+                    // Checked after the negation: +inf entries are unbounded gains when maximizing.
+                    value = maximize ? -value : value;
+                    TORCH_CHECK(value != -std::numeric_limits<double>::infinity(),
+                                maximize ? "Cost matrix contains +inf values (not allowed with maximize=True)"
+                                         : "Cost matrix contains -inf values");
+                    ws.cost[transpose ? c * solver_nc + r : r * solver_nc + c] = value;
+                }
+            }
+
+            solve_lsap(ws, solver_nr, solver_nc);
+
+            if (!transpose) {
+                for (int64_t r = 0; r < nr; ++r) {
+                    rows_out[r] = r;
+                    cols_out[r] = ws.col4row[r];
+                }
+            } else {
+                // Order the matches by (original) row index, as for the non-transposed case.
+                std::vector<int64_t> order(solver_nr);
+                std::iota(order.begin(), order.end(), 0);
+                std::sort(order.begin(), order.end(),
+                          [&](int64_t a, int64_t b) { return ws.col4row[a] < ws.col4row[b]; });
+                for (int64_t k = 0; k < solver_nr; ++k) {
+                    rows_out[k] = ws.col4row[order[k]];
+                    cols_out[k] = order[k];
+                }
+            }
+        }
+    });
+}
+
+}  // namespace
+
+std::vector<torch::Tensor> batched_linear_sum_assignment_cpu(const torch::Tensor& cost,
+                                                             const torch::Tensor& nums_rows,
+                                                             const torch::Tensor& nums_cols, bool maximize) {
+    const int64_t batch_size = cost.size(0);
+    const int64_t max_rows = cost.size(1);
+    const int64_t max_cols = cost.size(2);
+    const int64_t max_matches = std::min(max_rows, max_cols);
+
+    const auto index_options = torch::TensorOptions().dtype(torch::kInt64).device(cost.device());
+    torch::Tensor row_indices = torch::empty({batch_size, max_matches}, index_options);
+    torch::Tensor col_indices = torch::empty({batch_size, max_matches}, index_options);
+    torch::Tensor nums_matches = torch::empty({batch_size}, index_options);
+
+    DISPATCH_INDEX_TYPES(nums_rows.scalar_type(), "batched_linear_sum_assignment_cpu [for: nums_rows]", [&] {
+        using index_scalar_t = scalar_t;
+        AT_DISPATCH_FLOATING_TYPES(cost.scalar_type(), "batched_linear_sum_assignment_cpu [for: cost]", [&] {
+            batched_linear_sum_assignment_cpu_impl<scalar_t, index_scalar_t>(
+                cost.data_ptr<scalar_t>(), nums_rows.data_ptr<index_scalar_t>(),
+                nums_cols.data_ptr<index_scalar_t>(), batch_size, max_rows, max_cols, maximize,
+                row_indices.data_ptr<int64_t>(), col_indices.data_ptr<int64_t>(),
+                nums_matches.data_ptr<int64_t>());
+        });
+    });
+
+    return {row_indices, col_indices, nums_matches};
+}
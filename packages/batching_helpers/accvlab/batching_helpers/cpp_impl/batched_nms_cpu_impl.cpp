@@ -0,0 +1,294 @@
+/*
+ * Copyright (c) 2025, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <numeric>
+#include <vector>
+
+#include <torch/torch.h>
+
+#include <ATen/ATen.h>
+#include <ATen/OpMathType.h>
+#include <ATen/Parallel.h>
+#include <torch/extension.h>
+
+#include "batched_indexing_access_helpers.h"
+#include "ragged_sort_helpers.h"
+
+namespace {
+
+// Must match `_NMS_METHODS` in `batched_nms.py`
+enum class NmsMethod : int64_t { Hard = 0, SoftLinear = 1, SoftGaussian = 2 };
+
+// Minimum number of boxes per task when parallelizing over the samples
+constexpr int64_t kMinBoxesPerTask = 1024;
+constexpr int64_t kBitsPerWord = 64;
+
+// Per-thread working memory, reused across the samples processed by one thread. The boxes of a sample are
+// stored as separate coordinate planes in descending score order, so that the overlap computation of one
+// box against a block of following boxes is a plain element-wise loop which the compiler vectorizes.
+template <typename opmath_t>
+struct NmsWorkspace {
+    std::vector<int64_t> order;
+    std::vector<opmath_t> x1;
+    std::vector<opmath_t> y1;
+    std::vector<opmath_t> x2;
+    std::vector<opmath_t> y2;
+    std::vector<opmath_t> area;
+    std::vector<opmath_t> score;
+    std::vector<int64_t> label;
+    std::vector<int64_t> remaining;
+    std::vector<uint64_t> suppressed;
+    std::vector<uint8_t> block_flags;
+};
+
+template <typename opmath_t>
+inline opmath_t iou_sorted(const NmsWorkspace<opmath_t>& ws, int64_t i, int64_t j) {
+    const opmath_t w = std::max(std::min(ws.x2[i], ws.x2[j]) - std::max(ws.x1[i], ws.x1[j]), opmath_t(0));
+    const opmath_t h = std::max(std::min(ws.y2[i], ws.y2[j]) - std::max(ws.y1[i], ws.y1[j]), opmath_t(0));
+    const opmath_t inter = w * h;
+    return inter / (ws.area[i] + ws.area[j] - inter);
+}
+
+// Sort the valid boxes of a sample with a score of at least `score_threshold` by descending score and
+// store them in the workspace. Returns the number of stored boxes.
+template <typename scalar_t, typename opmath_t>
+int64_t gather_sorted_boxes(NmsWorkspace<opmath_t>& ws, const scalar_t* boxes, const scalar_t* scores,
+                            const int64_t* labels, int64_t num_boxes, opmath_t score_threshold) {
+    ws.order.clear();
+    for (int64_t i = 0; i < num_boxes; ++i) {
+        if (static_cast<opmath_t>(scores[i]) >= score_threshold) {
+            ws.order.push_back(i);
+        }
+    }
+    std::sort(ws.order.begin(), ws.order.end(), [&](int64_t a, int64_t b) {
+        return ragged_sort_before(scores[a], a, scores[b], b, /*descending=*/true);
+    });
+
+    const int64_t n = static_cast<int64_t>(ws.order.size());
+    ws.x1.resize(n);
+    ws.y1.resize(n);
+    ws.x2.resize(n);
+    ws.y2.resize(n);
+    ws.area.resize(n);
+    ws.score.resize(n);
+    ws.label.resize(n);
+    for (int64_t k = 0; k < n; ++k) {
+        const int64_t i = ws.order[k];
+        const scalar_t* box = boxes + i * 4;
+        ws.x1[k] = static_cast<opmath_t>(box[0]);
+        ws.y1[k] = static_cast<opmath_t>(box[1]);
+        ws.x2[k] = static_cast<opmath_t>(box[2]);
+        ws.y2[k] = static_cast<opmath_t>(box[3]);
+        ws.area[k] = (ws.x2[k] - ws.x1[k]) * (ws.y2[k] - ws.y1[k]);
+        ws.score[k] = static_cast<opmath_t>(scores[i]);
+        ws.label[k] = labels != nullptr ? labels[i] : 0;
+    }
+    return n;
+}
+
+// Hard NMS as a sweep over the boxes in descending score order. The suppressed boxes are tracked in a
+// bitmask. Each kept box is only compared against the following, not yet suppressed boxes, and fully
+// suppressed 64-box blocks are skipped. Writes the kept positions (in the sorted order) to `kept` and
+// returns their number.
+template <typename opmath_t>
+int64_t hard_nms_sweep(NmsWorkspace<opmath_t>& ws, int64_t n, opmath_t iou_threshold, bool class_aware,
+                       int64_t max_num_kept, std::vector<int64_t>& kept) {
+    const int64_t num_words = (n + kBitsPerWord - 1) / kBitsPerWord;
+    ws.suppressed.assign(num_words, 0);
+    ws.block_flags.resize(kBitsPerWord);
+    kept.clear();
+
+    for (int64_t i = 0; i < n && static_cast<int64_t>(kept.size()) < max_num_kept; ++i) {
+        if ((ws.suppressed[i / kBitsPerWord] >> (i % kBitsPerWord)) & 1u) {
+            continue;
+        }
+        kept.push_back(i);
+
+        const opmath_t ix1 = ws.x1[i];
+        const opmath_t iy1 = ws.y1[i];
+        const opmath_t ix2 = ws.x2[i];
+        const opmath_t iy2 = ws.y2[i];
+        const opmath_t iarea = ws.area[i];
+        const int64_t ilabel = ws.label[i];
+        for (int64_t word = (i + 1) / kBitsPerWord; word < num_words; ++word) {
+            const int64_t block_start = word * kBitsPerWord;
+            const int64_t j_begin = std::max(block_start, i + 1);
+            const int64_t j_end = std::min(block_start + kBitsPerWord, n);
+            const uint64_t valid_bits =
+                (j_end - block_start == kBitsPerWord ? ~uint64_t(0)
+                                                     : (uint64_t(1) << (j_end - block_start)) - 1) &
+                ~((uint64_t(1) << (j_begin - block_start)) - 1);
+            if ((ws.suppressed[word] & valid_bits) == valid_bits) {
+                continue;
+            }
+            uint8_t* flags = ws.block_flags.data();
+            for (int64_t j = j_begin; j < j_end; ++j) {
+                const opmath_t w = std::max(std::min(ix2, ws.x2[j]) - std::max(ix1, ws.x1[j]), opmath_t(0));
+                const opmath_t h = std::max(std::min(iy2, ws.y2[j]) - std::max(iy1, ws.y1[j]), opmath_t(0));
+                const opmath_t inter = w * h;
+                const opmath_t iou = inter / (iarea + ws.area[j] - inter);
+                flags[j - block_start] = (iou > iou_threshold) & (!class_aware | (ws.label[j] == ilabel));
+            }
+            uint64_t bits = 0;
+            for (int64_t j = j_begin; j < j_end; ++j) {
+                bits |= static_cast<uint64_t>(flags[j - block_start]) << (j - block_start);
+            }
+            ws.suppressed[word] |= bits;
+        }
+    }
+    return static_cast<int64_t>(kept.size());
+}
+
+// Soft-NMS (Bodla et al., 2017): the highest scoring remaining box is kept and the scores of the
+// remaining boxes are decayed depending on their overlap with it. Boxes with a decayed score below
+// `score_threshold` are discarded. The kept positions are written in selection order, and `ws.score` holds
+// the decayed scores afterwards.
+template <typename opmath_t>
+int64_t soft_nms_sweep(NmsWorkspace<opmath_t>& ws, int64_t n, NmsMethod method, opmath_t iou_threshold,
+                       opmath_t sigma, opmath_t score_threshold, bool class_aware, int64_t max_num_kept,
+                       std::vector<int64_t>& kept) {
+    // `remaining` holds positions in the sorted order. Ties in the (decayed) scores are broken by the
+    // original box index (as for hard NMS), so the selection does not depend on the order of `remaining`
+    std::vector<int64_t>& remaining = ws.remaining;
+    remaining.resize(n);
+    std::iota(remaining.begin(), remaining.end(), 0);
+    kept.clear();
+
+    while (!remaining.empty() && static_cast<int64_t>(kept.size()) < max_num_kept) {
+        int64_t best = 0;
+        for (int64_t r = 1; r < static_cast<int64_t>(remaining.size()); ++r) {
+            if (ragged_sort_before(ws.score[remaining[r]], ws.order[remaining[r]], ws.score[remaining[best]],
+                                   ws.order[remaining[best]], /*descending=*/true)) {
+                best = r;
+            }
+        }
+        const int64_t i = remaining[best];
+        remaining[best] = remaining.back();
+        remaining.pop_back();
+        kept.push_back(i);
+
+        int64_t num_remaining = 0;
+        for (int64_t r = 0; r < static_cast<int64_t>(remaining.size()); ++r) {
+            const int64_t j = remaining[r];
+            if (!class_aware || ws.label[j] == ws.label[i]) {
+                const opmath_t iou = iou_sorted(ws, i, j);
+                if (method == NmsMethod::SoftLinear) {
+                    if (iou > iou_threshold) {
+                        ws.score[j] *= opmath_t(1) - iou;
+                    }
+                } else {
+                    ws.score[j] *= std::exp(-(iou * iou) / sigma);
+                }
+            }
+            if (ws.score[j] >= score_threshold) {
+                remaining[num_remaining++] = j;
+            }
+        }
+        remaining.resize(num_remaining);
+    }
+    return static_cast<int64_t>(kept.size());
+}
+
+template <typename scalar_t, typename index_t>
+void batched_ragged_nms_cpu_impl(const scalar_t* boxes, const scalar_t* scores, const int64_t* labels,
+                                 const index_t* nums_boxes, int64_t batch_size, int64_t max_num_boxes,
+                                 NmsMethod method, double iou_threshold, double sigma, double score_threshold,
+                                 int64_t max_num_kept, int64_t* kept_indices, scalar_t* kept_scores,
+                                 int64_t* nums_kept) {
+    using opmath_t = at::opmath_type<scalar_t>;
+    const bool class_aware = labels != nullptr;
+
+    const int64_t grain_size = std::max<int64_t>(1, kMinBoxesPerTask / std::max<int64_t>(max_num_boxes, 1));
+    at::parallel_for(0, batch_size, grain_size, [&](int64_t start, int64_t end) {
+        NmsWorkspace<opmath_t> ws;
+        std::vector<int64_t> kept;
+        for (int64_t sample = start; sample < end; ++sample) {
+            const int64_t num_boxes =
+                std::min<int64_t>(std::max<int64_t>(nums_boxes[sample], 0), max_num_boxes);
+            const int64_t offset = sample * max_num_boxes;
+
+            const int64_t n = gather_sorted_boxes(ws, boxes + offset * 4, scores + offset,
+                                                  class_aware ? labels + offset : nullptr, num_boxes,
+                                                  static_cast<opmath_t>(score_threshold));
+            int64_t num_kept;
+            if (method == NmsMethod::Hard) {
+                num_kept = hard_nms_sweep(ws, n, static_cast<opmath_t>(iou_threshold), class_aware,
+                                          max_num_kept, kept);
+            } else {
+                num_kept = soft_nms_sweep(
+                    ws, n, method, static_cast<opmath_t>(iou_threshold), static_cast<opmath_t>(sigma),
+                    static_cast<opmath_t>(score_threshold), class_aware, max_num_kept, kept);
+            }
+
+            int64_t* kept_indices_row = kept_indices + offset;
+            scalar_t* kept_scores_row = kept_scores + offset;
+            for (int64_t k = 0; k < num_kept; ++k) {
+                kept_indices_row[k] = ws.order[kept[k]];
+                kept_scores_row[k] = static_cast<scalar_t>(ws.score[kept[k]]);
+            }
+            std::fill(kept_indices_row + num_kept, kept_indices_row + max_num_boxes, int64_t(0));
+            std::fill(kept_scores_row + num_kept, kept_scores_row + max_num_boxes, scalar_t(0));
+            nums_kept[sample] = num_kept;
+        }
+    });
+}
+
+}  // namespace
+
+std::vector<torch::Tensor> batched_ragged_nms_cpu(const torch::Tensor& boxes, const torch::Tensor& scores,
+                                                  const c10::optional<torch::Tensor>& labels,
+                                                  const torch::Tensor& nums_boxes, int64_t method,
+                                                  double iou_threshold, double sigma, double score_threshold,
+                                                  int64_t max_num_kept) {
+    TORCH_CHECK(method >= 0 && method <= static_cast<int64_t>(NmsMethod::SoftGaussian),
+                "Unknown NMS method: ", method);
+    TORCH_CHECK(method != static_cast<int64_t>(NmsMethod::SoftGaussian) || sigma > 0.0,
+                "`sigma` needs to be positive for Gaussian Soft-NMS");
+
+    const int64_t batch_size = boxes.size(0);
+    const int64_t max_num_boxes = boxes.size(1);
+    if (max_num_kept < 0) {
+        max_num_kept = max_num_boxes;
+    }
+
+    torch::Tensor kept_indices =
+        torch::empty({batch_size, max_num_boxes}, scores.options().dtype(torch::kInt64));
+    torch::Tensor kept_scores = torch::empty({batch_size, max_num_boxes}, scores.options());
+    torch::Tensor nums_kept = torch::zeros({batch_size}, scores.options().dtype(torch::kInt64));
+    if (batch_size == 0 || max_num_boxes == 0) {
+        return {kept_indices, kept_scores, nums_kept};
+    }
+
+    const int64_t* labels_ptr = labels.has_value() ? labels->data_ptr<int64_t>() : nullptr;
+
+    DISPATCH_INDEX_TYPES(nums_boxes.scalar_type(), "batched_ragged_nms_cpu [for: nums_boxes]", [&] {
+        using index_scalar_t = scalar_t;
+        AT_DISPATCH_FLOATING_TYPES_AND2(
+            at::ScalarType::Half, at::ScalarType::BFloat16, boxes.scalar_type(),
+            "batched_ragged_nms_cpu [for: boxes]", [&] {
+                batched_ragged_nms_cpu_impl<scalar_t, index_scalar_t>(
+                    boxes.data_ptr<scalar_t>(), scores.data_ptr<scalar_t>(), labels_ptr,
+                    nums_boxes.data_ptr<index_scalar_t>(), batch_size, max_num_boxes,
+                    static_cast<NmsMethod>(method), iou_threshold, sigma, score_threshold, max_num_kept,
+                    kept_indices.data_ptr<int64_t>(), kept_scores.data_ptr<scalar_t>(),
+                    nums_kept.data_ptr<int64_t>());
+            });
+    });
+    return {kept_indices, kept_scores, nums_kept};
+}
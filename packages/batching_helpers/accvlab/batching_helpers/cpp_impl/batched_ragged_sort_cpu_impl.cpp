@@ -0,0 +1,102 @@
+/*
+ * Copyright (c) 2025, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <algorithm>
+#include <numeric>
+#include <vector>
+
+#include <torch/torch.h>
+
+#include <ATen/ATen.h>
+#include <ATen/Parallel.h>
+#include <torch/extension.h>
+
+#include "batched_indexing_access_helpers.h"
+#include "ragged_sort_helpers.h"
+
+// Samples up to this size are sorted with insertion sort, which is faster than std::sort for tiny inputs
+constexpr int64_t kInsertionSortMaxSize = 16;
+// Minimum number of entries per task when parallelizing over the samples
+constexpr int64_t kMinEntriesPerTask = 4096;
+
+template <typename scalar_t, typename index_t>
+void batched_ragged_sort_cpu_impl(const scalar_t* data, const index_t* nums_entries, int64_t batch_size,
+                                  int64_t max_num_entries, int64_t num_out, bool descending, scalar_t* values,
+                                  int64_t* indices) {
+    const int64_t grain_size =
+        std::max<int64_t>(1, kMinEntriesPerTask / std::max<int64_t>(max_num_entries, 1));
+    at::parallel_for(0, batch_size, grain_size, [&](int64_t start, int64_t end) {
+        std::vector<int64_t> order;
+        for (int64_t sample = start; sample < end; ++sample) {
+            const scalar_t* row = data + sample * max_num_entries;
+            const int64_t num_entries =
+                std::min<int64_t>(std::max<int64_t>(nums_entries[sample], 0), max_num_entries);
+            const int64_t num_to_write = std::min(num_entries, num_out);
+
+            order.resize(num_entries);
+            std::iota(order.begin(), order.end(), 0);
+            const auto before = [&](int64_t a, int64_t b) {
+                return ragged_sort_before(row[a], a, row[b], b, descending);
+            };
+            if (num_entries <= kInsertionSortMaxSize) {
+                for (int64_t i = 1; i < num_entries; ++i) {
+                    const int64_t to_insert = order[i];
+                    int64_t j = i;
+                    for (; j > 0 && before(to_insert, order[j - 1]); --j) {
+                        order[j] = order[j - 1];
+                    }
+                    order[j] = to_insert;
+                }
+            } else if (num_to_write < num_entries) {
+                std::partial_sort(order.begin(), order.begin() + num_to_write, order.end(), before);
+            } else {
+                std::sort(order.begin(), order.end(), before);
+            }
+
+            scalar_t* values_row = values + sample * num_out;
+            int64_t* indices_row = indices + sample * num_out;
+            for (int64_t i = 0; i < num_to_write; ++i) {
+                values_row[i] = row[order[i]];
+                indices_row[i] = order[i];
+            }
+            std::fill(values_row + num_to_write, values_row + num_out, scalar_t(0));
+            std::fill(indices_row + num_to_write, indices_row + num_out, int64_t(0));
+        }
+    });
+}
+
+void batched_ragged_sort_cpu(const torch::Tensor& data, const torch::Tensor& nums_entries, bool descending,
+                             torch::Tensor& values, torch::Tensor& indices) {
+    if (values.numel() == 0) {
+        return;
+    }
+
+    const int64_t batch_size = data.size(0);
+    const int64_t max_num_entries = data.size(1);
+    const int64_t num_out = values.size(1);
+
+    DISPATCH_INDEX_TYPES(nums_entries.scalar_type(), "batched_ragged_sort_cpu [for: nums_entries]", [&] {
+        using index_scalar_t = scalar_t;
+        AT_DISPATCH_ALL_TYPES_AND2(
+            at::ScalarType::Half, at::ScalarType::BFloat16, data.scalar_type(),
+            "batched_ragged_sort_cpu [for: data]", [&] {
+                batched_ragged_sort_cpu_impl<scalar_t, index_scalar_t>(
+                    data.data_ptr<scalar_t>(), nums_entries.data_ptr<index_scalar_t>(), batch_size,
+                    max_num_entries, num_out, descending, values.data_ptr<scalar_t>(),
+                    indices.data_ptr<int64_t>());
+            });
+    });
+}
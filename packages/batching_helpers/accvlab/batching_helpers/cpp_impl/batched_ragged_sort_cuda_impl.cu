@@ -0,0 +1,171 @@
+/*
+ * Copyright (c) 2025, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <algorithm>
+#include <limits>
+#include <vector>
+
+#include <torch/torch.h>
+
+#include <cuda.h>
+
+#include <ATen/ATen.h>
+#include <ATen/cuda/CUDAContext.h>
+#include <torch/extension.h>
+
+#include "batched_indexing_access_helpers.h"
+#include "ragged_sort_helpers.h"
+
+// Samples up to this size are sorted in shared memory by a single block (bitonic sort)
+constexpr int64_t kMaxBitonicSortSize = 2048;
+constexpr int kMaxBitonicSortThreads = 1024;
+
+// Padding slots (index -1) are placed after all valid entries
+template <typename scalar_t>
+__device__ __forceinline__ bool bitonic_slot_before(scalar_t key_a, int64_t idx_a, scalar_t key_b,
+                                                    int64_t idx_b, bool descending) {
+    if (idx_a < 0) {
+        return false;
+    }
+    if (idx_b < 0) {
+        return true;
+    }
+    return ragged_sort_before(key_a, idx_a, key_b, idx_b, descending);
+}
+
+template <typename scalar_t, typename index_t>
+__global__ static void batched_ragged_bitonic_sort_kernel(const scalar_t* data, const index_t* nums_entries,
+                                                          int64_t max_num_entries, int64_t num_out,
+                                                          int64_t sort_size, bool descending,
+                                                          scalar_t* values, int64_t* indices) {
+    extern __shared__ unsigned char shared_mem[];
+    int64_t* s_idx = reinterpret_cast<int64_t*>(shared_mem);
+    scalar_t* s_key = reinterpret_cast<scalar_t*>(s_idx + sort_size);
+
+    const int64_t sample = blockIdx.x;
+    const scalar_t* row = data + sample * max_num_entries;
+    const int64_t num_entries =
+        min(max(static_cast<int64_t>(nums_entries[sample]), int64_t(0)), max_num_entries);
+
+    for (int64_t i = threadIdx.x; i < sort_size; i += blockDim.x) {
+        const bool is_valid = i < num_entries;
+        s_key[i] = is_valid ? row[i] : scalar_t(0);
+        s_idx[i] = is_valid ? i : -1;
+    }
+    __syncthreads();
+
+    for (int64_t size = 2; size <= sort_size; size <<= 1) {
+        for (int64_t stride = size / 2; stride > 0; stride >>= 1) {
+            for (int64_t i = threadIdx.x; i < sort_size / 2; i += blockDim.x) {
+                const int64_t pos = 2 * i - (i & (stride - 1));
+                const int64_t partner = pos + stride;
+                const bool ascending_part = (pos & size) == 0;
+                const bool partner_first =
+                    bitonic_slot_before(s_key[partner], s_idx[partner], s_key[pos], s_idx[pos], descending);
+                if (partner_first == ascending_part) {
+                    const scalar_t key = s_key[pos];
+                    s_key[pos] = s_key[partner];
+                    s_key[partner] = key;
+                    const int64_t idx = s_idx[pos];
+                    s_idx[pos] = s_idx[partner];
+                    s_idx[partner] = idx;
+                }
+            }
+            __syncthreads();
+        }
+    }
+
+    const int64_t num_to_write = min(num_entries, num_out);
+    for (int64_t i = threadIdx.x; i < num_out; i += blockDim.x) {
+        const bool is_valid = i < num_to_write;
+        values[sample * num_out + i] = is_valid ? s_key[i] : scalar_t(0);
+        indices[sample * num_out + i] = is_valid ? s_idx[i] : 0;
+    }
+}
+
+static int64_t ceil_pow2_int(int64_t value) {
+    int64_t res = 1;
+    while (res < value) {
+        res <<= 1;
+    }
+    return res;
+}
+
+// Used for samples larger than `kMaxBitonicSortSize`. The padding is set to a value which a stable sort
+// places after all valid entries (NaN is treated as the largest value by `torch.sort`), so the result is
+// identical to the one of the bitonic sort path.
+static void batched_ragged_sort_padded_fallback(const torch::Tensor& data,
+                                                const torch::Tensor& nums_entries, bool descending,
+                                                torch::Tensor& values, torch::Tensor& indices) {
+    const int64_t num_out = values.size(1);
+    const torch::Tensor positions = torch::arange(data.size(1), nums_entries.options()).unsqueeze(0);
+    const torch::Tensor is_padding = positions >= nums_entries.unsqueeze(1);
+
+    at::Scalar fill;
+    if (at::isFloatingType(data.scalar_type())) {
+        fill = descending ? -std::numeric_limits<double>::infinity()
+                          : std::numeric_limits<double>::quiet_NaN();
+    } else {
+        AT_DISPATCH_INTEGRAL_TYPES(data.scalar_type(), "batched_ragged_sort_padded_fallback", [&] {
+            fill = descending ? std::numeric_limits<scalar_t>::lowest()
+                              : std::numeric_limits<scalar_t>::max();
+        });
+    }
+    const torch::Tensor filled = data.masked_fill(is_padding, fill);
+    auto sorted = torch::sort(filled, /*stable=*/true, /*dim=*/1, descending);
+    const torch::Tensor num_to_write = nums_entries.to(torch::kInt64).clamp(0, num_out).unsqueeze(1);
+    const torch::Tensor out_positions = torch::arange(num_out, indices.options()).unsqueeze(0);
+    const torch::Tensor is_out_padding = out_positions >= num_to_write;
+    values.copy_(std::get<0>(sorted).narrow(1, 0, num_out).masked_fill(is_out_padding, 0));
+    indices.copy_(std::get<1>(sorted).narrow(1, 0, num_out).masked_fill(is_out_padding, 0));
+}
+
+void batched_ragged_sort_cuda(const torch::Tensor& data, const torch::Tensor& nums_entries, bool descending,
+                              torch::Tensor& values, torch::Tensor& indices) {
+    if (values.numel() == 0) {
+        return;
+    }
+
+    const int64_t batch_size = data.size(0);
+    const int64_t max_num_entries = data.size(1);
+    const int64_t num_out = values.size(1);
+
+    if (max_num_entries > kMaxBitonicSortSize) {
+        batched_ragged_sort_padded_fallback(data, nums_entries, descending, values, indices);
+        return;
+    }
+
+    const int64_t sort_size = ceil_pow2_int(std::max<int64_t>(max_num_entries, 2));
+    const int num_threads =
+        static_cast<int>(std::min<int64_t>(kMaxBitonicSortThreads, std::max<int64_t>(sort_size / 2, 32)));
+
+    cudaStream_t stream = at::cuda::getCurrentCUDAStream();
+
+    DISPATCH_INDEX_TYPES(nums_entries.scalar_type(), "batched_ragged_sort_cuda [for: nums_entries]", [&] {
+        using index_scalar_t = scalar_t;
+        AT_DISPATCH_ALL_TYPES_AND2(
+            at::ScalarType::Half, at::ScalarType::BFloat16, data.scalar_type(),
+            "batched_ragged_sort_cuda [for: data]", [&] {
+                const size_t shared_mem_size = sort_size * (sizeof(int64_t) + sizeof(scalar_t));
+                batched_ragged_bitonic_sort_kernel<scalar_t, index_scalar_t>
+                    <<<batch_size, num_threads, shared_mem_size, stream>>>(
+                        data.data_ptr<scalar_t>(), nums_entries.data_ptr<index_scalar_t>(), max_num_entries,
+                        num_out, sort_size, descending, values.data_ptr<scalar_t>(),
+                        indices.data_ptr<int64_t>());
+                C10_CUDA_CHECK(cudaGetLastError());
+            });
+    });
+}
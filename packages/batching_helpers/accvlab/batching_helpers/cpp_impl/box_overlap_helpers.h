@@ -0,0 +1,88 @@
+/*
+ * Copyright (c) 2025, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef BATCHING_HELPERS_CPP_IMPL_BOX_OVERLAP_HELPERS_H
+#define BATCHING_HELPERS_CPP_IMPL_BOX_OVERLAP_HELPERS_H
+
+#include <c10/macros/Macros.h>
+#include <c10/util/Exception.h>
+
+// Must match the mode values used in `batched_box_overlap.py`
+enum class BoxOverlapMode : int64_t { IoU = 0, GIoU = 1, DIoU = 2 };
+
+#define DISPATCH_BOX_OVERLAP_MODE(MODE, ...)                                  \
+    [&] {                                                                     \
+        switch (static_cast<BoxOverlapMode>(MODE)) {                          \
+            case BoxOverlapMode::IoU: {                                       \
+                constexpr BoxOverlapMode overlap_mode = BoxOverlapMode::IoU;  \
+                return __VA_ARGS__();                                         \
+            }                                                                 \
+            case BoxOverlapMode::GIoU: {                                      \
+                constexpr BoxOverlapMode overlap_mode = BoxOverlapMode::GIoU; \
+                return __VA_ARGS__();                                         \
+            }                                                                 \
+            case BoxOverlapMode::DIoU: {                                      \
+                constexpr BoxOverlapMode overlap_mode = BoxOverlapMode::DIoU; \
+                return __VA_ARGS__();                                         \
+            }                                                                 \
+            default:                                                          \
+                AT_ERROR("Unknown box overlap mode: ", MODE);                 \
+        }                                                                     \
+    }()
+
+template <typename T>
+C10_HOST_DEVICE inline T box_overlap_min(T a, T b) {
+    return a < b ? a : b;
+}
+
+template <typename T>
+C10_HOST_DEVICE inline T box_overlap_max(T a, T b) {
+    return a > b ? a : b;
+}
+
+/**
+ * Overlap of two axis-aligned boxes given as (x1, y1, x2, y2), with (x1, y1) the upper-left corner.
+ *
+ * The computation is branch-free so that the CPU loop over the second box can be auto-vectorized.
+ * Degenerate unions / enclosing boxes are clamped to `eps`, as in the reference Python implementation.
+ */
+template <BoxOverlapMode mode, typename T>
+C10_HOST_DEVICE inline T box_overlap(T a_x1, T a_y1, T a_x2, T a_y2, T b_x1, T b_y1, T b_x2, T b_y2,
+                                     T eps) {
+    const T area_a = (a_x2 - a_x1) * (a_y2 - a_y1);
+    const T area_b = (b_x2 - b_x1) * (b_y2 - b_y1);
+    const T inter_w = box_overlap_max(box_overlap_min(a_x2, b_x2) - box_overlap_max(a_x1, b_x1), T(0));
+    const T inter_h = box_overlap_max(box_overlap_min(a_y2, b_y2) - box_overlap_max(a_y1, b_y1), T(0));
+    const T inter = inter_w * inter_h;
+    const T uni = box_overlap_max(area_a + area_b - inter, eps);
+    T res = inter / uni;
+    if constexpr (mode != BoxOverlapMode::IoU) {
+        const T encl_w = box_overlap_max(a_x2, b_x2) - box_overlap_min(a_x1, b_x1);
+        const T encl_h = box_overlap_max(a_y2, b_y2) - box_overlap_min(a_y1, b_y1);
+        if constexpr (mode == BoxOverlapMode::GIoU) {
+            const T encl_area = box_overlap_max(encl_w * encl_h, eps);
+            res -= (encl_area - uni) / encl_area;
+        } else {
+            const T encl_diag_sq = box_overlap_max(encl_w * encl_w + encl_h * encl_h, eps);
+            const T center_dx = (a_x1 + a_x2 - b_x1 - b_x2) * T(0.5);
+            const T center_dy = (a_y1 + a_y2 - b_y1 - b_y2) * T(0.5);
+            res -= (center_dx * center_dx + center_dy * center_dy) / encl_diag_sq;
+        }
+    }
+    return res;
+}
+
+#endif  // BATCHING_HELPERS_CPP_IMPL_BOX_OVERLAP_HELPERS_H
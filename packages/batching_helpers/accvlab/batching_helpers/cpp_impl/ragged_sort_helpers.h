@@ -0,0 +1,48 @@
+/*
+ * Copyright (c) 2025, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef BATCHING_HELPERS_CPP_IMPL_RAGGED_SORT_HELPERS_H
+#define BATCHING_HELPERS_CPP_IMPL_RAGGED_SORT_HELPERS_H
+
+#include <ATen/NumericUtils.h>
+#include <c10/macros/Macros.h>
+
+/**
+ * Strict total order used by the ragged sort / top-k ops (CPU and CUDA).
+ *
+ * Matches `torch.sort(..., stable=True)`: NaN is treated as the largest value (i.e. NaNs are placed last
+ * for ascending and first for descending order), and equal keys keep their original order. As the index
+ * is part of the comparison, any (also non-stable) sorting algorithm yields the same, stable result.
+ */
+template <typename scalar_t>
+C10_HOST_DEVICE inline bool ragged_sort_before(scalar_t key_a, int64_t idx_a, scalar_t key_b, int64_t idx_b,
+                                               bool descending) {
+    const bool nan_a = at::_isnan(key_a);
+    const bool nan_b = at::_isnan(key_b);
+    if (nan_a || nan_b) {
+        if (nan_a && nan_b) {
+            return idx_a < idx_b;
+        }
+        // NaN is the largest value
+        return descending ? nan_a : nan_b;
+    }
+    if (key_a != key_b) {
+        return descending ? key_b < key_a : key_a < key_b;
+    }
+    return idx_a < idx_b;
+}
+
+#endif  // BATCHING_HELPERS_CPP_IMPL_RAGGED_SORT_HELPERS_H
@@ -0,0 +1,110 @@
+# Copyright (c) 2025, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+"""
+Benchmark the ragged per-sample NMS (batched_nms) against the padded torchvision approach, i.e. filtering
+the filler predictions, running torchvision.ops.batched_nms on the flattened predictions (with the sample
+index, and optionally the class, as the group index), and converting the result back to a RaggedBatch.
+"""
+
+import argparse
+import time
+
+import torch
+import torchvision
+
+from accvlab.batching_helpers import RaggedBatch, batched_nms
+
+
+def generate_predictions(batch_size, max_num_boxes, num_classes, device):
+    sample_sizes = torch.randint(max_num_boxes // 4, max_num_boxes + 1, (batch_size,), device=device)
+    ul = torch.rand((batch_size, max_num_boxes, 2), device=device) * 200.0
+    wh = torch.rand((batch_size, max_num_boxes, 2), device=device) * 40.0 + 5.0
+    boxes = RaggedBatch(torch.cat([ul, ul + wh], dim=-1), sample_sizes=sample_sizes)
+    scores = torch.rand((batch_size, max_num_boxes), device=device)
+    labels = torch.randint(0, num_classes, (batch_size, max_num_boxes), device=device)
+    return boxes, scores, labels
+
+
+def nms_torchvision_padded(boxes, scores, labels, iou_threshold):
+    batch_size, max_num_boxes = scores.shape
+    mask = boxes.mask
+    sample_indices = torch.arange(batch_size, device=scores.device).unsqueeze(1).expand(-1, max_num_boxes)
+    box_indices = torch.arange(max_num_boxes, device=scores.device).unsqueeze(0).expand(batch_size, -1)
+    groups = sample_indices if labels is None else sample_indices * (int(labels.max()) + 1) + labels
+    keep = torchvision.ops.batched_nms(boxes.tensor[mask], scores[mask], groups[mask], iou_threshold)
+    # `keep` is sorted by decreasing score over all samples; convert to per-sample indices
+    kept_samples = sample_indices[mask][keep]
+    kept_boxes = box_indices[mask][keep]
+    order = torch.sort(kept_samples, stable=True)[1]
+    nums_kept = torch.bincount(kept_samples, minlength=batch_size)
+    max_num_kept = int(nums_kept.max())
+    kept = torch.zeros((batch_size, max_num_kept), dtype=torch.int64, device=scores.device)
+    positions = torch.arange(max_num_kept, device=scores.device).unsqueeze(0) < nums_kept.unsqueeze(1)
+    kept[positions] = kept_boxes[order]
+    return RaggedBatch(kept, sample_sizes=nums_kept)
+
+
+def measure(fn, num_iters, device):
+    fn()  # warm-up
+    if device.type == "cuda":
+        torch.cuda.synchronize()
+    start = time.perf_counter()
+    for _ in range(num_iters):
+        fn()
+    if device.type == "cuda":
+        torch.cuda.synchronize()
+    return (time.perf_counter() - start) / num_iters * 1e3
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__)
+    parser.add_argument("--batch-size", type=int, default=32)
+    parser.add_argument("--max-num-boxes", type=int, nargs="+", default=[100, 1000, 5000])
+    parser.add_argument("--num-classes", type=int, default=10)
+    parser.add_argument("--iou-threshold", type=float, default=0.5)
+    parser.add_argument("--iters", type=int, default=20)
+    args = parser.parse_args()
+
+    torch.manual_seed(42)
+    devices = [torch.device("cpu")]
+    if torch.cuda.is_available():
+        devices.append(torch.device("cuda", 0))
+
+    print(f"{'device':>8} {'max boxes':>10} {'class-aware':>12} {'torchvision [ms]':>17} {'ragged [ms]':>12}")
+    for device in devices:
+        for max_num_boxes in args.max_num_boxes:
+            boxes, scores, labels = generate_predictions(
+                args.batch_size, max_num_boxes, args.num_classes, device
+            )
+            for class_aware in (False, True):
+                sample_labels = labels if class_aware else None
+                time_tv = measure(
+                    lambda: nms_torchvision_padded(boxes, scores, sample_labels, args.iou_threshold),
+                    args.iters,
+                    device,
+                )
+                time_ragged = measure(
+                    lambda: batched_nms(boxes, scores, args.iou_threshold, labels=sample_labels),
+                    args.iters,
+                    device,
+                )
+                print(
+                    f"{device.type:>8} {max_num_boxes:>10} {str(class_aware):>12} {time_tv:>17.3f} "
+                    f"{time_ragged:>12.3f}"
+                )
+
+
+if __name__ == "__main__":
+    main()
@@ -14,7 +14,6 @@
 
 import torch
 import accvlab.batching_helpers as batching_helpers
-from scipy.optimize import linear_sum_assignment
 
 
 class Matcher:
@@ -24,8 +23,11 @@ class Matcher:
         # Get the cost matrices denoting the cost for each GT to prediction combination. Note that as the
         # samples in the GT data are padded to uniform size (see documentation of `RaggedBatch.tensor`), the
         # same will be true for the matrices.
-        batch_size = rects_gt.shape[0]
-        iou_cost_matrices = self._iou_cost_func(rects_gt.tensor, rects_pred)
+        # The IoU cost is computed by a native op which directly handles the RaggedBatch GT boxes, i.e. it
+        # only evaluates valid (prediction, GT) pairs and sets the filler region to a fixed value.
+        iou_cost_matrices = batching_helpers.batched_pairwise_box_overlap(
+            rects_pred, rects_gt, mode="iou", as_cost=True
+        ).tensor
         class_cost_matrices = self._class_l1_cost_func_gt_labels(classes_gt.tensor, classes_pred)
         total_cost_matrices = iou_cost_matrices + class_cost_matrices
 
@@ -44,66 +46,17 @@ class Matcher:
         )
 
         # @NOTE
-        # The Hungarian matching is done on the CPU one sample at a time. Therefore, move the data to the CPU
-        # and split RaggedBatch instances containing the cost matrices into individual samples. Note that
-        # `split()` removes the filler value padding, so that the valid matrices with correct sample sizes are
-        # obtained.
-        device_cpu = torch.device("cpu")
-        total_cost_matrices_cpu = total_cost_matrices.to_device(device_cpu)
-        total_cost_matrices_list = total_cost_matrices_cpu.split()
-
-        # @NOTE: Perform matching for each sample
-        matched_gt_index_list = [None] * batch_size
-        matched_pred_index_list = [None] * batch_size
-        for i, cost_mat in enumerate(total_cost_matrices_list):
-            m_pred, m_gt = linear_sum_assignment(cost_mat)
-            matched_gt_index_list[i] = torch.tensor(m_gt, dtype=torch.int64, device=device_cpu)
-            matched_pred_index_list[i] = torch.tensor(m_pred, dtype=torch.int64, device=device_cpu)
-
-        # @NOTE
-        # Combine resulting indices for the individual samples into RaggedBatch instances representing the
-        # whole batch.
-        matched_gt_indices = batching_helpers.combine_data(matched_gt_index_list)
-        matched_pred_indices = batching_helpers.combine_data(
-            matched_pred_index_list, other_with_same_sample_sizes=matched_gt_indices
+        # Perform the Hungarian matching for the whole batch at once. The matching itself runs on the CPU
+        # (with the samples processed in parallel), but the data transfer as well as the handling of the
+        # filler values is done internally, and the results are returned on the device of the input as
+        # RaggedBatch instances (with one entry per match). The rows of the cost matrices correspond to the
+        # predictions and the columns to the GT objects.
+        matched_pred_indices, matched_gt_indices = batching_helpers.batched_linear_sum_assignment(
+            total_cost_matrices
         )
-        # @NOTE: Move results to the GPU
-        matched_gt_indices = matched_gt_indices.to_device(device=rects_gt.device)
-        matched_pred_indices = matched_pred_indices.to_device(device=rects_gt.device)
 
         return matched_gt_indices, matched_pred_indices
 
-    # Example batched cost function for the matcher. It is used in the example, but the implementation
-    # of this function is not the focus of the example.
-    @staticmethod
-    def _iou_cost_func(rects_gt, rects_pred, eps=1e-6):
-
-        # With broadcasting, using the `_ext` variants will lead to pair-wise results for all possible
-        # combinations
-        rects_gt_ext = rects_gt.unsqueeze(1)
-        rects_pred_ext = rects_pred.unsqueeze(2)
-
-        areas_gt = torch.prod(rects_gt_ext[..., 2:4] - rects_gt_ext[..., 0:2], axis=-1)
-        areas_pred = torch.prod(rects_pred_ext[..., 2:4] - rects_pred_ext[..., 0:2], axis=-1)
-
-        rects_gt_ul = rects_gt_ext[..., 0:2]
-        rects_gt_lr = rects_gt_ext[..., 2:4]
-        rects_pred_ul = rects_pred_ext[..., 0:2]
-        rects_pred_lr = rects_pred_ext[..., 2:4]
-
-        intersections_ul = torch.max(rects_gt_ul, rects_pred_ul)
-        intersections_lr = torch.min(rects_gt_lr, rects_pred_lr)
-        sizes_intersections = intersections_lr - intersections_ul
-        sizes_intersections[sizes_intersections < 0.0] = 0.0
-        areas_intersections = torch.prod(sizes_intersections, axis=-1)
-
-        areas_union = areas_gt + areas_pred - areas_intersections
-        areas_union[areas_union < eps] = eps
-
-        res = 1.0 - areas_intersections / areas_union
-
-        return res
-
     # Example batched cost function for the matcher. It is used in the example, but the implementation
     # of this function is not the focus of the example.
     @staticmethod
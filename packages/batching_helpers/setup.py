@@ -52,11 +52,17 @@ def get_extensions():
     cpp_filenames = [
         'cpp_impl/batched_indexing_access_cpu.cpp',
         'cpp_impl/batched_indexing_access_cpu_impl.cpp',
+        'cpp_impl/batched_linear_assignment_cpu_impl.cpp',
+        'cpp_impl/batched_box_overlap_cpu_impl.cpp',
+        'cpp_impl/batched_ragged_sort_cpu_impl.cpp',
+        'cpp_impl/batched_nms_cpu_impl.cpp',
     ]
     # For CUDA extension, include both C++ and CUDA files
     cuda_filenames = [
         'cpp_impl/batched_indexing_access_cuda.cpp',
         'cpp_impl/batched_indexing_access_cuda_impl.cu',
+        'cpp_impl/batched_box_overlap_cuda_impl.cu',
+        'cpp_impl/batched_ragged_sort_cuda_impl.cu',
     ]
 
     config = load_config()
@@ -0,0 +1,152 @@
+# Copyright (c) 2025, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+import pytest
+import torch
+from accvlab.batching_helpers.batched_processing_py import RaggedBatch
+from accvlab.batching_helpers.batched_box_overlap import batched_pairwise_box_overlap
+
+_DEVICES = [
+    "cpu",
+    pytest.param(
+        "cuda:0", marks=pytest.mark.skipif(not torch.cuda.is_available(), reason="CUDA not available")
+    ),
+]
+
+# -------------------------------------------------------------------------------------------------
+# Reference implementations for testing using random data
+# -------------------------------------------------------------------------------------------------
+
+
+def _reference_pairwise_overlap(boxes_a: torch.Tensor, boxes_b: torch.Tensor, mode: str, eps: float = 1e-6):
+    a = boxes_a.double().unsqueeze(1)
+    b = boxes_b.double().unsqueeze(0)
+    area_a = (a[..., 2] - a[..., 0]) * (a[..., 3] - a[..., 1])
+    area_b = (b[..., 2] - b[..., 0]) * (b[..., 3] - b[..., 1])
+    inter_wh = (torch.min(a[..., 2:], b[..., 2:]) - torch.max(a[..., :2], b[..., :2])).clamp(min=0.0)
+    inter = inter_wh[..., 0] * inter_wh[..., 1]
+    union = (area_a + area_b - inter).clamp(min=eps)
+    iou = inter / union
+    if mode == "iou":
+        return iou
+    encl_wh = torch.max(a[..., 2:], b[..., 2:]) - torch.min(a[..., :2], b[..., :2])
+    if mode == "giou":
+        encl_area = (encl_wh[..., 0] * encl_wh[..., 1]).clamp(min=eps)
+        return iou - (encl_area - union) / encl_area
+    diag_sq = (encl_wh**2).sum(-1).clamp(min=eps)
+    center_dist_sq = (((a[..., :2] + a[..., 2:]) - (b[..., :2] + b[..., 2:])) * 0.5).pow(2).sum(-1)
+    return iou - center_dist_sq / diag_sq
+
+
+def _random_boxes(batch_size, num_boxes, device):
+    ul = torch.rand((batch_size, num_boxes, 2), device=device) * 10.0
+    wh = torch.rand((batch_size, num_boxes, 2), device=device) * 5.0
+    return torch.cat([ul, ul + wh], dim=-1)
+
+
+# -------------------------------------------------------------------------------------------------
+# Tests
+# -------------------------------------------------------------------------------------------------
+
+
+def test_batched_pairwise_box_overlap_manual_example(capsys):
+    boxes_a = torch.tensor([[[0.0, 0.0, 2.0, 2.0], [0.0, 0.0, 1.0, 1.0]]])
+    boxes_b = RaggedBatch(
+        torch.tensor([[[1.0, 1.0, 3.0, 3.0], [5.0, 5.0, 6.0, 6.0], [0.0, 0.0, 0.0, 0.0]]]),
+        sample_sizes=torch.tensor([2]),
+    )
+
+    res = batched_pairwise_box_overlap(boxes_a, boxes_b, mode="iou", fill_value=-1.0)
+
+    assert res.non_uniform_dim == 2
+    assert res.sample_sizes.tolist() == [2]
+    expected = torch.tensor([[[1.0 / 7.0, 0.0, -1.0], [0.0, 0.0, -1.0]]])
+    assert torch.allclose(res.tensor, expected)
+
+
+@pytest.mark.parametrize("device", _DEVICES)
+@pytest.mark.parametrize("mode", ["iou", "giou", "diou"])
+@pytest.mark.parametrize("as_cost", [False, True])
+def test_batched_pairwise_box_overlap_random_runs(capsys, device, mode, as_cost):
+    batch_size = 6
+    max_num_a = 13
+    max_num_b = 37
+    fill_value = 123.0
+    for _ in range(20):
+        boxes_a = _random_boxes(batch_size, max_num_a, device)
+        boxes_b = _random_boxes(batch_size, max_num_b, device)
+        nums_a = torch.randint(0, max_num_a + 1, (batch_size,), device=device)
+        nums_b = torch.randint(0, max_num_b + 1, (batch_size,), device=device)
+        boxes_a = RaggedBatch(boxes_a, sample_sizes=nums_a)
+        boxes_b = RaggedBatch(boxes_b, sample_sizes=nums_b)
+
+        res = batched_pairwise_box_overlap(
+            boxes_a, boxes_b, mode=mode, as_cost=as_cost, fill_value=fill_value
+        )
+
+        assert res.device == boxes_a.device
+        assert res.tensor.shape == (batch_size, max_num_a, max_num_b)
+        assert torch.equal(res.sample_sizes, nums_b)
+        for s in range(batch_size):
+            na = nums_a[s].item()
+            nb = nums_b[s].item()
+            ref = _reference_pairwise_overlap(boxes_a.tensor[s, :na], boxes_b.tensor[s, :nb], mode)
+            if as_cost:
+                ref = 1.0 - ref
+            assert torch.allclose(res.tensor[s, :na, :nb].double(), ref, atol=1e-5), "Wrong overlap values"
+            assert torch.all(res.tensor[s, na:] == fill_value), "Filler rows not set"
+            assert torch.all(res.tensor[s, :, nb:] == fill_value), "Filler columns not set"
+
+
+@pytest.mark.parametrize("device", _DEVICES)
+def test_batched_pairwise_box_overlap_uniform_and_multi_batch_dim(capsys, device):
+    boxes_a = _random_boxes(6, 4, device).reshape(2, 3, 4, 4)
+    boxes_b = _random_boxes(6, 5, device).reshape(2, 3, 5, 4)
+
+    res = batched_pairwise_box_overlap(boxes_a, boxes_b, mode="giou")
+
+    assert res.batch_shape == (2, 3)
+    assert res.non_uniform_dim == 3
+    for i in range(2):
+        for j in range(3):
+            ref = _reference_pairwise_overlap(boxes_a[i, j], boxes_b[i, j], "giou")
+            assert torch.allclose(res.tensor[i, j].double(), ref, atol=1e-5)
+
+
+@pytest.mark.parametrize("device", _DEVICES)
+def test_batched_pairwise_box_overlap_half(capsys, device):
+    boxes_a = _random_boxes(2, 7, device)
+    boxes_b = RaggedBatch(_random_boxes(2, 9, device), sample_sizes=torch.tensor([9, 4], device=device))
+
+    res = batched_pairwise_box_overlap(boxes_a.half(), boxes_b.half(), mode="iou")
+
+    assert res.dtype == torch.float16
+    ref = _reference_pairwise_overlap(boxes_a[1].half(), boxes_b.tensor[1, :4].half(), "iou")
+    assert torch.allclose(res.tensor[1, :, :4].double(), ref, atol=5e-3)
+
+
+@pytest.mark.parametrize("device", _DEVICES)
+def test_batched_pairwise_box_overlap_negative_sample_size(capsys, device):
+    # Negative sample sizes are treated as empty samples (and must not cause out-of-bounds writes)
+    boxes_a = RaggedBatch(_random_boxes(2, 5, device), sample_sizes=torch.tensor([-2, 5], device=device))
+    boxes_b = RaggedBatch(_random_boxes(2, 6, device), sample_sizes=torch.tensor([6, -3], device=device))
+
+    res = batched_pairwise_box_overlap(boxes_a, boxes_b, mode="iou", fill_value=-1.0)
+
+    assert res.tensor.shape == (2, 5, 6)
+    assert torch.all(res.tensor == -1.0)
+
+
+if __name__ == "__main__":
+    pytest.main([__file__])
@@ -0,0 +1,172 @@
+# Copyright (c) 2025, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+import itertools
+
+import pytest
+import torch
+from accvlab.batching_helpers.batched_processing_py import RaggedBatch
+from accvlab.batching_helpers.batched_linear_assignment import batched_linear_sum_assignment
+
+# -------------------------------------------------------------------------------------------------
+# Reference implementations for testing using random data
+# -------------------------------------------------------------------------------------------------
+
+
+def _reference_optimal_cost(cost: torch.Tensor, maximize: bool) -> float:
+    num_rows, num_cols = cost.shape
+    if num_rows == 0 or num_cols == 0:
+        return 0.0
+    if num_rows > num_cols:
+        cost = cost.T
+        num_rows, num_cols = num_cols, num_rows
+    totals = [
+        sum(cost[r, c].item() for r, c in zip(range(num_rows), cols))
+        for cols in itertools.permutations(range(num_cols), num_rows)
+    ]
+    return max(totals) if maximize else min(totals)
+
+
+def _check_assignment(cost, nums_rows, nums_cols, row_indices, col_indices, maximize):
+    for s in range(cost.shape[0]):
+        num_rows = nums_rows[s].item()
+        num_cols = nums_cols[s].item()
+        num_matches = row_indices.sample_sizes[s].item()
+        assert num_matches == min(num_rows, num_cols), "Wrong number of matches"
+        assert col_indices.sample_sizes[s].item() == num_matches, "Row and column sample sizes differ"
+
+        rows = row_indices.tensor[s, :num_matches].cpu()
+        cols = col_indices.tensor[s, :num_matches].cpu()
+        assert torch.all(rows[1:] > rows[:-1]), "Matches are not ordered by row index"
+        assert torch.all((rows >= 0) & (rows < num_rows)), "Row index out of range"
+        assert torch.all((cols >= 0) & (cols < num_cols)), "Column index out of range"
+        assert cols.unique().numel() == num_matches, "Column assigned more than once"
+
+        sample_cost = cost[s, :num_rows, :num_cols].cpu().double()
+        total = sample_cost[rows, cols].sum().item()
+        expected = _reference_optimal_cost(sample_cost, maximize)
+        assert total == pytest.approx(expected, abs=1e-6), "Assignment is not optimal"
+
+
+# -------------------------------------------------------------------------------------------------
+# Tests
+# -------------------------------------------------------------------------------------------------
+
+
+def test_batched_linear_sum_assignment_manual_example(capsys):
+    # Sample 0: 3x3 with a unique optimum; sample 1: only 2 valid columns (rest is filler)
+    cost = torch.tensor(
+        [
+            [[4.0, 1.0, 3.0], [2.0, 0.0, 5.0], [3.0, 2.0, 2.0]],
+            [[1.0, 9.0, -100.0], [9.0, 1.0, -100.0], [5.0, 5.0, -100.0]],
+        ],
+        dtype=torch.float32,
+    )
+    cost_batch = RaggedBatch(cost, sample_sizes=torch.tensor([3, 2]), non_uniform_dim=2)
+
+    row_indices, col_indices = batched_linear_sum_assignment(cost_batch)
+
+    assert row_indices.sample_sizes.tolist() == [3, 2]
+    assert row_indices.tensor[0].tolist() == [0, 1, 2]
+    assert col_indices.tensor[0].tolist() == [1, 0, 2]
+    # More rows than valid columns: the best two rows are selected, ordered by row index
+    assert row_indices.tensor[1, :2].tolist() == [0, 1]
+    assert col_indices.tensor[1, :2].tolist() == [0, 1]
+
+
+@pytest.mark.parametrize("non_uniform_dim", [1, 2])
+@pytest.mark.parametrize("maximize", [False, True])
+def test_batched_linear_sum_assignment_random_runs(capsys, non_uniform_dim, maximize):
+    # To see console outputs, use `with capsys.disabled(): ...`
+    batch_size = 8
+    num_tries = 50
+    max_size = 5
+    for _ in range(num_tries):
+        cost = torch.rand((batch_size, max_size, max_size), dtype=torch.float64)
+        # Use some integer costs to also cover ties
+        cost[::2] = torch.randint(0, 3, (cost[::2].shape), dtype=torch.float64)
+        sample_sizes = torch.randint(0, max_size + 1, (batch_size,), dtype=torch.int64)
+        other_sample_sizes = torch.randint(0, max_size + 1, (batch_size,), dtype=torch.int64)
+        cost_batch = RaggedBatch(cost, sample_sizes=sample_sizes, non_uniform_dim=non_uniform_dim)
+        # Filler values must not have any effect on the result
+        cost_batch.set_padded_to(-1000.0 if not maximize else 1000.0)
+
+        row_indices, col_indices = batched_linear_sum_assignment(
+            cost_batch, other_sample_sizes=other_sample_sizes, maximize=maximize
+        )
+
+        nums_rows, nums_cols = (
+            (sample_sizes, other_sample_sizes) if non_uniform_dim == 1 else (other_sample_sizes, sample_sizes)
+        )
+        # Entries beyond `other_sample_sizes` keep random values and need to be ignored as well
+        _check_assignment(cost_batch.tensor, nums_rows, nums_cols, row_indices, col_indices, maximize)
+
+
+def test_batched_linear_sum_assignment_multi_batch_dim(capsys):
+    cost = torch.rand((2, 3, 4, 6), dtype=torch.float32)
+    sample_sizes = torch.randint(0, 7, (2, 3), dtype=torch.int64)
+    cost_batch = RaggedBatch(cost, sample_sizes=sample_sizes, non_uniform_dim=3)
+
+    row_indices, col_indices = batched_linear_sum_assignment(cost_batch)
+
+    assert row_indices.batch_shape == (2, 3)
+    assert col_indices.batch_shape == (2, 3)
+    _check_assignment(
+        cost.reshape(6, 4, 6),
+        torch.full((6,), 4),
+        sample_sizes.reshape(-1),
+        row_indices.flatten_batch_dims(),
+        col_indices.flatten_batch_dims(),
+        False,
+    )
+
+
+def test_batched_linear_sum_assignment_infeasible(capsys):
+    cost = torch.full((1, 2, 2), float("inf"))
+    cost[0, 0, 0] = 1.0
+    cost_batch = RaggedBatch.FromFullTensor(cost)
+    with pytest.raises(ValueError):
+        batched_linear_sum_assignment(cost_batch)
+
+
+@pytest.mark.parametrize("maximize", [False, True])
+def test_batched_linear_sum_assignment_unbounded_cost(capsys, maximize):
+    # -inf when minimizing and +inf when maximizing would make the objective unbounded
+    cost = torch.rand((2, 3, 3))
+    cost[1, 2, 0] = float("inf") if maximize else -float("inf")
+    cost_batch = RaggedBatch.FromFullTensor(cost)
+    with pytest.raises(RuntimeError, match="inf values"):
+        batched_linear_sum_assignment(cost_batch, maximize=maximize)
+
+    # The opposite infinity marks a forbidden match and is allowed
+    cost[1, 2, 0] = -float("inf") if maximize else float("inf")
+    row_indices, col_indices = batched_linear_sum_assignment(cost_batch, maximize=maximize)
+    _check_assignment(cost, torch.full((2,), 3), torch.full((2,), 3), row_indices, col_indices, maximize)
+
+
+@pytest.mark.skipif(not torch.cuda.is_available(), reason="CUDA not available")
+def test_batched_linear_sum_assignment_cuda_input(capsys):
+    cost = torch.rand((4, 6, 3), dtype=torch.float16, device="cuda:0")
+    sample_sizes = torch.tensor([3, 0, 2, 1], dtype=torch.int64, device="cuda:0")
+    cost_batch = RaggedBatch(cost, sample_sizes=sample_sizes, non_uniform_dim=2)
+
+    row_indices, col_indices = batched_linear_sum_assignment(cost_batch)
+
+    assert row_indices.device == cost.device
+    assert col_indices.device == cost.device
+    _check_assignment(cost.float(), torch.full((4,), 6), sample_sizes, row_indices, col_indices, False)
+
+
+if __name__ == "__main__":
+    pytest.main([__file__])
@@ -0,0 +1,208 @@
+# Copyright (c) 2025, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+import math
+
+import pytest
+import torch
+from accvlab.batching_helpers.batched_processing_py import RaggedBatch
+from accvlab.batching_helpers.batched_nms import batched_nms, batched_soft_nms
+
+_DEVICES = [
+    "cpu",
+    pytest.param(
+        "cuda:0", marks=pytest.mark.skipif(not torch.cuda.is_available(), reason="CUDA not available")
+    ),
+]
+
+# -------------------------------------------------------------------------------------------------
+# Reference implementations for testing using random data
+# -------------------------------------------------------------------------------------------------
+
+
+def _iou(box_a, box_b):
+    w = max(min(box_a[2], box_b[2]) - max(box_a[0], box_b[0]), 0.0)
+    h = max(min(box_a[3], box_b[3]) - max(box_a[1], box_b[1]), 0.0)
+    inter = w * h
+    area_a = (box_a[2] - box_a[0]) * (box_a[3] - box_a[1])
+    area_b = (box_b[2] - box_b[0]) * (box_b[3] - box_b[1])
+    return inter / (area_a + area_b - inter)
+
+
+def _reference_nms(boxes, scores, labels, iou_threshold):
+    boxes = boxes.tolist()
+    labels = labels.tolist() if labels is not None else [0] * len(boxes)
+    order = torch.sort(scores, descending=True, stable=True)[1].tolist()
+    kept = []
+    suppressed = set()
+    for pos, i in enumerate(order):
+        if i in suppressed:
+            continue
+        kept.append(i)
+        for j in order[pos + 1 :]:
+            if labels[i] == labels[j] and _iou(boxes[i], boxes[j]) > iou_threshold:
+                suppressed.add(j)
+    return kept
+
+
+def _reference_soft_nms(boxes, scores, labels, method, sigma, iou_threshold, score_threshold):
+    boxes = boxes.tolist()
+    scores = scores.tolist()
+    labels = labels.tolist() if labels is not None else [0] * len(boxes)
+    remaining = [i for i in range(len(boxes)) if scores[i] >= score_threshold]
+    kept = []
+    kept_scores = []
+    while remaining:
+        i = max(remaining, key=lambda r: (scores[r], -r))
+        remaining.remove(i)
+        kept.append(i)
+        kept_scores.append(scores[i])
+        for j in remaining:
+            if labels[i] != labels[j]:
+                continue
+            iou = _iou(boxes[i], boxes[j])
+            if method == "linear":
+                if iou > iou_threshold:
+                    scores[j] *= 1.0 - iou
+            else:
+                scores[j] *= math.exp(-(iou * iou) / sigma)
+        remaining = [j for j in remaining if scores[j] >= score_threshold]
+    return kept, kept_scores
+
+
+def _random_predictions(batch_size, max_num_boxes, num_classes, device):
+    # Boxes are placed in a small area so that many of them overlap
+    ul = torch.rand((batch_size, max_num_boxes, 2), dtype=torch.float64) * 20.0
+    wh = torch.rand((batch_size, max_num_boxes, 2), dtype=torch.float64) * 6.0 + 1.0
+    boxes = torch.cat([ul, ul + wh], dim=-1).to(device=device)
+    # Quantized scores to get ties
+    scores = (torch.rand((batch_size, max_num_boxes), dtype=torch.float64) * 20.0).round() / 20.0
+    scores = scores.to(device=device)
+    labels = torch.randint(0, num_classes, (batch_size, max_num_boxes), device=device)
+    sample_sizes = torch.randint(0, max_num_boxes + 1, (batch_size,), device=device)
+    return RaggedBatch(boxes, sample_sizes=sample_sizes), scores, labels
+
+
+# -------------------------------------------------------------------------------------------------
+# Tests
+# -------------------------------------------------------------------------------------------------
+
+
+def test_batched_nms_manual_example(capsys):
+    boxes = RaggedBatch(
+        torch.tensor(
+            [
+                [[0.0, 0.0, 2.0, 2.0], [0.0, 0.0, 2.0, 1.9], [3.0, 3.0, 4.0, 4.0], [9.0, 9.0, 9.0, 9.0]],
+                [[0.0, 0.0, 1.0, 1.0], [0.0, 0.0, 1.0, 1.0], [0.0, 0.0, 0.0, 0.0], [0.0, 0.0, 0.0, 0.0]],
+            ]
+        ),
+        sample_sizes=torch.tensor([3, 2]),
+    )
+    scores = torch.tensor([[0.5, 0.9, 0.7, 1.0], [0.3, 0.3, 1.0, 1.0]])
+
+    kept = batched_nms(boxes, scores, iou_threshold=0.5)
+
+    assert kept.sample_sizes.tolist() == [2, 1]
+    assert kept.tensor[0].tolist() == [1, 2]
+    assert kept.tensor[1, 0].item() == 0
+
+    labels = torch.tensor([[0, 1, 0, 0], [0, 1, 0, 0]])
+    kept = batched_nms(boxes, scores, iou_threshold=0.5, labels=labels)
+    assert kept.sample_sizes.tolist() == [3, 2]
+    assert kept.tensor[0].tolist() == [1, 2, 0]
+    assert kept.tensor[1, :2].tolist() == [0, 1]
+
+
+@pytest.mark.parametrize("device", _DEVICES)
+@pytest.mark.parametrize("class_aware", [False, True])
+@pytest.mark.parametrize("max_num_boxes", [5, 70, 200])
+def test_batched_nms_random_runs(capsys, device, class_aware, max_num_boxes):
+    batch_size = 5
+    iou_threshold = 0.4
+    for _ in range(5):
+        boxes, scores, labels = _random_predictions(batch_size, max_num_boxes, 3, device)
+        labels = labels if class_aware else None
+
+        kept = batched_nms(boxes, scores, iou_threshold, labels=labels)
+
+        assert kept.device == boxes.device
+        for s in range(batch_size):
+            n = boxes.sample_sizes[s].item()
+            ref = _reference_nms(
+                boxes.tensor[s, :n], scores[s, :n], labels[s, :n] if class_aware else None, iou_threshold
+            )
+            assert kept.sample_sizes[s].item() == len(ref)
+            assert kept.tensor[s, : len(ref)].tolist() == ref, "Wrong kept indices"
+
+
+@pytest.mark.parametrize("device", _DEVICES)
+def test_batched_nms_score_threshold_and_max_num_kept(capsys, device):
+    boxes, scores, _ = _random_predictions(4, 50, 1, device)
+
+    kept = batched_nms(boxes, scores, 0.5, score_threshold=0.3, max_num_kept=6)
+
+    for s in range(4):
+        n = boxes.sample_sizes[s].item()
+        valid = (scores[s, :n] >= 0.3).nonzero().flatten()
+        ref = _reference_nms(boxes.tensor[s, valid], scores[s, valid], None, 0.5)
+        ref = valid[ref].tolist()[:6]
+        assert kept.tensor[s, : kept.sample_sizes[s]].tolist() == ref
+
+
+@pytest.mark.parametrize("device", _DEVICES)
+@pytest.mark.parametrize("method", ["linear", "gaussian"])
+@pytest.mark.parametrize("class_aware", [False, True])
+def test_batched_soft_nms_random_runs(capsys, device, method, class_aware):
+    batch_size = 4
+    for _ in range(5):
+        boxes, scores, labels = _random_predictions(batch_size, 40, 2, device)
+        labels = labels if class_aware else None
+
+        kept, kept_scores = batched_soft_nms(
+            boxes, scores, method=method, sigma=0.5, iou_threshold=0.3, score_threshold=0.05, labels=labels
+        )
+
+        assert torch.equal(kept.sample_sizes, kept_scores.sample_sizes)
+        for s in range(batch_size):
+            n = boxes.sample_sizes[s].item()
+            ref, ref_scores = _reference_soft_nms(
+                boxes.tensor[s, :n],
+                scores[s, :n],
+                labels[s, :n] if class_aware else None,
+                method,
+                0.5,
+                0.3,
+                0.05,
+            )
+            assert kept.sample_sizes[s].item() == len(ref)
+            assert kept.tensor[s, : len(ref)].tolist() == ref, "Wrong kept indices"
+            assert torch.allclose(
+                kept_scores.tensor[s, : len(ref)].cpu(), torch.tensor(ref_scores, dtype=torch.float64)
+            ), "Wrong decayed scores"
+
+
+@pytest.mark.parametrize("device", _DEVICES)
+def test_batched_nms_multi_batch_dim(capsys, device):
+    boxes, scores, _ = _random_predictions(6, 30, 1, device)
+
+    kept = batched_nms(boxes.reshape_batch_dims((2, 3)), scores.reshape(2, 3, 30), 0.5)
+
+    assert kept.batch_shape == (2, 3)
+    ref = batched_nms(boxes, scores, 0.5)
+    assert torch.equal(kept.flatten_batch_dims().sample_sizes, ref.sample_sizes)
+    assert torch.equal(kept.flatten_batch_dims().tensor, ref.tensor)
+
+
+if __name__ == "__main__":
+    pytest.main([__file__])
@@ -0,0 +1,135 @@
+# Copyright (c) 2025, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+import pytest
+import torch
+from accvlab.batching_helpers.batched_processing_py import RaggedBatch
+from accvlab.batching_helpers.batched_sort import batched_sort, batched_argsort, batched_topk
+from accvlab.batching_helpers.batched_indexing_ops import batched_indexing_access
+
+_DEVICES = [
+    "cpu",
+    pytest.param(
+        "cuda:0", marks=pytest.mark.skipif(not torch.cuda.is_available(), reason="CUDA not available")
+    ),
+]
+
+# -------------------------------------------------------------------------------------------------
+# Helpers for testing using random data
+# -------------------------------------------------------------------------------------------------
+
+
+def _random_ragged_data(batch_size, max_sample_size, device, dtype=torch.float32, with_nan=False):
+    # Small value range to get many ties (checks stability)
+    data = torch.randint(0, 5, (batch_size, max_sample_size), device=device).to(dtype=dtype)
+    if with_nan:
+        nan_mask = torch.rand((batch_size, max_sample_size), device=device) < 0.1
+        data[nan_mask] = float("nan")
+    sample_sizes = torch.randint(0, max_sample_size + 1, (batch_size,), device=device)
+    return RaggedBatch(data, sample_sizes=sample_sizes)
+
+
+def _check_against_reference(data, values, indices, descending, k=None):
+    for s in range(data.batch_shape[0]):
+        n = data.sample_sizes[s].item()
+        ref_values, ref_indices = torch.sort(data.tensor[s, :n], descending=descending, stable=True)
+        num_out = n if k is None else min(n, k)
+        assert values.sample_sizes[s].item() == num_out
+        assert indices.sample_sizes[s].item() == num_out
+        assert torch.equal(indices.tensor[s, :num_out], ref_indices[:num_out]), "Wrong indices"
+        assert torch.allclose(
+            values.tensor[s, :num_out], ref_values[:num_out], equal_nan=True
+        ), "Wrong values"
+        assert torch.all(indices.tensor[s, num_out:] == 0), "Filler indices not set to 0"
+
+
+# -------------------------------------------------------------------------------------------------
+# Tests
+# -------------------------------------------------------------------------------------------------
+
+
+def test_batched_sort_manual_example(capsys):
+    data = RaggedBatch(
+        torch.tensor([[3.0, 1.0, 2.0, 1.0], [5.0, 4.0, -1.0, -1.0]]), sample_sizes=torch.tensor([4, 2])
+    )
+
+    values, indices = batched_sort(data)
+
+    assert torch.equal(values.sample_sizes, data.sample_sizes)
+    assert torch.equal(values.tensor, torch.tensor([[1.0, 1.0, 2.0, 3.0], [4.0, 5.0, 0.0, 0.0]]))
+    assert torch.equal(indices.tensor, torch.tensor([[1, 3, 2, 0], [1, 0, 0, 0]]))
+
+
+@pytest.mark.parametrize("device", _DEVICES)
+@pytest.mark.parametrize("descending", [False, True])
+@pytest.mark.parametrize("max_sample_size", [1, 13, 100, 3000])
+def test_batched_sort_random_runs(capsys, device, descending, max_sample_size):
+    for _ in range(5):
+        data = _random_ragged_data(7, max_sample_size, device, with_nan=True)
+        values, indices = batched_sort(data, descending=descending)
+        assert values.device == data.device
+        _check_against_reference(data, values, indices, descending)
+
+        indices_only = batched_argsort(data, descending=descending)
+        assert torch.equal(indices_only.tensor, indices.tensor)
+
+
+@pytest.mark.parametrize("device", _DEVICES)
+@pytest.mark.parametrize("largest", [False, True])
+@pytest.mark.parametrize("k", [0, 1, 5, 40])
+def test_batched_topk_random_runs(capsys, device, largest, k):
+    for _ in range(5):
+        data = _random_ragged_data(9, 30, device)
+        values, indices = batched_topk(data, k, largest=largest)
+        assert values.tensor.shape == (9, min(k, 30))
+        _check_against_reference(data, values, indices, largest, k)
+
+
+@pytest.mark.parametrize("device", _DEVICES)
+@pytest.mark.parametrize("dtype", [torch.int32, torch.int64, torch.float16, torch.float64])
+def test_batched_sort_dtypes(capsys, device, dtype):
+    data = _random_ragged_data(4, 50, device, dtype=dtype)
+    values, indices = batched_sort(data, descending=True)
+    assert values.dtype == dtype
+    assert indices.dtype == torch.int64
+    _check_against_reference(data, values, indices, True)
+
+
+@pytest.mark.parametrize("device", _DEVICES)
+def test_batched_sort_multi_batch_dim(capsys, device):
+    data = _random_ragged_data(6, 11, device)
+
+    values, indices = batched_sort(data.reshape_batch_dims((2, 3)))
+
+    assert values.batch_shape == (2, 3)
+    assert indices.batch_shape == (2, 3)
+    _check_against_reference(data, values.flatten_batch_dims(), indices.flatten_batch_dims(), False)
+
+
+@pytest.mark.parametrize("device", _DEVICES)
+def test_batched_topk_with_batched_indexing_access(capsys, device):
+    scores = _random_ragged_data(5, 20, device)
+    boxes = scores.create_with_sample_sizes_like_self(torch.rand((5, 20, 4), device=device))
+
+    top_scores, top_indices = batched_topk(scores, 8)
+    top_boxes = batched_indexing_access(boxes, top_indices)
+
+    assert torch.equal(top_boxes.sample_sizes, top_scores.sample_sizes)
+    for s in range(5):
+        n = top_indices.sample_sizes[s].item()
+        assert torch.equal(top_boxes.tensor[s, :n], boxes.tensor[s, top_indices.tensor[s, :n]])
+
+
+if __name__ == "__main__":
+    pytest.main([__file__])
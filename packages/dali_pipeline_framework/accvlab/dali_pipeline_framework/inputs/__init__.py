@@ -16,22 +16,46 @@
 This module contains classes for handling the input data to the DALI pipeline.
 '''
 
+from .batch_index_generator import BatchIndexGenerator
 from .callable_base import CallableBase
+from .columnar_store import ColumnarStore, write_columnar_store
 from .data_provider import DataProvider
+from .gop_bundle_reader import gop_bundle_reader, GOP_BUNDLE_FRAME_INFO_FIELDS
 from .iterable_base import IterableBase
+from .packed_image_records import (
+    pack_image_records,
+    PackedImageRecords,
+    PACKED_RECORD_INDEX_COLUMNS,
+    PACKED_RECORD_INDEX_FILE,
+)
+from .packed_record_reader import packed_record_reader
+from .random_access_sampler_base import RandomAccessSamplerBase
 from .sampler_base import SamplerBase
 from .sampler_input_callable import SamplerInputCallable
 from .sampler_input_iterable import SamplerInputIterable
 from .sequence_sampler import SequenceSampler
+from .shuffled_batch_sampler import ShuffledBatchSampler
 from .sfuffled_sharded_input_callable import ShuffledShardedInputCallable
 
 __all__ = [
+    'BatchIndexGenerator',
     'CallableBase',
+    'ColumnarStore',
     'DataProvider',
+    'gop_bundle_reader',
+    'GOP_BUNDLE_FRAME_INFO_FIELDS',
     'IterableBase',
+    'pack_image_records',
+    'PackedImageRecords',
+    'PACKED_RECORD_INDEX_COLUMNS',
+    'PACKED_RECORD_INDEX_FILE',
+    'packed_record_reader',
+    'RandomAccessSamplerBase',
     'SamplerBase',
     'SamplerInputCallable',
     'SamplerInputIterable',
     'SequenceSampler',
+    'ShuffledBatchSampler',
     'ShuffledShardedInputCallable',
+    'write_columnar_store',
 ]
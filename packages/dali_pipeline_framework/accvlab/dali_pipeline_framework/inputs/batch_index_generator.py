@@ -0,0 +1,244 @@
+# Copyright (c) 2025, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+import copy
+from collections import deque
+from typing import Dict, List, Optional, Tuple
+
+from .sampler_base import SamplerBase
+from .random_access_sampler_base import RandomAccessSamplerBase
+
+
+class BatchIndexGenerator:
+    '''Provide the sample indices of batches of a sampler on demand, by position.
+
+    DALI input callables are stateless and are queried by position (epoch & sample index inside the
+    epoch), possibly out of order and from multiple worker processes. This class maps such positions to the
+    batches of a sampler (see :class:`SamplerBase`) without pre-generating the batches:
+
+      - For random-access samplers (see :class:`RandomAccessSamplerBase`), each batch is computed directly
+        from its position. No batches are stored.
+      - For other samplers, a copy of the sampler is advanced as needed, and only the most recent
+        ``look_ahead_window`` batches are kept. Requests for batches which were already dropped from the
+        window are served by replaying the sampler from the start. As DALI requests the batches
+        (approximately) in order, this does not happen in normal operation if the window covers the
+        batches which are processed concurrently (pre-fetch queue and parallel workers).
+
+    Positions are relative to the start position, which is defined by the resume state (see
+    :meth:`get_resume_state`). This allows to resume a run after a restart with the exact same batches.
+    Without a resume state, the relative positions are equal to the absolute positions of the sampler.
+
+    Note:
+        For samplers which are not random-access, resuming replays the sampler up to the resume position
+        (in bounded memory), and each worker process advances its own copy of the sampler. Therefore, the
+        sampler needs to be deterministic, i.e. each copy needs to provide the same sequence of batches (for
+        epoch-based samplers also after :meth:`SamplerBase.reset`). For example, random generators need to
+        be seeded. As a plausibility check, the first batch is obtained from two copies of the sampler at
+        construction, and a :exc:`ValueError` is raised if they differ.
+    '''
+
+    def __init__(
+        self,
+        sampler: SamplerBase,
+        look_ahead_window: int = 64,
+        resume_state: Optional[Dict[str, int]] = None,
+    ):
+        '''
+
+        Args:
+            sampler: Sampler to obtain the batches from. The sampler itself is not advanced (a copy is used
+                for samplers which are not random-access).
+            look_ahead_window: Number of most recent batches to keep for samplers which are not
+                random-access. Not used for random-access samplers.
+            resume_state: State as returned by :meth:`get_resume_state` to resume from. If ``None``, the
+                batches are provided from the start.
+        '''
+        if look_ahead_window < 1:
+            raise ValueError(f"Look-ahead window has to contain at least one batch; got {look_ahead_window}")
+        self._is_random_access = isinstance(sampler, RandomAccessSamplerBase)
+        # Copy of the sampler in its initial state (used for replaying if the sampler is not random-access)
+        self._sampler = sampler if self._is_random_access else copy.deepcopy(sampler)
+        self._is_epoch_based = sampler.is_epoch_based
+        self._look_ahead_window = look_ahead_window
+        # Number of batches of absolute epochs (known once the end of the epoch was reached)
+        self._epoch_lengths = {}
+        if not self._is_random_access:
+            self._check_deterministic()
+        if resume_state is None:
+            resume_state = {"epoch": 0, "batch": 0}
+        if not self._is_epoch_based and resume_state["epoch"] != 0:
+            raise ValueError("Resume state of sampler which is not epoch-based has to be in epoch 0")
+        self._start_epoch, self._start_batch = self._normalize_position(
+            resume_state["epoch"], resume_state["batch"]
+        )
+        self._reset_window()
+
+    def _reset_window(self):
+        self._working_sampler = None
+        self._next_position = (0, 0)
+        self._window = deque()
+        self._window_batches = {}
+
+    def __getstate__(self):
+        # The working sampler may contain non-serializable objects (e.g. generators) once used. Workers
+        # start with an empty window instead.
+        state = self.__dict__.copy()
+        state["_working_sampler"] = None
+        state["_next_position"] = (0, 0)
+        state["_window"] = deque()
+        state["_window_batches"] = {}
+        return state
+
+    @property
+    def is_epoch_based(self) -> bool:
+        '''Whether the underlying sampler is epoch-based.'''
+        return self._is_epoch_based
+
+    def get_batch(self, epoch_idx: int, batch_idx: int) -> Optional[List[int]]:
+        '''Get the sample indices of a batch.
+
+        Args:
+            epoch_idx: Epoch index relative to the start position (as counted by DALI).
+            batch_idx: Index of the batch inside the epoch, relative to the start position.
+
+        Returns:
+            Sample indices of the batch, or ``None`` if the epoch ends before the batch.
+        '''
+        epoch, batch = self._to_absolute(epoch_idx, batch_idx)
+        if self._is_random_access:
+            num_batches = self._sampler.get_num_batches(epoch)
+            if num_batches is not None and batch >= num_batches:
+                return None
+            return self._sampler.get_batch_indices(epoch, batch)
+        return self._get_batch_from_window(epoch, batch)
+
+    def get_num_batches(self, epoch_idx: int) -> Optional[int]:
+        '''Get the number of batches in an epoch.
+
+        Args:
+            epoch_idx: Epoch index relative to the start position.
+
+        Returns:
+            Number of batches in the epoch (excluding the batches before the start position for the first
+            epoch), or ``None`` if the sampler is not epoch-based.
+        '''
+        if not self._is_epoch_based:
+            return None
+        epoch = self._start_epoch + epoch_idx
+        if self._is_random_access:
+            num_batches = self._sampler.get_num_batches(epoch)
+        else:
+            num_batches = self._count_epoch_length(epoch)
+        if epoch_idx == 0:
+            num_batches = max(num_batches - self._start_batch, 0)
+        return num_batches
+
+    def get_resume_state(self, epoch_idx: int, batch_idx: int) -> Dict[str, int]:
+        '''Get the state to resume from a position.
+
+        The returned state only contains integers and can be stored e.g. as part of a training checkpoint.
+
+        Args:
+            epoch_idx: Epoch index of the next batch to provide after resuming (relative to the start
+                position, as counted by DALI).
+            batch_idx: Index of the next batch to provide after resuming inside the epoch (relative to the
+                start position).
+
+        Returns:
+            State to pass to the constructor to resume from the position. A position after the last batch of
+            an epoch (e.g. a checkpoint at the end of the epoch) is mapped to the start of the next epoch.
+        '''
+        epoch, batch = self._normalize_position(*self._to_absolute(epoch_idx, batch_idx))
+        return {"epoch": epoch, "batch": batch}
+
+    def _normalize_position(self, epoch: int, batch: int) -> Tuple[int, int]:
+        if not self._is_epoch_based:
+            return epoch, batch
+        if self._is_random_access:
+            num_batches = self._sampler.get_num_batches(epoch)
+        else:
+            num_batches = self._count_epoch_length(epoch)
+        if num_batches is not None and batch >= num_batches:
+            return epoch + 1, 0
+        return epoch, batch
+
+    def _check_deterministic(self):
+        first_batches = []
+        for _ in range(2):
+            try:
+                first_batches.append(copy.deepcopy(self._sampler).get_next_batch_indices())
+            except StopIteration:
+                first_batches.append(None)
+        if first_batches[0] != first_batches[1]:
+            raise ValueError(
+                "Copies of the sampler provide different batches. Samplers which are not random-access "
+                "need to be deterministic (e.g. use a seeded random generator), as each worker process "
+                "advances its own copy."
+            )
+
+    def _to_absolute(self, epoch_idx: int, batch_idx: int) -> Tuple[int, int]:
+        if epoch_idx == 0:
+            return self._start_epoch, self._start_batch + batch_idx
+        return self._start_epoch + epoch_idx, batch_idx
+
+    def _is_after_epoch_end(self, epoch: int, batch: int) -> bool:
+        return epoch in self._epoch_lengths and batch >= self._epoch_lengths[epoch]
+
+    def _count_epoch_length(self, epoch: int) -> int:
+        if epoch not in self._epoch_lengths:
+            # Use a separate copy to not disturb the window
+            sampler = copy.deepcopy(self._sampler)
+            for e in range(epoch + 1):
+                num_batches = 0
+                try:
+                    while True:
+                        sampler.get_next_batch_indices()
+                        num_batches += 1
+                except StopIteration:
+                    self._epoch_lengths[e] = num_batches
+                sampler.reset()
+        return self._epoch_lengths[epoch]
+
+    def _advance(self):
+        epoch, batch = self._next_position
+        try:
+            batch_indices = self._working_sampler.get_next_batch_indices()
+        except StopIteration:
+            if not self._is_epoch_based:
+                raise RuntimeError("Sampler which is not epoch-based indicated the end of an epoch")
+            self._epoch_lengths[epoch] = batch
+            self._working_sampler.reset()
+            self._next_position = (epoch + 1, 0)
+            return
+        self._window.append((epoch, batch))
+        self._window_batches[(epoch, batch)] = batch_indices
+        if len(self._window) > self._look_ahead_window:
+            del self._window_batches[self._window.popleft()]
+        self._next_position = (epoch, batch + 1)
+
+    def _get_batch_from_window(self, epoch: int, batch: int) -> Optional[List[int]]:
+        if self._is_after_epoch_end(epoch, batch):
+            return None
+        position = (epoch, batch)
+        if position in self._window_batches:
+            return self._window_batches[position]
+        if self._working_sampler is None or position < self._next_position:
+            # Batch not generated yet (first use) or already dropped from the window: replay from the start
+            self._reset_window()
+            self._working_sampler = copy.deepcopy(self._sampler)
+        while position not in self._window_batches:
+            if self._is_after_epoch_end(epoch, batch):
+                return None
+            self._advance()
+        return self._window_batches[position]
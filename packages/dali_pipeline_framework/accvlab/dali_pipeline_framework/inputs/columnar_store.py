@@ -0,0 +1,452 @@
+# Copyright (c) 2025, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+import os
+import struct
+import tempfile
+from typing import Dict, List, Mapping, Optional, Sequence, Union
+
+import numpy as np
+
+# File layout (all values little-endian, all sections aligned to `_ALIGNMENT` bytes):
+#
+#   - Header (`_HEADER`, padded to `_HEADER_SIZE` bytes)
+#   - Column directory: one `_COLUMN` entry per column
+#   - Per column: data (rows of all samples, concatenated) and, for ragged columns, `uint64` offsets
+#     (`num_samples + 1` entries, in rows)
+#   - String table: `uint64` offsets (`num_strings + 1` entries, in bytes) and the concatenated UTF-8 data
+#   - Sample index (optional): `uint32` key string id per sample, followed by the sample indices (`uint64`)
+#     sorted by key
+#
+# Has to match `ColumnarStore.h` of the native operators.
+
+_MAGIC = b"ACCVCOL1"
+_VERSION = 1
+_ALIGNMENT = 64
+_HEADER_SIZE = 128
+_MAX_ELEMENT_DIMS = 4
+
+# magic, version, num_columns, num_samples, columns_offset, num_strings, string_offsets_offset,
+# string_data_offset, sample_keys_offset, sorted_keys_offset
+_HEADER = struct.Struct("<8sIIQQQQQQQ")
+# name_id, dtype, flags, element_ndim, reserved, element_shape[4], data_offset, data_size, offsets_offset
+_COLUMN = struct.Struct("<IBBBB4qQQQ")
+
+_FLAG_RAGGED = 1
+_FLAG_STRING = 2
+
+# Index in this list is the dtype code stored in the file
+_DTYPES = [
+    np.dtype(np.bool_),
+    np.dtype(np.uint8),
+    np.dtype(np.int8),
+    np.dtype(np.uint16),
+    np.dtype(np.int16),
+    np.dtype(np.uint32),
+    np.dtype(np.int32),
+    np.dtype(np.uint64),
+    np.dtype(np.int64),
+    np.dtype(np.float16),
+    np.dtype(np.float32),
+    np.dtype(np.float64),
+]
+
+
+def _align(value: int) -> int:
+    return (value + _ALIGNMENT - 1) // _ALIGNMENT * _ALIGNMENT
+
+
+def _is_string_list(values) -> bool:
+    return isinstance(values, (list, tuple)) and all(v is None or isinstance(v, str) for v in values)
+
+
+class _StringTable:
+    def __init__(self):
+        self._ids = {}
+        self.strings = []
+
+    def add(self, string: Optional[str]) -> int:
+        if string is None:
+            return -1
+        if string not in self._ids:
+            self._ids[string] = len(self.strings)
+            self.strings.append(string)
+        return self._ids[string]
+
+
+class _PreparedColumn:
+    def __init__(self, name_id, data: np.ndarray, offsets: Optional[np.ndarray], is_string: bool):
+        if data.dtype not in _DTYPES:
+            raise TypeError(f"Unsupported column data type: {data.dtype}")
+        if data.ndim - 1 > _MAX_ELEMENT_DIMS:
+            raise ValueError(f"Column elements can have at most {_MAX_ELEMENT_DIMS} dimensions")
+        self.name_id = name_id
+        self.data = np.ascontiguousarray(data)
+        self.offsets = offsets
+        self.is_string = is_string
+
+
+def _prepare_column(name: str, values, strings: _StringTable, num_samples: int) -> _PreparedColumn:
+    name_id = strings.add(name)
+    if isinstance(values, np.ndarray):
+        if len(values) != num_samples:
+            raise ValueError(f"Column '{name}' has {len(values)} rows, expected {num_samples}")
+        return _PreparedColumn(name_id, values, None, False)
+
+    values = list(values)
+    if len(values) != num_samples:
+        raise ValueError(f"Column '{name}' has {len(values)} rows, expected {num_samples}")
+
+    if _is_string_list(values):
+        ids = np.array([strings.add(v) for v in values], dtype=np.int32)
+        return _PreparedColumn(name_id, ids, None, True)
+
+    offsets = np.zeros(num_samples + 1, dtype=np.uint64)
+    if all(_is_string_list(v) for v in values):
+        ids = [strings.add(s) for v in values for s in v]
+        offsets[1:] = np.cumsum([len(v) for v in values])
+        return _PreparedColumn(name_id, np.array(ids, dtype=np.int32), offsets, True)
+
+    arrays = [np.asarray(v) for v in values]
+    num_scalars = sum(1 for a in arrays if a.ndim == 0)
+    if num_scalars > 0:
+        if num_scalars != num_samples:
+            raise ValueError(f"Column '{name}' mixes scalars and arrays; use one of them for all samples")
+        return _PreparedColumn(name_id, np.asarray(values), None, False)
+
+    non_empty = [a for a in arrays if a.size > 0]
+    element_shape = non_empty[0].shape[1:] if non_empty else ()
+    dtype = np.result_type(*non_empty) if non_empty else np.dtype(np.float32)
+    rows = []
+    for i, a in enumerate(arrays):
+        if a.size == 0:
+            a = a.reshape((0,) + element_shape)
+        elif a.shape[1:] != element_shape:
+            raise ValueError(
+                f"Rows of column '{name}' have different element shapes ({a.shape[1:]} for sample {i}, "
+                f"{element_shape} before)"
+            )
+        rows.append(a.astype(dtype, copy=False))
+        offsets[i + 1] = offsets[i] + len(a)
+    data = np.concatenate(rows) if rows else np.zeros((0,) + element_shape, dtype=dtype)
+    return _PreparedColumn(name_id, data, offsets, False)
+
+
+def write_columnar_store(
+    path: str,
+    columns: Mapping[str, Union[np.ndarray, Sequence]],
+    sample_keys: Optional[Sequence[str]] = None,
+):
+    '''Write a columnar store (to be read with :class:`ColumnarStore`).
+
+    The store is written to a temporary file first, which is then renamed to ``path``. This way, processes
+    which concurrently create the same store (e.g. one per rank) never read a partially written file.
+
+    The type of each column is derived from its values:
+
+      - ``np.ndarray``: Fixed-size column. The first dimension corresponds to the samples, i.e. each sample
+        has one element of shape ``values.shape[1:]``.
+      - Sequence of scalars: Fixed-size column with one scalar per sample (same as a 1D ``np.ndarray``).
+      - Sequence of ``str`` (or ``None``): String column with one string per sample.
+      - Sequence of sequences of ``str``: Ragged string column (variable number of strings per sample).
+      - Sequence of array-likes: Ragged column (e.g. per-object data). The array of each sample has shape
+        ``[num_objects, *element_shape]``, where ``element_shape`` is the same for all samples.
+
+    Args:
+        path: Output file.
+        columns: Columns by name. All columns have to have the same number of samples.
+        sample_keys: Optional unique key per sample (e.g. sample token), for :meth:`ColumnarStore.index_of`.
+    '''
+    if len(columns) == 0:
+        raise ValueError("At least one column is needed")
+    num_samples = len(next(iter(columns.values())))
+
+    strings = _StringTable()
+    prepared = [_prepare_column(name, values, strings, num_samples) for name, values in columns.items()]
+
+    key_ids = None
+    sorted_keys = None
+    if sample_keys is not None:
+        sample_keys = list(sample_keys)
+        if len(sample_keys) != num_samples or len(set(sample_keys)) != num_samples:
+            raise ValueError("`sample_keys` has to contain one unique key per sample")
+        key_ids = np.array([strings.add(k) for k in sample_keys], dtype=np.uint32)
+        sorted_keys = np.array(
+            sorted(range(num_samples), key=lambda i: sample_keys[i].encode("utf-8")), dtype=np.uint64
+        )
+
+    encoded_strings = [s.encode("utf-8") for s in strings.strings]
+    string_offsets = np.zeros(len(encoded_strings) + 1, dtype=np.uint64)
+    string_offsets[1:] = np.cumsum([len(s) for s in encoded_strings])
+    string_data = b"".join(encoded_strings)
+
+    # Layout
+    sections = []
+    position = _align(_HEADER_SIZE)
+    columns_offset = position
+    position = _align(position + _COLUMN.size * len(prepared))
+    column_entries = []
+    for column in prepared:
+        data_offset = position
+        position = _align(position + column.data.nbytes)
+        offsets_offset = 0
+        if column.offsets is not None:
+            offsets_offset = position
+            position = _align(position + column.offsets.nbytes)
+            sections.append((offsets_offset, column.offsets.tobytes()))
+        sections.append((data_offset, column.data.tobytes()))
+        element_shape = list(column.data.shape[1:])
+        flags = _FLAG_RAGGED if column.offsets is not None else 0
+        flags |= _FLAG_STRING if column.is_string else 0
+        column_entries.append(
+            _COLUMN.pack(
+                column.name_id,
+                _DTYPES.index(column.data.dtype),
+                flags,
+                len(element_shape),
+                0,
+                *(element_shape + [0] * (_MAX_ELEMENT_DIMS - len(element_shape))),
+                data_offset,
+                column.data.nbytes,
+                offsets_offset,
+            )
+        )
+    sections.append((columns_offset, b"".join(column_entries)))
+
+    string_offsets_offset = position
+    position = _align(position + string_offsets.nbytes)
+    string_data_offset = position
+    position = _align(position + len(string_data))
+    sections.append((string_offsets_offset, string_offsets.tobytes()))
+    sections.append((string_data_offset, string_data))
+
+    sample_keys_offset = 0
+    sorted_keys_offset = 0
+    if key_ids is not None:
+        sample_keys_offset = position
+        position = _align(position + key_ids.nbytes)
+        sorted_keys_offset = position
+        position = _align(position + sorted_keys.nbytes)
+        sections.append((sample_keys_offset, key_ids.tobytes()))
+        sections.append((sorted_keys_offset, sorted_keys.tobytes()))
+
+    header = _HEADER.pack(
+        _MAGIC,
+        _VERSION,
+        len(prepared),
+        num_samples,
+        columns_offset,
+        len(encoded_strings),
+        string_offsets_offset,
+        string_data_offset,
+        sample_keys_offset,
+        sorted_keys_offset,
+    )
+    sections.append((0, header))
+
+    directory = os.path.dirname(os.path.abspath(path))
+    fd, tmp_path = tempfile.mkstemp(dir=directory, prefix=".columnar_store_")
+    try:
+        with os.fdopen(fd, "wb") as file:
+            for offset, data in sorted(sections, key=lambda s: s[0]):
+                file.seek(offset)
+                file.write(data)
+            file.truncate(position)
+        # Temporary files are only readable by the owner
+        os.chmod(tmp_path, 0o644)
+        os.replace(tmp_path, path)
+    except BaseException:
+        os.unlink(tmp_path)
+        raise
+
+
+class ColumnarStore:
+    '''Read-only, memory-mapped columnar store (written with :func:`write_columnar_store`).
+
+    Columns are flat typed arrays (with offset arrays for ragged per-sample data such as per-object
+    annotations), strings are stored in a shared string table. The file is memory-mapped, so that the data is
+    only read when accessed, and is shared via the page cache between all processes using the same store
+    (e.g. DALI worker processes and ranks on the same node), instead of each process holding its own
+    deserialized copy of the whole dataset metadata.
+
+    Numeric data is returned as read-only ``np.ndarray`` views into the mapped file (no copy). Pickling a
+    store (e.g. when passing a data provider to worker processes) only transfers the path; the file is
+    mapped again in the receiving process.
+
+    Example:
+
+        A :class:`DataProvider` can keep a store and read the per-sample data in ``get_data()``::
+
+            self._store = ColumnarStore(path)
+            ...
+            boxes = self._store.get("boxes", sample_index)  # e.g. shape [num_objects, 7]
+            image_path = self._store.get("image_path", sample_index)
+
+    Note:
+        The store can also be read from native operators (see ``ColumnarStore.h``).
+    '''
+
+    def __init__(self, path: str):
+        '''
+        Args:
+            path: File containing the store.
+        '''
+        self._path = path
+        self._buffer = np.memmap(path, dtype=np.uint8, mode="r")
+        if len(self._buffer) < _HEADER_SIZE:
+            raise ValueError(f"'{path}' is not a columnar store (file too small)")
+        (
+            magic,
+            version,
+            num_columns,
+            self._num_samples,
+            columns_offset,
+            num_strings,
+            string_offsets_offset,
+            self._string_data_offset,
+            sample_keys_offset,
+            sorted_keys_offset,
+        ) = _HEADER.unpack_from(self._buffer, 0)
+        if magic != _MAGIC or version != _VERSION:
+            raise ValueError(f"'{path}' is not a columnar store of version {_VERSION}")
+
+        self._string_offsets = self._array(string_offsets_offset, np.uint64, num_strings + 1)
+        self._check_offsets(
+            self._string_offsets, num_strings + 1, len(self._buffer) - self._string_data_offset, "string offsets"
+        )
+        self._columns = {}
+        for i in range(num_columns):
+            entry = _COLUMN.unpack_from(self._buffer, columns_offset + i * _COLUMN.size)
+            name_id, dtype, flags, ndim = entry[:4]
+            element_shape = tuple(entry[5 : 5 + ndim])
+            data_offset, data_size, offsets_offset = entry[9:]
+            dtype = _DTYPES[dtype]
+            rows = self._array(data_offset, dtype, data_size // dtype.itemsize)
+            rows = rows.reshape((-1,) + element_shape)
+            offsets = None
+            if flags & _FLAG_RAGGED:
+                offsets = self._array(offsets_offset, np.uint64, self._num_samples + 1)
+                self._check_offsets(offsets, self._num_samples + 1, len(rows), "column offsets")
+            self._columns[self.string(name_id)] = (rows, offsets, bool(flags & _FLAG_STRING))
+
+        self._sample_keys = None
+        self._sorted_keys = None
+        if sample_keys_offset != 0:
+            self._sample_keys = self._array(sample_keys_offset, np.uint32, self._num_samples)
+            self._sorted_keys = self._array(sorted_keys_offset, np.uint64, self._num_samples)
+            if (
+                len(self._sample_keys) != self._num_samples
+                or len(self._sorted_keys) != self._num_samples
+                or np.any(self._sample_keys >= num_strings)
+                or np.any(self._sorted_keys >= self._num_samples)
+            ):
+                raise ValueError(f"'{path}' has invalid sample keys")
+
+    def _check_offsets(self, offsets: np.ndarray, count: int, limit: int, what: str):
+        if len(offsets) != count or np.any(offsets[1:] < offsets[:-1]) or offsets[-1] > limit:
+            raise ValueError(f"'{self._path}' has corrupt {what}")
+
+    def _array(self, offset: int, dtype, count: int) -> np.ndarray:
+        dtype = np.dtype(dtype)
+        return self._buffer[offset : offset + count * dtype.itemsize].view(dtype)
+
+    def __getstate__(self):
+        return {"path": self._path}
+
+    def __setstate__(self, state):
+        self.__init__(state["path"])
+
+    def __len__(self) -> int:
+        return self._num_samples
+
+    def __contains__(self, column: str) -> bool:
+        return column in self._columns
+
+    @property
+    def path(self) -> str:
+        '''File containing the store.'''
+        return self._path
+
+    @property
+    def num_samples(self) -> int:
+        '''Number of samples.'''
+        return self._num_samples
+
+    @property
+    def column_names(self) -> List[str]:
+        '''Names of the columns (in the order in which they were written).'''
+        return list(self._columns.keys())
+
+    def is_ragged(self, column: str) -> bool:
+        '''Whether the column has a variable number of rows per sample.'''
+        return self._columns[column][1] is not None
+
+    def string(self, string_id: int) -> Optional[str]:
+        '''Get a string from the string table (``None`` for the id ``-1``).'''
+        if string_id < 0:
+            return None
+        begin = self._string_data_offset + int(self._string_offsets[string_id])
+        end = self._string_data_offset + int(self._string_offsets[string_id + 1])
+        return bytes(self._buffer[begin:end]).decode("utf-8")
+
+    def get(self, column: str, sample_index: int) -> Union[np.ndarray, str, List[str], None]:
+        '''Get the data of a column for one sample.
+
+        Args:
+            column: Name of the column.
+            sample_index: Index of the sample.
+
+        Returns:
+            For numeric columns, a read-only array view of shape ``element_shape`` (fixed-size columns) or
+            ``[num_rows, *element_shape]`` (ragged columns). For string columns, the string (or ``None``), or
+            the list of strings for ragged string columns.
+        '''
+        if not 0 <= sample_index < self._num_samples:
+            raise IndexError(f"Sample index {sample_index} out of range [0, {self._num_samples})")
+        rows, offsets, is_string = self._columns[column]
+        if offsets is None:
+            res = rows[sample_index]
+            return self.string(int(res)) if is_string else res
+        res = rows[int(offsets[sample_index]) : int(offsets[sample_index + 1])]
+        return [self.string(int(s)) for s in res] if is_string else res
+
+    def get_sample(self, sample_index: int, columns: Optional[Sequence[str]] = None) -> Dict[str, object]:
+        '''Get the data of multiple columns (all columns by default) for one sample.'''
+        if columns is None:
+            columns = self._columns.keys()
+        return {name: self.get(name, sample_index) for name in columns}
+
+    def index_of(self, key: str) -> int:
+        '''Get the index of the sample with the given key.
+
+        See ``sample_keys`` of :func:`write_columnar_store`.
+
+        Raises:
+            KeyError: If there is no sample with the given key.
+        '''
+        if self._sorted_keys is None:
+            raise KeyError("The store has no sample keys")
+        encoded_key = key.encode("utf-8")
+        low, high = 0, self._num_samples
+        while low < high:
+            mid = (low + high) // 2
+            sample = int(self._sorted_keys[mid])
+            mid_key = self.string(int(self._sample_keys[sample])).encode("utf-8")
+            if mid_key < encoded_key:
+                low = mid + 1
+            elif mid_key > encoded_key:
+                high = mid
+            else:
+                return sample
+        raise KeyError(f"No sample with key '{key}'")
@@ -0,0 +1,119 @@
+# Copyright (c) 2025, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+import os
+from typing import Optional, Sequence
+
+import nvidia.dali.fn as fn
+
+#: Columns of the ``frame_info`` output of :func:`gop_bundle_reader`
+GOP_BUNDLE_FRAME_INFO_FIELDS = (
+    'color_range',
+    'codec_id',
+    'width',
+    'height',
+    'frame_size',
+    'gop_len',
+    'first_frame_id',
+    'num_packets',
+)
+
+_custom_operator_loaded = False
+
+
+def _load_custom_operator():
+    global _custom_operator_loaded
+    if _custom_operator_loaded:
+        return
+    import nvidia.dali.plugin_manager as plugin_manager
+
+    parent_dir = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+    plugin_manager.load_library(os.path.join(parent_dir, "lib_gop_bundle_reader.so"), global_symbols=True)
+    _custom_operator_loaded = True
+
+
+def gop_bundle_reader(
+    files: Optional[Sequence[str]] = None,
+    index_file: Optional[str] = None,
+    file_root: str = "",
+    shard_id: int = 0,
+    num_shards: int = 1,
+    random_shuffle: bool = False,
+    stick_to_shard: bool = False,
+    pad_last_batch: bool = False,
+    seed: Optional[int] = None,
+    name: Optional[str] = None,
+):
+    '''Read serialized GOP bundles inside a DALI pipeline (CPU operator).
+
+    Each sample is one GOP bundle, as produced by ``PyNvGopDecoder.GetGOP`` (e.g. saved with
+    ``SavePacketsToFile``) or by the GOP extraction driver of ``accvlab.on_demand_video_decoder`` (packed into
+    shard files and listed in ``gop_index.tsv``). The bundles are read and validated by the operator on the
+    thread pool of the pipeline, so that GOP I/O is part of the pipeline prefetching instead of being done in
+    Python before feeding the pipeline.
+
+    Sharding and shuffling follow the DALI file readers: the bundles are split into ``num_shards`` contiguous
+    shards, and with ``random_shuffle``, the samples of a shard are shuffled in each epoch. Use ``name`` as
+    ``reader_name`` of the DALI iterators to obtain the epoch size.
+
+    Note:
+        Must be called inside a pipeline definition.
+
+    Args:
+        files: GOP bundle files (one sample per file). Mutually exclusive with ``index_file``.
+        index_file: GOP extraction index (``gop_index.tsv``). One sample per GOP bundle of the completed jobs;
+            shard files are resolved relative to the directory of the index.
+        file_root: Directory prepended to relative paths in ``files``.
+        shard_id: Index of the shard to read.
+        num_shards: Number of shards the data is split into.
+        random_shuffle: Whether to shuffle the samples of the shard in each epoch.
+        stick_to_shard: Whether to read the same shard in each epoch (otherwise, the next shard is read in the
+            next epoch).
+        pad_last_batch: Whether to pad the last batch of an epoch by repeating its last sample (otherwise, it
+            is filled with samples of the next epoch).
+        seed: Seed of the shuffling. If not set, the seed of the pipeline is used.
+        name: Name of the operator (to be used as ``reader_name``).
+
+    Returns:
+        Tuple ``(data, frame_info, payload_ranges)`` with
+
+        - ``data``: The serialized bundle (``uint8``), which can be passed to the ``DecodeFromGOP*`` methods
+          of ``PyNvGopDecoder``.
+        - ``frame_info``: Metadata of each frame entry of the bundle (``int32``, shape ``[num_frames, 8]``),
+          with columns as listed in :data:`GOP_BUNDLE_FRAME_INFO_FIELDS`.
+        - ``payload_ranges``: Offset and size of the concatenated packet data of each frame entry in ``data``
+          (``int64``, shape ``[num_frames, 2]``).
+    '''
+    if (files is None) == (index_file is None):
+        raise ValueError("Exactly one of `files` and `index_file` has to be set")
+    _load_custom_operator()
+
+    kwargs = {}
+    if files is not None:
+        kwargs["files"] = list(files)
+        kwargs["file_root"] = file_root
+    else:
+        kwargs["index_file"] = index_file
+    if seed is not None:
+        kwargs["seed"] = seed
+    if name is not None:
+        kwargs["name"] = name
+    return fn.gop_bundle_reader(
+        shard_id=shard_id,
+        num_shards=num_shards,
+        random_shuffle=random_shuffle,
+        stick_to_shard=stick_to_shard,
+        pad_last_batch=pad_last_batch,
+        **kwargs,
+    )
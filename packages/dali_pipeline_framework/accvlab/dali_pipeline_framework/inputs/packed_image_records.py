@@ -0,0 +1,242 @@
+# Copyright (c) 2025, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+'''
+Packed image record shards.
+
+Many small files (e.g. one JPEG per camera and sample) are packed into a few large shard files, so that
+reading a batch does not require one file open per image. Each record consists of the encoded image and an
+optional annotation blob. The records are located using an index, which is a :class:`ColumnarStore` with
+one sample per record and the columns listed in :data:`PACKED_RECORD_INDEX_COLUMNS`.
+
+The records can be read inside the pipeline with :func:`packed_record_reader` (or the
+:class:`~accvlab.dali_pipeline_framework.processing_steps.PackedImageRecordLoader` step), or on the CPU with
+:class:`PackedImageRecords`.
+
+The module can also be run as a packing tool::
+
+    python -m accvlab.dali_pipeline_framework.inputs.packed_image_records \\
+        --file-root <dataset_root> --file-list <list_of_image_files.txt> --output-dir <output_dir>
+'''
+
+import argparse
+import os
+from concurrent.futures import ThreadPoolExecutor
+from typing import Dict, Optional, Sequence
+
+import numpy as np
+
+from .columnar_store import ColumnarStore, write_columnar_store
+
+#: Columns of the record index (all except ``shard`` are ``uint64`` byte offsets/sizes)
+PACKED_RECORD_INDEX_COLUMNS = ('shard', 'offset', 'size', 'annotation_offset', 'annotation_size')
+
+#: File name of the record index inside the output directory of :func:`pack_image_records`
+PACKED_RECORD_INDEX_FILE = 'records_index.acs'
+
+_SHARD_FILE_PATTERN = 'records_{:05d}.bin'
+
+
+class _ShardWriter:
+    '''Writes records to consecutive shard files, starting a new shard when the maximum size is exceeded.'''
+
+    def __init__(self, output_dir: str, max_shard_size: int):
+        self._output_dir = output_dir
+        self._max_shard_size = max_shard_size
+        self._file = None
+        self._name = None
+        self._num_shards = 0
+        self._position = 0
+
+    def __enter__(self):
+        return self
+
+    def __exit__(self, *args):
+        if self._file is not None:
+            self._file.close()
+
+    def write(self, data: bytes, annotation: Optional[bytes]):
+        '''Write a record, returning the name of the shard and the offset of the record in the shard.'''
+        record_size = len(data) + (len(annotation) if annotation else 0)
+        if self._file is None or (self._position > 0 and self._position + record_size > self._max_shard_size):
+            if self._file is not None:
+                self._file.close()
+            self._name = _SHARD_FILE_PATTERN.format(self._num_shards)
+            self._file = open(os.path.join(self._output_dir, self._name), "wb")
+            self._num_shards += 1
+            self._position = 0
+        offset = self._position
+        self._file.write(data)
+        if annotation:
+            self._file.write(annotation)
+        self._position += record_size
+        return self._name, offset
+
+
+def pack_image_records(
+    output_dir: str,
+    files: Sequence[str],
+    keys: Optional[Sequence[str]] = None,
+    annotations: Optional[Sequence[Optional[bytes]]] = None,
+    file_root: str = "",
+    max_shard_size: int = 1 << 30,
+    num_threads: int = 8,
+) -> str:
+    '''Pack (encoded) image files into record shards.
+
+    The records are written in the given order. Records which are typically read together (e.g. the images
+    of all cameras of a sample, and consecutive samples of a sequence) should therefore be adjacent, so that
+    their reads can be coalesced.
+
+    The index is written last (see :func:`write_columnar_store`), so an interrupted packing run never leaves
+    a valid index referring to incomplete shards.
+
+    Args:
+        output_dir: Output directory for the shard files and the index (:data:`PACKED_RECORD_INDEX_FILE`).
+        files: Image files to pack (one record per file). The content is stored as is (i.e. still encoded).
+        keys: Unique key per record, for :meth:`PackedImageRecords.index_of`. If not set, ``files`` is used.
+        annotations: Optional annotation blob per record (``None`` for records without annotation).
+        file_root: Directory prepended to relative paths in ``files``.
+        max_shard_size: Size (in bytes) after which a new shard file is started.
+        num_threads: Number of threads used to read the input files.
+
+    Returns:
+        Path of the written index.
+    '''
+    files = list(files)
+    keys = list(files) if keys is None else list(keys)
+    if len(keys) != len(files):
+        raise ValueError("`keys` has to contain one key per file")
+    if annotations is not None and len(annotations) != len(files):
+        raise ValueError("`annotations` has to contain one entry per file")
+    os.makedirs(output_dir, exist_ok=True)
+
+    def read_file(file: str) -> bytes:
+        path = file if not file_root or os.path.isabs(file) else os.path.join(file_root, file)
+        with open(path, "rb") as f:
+            return f.read()
+
+    columns: Dict[str, list] = {name: [] for name in PACKED_RECORD_INDEX_COLUMNS}
+    with _ShardWriter(output_dir, max_shard_size) as writer, ThreadPoolExecutor(num_threads) as executor:
+        # Read in chunks, so that only a bounded number of images is held in memory
+        chunk_size = 16 * num_threads
+        for begin in range(0, len(files), chunk_size):
+            chunk = files[begin : begin + chunk_size]
+            for i, data in enumerate(executor.map(read_file, chunk), begin):
+                annotation = annotations[i] if annotations is not None else None
+                shard_name, offset = writer.write(data, annotation)
+                columns['shard'].append(shard_name)
+                columns['offset'].append(offset)
+                columns['size'].append(len(data))
+                columns['annotation_offset'].append(offset + len(data) if annotation else 0)
+                columns['annotation_size'].append(len(annotation) if annotation else 0)
+
+    index_columns = {
+        name: (values if name == 'shard' else np.array(values, dtype=np.uint64))
+        for name, values in columns.items()
+    }
+    index_path = os.path.join(output_dir, PACKED_RECORD_INDEX_FILE)
+    write_columnar_store(index_path, index_columns, sample_keys=keys)
+    return index_path
+
+
+class PackedImageRecords:
+    '''CPU reader of packed image records (written with :func:`pack_image_records`).
+
+    Shard files are memory-mapped when first accessed, so reading a record does not open a file. Pickling an
+    instance only transfers the path of the index.
+
+    Note:
+        Inside the pipeline, use :func:`packed_record_reader` instead, which reads the records of a whole
+        batch with coalesced reads on the thread pool of the pipeline.
+    '''
+
+    def __init__(self, index_file: str):
+        '''
+        Args:
+            index_file: Record index (:data:`PACKED_RECORD_INDEX_FILE` in the output directory of
+                :func:`pack_image_records`).
+        '''
+        self._index_file = index_file
+        self._index = ColumnarStore(index_file)
+        missing = [name for name in PACKED_RECORD_INDEX_COLUMNS if name not in self._index]
+        if missing:
+            raise ValueError(f"'{index_file}' is not a packed record index (missing columns: {missing})")
+        self._shard_dir = os.path.dirname(os.path.abspath(index_file))
+        self._shards = {}
+
+    def __getstate__(self):
+        return {"index_file": self._index_file}
+
+    def __setstate__(self, state):
+        self.__init__(state["index_file"])
+
+    def __len__(self) -> int:
+        return len(self._index)
+
+    @property
+    def index_file(self) -> str:
+        '''Record index file.'''
+        return self._index_file
+
+    def index_of(self, key: str) -> int:
+        '''Get the index of the record with the given key (see ``keys`` of :func:`pack_image_records`).
+
+        Raises:
+            KeyError: If there is no record with the given key.
+        '''
+        return self._index.index_of(key)
+
+    def _read_range(self, record_index: int, offset_column: str, size_column: str) -> np.ndarray:
+        shard_name = self._index.get('shard', record_index)
+        shard = self._shards.get(shard_name)
+        if shard is None:
+            shard = np.memmap(os.path.join(self._shard_dir, shard_name), dtype=np.uint8, mode="r")
+            self._shards[shard_name] = shard
+        offset = int(self._index.get(offset_column, record_index))
+        size = int(self._index.get(size_column, record_index))
+        return np.array(shard[offset : offset + size])
+
+    def read(self, record_index: int) -> np.ndarray:
+        '''Read the encoded image of a record (as ``uint8`` array).'''
+        return self._read_range(record_index, 'offset', 'size')
+
+    def read_annotation(self, record_index: int) -> np.ndarray:
+        '''Read the annotation blob of a record (as ``uint8`` array, empty if there is no annotation).'''
+        return self._read_range(record_index, 'annotation_offset', 'annotation_size')
+
+
+def _main():
+    parser = argparse.ArgumentParser(description="Pack image files into record shards")
+    parser.add_argument("--file-list", required=True, help="Text file with one image file per line")
+    parser.add_argument("--file-root", default="", help="Directory prepended to relative image paths")
+    parser.add_argument("--output-dir", required=True, help="Output directory for the shards and the index")
+    parser.add_argument("--max-shard-size-mb", type=int, default=1024, help="Maximum size of a shard file")
+    parser.add_argument("--num-threads", type=int, default=8, help="Number of threads reading the images")
+    args = parser.parse_args()
+
+    with open(args.file_list) as f:
+        files = [line.strip() for line in f if line.strip()]
+    index_path = pack_image_records(
+        args.output_dir,
+        files,
+        file_root=args.file_root,
+        max_shard_size=args.max_shard_size_mb << 20,
+        num_threads=args.num_threads,
+    )
+    print(f"Packed {len(files)} records; index: {index_path}")
+
+
+if __name__ == "__main__":
+    _main()
@@ -0,0 +1,91 @@
+# Copyright (c) 2025, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+import os
+from typing import List, Optional, Tuple, Union
+
+import nvidia.dali.fn as fn
+from nvidia.dali.pipeline import DataNode
+
+_custom_operator_loaded = False
+
+
+def _load_custom_operator():
+    global _custom_operator_loaded
+    if _custom_operator_loaded:
+        return
+    import nvidia.dali.plugin_manager as plugin_manager
+
+    parent_dir = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+    plugin_manager.load_library(os.path.join(parent_dir, "lib_packed_record_reader.so"), global_symbols=True)
+    _custom_operator_loaded = True
+
+
+def packed_record_reader(
+    *record_indices: DataNode,
+    index_file: str,
+    read_annotations: bool = False,
+    max_gap: int = 64 << 10,
+    max_read_size: int = 16 << 20,
+    read_ahead: int = 4 << 20,
+) -> Union[List[DataNode], Tuple[List[DataNode], List[DataNode]]]:
+    '''Read packed image records by index inside a DALI pipeline (CPU operator).
+
+    The records are written with :func:`pack_image_records`.
+
+    Each input contains one record index (``int64`` scalar) per sample, e.g. one input per camera. The records
+    of all inputs and samples of a batch are read together: the reads are sorted by shard and offset, and
+    records which are close to each other in a shard (at most ``max_gap`` bytes apart) are read with a single
+    read. The reads are performed on the thread pool of the pipeline, using file descriptors which are opened
+    once per shard. With each batch, the read-ahead of the region following the last read record of each
+    shard is requested, so that sequential access patterns are served from the page cache.
+
+    The outputs contain the encoded images (``uint8``), i.e. they can be used in the same way as image files
+    read in an input callable (e.g. decoded by the
+    :class:`~accvlab.dali_pipeline_framework.processing_steps.ImageDecoder` step).
+
+    Note:
+        Must be called inside a pipeline definition.
+
+    Args:
+        record_indices: Record indices (one input per image to read per sample).
+        index_file: Record index (as returned by :func:`pack_image_records`).
+        read_annotations: Whether to also output the annotation blobs of the records.
+        max_gap: Maximum gap (in bytes) between records to read them with a single read.
+        max_read_size: Maximum size (in bytes) of a single (coalesced) read.
+        read_ahead: Size (in bytes) of the region to request read-ahead for per shard (``0`` to disable).
+
+    Returns:
+        List of encoded images (one per input). If ``read_annotations`` is set, tuple of the list of images
+        and the list of annotation blobs (``uint8``, empty for records without annotation).
+    '''
+    if len(record_indices) == 0:
+        raise ValueError("At least one input with record indices is needed")
+    _load_custom_operator()
+
+    outputs = fn.packed_record_reader(
+        *record_indices,
+        index_file=index_file,
+        read_annotations=read_annotations,
+        max_gap=max_gap,
+        max_read_size=max_read_size,
+        read_ahead=read_ahead,
+    )
+    if not isinstance(outputs, (list, tuple)):
+        outputs = [outputs]
+    num_inputs = len(record_indices)
+    images = list(outputs[:num_inputs])
+    if read_annotations:
+        return images, list(outputs[num_inputs:])
+    return images
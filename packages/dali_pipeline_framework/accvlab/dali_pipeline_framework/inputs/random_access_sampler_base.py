@@ -0,0 +1,97 @@
+# Copyright (c) 2025, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+from abc import abstractmethod
+from typing import List, Optional
+
+try:
+    from typing import override
+except ImportError:
+    from typing_extensions import override
+
+from .sampler_base import SamplerBase
+
+
+class RandomAccessSamplerBase(SamplerBase):
+    '''Base class for samplers which can compute any batch directly from its position.
+
+    In contrast to general samplers (see :class:`SamplerBase`), which provide the batches one after another,
+    a random-access sampler computes the indices of batch ``batch_idx`` of epoch ``epoch_idx`` directly (see
+    :meth:`get_batch_indices`), without generating the preceding batches. This allows
+    :class:`SamplerInputCallable` to obtain the batches on demand (see :class:`BatchIndexGenerator`) instead
+    of keeping a window of the most recent batches.
+
+    The sequential interface of :class:`SamplerBase` is implemented on top of :meth:`get_batch_indices`, so
+    that random-access samplers can also be used with :class:`SamplerInputIterable`.
+
+    Note:
+        Derived classes need to call the constructor of this class.
+    '''
+
+    def __init__(self):
+        self._curr_epoch = 0
+        self._curr_batch = 0
+
+    @abstractmethod
+    def get_batch_indices(self, epoch_idx: int, batch_idx: int) -> List[int]:
+        '''Get the indices of the samples of a batch.
+
+        Has to be deterministic, i.e. return the same indices for the same position whenever it is called.
+
+        Args:
+            epoch_idx: Index of the epoch (``0`` for samplers which are not epoch-based).
+            batch_idx: Index of the batch inside the epoch (in ``[0, get_num_batches(epoch_idx))``).
+
+        Returns:
+            List of sample indices of the batch.
+        '''
+        pass
+
+    @abstractmethod
+    def get_num_batches(self, epoch_idx: int) -> Optional[int]:
+        '''Get the number of batches of an epoch.
+
+        Args:
+            epoch_idx: Index of the epoch.
+
+        Returns:
+            Number of batches of the epoch, or ``None`` if the sampler is not epoch-based (i.e. the batches
+            continue indefinitely).
+        '''
+        pass
+
+    @override
+    def get_next_batch_indices(self) -> List[int]:
+        num_batches = self.get_num_batches(self._curr_epoch)
+        if num_batches is not None and self._curr_batch >= num_batches:
+            raise StopIteration
+        res = self.get_batch_indices(self._curr_epoch, self._curr_batch)
+        self._curr_batch += 1
+        return res
+
+    @property
+    @override
+    def is_epoch_based(self) -> bool:
+        return self.get_num_batches(0) is not None
+
+    @override
+    def reset(self):
+        self._curr_epoch += 1
+        self._curr_batch = 0
+
+    @property
+    @override
+    def length(self) -> Optional[int]:
+        '''Number of batches in the first epoch (``None`` if the sampler is not epoch-based).'''
+        return self.get_num_batches(0)
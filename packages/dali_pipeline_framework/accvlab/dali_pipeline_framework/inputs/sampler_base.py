@@ -47,11 +47,17 @@ class SamplerBase(ABC):
         first time. At this point, the iterable is already in the worker process, and therefore, the sampler
         does not need to be serializable anymore.
 
-        Note that the :class:`SamplerInputCallable` does not require the sampler to be serializable as
-        it is only used to generate the look-up table in advance. However, it is advisable to keep sampler
-        objects compatible with both :class:`SamplerInputIterable` and :class:`SamplerInputCallable`, and
-        therefore, to not create non-serializable objects before the first call to
-        :meth:`get_next_batch_indices`.
+        The same applies to :class:`SamplerInputCallable`, which copies the sampler to the worker
+        processes and advances the copies there (see :class:`BatchIndexGenerator`). Samplers which can
+        compute each batch directly from its position should derive from :class:`RandomAccessSamplerBase`
+        instead, in which case no copies are advanced.
+
+    Important:
+        When used with :class:`SamplerInputCallable`, the sampler needs to be deterministic: every copy of
+        the sampler needs to provide the same sequence of batches, as each worker process (and each replay,
+        e.g. when resuming) obtains the batches from its own copy. Random generators therefore need to be
+        seeded (with the same seed in all copies), also if they are created lazily. Otherwise, different
+        workers would use different batches.
     '''
 
     @abstractmethod
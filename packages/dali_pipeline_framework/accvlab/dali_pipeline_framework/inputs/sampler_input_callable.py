@@ -12,7 +12,7 @@
 # See the License for the specific language governing permissions and
 # limitations under the License.
 
-from typing import Optional
+from typing import Dict, Optional
 
 from nvidia.dali import types
 
@@ -20,6 +20,7 @@ from ..pipeline import SampleDataGroup
 
 from .callable_base import CallableBase
 from .sampler_base import SamplerBase
+from .batch_index_generator import BatchIndexGenerator
 from .data_provider import DataProvider
 
 try:
@@ -35,34 +36,54 @@ class SamplerInputCallable(CallableBase):
     Information on when an epoch ends is obtained from the sampler (which in turn should indicate this
     by raising :class:`StopIteration`, see documentation of :class:`SamplerBase`).
 
-    As the sampler can have an internal state (while the callable is expected to be stateless), a look-up
-    table is pre-generated at construction, leading to overhead and the need to know the maximum number of
-    iterations in advance.
+    As the sampler can have an internal state (while the callable is expected to be stateless), the batches
+    are obtained by position using a :class:`BatchIndexGenerator`. For random-access samplers (see
+    :class:`RandomAccessSamplerBase`, e.g. :class:`ShuffledBatchSampler`), each batch is computed directly
+    from its position. For other samplers, a bounded window of the most recent batches is kept.
+
+    The position of the next batch can be obtained as a resume state (see :meth:`get_resume_state`), which
+    allows to continue a run after a restart with the exact same batches.
 
     Note:
-        To avoid the overhead of pre-generating the look-up table, it is recommended to only use this class
-        if a single process for data loading is not enough and prefer
-        :class:`~accvlab.dali_pipeline_framework.inputs.SamplerInputIterable` in general.
+        For samplers which are not random-access, it is recommended to only use this class if a single
+        process for data loading is not enough and prefer
+        :class:`~accvlab.dali_pipeline_framework.inputs.SamplerInputIterable` in general, as each worker
+        process advances its own copy of the sampler.
+
+    Important:
+        For samplers which are not random-access, each worker process advances its own copy of the sampler,
+        so the sampler needs to be deterministic (e.g. seed random generators, also if they are created
+        lazily). Otherwise, the workers would provide samples from different batches. The first batch of two
+        copies is compared at construction, and a :exc:`ValueError` is raised if they differ.
     '''
 
     def __init__(
         self,
         data_provider: DataProvider,
         sampler: SamplerBase,
-        max_num_iterations: int,
-        pre_fetch_queue_length: int,
+        max_num_iterations: Optional[int] = None,
+        pre_fetch_queue_length: Optional[int] = None,
         shard_id: int = 0,
         num_shards: int = 1,
+        look_ahead_window: int = 64,
+        resume_state: Optional[Dict[str, int]] = None,
     ):
         '''
         Args:
             data_provider: Data provider to use (following the interface defined in :class:`DataProvider`).
             sampler: Sampler to use (following the interface defined in :class:`SamplerBase`).
-            max_num_iterations: Maximum number of iterations that will be performed.
-            pre_fetch_queue_length: Length of the pre-fetch queue depth of the DALI pipeline using this input callable. Used together with ``max_num_iterations`` to ensure that
-                the sampling look-up table is large enough.
+            max_num_iterations: Maximum number of iterations that will be performed. Only used to define
+                the :attr:`length` if the sampler is not epoch-based.
+            pre_fetch_queue_length: Length of the pre-fetch queue depth of the DALI pipeline using this input
+                callable. Only used together with ``max_num_iterations`` to define the :attr:`length` if the
+                sampler is not epoch-based.
             shard_id: Shard ID (default value of 0 should be used if sharding is not used)
             num_shards: Total of shards (default value of 1 should be used if sharding is not used)
+            look_ahead_window: Number of most recent batches to keep if the sampler is not random-access
+                (see :class:`BatchIndexGenerator`). Should cover the batches which are processed concurrently
+                (pre-fetch queue and parallel workers).
+            resume_state: State as returned by :meth:`get_resume_state` to resume from. If ``None``, the
+                batches are provided from the start.
         '''
 
         self._data_provider = data_provider
@@ -71,24 +92,13 @@ class SamplerInputCallable(CallableBase):
         self._num_shards = num_shards
         self._max_num_iterations = max_num_iterations
         self._pre_fetch_queue_length = pre_fetch_queue_length
-        self._max_num_iterations_inc_queue = max_num_iterations + pre_fetch_queue_length
-
-        self._look_up_table = []
-
-        i = 0
-        curr_epoch_look_up_table = []
-        while i < self._max_num_iterations_inc_queue:
-            try:
-                batch = sampler.get_next_batch_indices()
-                curr_epoch_look_up_table.append(batch)
-                i += 1
-            except StopIteration:
-                self._look_up_table.append(curr_epoch_look_up_table)
-                curr_epoch_look_up_table = []
-                sampler.reset()
-        self._look_up_table.append(curr_epoch_look_up_table)
-
-        self._total_batch_size = len(self._look_up_table[0][0])
+
+        self._batch_index_generator = BatchIndexGenerator(sampler, look_ahead_window, resume_state)
+
+        first_batch = self._batch_index_generator.get_batch(0, 0)
+        if first_batch is None:
+            raise ValueError("The sampler does not provide any batches (starting from the resume state)")
+        self._total_batch_size = len(first_batch)
         self._local_batch_size = self._total_batch_size // num_shards
 
         assert (
@@ -110,20 +120,11 @@ class SamplerInputCallable(CallableBase):
         batch_idx = sample_info.idx_in_epoch // self._local_batch_size
         idx_in_local_batch = sample_info.idx_in_batch
 
-        if epoch_idx >= len(self._look_up_table):
-            raise RuntimeError(
-                f"Maximum iteration number or pre-fetch queue length exceeded. SamplerInputCallable can only be used for the maximum number of iterations defined at construction\n"
-                + f"({self._max_num_iterations} in this case) and a maximum pre-fetch queue depth defined at construction ({self._pre_fetch_queue_length} in this case). These two values\n"
-                + f"define the total maximum number of batches which the callable can provide ({self._max_num_iterations_inc_queue} in this case)."
-            )
+        batch_of_indices = self._batch_index_generator.get_batch(epoch_idx, batch_idx)
 
-        epoch_size = len(self._look_up_table[epoch_idx])
-
-        if batch_idx >= epoch_size:
+        if batch_of_indices is None:
             raise StopIteration
 
-        batch_of_indices = self._look_up_table[epoch_idx][batch_idx]
-
         idx_in_full_batch = idx_in_local_batch + self._shard_id * self._local_batch_size
 
         index_to_use = batch_of_indices[idx_in_full_batch]
@@ -132,13 +133,30 @@ class SamplerInputCallable(CallableBase):
 
         return sample_data.get_data()
 
+    def get_resume_state(self, epoch_idx: int, batch_idx: int) -> Dict[str, int]:
+        '''Get the state to resume from a position (e.g. to store it in a training checkpoint).
+
+        Args:
+            epoch_idx: Index of the epoch of the next batch to process (as counted by DALI, i.e. relative to
+                the resume state used at construction).
+            batch_idx: Index of the next batch to process inside the epoch.
+
+        Returns:
+            State to pass as ``resume_state`` to the constructor to continue with the next batch.
+        '''
+        return self._batch_index_generator.get_resume_state(epoch_idx, batch_idx)
+
     @property
     @override
     def length(self) -> Optional[int]:
         '''Number of batches in one epoch.
 
         If the underlying sampler is not epoch-based, the length is the overall number of batches
-        that can be generated (i.e. the maximum number of iterations defined at construction plus
-        the pre-fetch queue length).
+        that is expected to be used (i.e. the maximum number of iterations defined at construction plus
+        the pre-fetch queue length), or ``None`` if the maximum number of iterations is not set.
         '''
-        return len(self._look_up_table[0])
+        if self._batch_index_generator.is_epoch_based:
+            return self._batch_index_generator.get_num_batches(0)
+        if self._max_num_iterations is None:
+            return None
+        return self._max_num_iterations + (self._pre_fetch_queue_length or 0)
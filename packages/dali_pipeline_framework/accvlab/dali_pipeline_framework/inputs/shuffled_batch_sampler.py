@@ -0,0 +1,136 @@
+# Copyright (c) 2025, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+from typing import List, Optional
+
+import numpy as np
+
+try:
+    from typing import override
+except ImportError:
+    from typing_extensions import override
+
+from .random_access_sampler_base import RandomAccessSamplerBase
+
+_MASK_64 = (1 << 64) - 1
+_GOLDEN_GAMMA = 0x9E3779B97F4A7C15
+_NUM_FEISTEL_ROUNDS = 4
+
+
+def _mix_64(value: int) -> int:
+    '''SplitMix64 finalizer (for Python ints).'''
+    value &= _MASK_64
+    value = ((value ^ (value >> 30)) * 0xBF58476D1CE4E5B9) & _MASK_64
+    value = ((value ^ (value >> 27)) * 0x94D049BB133111EB) & _MASK_64
+    return value ^ (value >> 31)
+
+
+def _mix_64_array(values: np.ndarray) -> np.ndarray:
+    '''SplitMix64 finalizer (element-wise for ``uint64`` arrays, wrapping on overflow).'''
+    values = (values ^ (values >> np.uint64(30))) * np.uint64(0xBF58476D1CE4E5B9)
+    values = (values ^ (values >> np.uint64(27))) * np.uint64(0x94D049BB133111EB)
+    return values ^ (values >> np.uint64(31))
+
+
+class _KeyedPermutation:
+    '''Pseudo-random permutation of ``[0, size)``, evaluated element-wise without materializing it.
+
+    A balanced Feistel network on the smallest power-of-4 domain containing ``[0, size)`` (i.e. less than
+    ``4 * size`` values) is a bijection of that domain. Values outside of ``[0, size)`` are mapped again
+    until they fall into the range ("cycle walking"), which preserves the bijection.
+    '''
+
+    def __init__(self, size: int, key: int):
+        self._size = size
+        num_bits = max(2, (size - 1).bit_length())
+        self._half_bits = np.uint64((num_bits + 1) // 2)
+        self._half_mask = np.uint64((1 << int(self._half_bits)) - 1)
+        self._round_keys = [
+            np.uint64(_mix_64(key + (r + 1) * _GOLDEN_GAMMA)) for r in range(_NUM_FEISTEL_ROUNDS)
+        ]
+
+    def _encrypt(self, values: np.ndarray) -> np.ndarray:
+        left = values >> self._half_bits
+        right = values & self._half_mask
+        for round_key in self._round_keys:
+            left, right = right, left ^ (_mix_64_array(right ^ round_key) & self._half_mask)
+        return (left << self._half_bits) | right
+
+    def __call__(self, positions: np.ndarray) -> np.ndarray:
+        values = self._encrypt(positions.astype(np.uint64))
+        outside = values >= np.uint64(self._size)
+        while np.any(outside):
+            values[outside] = self._encrypt(values[outside])
+            outside = values >= np.uint64(self._size)
+        return values.astype(np.int64)
+
+
+class ShuffledBatchSampler(RandomAccessSamplerBase):
+    '''Epoch-based sampler drawing each sample once per epoch in a shuffled order.
+
+    The shuffled order of each epoch is a pseudo-random permutation determined by ``(seed, epoch)``, which is
+    evaluated only for the positions of the requested batch (see :class:`RandomAccessSamplerBase`). This
+    means that batch ``k`` of epoch ``e`` is computed directly in ``O(batch_size)`` time and memory,
+    regardless of the dataset size and of ``k``.
+
+    Note:
+        If the number of samples is not divisible by the batch size, the incomplete batch at the end of each
+        epoch is dropped (as in :class:`ShuffledShardedInputCallable`). Note that the dropped samples differ
+        between epochs if shuffling is enabled.
+    '''
+
+    def __init__(self, num_samples: int, total_batch_size: int, seed: int = 21, shuffle: bool = True):
+        '''
+
+        Args:
+            num_samples: Number of samples in the dataset.
+            total_batch_size: Total batch size (i.e. the combined batch size over all shards if sharding is
+                used).
+            seed: Seed of the shuffling. If sharding is used, the samplers for all shards need to use the same
+                seed.
+            shuffle: Whether to shuffle the samples. If ``False``, the samples are used in order.
+        '''
+        super().__init__()
+        if total_batch_size <= 0 or num_samples < total_batch_size:
+            raise ValueError(
+                f"The number of samples ({num_samples}) has to be at least the batch size "
+                f"({total_batch_size})"
+            )
+        self._num_samples = num_samples
+        self._total_batch_size = total_batch_size
+        self._seed = seed
+        self._shuffle = shuffle
+        self._num_batches = num_samples // total_batch_size
+        # Permutation of the last used epoch (cheap to create, but typically used for many batches)
+        self._permutation = None
+        self._permutation_epoch = None
+
+    @override
+    def get_batch_indices(self, epoch_idx: int, batch_idx: int) -> List[int]:
+        if not 0 <= batch_idx < self._num_batches:
+            raise IndexError(f"Batch index {batch_idx} out of range [0, {self._num_batches})")
+        positions = np.arange(
+            batch_idx * self._total_batch_size, (batch_idx + 1) * self._total_batch_size, dtype=np.int64
+        )
+        if not self._shuffle:
+            return positions.tolist()
+        if self._permutation_epoch != epoch_idx:
+            key = _mix_64(_mix_64(self._seed) + epoch_idx * _GOLDEN_GAMMA)
+            self._permutation = _KeyedPermutation(self._num_samples, key)
+            self._permutation_epoch = epoch_idx
+        return self._permutation(positions).tolist()
+
+    @override
+    def get_num_batches(self, epoch_idx: int) -> Optional[int]:
+        return self._num_batches
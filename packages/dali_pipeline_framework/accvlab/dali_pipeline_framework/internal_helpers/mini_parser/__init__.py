@@ -23,6 +23,7 @@ processing step.
 
 from .ast import AST, Assignment, Literal, Variable, Comparison, Or, And, Not, UnaryMinus
 from .parser import Parser
+from .bytecode import OpCode, Bytecode, compile_to_bytecode
 from .lexer import Lexer, TokenType, Token
 
 __all__ = [
@@ -39,4 +40,7 @@ __all__ = [
     "Lexer",
     "TokenType",
     "Token",
+    "OpCode",
+    "Bytecode",
+    "compile_to_bytecode",
 ]
@@ -0,0 +1,142 @@
+# Copyright (c) 2025, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+from enum import IntEnum
+from typing import List, Tuple
+
+from . import ast
+
+
+class OpCode(IntEnum):
+    '''Op codes of the condition bytecode.
+
+    Note:
+        Has to match ``ConditionOpCode`` of the native ``condition_eval`` operator.
+    '''
+
+    LOAD_INPUT = 0
+    LOAD_CONST = 1
+    NEG = 2
+    NOT = 3
+    EQ = 4
+    NE = 5
+    LT = 6
+    GT = 7
+    LE = 8
+    GE = 9
+    AND = 10
+    OR = 11
+    TO_BOOL = 12
+
+
+_comparison_op_codes = {
+    "==": OpCode.EQ,
+    "!=": OpCode.NE,
+    "<": OpCode.LT,
+    ">": OpCode.GT,
+    "<=": OpCode.LE,
+    ">=": OpCode.GE,
+}
+
+
+class Bytecode:
+    '''Expression compiled to the bytecode of a stack machine.
+
+    The program is a sequence of ``(op_code, operand)`` instructions. ``LOAD_INPUT`` and ``LOAD_CONST`` push
+    the input (variable) / constant with the index given by the operand, all other instructions operate on
+    the top-most value(s) of the stack and ignore the operand.
+
+    Note:
+        The constructor parameters are also the attributes of the class.
+
+    Args:
+        program: Instructions as ``(op_code, operand)`` pairs.
+        constants: Constants referenced by ``LOAD_CONST``.
+        variable_names: Names of the variables referenced by ``LOAD_INPUT`` (in order of first use).
+    '''
+
+    def __init__(self, program: List[Tuple[OpCode, int]], constants: List[float], variable_names: List[str]):
+        self.program = program
+        self.constants = constants
+        self.variable_names = variable_names
+
+    @property
+    def flat_program(self) -> List[int]:
+        '''Program as flattened list of ints (as expected by the ``condition_eval`` operator).'''
+        return [int(value) for instruction in self.program for value in instruction]
+
+    def __str__(self):
+        lines = []
+        for op_code, operand in self.program:
+            if op_code == OpCode.LOAD_INPUT:
+                lines.append(f"{op_code.name} '{self.variable_names[operand]}'")
+            elif op_code == OpCode.LOAD_CONST:
+                lines.append(f"{op_code.name} {self.constants[operand]}")
+            else:
+                lines.append(op_code.name)
+        return "\n".join(lines)
+
+    def __repr__(self):
+        return self.__str__()
+
+
+def compile_to_bytecode(expression: ast.AST) -> Bytecode:
+    '''Compile an expression to :class:`Bytecode`.
+
+    The semantics correspond to the evaluation in
+    :class:`~accvlab.dali_pipeline_framework.processing_steps.AnnotationElementConditionEval`: operands of
+    comparisons are compared as float, ``and``, ``or`` & ``not`` treat non-zero values as ``True``.
+
+    Args:
+        expression: Expression to compile (e.g. the ``expression`` of the :class:`Assignment` obtained from
+            :class:`Parser`).
+
+    Returns:
+        Compiled expression.
+    '''
+    program = []
+    constants = []
+    variable_names = []
+
+    def emit(node: ast.AST):
+        if isinstance(node, ast.Variable):
+            if node.name not in variable_names:
+                variable_names.append(node.name)
+            program.append((OpCode.LOAD_INPUT, variable_names.index(node.name)))
+        elif isinstance(node, ast.Literal):
+            constants.append(float(node.value))
+            program.append((OpCode.LOAD_CONST, len(constants) - 1))
+        elif isinstance(node, ast.UnaryMinus):
+            emit(node.value)
+            program.append((OpCode.NEG, 0))
+        elif isinstance(node, ast.Not):
+            emit(node.condition)
+            program.append((OpCode.NOT, 0))
+        elif isinstance(node, ast.Comparison):
+            emit(node.val1)
+            emit(node.val2)
+            program.append((_comparison_op_codes[node.comparison_type], 0))
+        elif isinstance(node, (ast.And, ast.Or)):
+            op_code = OpCode.AND if isinstance(node, ast.And) else OpCode.OR
+            emit(node.conditions[0])
+            if len(node.conditions) == 1:
+                program.append((OpCode.TO_BOOL, 0))
+            for condition in node.conditions[1:]:
+                emit(condition)
+                program.append((op_code, 0))
+        else:
+            raise NotImplementedError(f"Condition type not supported: {type(node)}")
+
+    emit(expression)
+    return Bytecode(program, constants, variable_names)
@@ -0,0 +1,154 @@
+# Copyright (c) 2025, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+'''Attribution of the DALI operators created at graph construction time to the processing steps.
+
+While an :class:`OperatorTracker` is active (see :func:`track_operators`), each DALI data node created
+during graph construction is tagged with the path of the processing step inside which it is created (see
+:func:`step_scope`, which is entered by
+:meth:`~accvlab.dali_pipeline_framework.processing_steps.PipelineStepBase.__call__`). Paths consist of the
+index of the top-level step and the class names of the (nested) steps, e.g.
+``"2:DataGroupInPathAppliedStep/AffineTransformer"``. Nodes created outside of any step (e.g. the external
+source) have the path ``""``.
+
+If no tracker is active, :func:`step_scope` does nothing, so that the graph construction is not affected.
+'''
+
+from typing import Dict, List, Optional, Sequence
+
+from nvidia.dali.data_node import DataNode
+from nvidia.dali.pipeline import do_not_convert
+
+_active_tracker: Optional["OperatorTracker"] = None
+
+
+def get_operator_type(node: DataNode) -> str:
+    '''Get the type (schema name) of the operator producing a data node.'''
+    source = getattr(node, "source", None)
+    op = getattr(source, "_op", None)
+    if op is None:
+        return type(source).__name__
+    schema_name = getattr(op, "schema_name", None)
+    return schema_name if isinstance(schema_name, str) else type(op).__name__
+
+
+class OperatorTracker:
+    '''Collects the operators created while it is active, grouped by the path of the creating step.'''
+
+    def __init__(self):
+        self._path_stack: List[str] = []
+        self._num_top_level_steps = 0
+        # Operators (by id of the operator instance) per path, with the operator type
+        self._operators_per_path: Dict[str, Dict[int, str]] = {}
+        # Path of each created node (by id). The nodes are kept alive so that the ids are not reused.
+        self._node_paths: Dict[int, str] = {}
+        self._nodes: List[DataNode] = []
+        self.output_nodes: Optional[Sequence[DataNode]] = None
+
+    @property
+    def current_path(self) -> str:
+        return self._path_stack[-1] if self._path_stack else ""
+
+    @property
+    def operators_per_path(self) -> Dict[str, Dict[int, str]]:
+        '''Operator types (by id of the operator instance) created directly inside each step path.'''
+        return self._operators_per_path
+
+    def get_node_path(self, node: DataNode) -> Optional[str]:
+        '''Get the path of the step which created ``node`` (``None`` if not created while tracking).'''
+        return self._node_paths.get(id(node))
+
+    def enter_step(self, step):
+        name = type(step).__name__
+        if self._path_stack:
+            path = f"{self._path_stack[-1]}/{name}"
+        else:
+            path = f"{self._num_top_level_steps}:{name}"
+            self._num_top_level_steps += 1
+        self._path_stack.append(path)
+        self._operators_per_path.setdefault(path, {})
+
+    def exit_step(self):
+        self._path_stack.pop()
+
+    def on_node_created(self, node: DataNode):
+        path = self.current_path
+        self._nodes.append(node)
+        self._node_paths[id(node)] = path
+        source = getattr(node, "source", None)
+        if source is not None:
+            self._operators_per_path.setdefault(path, {})[id(source)] = get_operator_type(node)
+
+
+class _StepScope:
+    def __init__(self, step):
+        self._step = step
+
+    def __enter__(self):
+        if _active_tracker is not None:
+            _active_tracker.enter_step(self._step)
+        return self
+
+    def __exit__(self, exc_type, exc_value, traceback):
+        if _active_tracker is not None:
+            _active_tracker.exit_step()
+        return False
+
+
+@do_not_convert
+def step_scope(step) -> _StepScope:
+    '''Context in which the operators created are attributed to ``step`` (if a tracker is active).'''
+    return _StepScope(step)
+
+
+@do_not_convert
+def record_output_nodes(output_nodes: Sequence[DataNode]):
+    '''Record the (flat) output nodes of the pipeline in the active tracker (if any).'''
+    if _active_tracker is not None:
+        _active_tracker.output_nodes = list(output_nodes)
+
+
+class track_operators:
+    '''Context manager activating an :class:`OperatorTracker` for the graph construction inside the context.
+
+    Example:
+
+        .. code-block:: python
+
+            with track_operators() as tracker:
+                pipe = pipeline_definition.get_dali_pipeline(...)
+            print(tracker.operators_per_path)
+    '''
+
+    def __enter__(self) -> OperatorTracker:
+        global _active_tracker
+        if _active_tracker is not None:
+            raise RuntimeError("Operator tracking is already active")
+        tracker = OperatorTracker()
+        self._original_init = DataNode.__init__
+        original_init = self._original_init
+
+        def tracking_init(node, *args, **kwargs):
+            original_init(node, *args, **kwargs)
+            tracker.on_node_created(node)
+
+        DataNode.__init__ = tracking_init
+        _active_tracker = tracker
+        return tracker
+
+    def __exit__(self, exc_type, exc_value, traceback):
+        global _active_tracker
+        DataNode.__init__ = self._original_init
+        _active_tracker = None
+        return False
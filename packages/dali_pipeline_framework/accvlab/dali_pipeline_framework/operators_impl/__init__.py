@@ -18,9 +18,11 @@ Operators and utilities for use inside DALI pipelines.
 This module contains:
   - Functions to be used inside Python operators
   - Numba operators which can be used directly (including the needed Numba functions and the wrapping as a Numba operator)
+  - Counter-based random parameters, drawn as one record per sample by a native operator
 '''
 
 from . import numba_operators
 from . import python_operator_functions
+from . import random_parameters
 
-__all__ = ["numba_operators", "python_operator_functions"]
+__all__ = ["numba_operators", "python_operator_functions", "random_parameters"]
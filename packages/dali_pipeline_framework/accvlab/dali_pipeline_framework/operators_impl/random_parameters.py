@@ -0,0 +1,241 @@
+# Copyright (c) 2025, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+'''
+Counter-based random parameters, drawn as one record per sample by a native operator.
+
+In contrast to drawing each parameter with an individual ``fn.random.*`` operator, each value is a pure
+function of (seed, epoch, sample index, parameter id) (Philox4x32-10 generator). This means that the values
+are reproducible regardless of the order in which the operators of the pipeline are created, the other
+parameters in the record, the batch composition, and the number of threads. A NumPy implementation
+(:func:`draw_random_parameters_reference`) produces bit-identical records, e.g. to check or replay the
+parameters used for a given sample outside of the pipeline.
+'''
+
+import os
+import zlib
+from dataclasses import dataclass
+from enum import IntEnum
+from typing import Dict, Optional, Sequence, Union
+
+import numpy as np
+
+import nvidia.dali.fn as fn
+import nvidia.dali.types as types
+from nvidia.dali.pipeline import DataNode
+
+_custom_operator_loaded = False
+
+
+def _load_custom_operator():
+    global _custom_operator_loaded
+    if _custom_operator_loaded:
+        return
+    import nvidia.dali.plugin_manager as plugin_manager
+
+    parent_dir = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+    plugin_manager.load_library(os.path.join(parent_dir, "lib_random_parameters.so"), global_symbols=True)
+    _custom_operator_loaded = True
+
+
+class RandomParameterKind(IntEnum):
+    '''Kind of a random parameter. Has to match ``RandomParameterKind`` of the native operator.'''
+
+    UNIFORM = 0
+    BERNOULLI = 1
+    INTEGER = 2
+
+
+@dataclass(frozen=True)
+class RandomParameter:
+    '''Description of a random parameter.
+
+    Use :meth:`uniform`, :meth:`bernoulli` or :meth:`integer` to create instances.
+
+    The id of the parameter (part of the counter of the generator) is derived from its name. Therefore, the
+    value of a parameter only changes if its name, its range or the seed changes.
+    '''
+
+    name: str
+    kind: RandomParameterKind
+    low: float
+    high: float
+
+    @staticmethod
+    def uniform(name: str, low: float, high: float) -> "RandomParameter":
+        '''Float parameter, uniformly distributed in ``[low, high)`` (``low`` if ``low == high``).'''
+        if low > high:
+            raise ValueError(f"Parameter '{name}': low ({low}) has to be less than or equal to high ({high})")
+        return RandomParameter(name, RandomParameterKind.UNIFORM, float(low), float(high))
+
+    @staticmethod
+    def bernoulli(name: str, probability: float) -> "RandomParameter":
+        '''Boolean parameter, ``True`` with the given probability.'''
+        if not 0.0 <= probability <= 1.0:
+            raise ValueError(f"Parameter '{name}': probability ({probability}) not in [0, 1]")
+        return RandomParameter(name, RandomParameterKind.BERNOULLI, float(probability), 0.0)
+
+    @staticmethod
+    def integer(name: str, low: int, high: int) -> "RandomParameter":
+        '''Integer parameter, uniformly distributed in ``[low, high]`` (both inclusive).'''
+        is_integral = int(low) == low and int(high) == high
+        if not is_integral or low > high or max(abs(low), abs(high)) > (1 << 24):
+            raise ValueError(
+                f"Parameter '{name}': integer range has to be given by integral values with low <= high "
+                f"(and absolute values of at most 2^24); got [{low}, {high}]"
+            )
+        return RandomParameter(name, RandomParameterKind.INTEGER, float(low), float(high))
+
+    @property
+    def id(self) -> int:
+        '''Id of the parameter (derived from the name).'''
+        return zlib.crc32(self.name.encode()) & 0x7FFFFFFF
+
+
+def _check_parameters(parameters: Sequence[RandomParameter]):
+    if len(parameters) == 0:
+        raise ValueError("At least one parameter has to be defined")
+    ids = {}
+    for p in parameters:
+        if p.id in ids:
+            raise ValueError(
+                f"Parameters '{ids[p.id]}' and '{p.name}' have the same name or the same id; use unique names"
+            )
+        ids[p.id] = p.name
+
+
+def random_parameters(
+    parameters: Sequence[RandomParameter],
+    seed: int,
+    sample_position: Optional[DataNode] = None,
+) -> Dict[str, DataNode]:
+    '''Draw all parameters for each sample with a single operator.
+
+    Args:
+        parameters: Parameters to draw.
+        seed: Seed of the generator.
+        sample_position: Position of each sample (``INT64`` or ``INT32``), either the sample index (1 element)
+            or (epoch, sample index) (2 elements). If not set, the samples are numbered consecutively in the
+            order in which they are processed (epoch 0), i.e. the values are reproducible for the same seed
+            and the same sequence of samples.
+
+    Returns:
+        Dictionary mapping the parameter names to the drawn values (scalars): ``FLOAT`` for uniform
+        parameters, ``BOOL`` for Bernoulli parameters and ``INT32`` for integer parameters.
+    '''
+    _check_parameters(parameters)
+    _load_custom_operator()
+
+    inputs = [] if sample_position is None else [sample_position]
+    record = fn.random_parameters(
+        *inputs,
+        key=seed,
+        kinds=[int(p.kind) for p in parameters],
+        ids=[p.id for p in parameters],
+        lows=[p.low for p in parameters],
+        highs=[p.high for p in parameters],
+    )
+
+    res = {}
+    for i, p in enumerate(parameters):
+        value = record[i]
+        if p.kind == RandomParameterKind.BERNOULLI:
+            value = value != 0.0
+        elif p.kind == RandomParameterKind.INTEGER:
+            value = fn.cast(value, dtype=types.DALIDataType.INT32)
+        res[p.name] = value
+    return res
+
+
+_PHILOX_MULTIPLIERS = (np.uint64(0xD2511F53), np.uint64(0xCD9E8D57))
+_PHILOX_WEYL = (0x9E3779B9, 0xBB67AE85)
+_MASK_32 = np.uint64(0xFFFFFFFF)
+
+
+def philox4x32_10(counter: np.ndarray, key: Sequence[int]) -> np.ndarray:
+    '''Philox4x32-10 generator (as used by the native operator).
+
+    Args:
+        counter: Counters, array of shape ``(..., 4)`` with values in ``[0, 2^32)``.
+        key: Key as 2 values in ``[0, 2^32)``.
+
+    Returns:
+        Random values as ``uint32`` array of the same shape as ``counter``.
+    '''
+    counter = np.asarray(counter, dtype=np.uint64)
+    c = [counter[..., i] for i in range(4)]
+    k = [int(key[0]), int(key[1])]
+    for _ in range(10):
+        product_0 = _PHILOX_MULTIPLIERS[0] * c[0]
+        product_1 = _PHILOX_MULTIPLIERS[1] * c[2]
+        c = [
+            (product_1 >> np.uint64(32)) ^ c[1] ^ np.uint64(k[0]),
+            product_1 & _MASK_32,
+            (product_0 >> np.uint64(32)) ^ c[3] ^ np.uint64(k[1]),
+            product_0 & _MASK_32,
+        ]
+        k = [(k[0] + _PHILOX_WEYL[0]) & 0xFFFFFFFF, (k[1] + _PHILOX_WEYL[1]) & 0xFFFFFFFF]
+    return np.stack(c, axis=-1).astype(np.uint32)
+
+
+def draw_random_parameters_reference(
+    parameters: Sequence[RandomParameter],
+    seed: int,
+    sample_indices: Union[int, Sequence[int]],
+    epochs: Union[int, Sequence[int]] = 0,
+) -> np.ndarray:
+    '''Compute the records drawn by :func:`random_parameters` on the CPU (bit-identical).
+
+    Args:
+        parameters: Parameters to draw.
+        seed: Seed of the generator.
+        sample_indices: Sample index or indices.
+        epochs: Epoch(s) of the samples (broadcast against ``sample_indices``).
+
+    Returns:
+        Records as ``float32`` array of shape ``(num_samples, num_parameters)``, with the parameters in the
+        order of ``parameters`` (Bernoulli parameters as 0 or 1).
+    '''
+    _check_parameters(parameters)
+    sample_indices, epochs = np.broadcast_arrays(
+        np.atleast_1d(np.asarray(sample_indices, dtype=np.int64)), np.asarray(epochs, dtype=np.int64)
+    )
+    indices = sample_indices.astype(np.uint64)
+    seed = seed & 0xFFFFFFFFFFFFFFFF
+    key = (seed & 0xFFFFFFFF, seed >> 32)
+
+    res = np.empty((len(indices), len(parameters)), dtype=np.float32)
+    for i, p in enumerate(parameters):
+        counter = np.stack(
+            [
+                indices & _MASK_32,
+                indices >> np.uint64(32),
+                epochs.astype(np.uint64) & _MASK_32,
+                np.full(len(indices), p.id, dtype=np.uint64),
+            ],
+            axis=-1,
+        )
+        bits = philox4x32_10(counter, key)[:, 0]
+        uniform_01 = (bits >> np.uint32(8)).astype(np.float32) * np.float32(1.0 / 16777216.0)
+        if p.kind == RandomParameterKind.UNIFORM:
+            low = float(np.float32(p.low))
+            value_range = float(np.float32(p.high)) - low
+            res[:, i] = (low + value_range * uniform_01.astype(np.float64)).astype(np.float32)
+        elif p.kind == RandomParameterKind.BERNOULLI:
+            res[:, i] = (uniform_01 < np.float32(p.low)).astype(np.float32)
+        else:
+            num_values = np.uint64(int(p.high - p.low) + 1)
+            offsets = (bits.astype(np.uint64) * num_values) >> np.uint64(32)
+            res[:, i] = np.float32(p.low) + offsets.astype(np.float32)
+    return res
@@ -21,5 +21,12 @@ output of the pipeline.
 from .pipeline import PipelineDefinition
 from .dali_structured_output_iterator import DALIStructuredOutputIterator
 from .sample_data_group import SampleDataGroup
+from .step_profiler import StepProfile, StepProfileReport
 
-__all__ = ['PipelineDefinition', 'DALIStructuredOutputIterator', 'SampleDataGroup']
+__all__ = [
+    'PipelineDefinition',
+    'DALIStructuredOutputIterator',
+    'SampleDataGroup',
+    'StepProfile',
+    'StepProfileReport',
+]
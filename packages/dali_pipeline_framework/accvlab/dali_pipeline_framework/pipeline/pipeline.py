@@ -24,9 +24,11 @@ import nvidia.dali as dali
 
 from .sample_data_group import SampleDataGroup
 from ..processing_steps import PipelineStepBase
+from ..internal_helpers.operator_tracking import record_output_nodes
 
 if TYPE_CHECKING:
     from ..inputs import CallableBase, IterableBase
+    from .step_profiler import StepProfileReport
 
 
 class PipelineDefinition:
@@ -150,6 +152,46 @@ class PipelineDefinition:
 
         return self._get_dali_pipeline_inner(*args, **kwargs)
 
+    def profile_steps(
+        self,
+        batch_size: int,
+        num_iterations: int = 10,
+        num_warmup_iterations: int = 2,
+        num_threads: int = 1,
+        **kwargs,
+    ) -> 'StepProfileReport':
+        '''Profile the cost of each processing step (e.g. to find the steps worth optimizing).
+
+        For each step (including nested steps), the number of created operators and the number of
+        ``python_function`` and ``numba_function`` operators among them are reported. For the top-level steps
+        and the data loading, the wall time per iteration and the size of the produced outputs are reported
+        as well.
+
+        DALI does not expose the run time of individual operators. Therefore, the wall time of a step is
+        measured as the difference between the run times of the pipelines consisting of the data loading and
+        the steps up to (and including) the step, and up to the previous step. This means that one pipeline
+        is built and run per step. All pipelines are run on the CPU (``device_id=None``) with synchronous,
+        non-pipelined execution and without the parallel external source, so that the measured times are
+        not hidden by prefetching. Note that the data loading is timed together with the external source,
+        i.e. it is included in the time of the data loading (and not in the time of the steps).
+
+        Args:
+            batch_size: Batch size to use.
+            num_iterations: Number of timed iterations per pipeline.
+            num_warmup_iterations: Number of iterations to run before timing.
+            num_threads: Number of CPU threads used by DALI.
+            **kwargs: Further keyword arguments for the DALI pipelines (see :meth:`get_dali_pipeline`).
+                Override the defaults described above if set.
+
+        Returns:
+            The per-step cost report. Can be printed as a table.
+        '''
+        from .step_profiler import profile_pipeline_steps
+
+        return profile_pipeline_steps(
+            self, batch_size, num_iterations, num_warmup_iterations, num_threads, **kwargs
+        )
+
     @pipeline_def
     def _get_dali_pipeline_inner(self) -> dali.pipeline.Pipeline:
         '''Get the DALI pipeline as configured.
@@ -201,5 +243,6 @@ class PipelineDefinition:
 
         # Get the data as a flat sequence. Similar to the external source, we can only output sequences of DataNode elements, no nested data structures.
         data_out = data_structure_used.get_data()
+        record_output_nodes(data_out)
         # And return the flat data.
         return data_out
@@ -0,0 +1,273 @@
+# Copyright (c) 2025, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+'''Per-step cost profiling of a :class:`~accvlab.dali_pipeline_framework.pipeline.PipelineDefinition`.
+
+DALI does not expose the run time of individual operators to Python. Therefore, the run time of a processing
+step is measured as the marginal cost of the step, i.e. as the difference between the run times of the
+pipelines consisting of the data loading and the steps up to (and including) the step and up to the step
+before. All pipelines are run on the CPU with synchronous execution, so that the measured times are not
+hidden by prefetching.
+
+The operators created by each step (including nested steps, e.g. inside
+:class:`~accvlab.dali_pipeline_framework.processing_steps.DataGroupInPathAppliedStep`) are counted by
+tracking the graph construction.
+'''
+
+import time
+from dataclasses import dataclass
+from typing import Dict, List, Optional, TYPE_CHECKING
+
+import numpy as np
+
+from ..internal_helpers.operator_tracking import OperatorTracker, track_operators
+
+if TYPE_CHECKING:
+    from .pipeline import PipelineDefinition
+
+INPUT_PATH = ""
+
+
+@dataclass
+class StepProfile:
+    '''Cost of a single processing step.
+
+    Attributes:
+        path: Path of the step, consisting of the index of the top-level step and the class names of the
+            (nested) steps, e.g. ``"2:DataGroupInPathAppliedStep/AffineTransformer"``. The operators
+            created outside of any step (data loading, i.e. the external source and its post-processing)
+            are reported with the path ``""``.
+        num_operators: Number of operators created by the step (including nested steps).
+        num_python_function_operators: Number of ``python_function`` operators created by the step
+            (including nested steps). Note that the number of calls per iteration depends on the
+            ``batch_processing`` argument of the operators: with ``batch_processing=False`` (the default),
+            the function is called once per sample, i.e. ``batch_size`` times per iteration.
+        num_numba_function_operators: Number of ``numba_function`` operators created by the step (including
+            nested steps). As for ``python_function``, the function is called once per sample unless
+            ``batch_processing`` is set.
+        wall_time: Wall time of the step per iteration in seconds. Only available for top-level steps and the
+            data loading (``None`` otherwise).
+        output_bytes: Size of the pipeline outputs produced by the step per iteration in bytes, i.e. of the
+            outputs which are last written by the step. Only available for top-level steps and the data
+            loading (``None`` otherwise).
+    '''
+
+    path: str
+    num_operators: int
+    num_python_function_operators: int
+    num_numba_function_operators: int
+    wall_time: Optional[float] = None
+    output_bytes: Optional[float] = None
+
+    @property
+    def depth(self) -> int:
+        '''Nesting depth of the step (0 for top-level steps and the data loading).'''
+        return self.path.count("/")
+
+    @property
+    def is_top_level(self) -> bool:
+        return self.depth == 0
+
+
+@dataclass
+class StepProfileReport:
+    '''Result of :meth:`PipelineDefinition.profile_steps`.
+
+    Attributes:
+        steps: Profiles of the data loading and of the (nested) steps, in the order of graph construction.
+        batch_size: Batch size used for profiling.
+        num_iterations: Number of timed iterations.
+        total_wall_time: Wall time of the whole pipeline per iteration in seconds.
+    '''
+
+    steps: List[StepProfile]
+    batch_size: int
+    num_iterations: int
+    total_wall_time: float
+
+    def get_step(self, path: str) -> StepProfile:
+        '''Get the profile of the step with the given path.'''
+        for step in self.steps:
+            if step.path == path:
+                return step
+        raise KeyError(f"No step with path '{path}' profiled")
+
+    def get_top_level_steps_by_wall_time(self) -> List[StepProfile]:
+        '''Get the profiles of the top-level steps and the data loading, most expensive first.'''
+        return sorted((s for s in self.steps if s.is_top_level), key=lambda s: s.wall_time, reverse=True)
+
+    def __str__(self) -> str:
+        header = (
+            f"{'Step':<50} {'#ops':>6} {'#py ops':>10} {'#numba ops':>13} {'time [ms]':>10} "
+            f"{'share':>7} {'output [KiB]':>13}"
+        )
+        lines = [
+            f"Per-step cost (batch size {self.batch_size}, {self.num_iterations} iterations, "
+            f"total {self.total_wall_time * 1e3:.3f} ms per iteration)",
+            header,
+            "-" * len(header),
+        ]
+        for step in self.steps:
+            if step.path == INPUT_PATH:
+                name = "<data loading>"
+            elif step.is_top_level:
+                name = step.path
+            else:
+                name = "  " * step.depth + step.path.split("/")[-1]
+            if step.wall_time is not None:
+                share = step.wall_time / self.total_wall_time if self.total_wall_time > 0.0 else 0.0
+                time_str = f"{step.wall_time * 1e3:>10.3f} {share * 100.0:>6.1f}%"
+                bytes_str = f"{step.output_bytes / 1024.0:>13.1f}"
+            else:
+                time_str = f"{'':>10} {'':>7}"
+                bytes_str = f"{'':>13}"
+            lines.append(
+                f"{name:<50} {step.num_operators:>6} {step.num_python_function_operators:>10} "
+                f"{step.num_numba_function_operators:>13} {time_str} {bytes_str}"
+            )
+        return "\n".join(lines)
+
+
+def _run_iteration(pipe):
+    try:
+        return pipe.run()
+    except StopIteration:
+        pipe.reset()
+        return pipe.run()
+
+
+def _get_output_bytes(output) -> int:
+    return sum(np.array(output.at(s)).nbytes for s in range(len(output)))
+
+
+def _is_in_scope(path: Optional[str], scope_path: str) -> bool:
+    if path is None:
+        return False
+    if scope_path == INPUT_PATH:
+        return path == INPUT_PATH
+    return path == scope_path or path.startswith(scope_path + "/")
+
+
+def _time_prefix_pipeline(
+    pipeline_definition: "PipelineDefinition",
+    num_steps: int,
+    scope_path: Optional[str],
+    batch_size: int,
+    num_iterations: int,
+    num_warmup_iterations: int,
+    pipeline_kwargs: Dict,
+):
+    '''Time the pipeline consisting of the data loading and the first ``num_steps`` steps.
+
+    Returns:
+        Tuple of the wall time per iteration, the size of the outputs produced by ``scope_path`` per
+        iteration and the operator tracker used during graph construction.
+    '''
+    from .pipeline import PipelineDefinition
+
+    prefix_definition = PipelineDefinition(
+        pipeline_definition._data_loading_callable_iterable,
+        pipeline_definition._preprocess_functors[:num_steps],
+        check_data_format=False,
+        use_parallel_external_source=False,
+    )
+    with track_operators() as tracker:
+        pipe = prefix_definition.get_dali_pipeline(batch_size=batch_size, **pipeline_kwargs)
+    pipe.build()
+
+    output_is_in_scope = [
+        _is_in_scope(tracker.get_node_path(node), scope_path) for node in tracker.output_nodes
+    ]
+
+    for _ in range(num_warmup_iterations):
+        _run_iteration(pipe)
+    output_bytes = 0
+    wall_time = 0.0
+    for _ in range(num_iterations):
+        start = time.perf_counter()
+        outputs = _run_iteration(pipe)
+        wall_time += time.perf_counter() - start
+        output_bytes += sum(
+            _get_output_bytes(output) for output, in_scope in zip(outputs, output_is_in_scope) if in_scope
+        )
+    return wall_time / num_iterations, output_bytes / num_iterations, tracker
+
+
+def _count_operators(tracker: OperatorTracker, scope_path: str, type_substring: Optional[str] = None) -> int:
+    res = 0
+    for path, operators in tracker.operators_per_path.items():
+        if not _is_in_scope(path, scope_path):
+            continue
+        if type_substring is None:
+            res += len(operators)
+        else:
+            res += sum(1 for op_type in operators.values() if type_substring in op_type.lower())
+    return res
+
+
+def profile_pipeline_steps(
+    pipeline_definition: "PipelineDefinition",
+    batch_size: int,
+    num_iterations: int = 10,
+    num_warmup_iterations: int = 2,
+    num_threads: int = 1,
+    **pipeline_kwargs,
+) -> StepProfileReport:
+    '''Profile the cost of each processing step of a pipeline definition.
+
+    See :meth:`PipelineDefinition.profile_steps` for details.
+    '''
+    if num_iterations < 1:
+        raise ValueError(f"At least one timed iteration is needed; got `num_iterations={num_iterations}`")
+
+    kwargs = dict(
+        num_threads=num_threads,
+        device_id=None,
+        prefetch_queue_depth=1,
+        enable_conditionals=True,
+        exec_async=False,
+        exec_pipelined=False,
+    )
+    kwargs.update(pipeline_kwargs)
+
+    steps = pipeline_definition._preprocess_functors
+    wall_times = []
+    output_bytes = []
+    for k in range(len(steps) + 1):
+        # The outputs last written by step `k - 1` are the ones created inside its scope.
+        scope_path = INPUT_PATH if k == 0 else f"{k - 1}:{type(steps[k - 1]).__name__}"
+        wall_time, num_bytes, tracker = _time_prefix_pipeline(
+            pipeline_definition, k, scope_path, batch_size, num_iterations, num_warmup_iterations, kwargs
+        )
+        wall_times.append(wall_time)
+        output_bytes.append(num_bytes)
+
+    # The tracker of the full pipeline contains the operators of all steps.
+    profiles = []
+    for path in tracker.operators_per_path:
+        step = StepProfile(
+            path=path,
+            num_operators=_count_operators(tracker, path),
+            num_python_function_operators=_count_operators(tracker, path, "python"),
+            num_numba_function_operators=_count_operators(tracker, path, "numba"),
+        )
+        if step.is_top_level:
+            k = 0 if path == INPUT_PATH else int(path.split(":", 1)[0]) + 1
+            step.wall_time = wall_times[k] - (wall_times[k - 1] if k > 0 else 0.0)
+            step.output_bytes = output_bytes[k]
+        profiles.append(step)
+
+    return StepProfileReport(
+        steps=profiles, batch_size=batch_size, num_iterations=num_iterations, total_wall_time=wall_times[-1]
+    )
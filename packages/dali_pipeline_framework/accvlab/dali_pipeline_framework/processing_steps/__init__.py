@@ -33,6 +33,7 @@ from .data_group_array_with_name_elements_applied_step import DataGroupArrayWith
 
 # Processing steps
 from .image_decoder import ImageDecoder
+from .packed_image_record_loader import PackedImageRecordLoader
 from .image_to_tile_size_padder import ImageToTileSizePadder
 from .image_range_01_normalizer import ImageRange01Normalizer
 from .image_mean_std_dev_normalizer import ImageMeanStdDevNormalizer
@@ -62,6 +63,7 @@ __all__ = [
     'DataGroupArrayWithNameElementsAppliedStep',
     # Processing steps
     'ImageDecoder',
+    'PackedImageRecordLoader',
     'ImageToTileSizePadder',
     'ImageRange01Normalizer',
     'ImageMeanStdDevNormalizer',
@@ -15,6 +15,7 @@
 # Used to enable type hints using a class type inside the implementation of that class itself.
 from __future__ import annotations
 
+import os
 from typing import Union
 
 try:
@@ -37,10 +38,24 @@ from ..internal_helpers.mini_parser import (
     And,
     Not,
     UnaryMinus,
+    compile_to_bytecode,
 )
 
 from .pipeline_step_base import PipelineStepBase
 
+_custom_operator_loaded = False
+
+
+def _load_custom_operator():
+    global _custom_operator_loaded
+    if _custom_operator_loaded:
+        return
+    import nvidia.dali.plugin_manager as plugin_manager
+
+    parent_dir = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+    plugin_manager.load_library(os.path.join(parent_dir, "lib_condition_eval.so"), global_symbols=True)
+    _custom_operator_loaded = True
+
 
 class AnnotationElementConditionEval(PipelineStepBase):
     '''Evaluate a declarative condition per annotation element and store the boolean result.
@@ -115,6 +130,11 @@ class AnnotationElementConditionEval(PipelineStepBase):
             This is a convenience feature and can be set to `True` if the data fields are not used after
             evaluating the condition. However, note that if some of the data fields are used, it has to be
             set to `False`, as the fields are not available after this step otherwise.
+        use_fused_operator:
+            Whether to evaluate the condition with a single native CPU operator (the condition is compiled to
+            bytecode, which is evaluated in one pass per sample) instead of building it from individual DALI
+            operators. The result is the same. Conditions without any data fields are always evaluated with
+            DALI operators. Default value is ``False``.
     '''
 
     def __init__(
@@ -122,12 +142,18 @@ class AnnotationElementConditionEval(PipelineStepBase):
         annotation_field_name: Union[str, int],
         condition: str,
         remove_data_fields_used_in_condition: bool,
+        use_fused_operator: bool = False,
     ):
         self._annotation_field_name = annotation_field_name
         self._condition_statement = Parser(condition).parse()
         self._condition = self._condition_statement.expression
         self._result_field_name = self._condition_statement.variable.name
         self._remove_data_fields_used_in_condition = remove_data_fields_used_in_condition
+        # The native operator needs at least one data field as input
+        bytecode = compile_to_bytecode(self._condition) if use_fused_operator else None
+        self._bytecode = bytecode if bytecode is not None and len(bytecode.variable_names) > 0 else None
+        if self._bytecode is not None:
+            _load_custom_operator()
 
     @override
     def _process(self, data: SampleDataGroup) -> SampleDataGroup:
@@ -162,7 +188,10 @@ class AnnotationElementConditionEval(PipelineStepBase):
         return data_empty
 
     def _eval_and_set_result_for_group(self, annotations: SampleDataGroup) -> SampleDataGroup:
-        valid = self._eval_condition_tree(annotations, self._condition)
+        if self._bytecode is not None:
+            valid = self._eval_compiled_condition(annotations)
+        else:
+            valid = self._eval_condition_tree(annotations, self._condition)
         annotations.add_data_field(self._result_field_name, types.DALIDataType.BOOL)
         annotations[self._result_field_name] = valid
         return annotations
@@ -180,6 +209,12 @@ class AnnotationElementConditionEval(PipelineStepBase):
             for field in used_fields:
                 annotation.remove_field(field)
 
+    def _eval_compiled_condition(self, annotation: SampleDataGroup):
+        inputs = [annotation[name] for name in self._bytecode.variable_names]
+        return fn.condition_eval(
+            *inputs, program=self._bytecode.flat_program, constants=self._bytecode.constants
+        )
+
     @staticmethod
     def _eval_condition_tree(annotation: SampleDataGroup, condition: AST):
         if isinstance(condition, Comparison):
@@ -0,0 +1,123 @@
+# Copyright (c) 2025, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+from typing import Optional
+
+try:
+    from typing import override
+except ImportError:
+    from typing_extensions import override
+
+import nvidia.dali.types as types
+
+from .pipeline_step_base import PipelineStepBase
+from ..pipeline.sample_data_group import SampleDataGroup
+from ..inputs.packed_record_reader import packed_record_reader
+
+_record_index_types = (types.DALIDataType.INT64, types.DALIDataType.INT32)
+
+
+class PackedImageRecordLoader(PipelineStepBase):
+    '''Load encoded images from packed image record shards.
+
+    Instead of reading the image files in the input callable (one file open per image), the data provider
+    sets the image fields to the index of the corresponding record (``INT64``, e.g. obtained with
+    :meth:`~accvlab.dali_pipeline_framework.inputs.PackedImageRecords.index_of`). This step replaces the
+    record indices by the encoded images, so that subsequent steps (e.g. :class:`ImageDecoder`) can be used
+    unchanged.
+
+    Behavior:
+      - Finds all images by name. The records of all images are read with a single
+        :func:`~accvlab.dali_pipeline_framework.inputs.packed_record_reader` operator, so that the reads of
+        all images of a batch are coalesced.
+      - Replaces the record indices by the encoded images (``UINT8``) in place.
+      - Optionally, adds the annotation blobs of the records as sibling fields (``UINT8``).
+    '''
+
+    def __init__(
+        self,
+        image_name: str,
+        index_file: str,
+        annotation_name: Optional[str] = None,
+        max_gap: int = 64 << 10,
+        max_read_size: int = 16 << 20,
+        read_ahead: int = 4 << 20,
+    ):
+        '''
+
+        Args:
+            image_name: Name of the image data field(s), containing the record indices.
+            index_file: Record index (as returned by
+                :func:`~accvlab.dali_pipeline_framework.inputs.pack_image_records`).
+            annotation_name: If set, the annotation blob of each record is added as a sibling of the image
+                with this name.
+            max_gap: Maximum gap (in bytes) between records to read them with a single read.
+            max_read_size: Maximum size (in bytes) of a single (coalesced) read.
+            read_ahead: Size (in bytes) of the region to request read-ahead for per shard (``0`` to disable).
+        '''
+
+        self._image_name = image_name
+        self._index_file = index_file
+        self._annotation_name = annotation_name
+        self._max_gap = max_gap
+        self._max_read_size = max_read_size
+        self._read_ahead = read_ahead
+
+    @override
+    def _process(self, data: SampleDataGroup) -> SampleDataGroup:
+        image_paths = data.find_all_occurrences(self._image_name)
+        record_indices = [data.get_item_in_path(ip) for ip in image_paths]
+
+        read_annotations = self._annotation_name is not None
+        outputs = packed_record_reader(
+            *record_indices,
+            index_file=self._index_file,
+            read_annotations=read_annotations,
+            max_gap=self._max_gap,
+            max_read_size=self._max_read_size,
+            read_ahead=self._read_ahead,
+        )
+        images, annotations = outputs if read_annotations else (outputs, None)
+
+        for i, ip in enumerate(image_paths):
+            data.change_type_of_data_and_remove_data(ip, types.DALIDataType.UINT8)
+            data.set_item_in_path(ip, images[i])
+            if read_annotations:
+                parent = data.get_parent_of_path(ip)
+                parent.add_data_field(self._annotation_name, types.DALIDataType.UINT8)
+                parent[self._annotation_name] = annotations[i]
+
+        return data
+
+    @override
+    def _check_and_adjust_data_format_input_to_output(self, data_empty: SampleDataGroup) -> SampleDataGroup:
+        image_paths = data_empty.find_all_occurrences(self._image_name)
+        if len(image_paths) == 0:
+            raise KeyError(
+                f"No occurrences of images found. Fields containing images are expected to have the name "
+                f"'{self._image_name}', as specified in the constructor."
+            )
+
+        for ip in image_paths:
+            if data_empty.get_type_of_item_in_path(ip) not in _record_index_types:
+                raise ValueError(
+                    f"Image field at path `{ip}` in the input data has to contain the record index (INT64 or "
+                    f"INT32)"
+                )
+            data_empty.change_type_of_data_and_remove_data(ip, types.DALIDataType.UINT8)
+            if self._annotation_name is not None:
+                image_parent = data_empty.get_parent_of_path(ip)
+                image_parent.add_data_field(self._annotation_name, types.DALIDataType.UINT8)
+
+        return data_empty
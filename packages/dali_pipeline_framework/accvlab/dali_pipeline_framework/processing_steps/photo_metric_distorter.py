@@ -12,7 +12,8 @@
 # See the License for the specific language governing permissions and
 # limitations under the License.
 
-from typing import Union, Sequence
+import os
+from typing import Optional, Union, Sequence
 
 try:
     from typing import override
@@ -25,9 +26,25 @@ import nvidia.dali.types as types
 from nvidia.dali.pipeline import DataNode
 
 from ..pipeline.sample_data_group import SampleDataGroup
+from ..operators_impl.random_parameters import RandomParameter, random_parameters
 
 from .pipeline_step_base import PipelineStepBase
 
+_custom_operator_loaded = False
+
+
+def _load_custom_operator():
+    global _custom_operator_loaded
+    if _custom_operator_loaded:
+        return
+    import nvidia.dali.plugin_manager as plugin_manager
+
+    parent_dir = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+    plugin_manager.load_library(
+        os.path.join(parent_dir, "lib_photo_metric_distortion.so"), global_symbols=True
+    )
+    _custom_operator_loaded = True
+
 
 class PhotoMetricDistorter(PipelineStepBase):
     '''Apply photometric augmentations to images (brightness, contrast, saturation, hue, channel swap).
@@ -50,6 +67,9 @@ class PhotoMetricDistorter(PipelineStepBase):
         prob_swap_channels: float = 0.5,
         is_bgr: bool = False,
         enforce_process_on_gpu: bool = True,
+        use_fused_operator: bool = False,
+        parameter_seed: Optional[int] = None,
+        parameter_sample_position_name: Optional[Union[str, int]] = None,
     ):
         '''
 
@@ -69,6 +89,24 @@ class PhotoMetricDistorter(PipelineStepBase):
             is_bgr: Whether the image is in BGR format (RGB otherwise).
             enforce_process_on_gpu: Whether to enforce the augmentation to happen on the GPU, even if the input image is stored on the CPU.
                 Default value is ``True``.
+            use_fused_operator: Whether to apply the whole distortion with a single native CPU operator
+                (one pass over each image, parameters drawn inside the operator) instead of a chain of DALI
+                operators. The augmentations, their probabilities and their order are the same. The images
+                have to be on the CPU; if ``enforce_process_on_gpu`` is set, the distorted images are moved
+                to the GPU afterwards. Default value is ``False``.
+            parameter_seed: If set, all random parameters of a sample are drawn at once with a counter-based
+                generator using this seed (see
+                :func:`~accvlab.dali_pipeline_framework.operators_impl.random_parameters.random_parameters`),
+                instead of one DALI random operator per parameter. The parameters are then reproducible
+                independently of the rest of the pipeline. Not used if ``use_fused_operator`` is set. Default
+                value is ``None``.
+            parameter_sample_position_name: Name of the data field containing the position of the sample
+                (``INT64`` or ``INT32``; the sample index, or the epoch and the sample index), which is used
+                as the counter of the generator if ``parameter_seed`` is set. Exactly one field with this
+                name has to be present. If not set, the samples are numbered consecutively in the order in
+                which they are processed by the pipeline (always epoch 0). The parameters then restart with
+                each pipeline build and are the same for all shards (unless different seeds are used), i.e.
+                they are only reproducible for the same sequence of samples. Default value is ``None``.
         '''
 
         self._image_name = image_name
@@ -82,7 +120,13 @@ class PhotoMetricDistorter(PipelineStepBase):
         self._prob_saturation_aug = prob_saturation_aug
         self._prob_swap_channels = prob_swap_channels
         self._enforce_process_on_gpu = enforce_process_on_gpu
+        self._is_bgr = is_bgr
         self._image_format = types.DALIImageType.BGR if is_bgr else types.DALIImageType.RGB
+        self._use_fused_operator = use_fused_operator
+        self._parameter_seed = parameter_seed
+        self._parameter_sample_position_name = parameter_sample_position_name
+        if use_fused_operator:
+            _load_custom_operator()
 
     @override
     def _process(self, data: SampleDataGroup) -> SampleDataGroup:
@@ -104,8 +148,17 @@ class PhotoMetricDistorter(PipelineStepBase):
                 types.DALIDataType.UINT8,
             ), f"Image type {image_types[i]} not supported"
 
+        sample_position = None
+        if self._uses_sample_position:
+            sample_position = data.get_item_in_path(
+                data.find_all_occurrences(self._parameter_sample_position_name)[0]
+            )
+
         # Process the images
-        self._process_images(images, image_types)
+        if self._use_fused_operator:
+            self._process_images_fused(images)
+        else:
+            self._process_images(images, image_types, sample_position)
 
         # Set the updated images
         for i, ip in enumerate(image_paths):
@@ -123,13 +176,33 @@ class PhotoMetricDistorter(PipelineStepBase):
             raise KeyError(
                 f"No occurrences of images found. Fields containing images are expected to have the name '{self._image_name}', as specified in the constructor."
             )
+        if self._uses_sample_position:
+            num_positions = len(data_empty.find_all_occurrences(self._parameter_sample_position_name))
+            if num_positions != 1:
+                raise KeyError(
+                    "Expected exactly one sample position field named "
+                    f"'{self._parameter_sample_position_name}'; found {num_positions}."
+                )
 
         return data_empty
 
-    def _process_images(self, images: Sequence[DataNode], image_types: Sequence[types.DALIDataType]):
+    @property
+    def _uses_sample_position(self) -> bool:
+        return (
+            self._parameter_seed is not None
+            and self._parameter_sample_position_name is not None
+            and not self._use_fused_operator
+        )
+
+    def _process_images(
+        self,
+        images: Sequence[DataNode],
+        image_types: Sequence[types.DALIDataType],
+        sample_position: Optional[DataNode] = None,
+    ):
         '''Process the images.'''
 
-        augmentation = self._get_augmentation_setup()
+        augmentation = self._get_augmentation_setup(sample_position)
 
         for i in range(len(images)):
 
@@ -188,7 +261,39 @@ class PhotoMetricDistorter(PipelineStepBase):
             else:
                 images[i] = dali_math.clamp(images[i], 0.0, 1.0)
 
-    def _get_augmentation_setup(self):
+    def _process_images_fused(self, images: Sequence[DataNode]):
+        '''Process the images with the native operator.
+
+        All images are inputs of a single operator call, so that the random parameters are shared between them
+        (as for :meth:`_process_images`).
+        '''
+
+        for i, image in enumerate(images):
+            if image.device != "cpu":
+                raise ValueError(
+                    f"The fused photometric distortion operator runs on the CPU, but image {i} is on the GPU."
+                )
+
+        outputs = fn.photo_metric_distortion(
+            *images,
+            min_max_brightness=list(self._min_max_brightness),
+            min_max_contrast=list(self._min_max_contrast),
+            min_max_saturation=list(self._min_max_saturation),
+            min_max_hue=list(self._min_max_hue),
+            prob_brightness_aug=self._prob_brightness_aug,
+            prob_contrast_aug=self._prob_contrast_aug,
+            prob_saturation_aug=self._prob_saturation_aug,
+            prob_hue_aug=self._prob_hue_aug,
+            prob_swap_channels=self._prob_swap_channels,
+            is_bgr=self._is_bgr,
+        )
+        if len(images) == 1:
+            outputs = [outputs]
+
+        for i in range(len(images)):
+            images[i] = outputs[i].gpu() if self._enforce_process_on_gpu else outputs[i]
+
+    def _get_augmentation_setup(self, sample_position: Optional[DataNode] = None):
 
         def get_color_channel_permutation(perm_index: int) -> DataNode:
             # In total, there are 3! = 6 possibilities for permutations.
@@ -215,6 +320,13 @@ class PhotoMetricDistorter(PipelineStepBase):
                 res = fn.constant(idata=[1, 2, 0], shape=[3], dtype=types.DALIDataType.INT32)
             return res
 
+        if self._parameter_seed is not None:
+            augmentation = self._draw_augmentation_parameters(sample_position)
+            augmentation["channel_permutation"] = get_color_channel_permutation(
+                augmentation.pop("permutation_index")
+            )
+            return augmentation
+
         aug_brightness = (
             fn.random.uniform(range=[0.0, 1.0], dtype=types.DALIDataType.FLOAT) < self._prob_brightness_aug
         )
@@ -264,6 +376,31 @@ class PhotoMetricDistorter(PipelineStepBase):
         }
         return res
 
+    def _draw_augmentation_parameters(self, sample_position: Optional[DataNode] = None):
+        '''Draw the parameters of all augmentations with a single counter-based random operator.
+
+        The values are drawn regardless of whether the corresponding augmentation is applied (they are not
+        used otherwise). If ``sample_position`` is ``None``, the samples are numbered consecutively by the
+        operator.
+        '''
+        return random_parameters(
+            [
+                RandomParameter.integer("contrast_mode", 0, 1),
+                RandomParameter.bernoulli("aug_brightness", self._prob_brightness_aug),
+                RandomParameter.bernoulli("aug_contrast", self._prob_contrast_aug),
+                RandomParameter.bernoulli("aug_saturation", self._prob_saturation_aug),
+                RandomParameter.bernoulli("aug_hue", self._prob_hue_aug),
+                RandomParameter.bernoulli("aug_swap_channels", self._prob_swap_channels),
+                RandomParameter.uniform("delta", *self._min_max_brightness),
+                RandomParameter.uniform("alpha", *self._min_max_contrast),
+                RandomParameter.uniform("hue", *self._min_max_hue),
+                RandomParameter.uniform("saturation", *self._min_max_saturation),
+                RandomParameter.integer("permutation_index", 0, 5),
+            ],
+            seed=self._parameter_seed,
+            sample_position=sample_position,
+        )
+
     @staticmethod
     def _get_random_in_range(range):
         if range[1] == range[0]:
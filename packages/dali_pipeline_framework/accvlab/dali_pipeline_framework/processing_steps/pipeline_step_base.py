@@ -15,6 +15,7 @@
 from abc import ABC, abstractmethod
 
 from ..pipeline.sample_data_group import SampleDataGroup
+from ..internal_helpers.operator_tracking import step_scope
 
 
 class PipelineStepBase(ABC):
@@ -106,7 +107,10 @@ class PipelineStepBase(ABC):
         # Note that this needs to be done before calling `_process()`, as `_process()` may change `data`.
         data_plueprint_in = data.get_empty_like_self()
 
-        processed = self._process(data)
+        # Attributes the created operators to this step if operator tracking is active (see
+        # `PipelineDefinition.profile_steps()`); no-op otherwise.
+        with step_scope(self):
+            processed = self._process(data)
 
         # The check is performed at DALI graph construction time and therefore does not affect runtime during training.
         reference_blueprint = self.check_input_data_format_and_set_output_data_format(data_plueprint_in)
@@ -0,0 +1,255 @@
+/*
+ * Copyright (c) 2025, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "ColumnarStore.h"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <cstring>
+
+#include "dali/core/error_handling.h"
+
+namespace custom_operators {
+
+namespace {
+
+constexpr char kMagic[8] = {'A', 'C', 'C', 'V', 'C', 'O', 'L', '1'};
+constexpr uint32_t kVersion = 1;
+constexpr int kMaxElementDims = 4;
+constexpr uint8_t kFlagRagged = 1;
+constexpr uint8_t kFlagString = 2;
+
+#pragma pack(push, 1)
+// Has to match `_HEADER` in `inputs/columnar_store.py`
+struct FileHeader {
+    char magic[8];
+    uint32_t version;
+    uint32_t num_columns;
+    uint64_t num_samples;
+    uint64_t columns_offset;
+    uint64_t num_strings;
+    uint64_t string_offsets_offset;
+    uint64_t string_data_offset;
+    uint64_t sample_keys_offset;
+    uint64_t sorted_keys_offset;
+};
+
+// Has to match `_COLUMN` in `inputs/columnar_store.py`
+struct FileColumn {
+    uint32_t name_id;
+    uint8_t dtype;
+    uint8_t flags;
+    uint8_t element_ndim;
+    uint8_t reserved;
+    int64_t element_shape[kMaxElementDims];
+    uint64_t data_offset;
+    uint64_t data_size;
+    uint64_t offsets_offset;
+};
+#pragma pack(pop)
+
+static_assert(sizeof(FileHeader) == 72, "Unexpected size of FileHeader");
+static_assert(sizeof(FileColumn) == 64, "Unexpected size of FileColumn");
+
+}  // namespace
+
+size_t columnar_dtype_size(ColumnarDType dtype) {
+    switch (dtype) {
+        case ColumnarDType::Bool:
+        case ColumnarDType::UInt8:
+        case ColumnarDType::Int8:
+            return 1;
+        case ColumnarDType::UInt16:
+        case ColumnarDType::Int16:
+        case ColumnarDType::Float16:
+            return 2;
+        case ColumnarDType::UInt32:
+        case ColumnarDType::Int32:
+        case ColumnarDType::Float32:
+            return 4;
+        case ColumnarDType::UInt64:
+        case ColumnarDType::Int64:
+        case ColumnarDType::Float64:
+            return 8;
+    }
+    DALI_FAIL("Unknown columnar store data type: " + std::to_string(static_cast<int>(dtype)));
+}
+
+ColumnarStore::ColumnarStore(const std::string& path) : _path(path) {
+    const int fd = ::open(path.c_str(), O_RDONLY);
+    if (fd < 0) {
+        DALI_FAIL("Failed to open columnar store: " + path);
+    }
+    struct stat file_stat;
+    if (::fstat(fd, &file_stat) != 0) {
+        ::close(fd);
+        DALI_FAIL("Failed to get the size of columnar store: " + path);
+    }
+    _size = static_cast<size_t>(file_stat.st_size);
+    if (_size < sizeof(FileHeader)) {
+        ::close(fd);
+        DALI_FAIL("Not a columnar store (file too small): " + path);
+    }
+    void* mapped = ::mmap(nullptr, _size, PROT_READ, MAP_SHARED, fd, 0);
+    // The mapping stays valid after closing the file
+    ::close(fd);
+    if (mapped == MAP_FAILED) {
+        DALI_FAIL("Failed to memory-map columnar store: " + path);
+    }
+    _mapped = static_cast<const uint8_t*>(mapped);
+
+    try {
+        FileHeader header;
+        std::memcpy(&header, _mapped, sizeof(header));
+        DALI_ENFORCE(std::memcmp(header.magic, kMagic, sizeof(kMagic)) == 0 && header.version == kVersion,
+                     "Not a columnar store of version " + std::to_string(kVersion) + ": " + path);
+        _num_samples = static_cast<int64_t>(header.num_samples);
+
+        _num_strings = header.num_strings;
+        CheckRange(header.string_offsets_offset, (_num_strings + 1) * sizeof(uint64_t), "string offsets");
+        _string_offsets = reinterpret_cast<const uint64_t*>(_mapped + header.string_offsets_offset);
+        CheckRange(header.string_data_offset, _string_offsets[_num_strings], "string data");
+        CheckMonotonic(_string_offsets, _num_strings + 1, "string offsets");
+        _string_data = reinterpret_cast<const char*>(_mapped + header.string_data_offset);
+
+        CheckRange(header.columns_offset, header.num_columns * sizeof(FileColumn), "column directory");
+        _columns.reserve(header.num_columns);
+        for (uint32_t i = 0; i < header.num_columns; ++i) {
+            FileColumn entry;
+            std::memcpy(&entry, _mapped + header.columns_offset + i * sizeof(FileColumn), sizeof(entry));
+            DALI_ENFORCE(entry.element_ndim <= kMaxElementDims, "Invalid column entry in " + path);
+
+            ColumnarColumn column;
+            column.name = std::string(String(entry.name_id));
+            column.dtype = static_cast<ColumnarDType>(entry.dtype);
+            column.is_ragged = (entry.flags & kFlagRagged) != 0;
+            column.is_string = (entry.flags & kFlagString) != 0;
+            column.element_shape.assign(entry.element_shape, entry.element_shape + entry.element_ndim);
+            column.row_size = columnar_dtype_size(column.dtype);
+            for (int64_t extent : column.element_shape) {
+                column.row_size *= static_cast<size_t>(extent);
+            }
+            CheckRange(entry.data_offset, entry.data_size, "column data");
+            column.data = _mapped + entry.data_offset;
+            column.data_size = entry.data_size;
+            column.offsets = nullptr;
+            if (column.is_ragged) {
+                CheckRange(entry.offsets_offset, (header.num_samples + 1) * sizeof(uint64_t),
+                           "column offsets");
+                column.offsets = reinterpret_cast<const uint64_t*>(_mapped + entry.offsets_offset);
+                DALI_ENFORCE(column.offsets[_num_samples] * column.row_size <= column.data_size,
+                             "Offsets of column '" + column.name + "' exceed its data in " + path);
+                CheckMonotonic(column.offsets, header.num_samples + 1,
+                               "offsets of column '" + column.name + "'");
+            } else {
+                DALI_ENFORCE(static_cast<uint64_t>(_num_samples) * column.row_size <= column.data_size,
+                             "Column '" + column.name + "' has less rows than samples in " + path);
+            }
+            _columns.push_back(std::move(column));
+        }
+
+        if (header.sample_keys_offset != 0) {
+            CheckRange(header.sample_keys_offset, header.num_samples * sizeof(uint32_t), "sample keys");
+            CheckRange(header.sorted_keys_offset, header.num_samples * sizeof(uint64_t), "sorted keys");
+            _sample_keys = reinterpret_cast<const uint32_t*>(_mapped + header.sample_keys_offset);
+            _sorted_keys = reinterpret_cast<const uint64_t*>(_mapped + header.sorted_keys_offset);
+            for (uint64_t i = 0; i < header.num_samples; ++i) {
+                DALI_ENFORCE(_sample_keys[i] < _num_strings && _sorted_keys[i] < header.num_samples,
+                             "Invalid sample key entry " + std::to_string(i) + " in " + path);
+            }
+        }
+    } catch (...) {
+        ::munmap(const_cast<uint8_t*>(_mapped), _size);
+        throw;
+    }
+}
+
+ColumnarStore::~ColumnarStore() { ::munmap(const_cast<uint8_t*>(_mapped), _size); }
+
+void ColumnarStore::CheckRange(uint64_t offset, uint64_t size, const char* what) const {
+    if (offset > _size || size > _size - offset) {
+        DALI_FAIL(std::string("Truncated columnar store (") + what + "): " + _path);
+    }
+}
+
+void ColumnarStore::CheckMonotonic(const uint64_t* offsets, uint64_t num_offsets,
+                                   const std::string& what) const {
+    for (uint64_t i = 1; i < num_offsets; ++i) {
+        if (offsets[i] < offsets[i - 1]) {
+            DALI_FAIL("Corrupt columnar store (" + what + " are not monotonic at " + std::to_string(i) +
+                      "): " + _path);
+        }
+    }
+}
+
+int ColumnarStore::FindColumn(const std::string& name) const {
+    for (size_t i = 0; i < _columns.size(); ++i) {
+        if (_columns[i].name == name) {
+            return static_cast<int>(i);
+        }
+    }
+    return -1;
+}
+
+ColumnarSampleData ColumnarStore::Get(int column, int64_t sample_index) const {
+    DALI_ENFORCE(column >= 0 && column < static_cast<int>(_columns.size()),
+                 "Invalid column index: " + std::to_string(column));
+    DALI_ENFORCE(sample_index >= 0 && sample_index < _num_samples,
+                 "Sample index " + std::to_string(sample_index) + " out of range [0, " +
+                     std::to_string(_num_samples) + ")");
+    const ColumnarColumn& c = _columns[column];
+    if (!c.is_ragged) {
+        return ColumnarSampleData{c.data + sample_index * c.row_size, 1};
+    }
+    const uint64_t begin = c.offsets[sample_index];
+    const uint64_t end = c.offsets[sample_index + 1];
+    return ColumnarSampleData{c.data + begin * c.row_size, static_cast<int64_t>(end - begin)};
+}
+
+std::string_view ColumnarStore::String(int64_t string_id) const {
+    DALI_ENFORCE(string_id >= 0 && static_cast<uint64_t>(string_id) < _num_strings,
+                 "Invalid string id: " + std::to_string(string_id));
+    const uint64_t begin = _string_offsets[string_id];
+    const uint64_t end = _string_offsets[string_id + 1];
+    return std::string_view(_string_data + begin, end - begin);
+}
+
+int64_t ColumnarStore::IndexOf(std::string_view key) const {
+    if (_sorted_keys == nullptr) {
+        return -1;
+    }
+    // Keys are sorted by their (UTF-8) bytes, as compared by std::string_view
+    int64_t low = 0;
+    int64_t high = _num_samples;
+    while (low < high) {
+        const int64_t mid = (low + high) / 2;
+        const uint64_t sample = _sorted_keys[mid];
+        const int cmp = String(_sample_keys[sample]).compare(key);
+        if (cmp < 0) {
+            low = mid + 1;
+        } else if (cmp > 0) {
+            high = mid;
+        } else {
+            return static_cast<int64_t>(sample);
+        }
+    }
+    return -1;
+}
+
+}  // namespace custom_operators
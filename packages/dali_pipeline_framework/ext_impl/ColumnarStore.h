@@ -0,0 +1,122 @@
+/*
+ * Copyright (c) 2025, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef COLUMNAR_STORE_H_
+#define COLUMNAR_STORE_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace custom_operators {
+
+// Data types of columns. Has to match `_DTYPES` in `inputs/columnar_store.py` (value is the index there).
+enum class ColumnarDType : uint8_t {
+    Bool = 0,
+    UInt8 = 1,
+    Int8 = 2,
+    UInt16 = 3,
+    Int16 = 4,
+    UInt32 = 5,
+    Int32 = 6,
+    UInt64 = 7,
+    Int64 = 8,
+    Float16 = 9,
+    Float32 = 10,
+    Float64 = 11,
+};
+
+// Size of one value of the given type in bytes
+size_t columnar_dtype_size(ColumnarDType dtype);
+
+// Description of one column of a store
+struct ColumnarColumn {
+    std::string name;
+    ColumnarDType dtype;
+    bool is_ragged;  // Variable number of rows per sample (per-sample offsets are stored)
+    bool is_string;  // Values are int32 ids in the string table (-1 for none)
+    std::vector<int64_t> element_shape;
+    const uint8_t* data;       // Rows of all samples, concatenated
+    uint64_t data_size;        // In bytes
+    const uint64_t* offsets;   // `num_samples + 1` row offsets for ragged columns, nullptr otherwise
+    size_t row_size;           // Size of one row (element) in bytes
+};
+
+// Data of one column for one sample
+struct ColumnarSampleData {
+    const void* data;
+    int64_t num_rows;  // 1 for non-ragged columns
+};
+
+/**
+ * Read-only accessor of a memory-mapped columnar store, as written by `write_columnar_store()` in
+ * `inputs/columnar_store.py` (see there for the file layout).
+ *
+ * This allows native operators to read per-sample metadata (e.g. annotations) directly from the mapped
+ * file, sharing the data via the page cache with all other processes using the same store. The accessor is
+ * immutable after construction and can be used from multiple threads concurrently.
+ */
+class ColumnarStore {
+   public:
+    explicit ColumnarStore(const std::string& path);
+
+    ~ColumnarStore();
+
+    ColumnarStore(const ColumnarStore&) = delete;
+    ColumnarStore& operator=(const ColumnarStore&) = delete;
+    ColumnarStore(ColumnarStore&&) = delete;
+    ColumnarStore& operator=(ColumnarStore&&) = delete;
+
+    int64_t NumSamples() const { return _num_samples; }
+
+    const std::vector<ColumnarColumn>& Columns() const { return _columns; }
+
+    // Index of the column with the given name, -1 if there is no such column
+    int FindColumn(const std::string& name) const;
+
+    // Data of column `column` (index in Columns()) for sample `sample_index`
+    ColumnarSampleData Get(int column, int64_t sample_index) const;
+
+    // String with the given id from the string table
+    std::string_view String(int64_t string_id) const;
+
+    // Index of the sample with the given key, -1 if there is no such sample (or the store has no keys)
+    int64_t IndexOf(std::string_view key) const;
+
+   private:
+    // Check that the range [offset, offset + size) lies inside the file
+    void CheckRange(uint64_t offset, uint64_t size, const char* what) const;
+    // Check that the `num_offsets` offsets are non-decreasing (the last offset is checked by the caller)
+    void CheckMonotonic(const uint64_t* offsets, uint64_t num_offsets, const std::string& what) const;
+
+    std::string _path;
+    const uint8_t* _mapped = nullptr;
+    size_t _size = 0;
+
+    int64_t _num_samples = 0;
+    std::vector<ColumnarColumn> _columns;
+    uint64_t _num_strings = 0;
+    const uint64_t* _string_offsets = nullptr;
+    const char* _string_data = nullptr;
+    const uint32_t* _sample_keys = nullptr;
+    const uint64_t* _sorted_keys = nullptr;
+};
+
+}  // namespace custom_operators
+
+#endif
@@ -0,0 +1,252 @@
+/*
+ * Copyright (c) 2025, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "ConditionEval.h"
+
+#include <algorithm>
+#include <string>
+
+#include "dali/core/static_switch.h"
+
+namespace custom_operators {
+
+// Number of elements of a 1D field (or a 2D field with one dimension of size 1)
+static int64_t get_num_elements(const ::dali::TensorShape<>& shape, int input_idx) {
+    DALI_ENFORCE(shape.size() == 1 || (shape.size() == 2 && (shape[0] == 1 || shape[1] == 1)),
+                 "Input " + std::to_string(input_idx) +
+                     " has to be 1D (or 2D with one dimension of size 1), got " +
+                     std::to_string(shape.size()) + " dimensions");
+    return ::dali::volume(shape);
+}
+
+template <typename T>
+static void load_as_float(const T* data, int64_t num_data_elements, int64_t num_elements, float* out) {
+    if (num_data_elements == 1) {
+        std::fill(out, out + num_elements, static_cast<float>(data[0]));
+    } else {
+        for (int64_t i = 0; i < num_elements; ++i) {
+            out[i] = static_cast<float>(data[i]);
+        }
+    }
+}
+
+template <typename Op>
+static void apply_binary(float* lhs, const float* rhs, int64_t num_elements, Op op) {
+    for (int64_t i = 0; i < num_elements; ++i) {
+        lhs[i] = op(lhs[i], rhs[i]) ? 1.0f : 0.0f;
+    }
+}
+
+ConditionEval::ConditionEval(const ::dali::OpSpec& spec)
+    : ::dali::Operator<::dali::CPUBackend>(spec),
+      _constants(spec.GetRepeatedArgument<float>("constants")) {
+    const std::vector<int> program = spec.GetRepeatedArgument<int>("program");
+    DALI_ENFORCE(program.size() % 2 == 0, "program has to consist of (op_code, operand) pairs");
+
+    // Validate the program & determine the needed stack size
+    int depth = 0;
+    for (size_t i = 0; i < program.size(); i += 2) {
+        const auto op_code = static_cast<ConditionOpCode>(program[i]);
+        const int32_t operand = program[i + 1];
+        switch (op_code) {
+            case ConditionOpCode::LoadInput:
+                DALI_ENFORCE(operand >= 0, "Invalid input index in program");
+                _num_used_inputs = std::max(_num_used_inputs, operand + 1);
+                ++depth;
+                break;
+            case ConditionOpCode::LoadConst:
+                DALI_ENFORCE(operand >= 0 && operand < static_cast<int32_t>(_constants.size()),
+                             "Invalid constant index in program");
+                ++depth;
+                break;
+            case ConditionOpCode::Neg:
+            case ConditionOpCode::Not:
+            case ConditionOpCode::ToBool:
+                DALI_ENFORCE(depth >= 1, "Stack underflow in program");
+                break;
+            case ConditionOpCode::Eq:
+            case ConditionOpCode::Ne:
+            case ConditionOpCode::Lt:
+            case ConditionOpCode::Gt:
+            case ConditionOpCode::Le:
+            case ConditionOpCode::Ge:
+            case ConditionOpCode::And:
+            case ConditionOpCode::Or:
+                DALI_ENFORCE(depth >= 2, "Stack underflow in program");
+                --depth;
+                break;
+            default:
+                DALI_FAIL("Unknown op code in program: " + std::to_string(program[i]));
+        }
+        _max_stack_depth = std::max(_max_stack_depth, depth);
+        _program.push_back(ConditionInstruction{op_code, operand});
+    }
+    DALI_ENFORCE(depth == 1, "program has to leave exactly one value on the stack");
+}
+
+ConditionEval::~ConditionEval() {}
+
+bool ConditionEval::SetupImpl(std::vector<::dali::OutputDesc>& output_desc, const ::dali::Workspace& ws) {
+    const int num_inputs = ws.NumInput();
+    DALI_ENFORCE(num_inputs >= _num_used_inputs, "program uses " + std::to_string(_num_used_inputs) +
+                                                     " inputs, but only " + std::to_string(num_inputs) +
+                                                     " are given");
+    const int batch_size = ws.Input<::dali::CPUBackend>(0).shape().num_samples();
+
+    // Determine the number of elements of each sample (inputs with one element are broadcast)
+    _num_elements.assign(batch_size, 1);
+    std::vector<::dali::TensorShape<>> shapes;
+    shapes.reserve(batch_size);
+    for (int s = 0; s < batch_size; ++s) {
+        bool is_set = false;
+        for (int i = 0; i < num_inputs; ++i) {
+            const int64_t num_elements = get_num_elements(ws.Input<::dali::CPUBackend>(i).shape()[s], i);
+            if (num_elements == 1) {
+                continue;
+            }
+            DALI_ENFORCE(!is_set || num_elements == _num_elements[s],
+                         "Inputs of sample " + std::to_string(s) + " have different numbers of elements (" +
+                             std::to_string(_num_elements[s]) + " and " + std::to_string(num_elements) + ")");
+            _num_elements[s] = num_elements;
+            is_set = true;
+        }
+        shapes.push_back(::dali::TensorShape<>{_num_elements[s]});
+    }
+
+    output_desc.resize(1);
+    output_desc[0].shape = ::dali::TensorListShape<>(shapes);
+    output_desc[0].type = ::dali::DALIDataType::DALI_BOOL;
+    return true;
+}
+
+void ConditionEval::EvaluateSample(const ::dali::Workspace& ws, int s, int64_t num_elements,
+                                   std::vector<float>& stack, bool* result) const {
+    stack.resize(static_cast<size_t>(_max_stack_depth) * num_elements);
+    int depth = 0;
+    // Values of the top-most stack entry
+    auto top = [&]() { return stack.data() + (depth - 1) * num_elements; };
+
+    for (const ConditionInstruction& instruction : _program) {
+        switch (instruction.op_code) {
+            case ConditionOpCode::LoadInput: {
+                const auto& input = ws.Input<::dali::CPUBackend>(instruction.operand);
+                const int64_t num_data_elements = ::dali::volume(input.shape()[s]);
+                ++depth;
+                float* out = top();
+                TYPE_SWITCH(input.type(), ::dali::type2id, T,
+                            (bool, uint8_t, int8_t, uint16_t, int16_t, uint32_t, int32_t, uint64_t, int64_t,
+                             float, double),
+                            (load_as_float(static_cast<const T*>(input.raw_tensor(s)), num_data_elements,
+                                           num_elements, out);),
+                            (DALI_FAIL("Unsupported input type for condition evaluation")));
+                break;
+            }
+            case ConditionOpCode::LoadConst: {
+                ++depth;
+                std::fill(top(), top() + num_elements, _constants[instruction.operand]);
+                break;
+            }
+            case ConditionOpCode::Neg: {
+                float* values = top();
+                for (int64_t i = 0; i < num_elements; ++i) values[i] = -values[i];
+                break;
+            }
+            case ConditionOpCode::Not: {
+                float* values = top();
+                for (int64_t i = 0; i < num_elements; ++i) values[i] = values[i] != 0.0f ? 0.0f : 1.0f;
+                break;
+            }
+            case ConditionOpCode::ToBool: {
+                float* values = top();
+                for (int64_t i = 0; i < num_elements; ++i) values[i] = values[i] != 0.0f ? 1.0f : 0.0f;
+                break;
+            }
+            default: {
+                // Binary operation: combine the two top-most values, leaving the result in place of the lower
+                const float* rhs = top();
+                --depth;
+                float* lhs = top();
+                switch (instruction.op_code) {
+                    case ConditionOpCode::Eq:
+                        apply_binary(lhs, rhs, num_elements, [](float a, float b) { return a == b; });
+                        break;
+                    case ConditionOpCode::Ne:
+                        apply_binary(lhs, rhs, num_elements, [](float a, float b) { return a != b; });
+                        break;
+                    case ConditionOpCode::Lt:
+                        apply_binary(lhs, rhs, num_elements, [](float a, float b) { return a < b; });
+                        break;
+                    case ConditionOpCode::Gt:
+                        apply_binary(lhs, rhs, num_elements, [](float a, float b) { return a > b; });
+                        break;
+                    case ConditionOpCode::Le:
+                        apply_binary(lhs, rhs, num_elements, [](float a, float b) { return a <= b; });
+                        break;
+                    case ConditionOpCode::Ge:
+                        apply_binary(lhs, rhs, num_elements, [](float a, float b) { return a >= b; });
+                        break;
+                    case ConditionOpCode::And:
+                        apply_binary(lhs, rhs, num_elements,
+                                     [](float a, float b) { return a != 0.0f && b != 0.0f; });
+                        break;
+                    case ConditionOpCode::Or:
+                        apply_binary(lhs, rhs, num_elements,
+                                     [](float a, float b) { return a != 0.0f || b != 0.0f; });
+                        break;
+                    default:
+                        DALI_FAIL("Unknown op code in program");
+                }
+                break;
+            }
+        }
+    }
+
+    const float* values = top();
+    for (int64_t i = 0; i < num_elements; ++i) {
+        result[i] = values[i] != 0.0f;
+    }
+}
+
+void ConditionEval::RunImpl(::dali::Workspace& ws) {
+    auto& output = ws.Output<::dali::CPUBackend>(0);
+    const int batch_size = static_cast<int>(_num_elements.size());
+
+    auto& thread_pool = ws.GetThreadPool();
+    for (int s = 0; s < batch_size; ++s) {
+        thread_pool.AddWork(
+            [s, &ws, &output, this](int thread_id) {
+                // Scratch memory for the value stack
+                std::vector<float> stack;
+                bool* result = static_cast<bool*>(output.raw_mutable_tensor(s));
+                this->EvaluateSample(ws, s, this->_num_elements[s], stack, result);
+            },
+            _num_elements[s]);
+    }
+    thread_pool.RunAll();
+}
+
+}  // namespace custom_operators
+
+DALI_REGISTER_OPERATOR(condition_eval, ::custom_operators::ConditionEval, ::dali::CPU);
+
+DALI_SCHEMA(condition_eval)
+    .DocStr(
+        "Element-wise evaluation of a condition compiled to bytecode on 1D inputs, producing a boolean mask")
+    .NumInput(1, 64)
+    .NumOutput(1)
+    .AddArg("program", "Bytecode of the condition as flattened (op_code, operand) pairs",
+            ::dali::DALIDataType::DALI_INT_VEC)
+    .AddOptionalArg("constants", "Constants referenced by the program", std::vector<float>());
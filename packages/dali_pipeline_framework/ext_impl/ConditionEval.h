@@ -0,0 +1,96 @@
+/*
+ * Copyright (c) 2025, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef CONDITION_EVAL_H_
+#define CONDITION_EVAL_H_
+
+#include <cstdint>
+#include <vector>
+
+#include "dali/core/error_handling.h"
+#include "dali/pipeline/data/types.h"
+#include "dali/pipeline/operator/operator.h"
+
+namespace custom_operators {
+
+// Op codes of the condition bytecode. Has to match `OpCode` in `internal_helpers/mini_parser/bytecode.py`.
+enum class ConditionOpCode : int32_t {
+    LoadInput = 0,  // Operand: index of the input
+    LoadConst = 1,  // Operand: index of the constant
+    Neg = 2,
+    Not = 3,
+    Eq = 4,
+    Ne = 5,
+    Lt = 6,
+    Gt = 7,
+    Le = 8,
+    Ge = 9,
+    And = 10,
+    Or = 11,
+    ToBool = 12,
+};
+
+struct ConditionInstruction {
+    ConditionOpCode op_code;
+    int32_t operand;
+};
+
+/**
+ * Evaluates a condition, compiled to a stack-based bytecode, element-wise on 1D inputs.
+ *
+ * This is the native counterpart of building the condition from individual DALI arithmetic operators (as
+ * done by the Python `AnnotationElementConditionEval` step). All values are evaluated as float (as in the
+ * Python implementation, where the operands of comparisons are cast to float), logical operators treat
+ * non-zero values as `true`, and the result is a boolean mask.
+ *
+ * Each input is one data field (1D, or 2D with one dimension of size 1). Inputs with a single element are
+ * broadcast, all other inputs of a sample have to have the same number of elements. The whole program is
+ * evaluated per sample in one pass over the instructions, each instruction being applied to all elements.
+ * Samples are processed in parallel on the thread pool of the pipeline.
+ */
+class ConditionEval : public ::dali::Operator<::dali::CPUBackend> {
+   public:
+    explicit ConditionEval(const ::dali::OpSpec& spec);
+
+    virtual ~ConditionEval();
+
+    ConditionEval(const ConditionEval&) = delete;
+    ConditionEval& operator=(const ConditionEval&) = delete;
+    ConditionEval(ConditionEval&&) = delete;
+    ConditionEval& operator=(ConditionEval&&) = delete;
+
+   protected:
+    bool SetupImpl(std::vector<::dali::OutputDesc>& output_desc, const ::dali::Workspace& ws) override;
+
+    void RunImpl(::dali::Workspace& ws) override;
+
+   private:
+    // Evaluate the program for sample `s`, using `stack` as scratch memory
+    void EvaluateSample(const ::dali::Workspace& ws, int s, int64_t num_elements, std::vector<float>& stack,
+                        bool* result) const;
+
+    std::vector<ConditionInstruction> _program;
+    std::vector<float> _constants;
+    int _max_stack_depth = 0;
+    int _num_used_inputs = 0;
+
+    // Number of elements of the result of each sample of the current batch
+    std::vector<int64_t> _num_elements;
+};
+
+}  // namespace custom_operators
+
+#endif
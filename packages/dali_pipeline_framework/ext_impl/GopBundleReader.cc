@@ -0,0 +1,390 @@
+/*
+ * Copyright (c) 2025, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "GopBundleReader.h"
+
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <numeric>
+#include <sstream>
+#include <unordered_map>
+
+namespace custom_operators {
+
+template <typename T>
+static T read_value(const uint8_t* data, size_t size, size_t& pos, const std::string& what) {
+    if (pos > size || size - pos < sizeof(T)) {
+        DALI_FAIL("Truncated GOP bundle (" + what + " at byte " + std::to_string(pos) + " of " +
+                  std::to_string(size) + ")");
+    }
+    T value;
+    std::memcpy(&value, data + pos, sizeof(T));
+    pos += sizeof(T);
+    return value;
+}
+
+/*
+ * Validate a serialized GOP bundle and return the metadata of its frames.
+ *
+ * Same layout as parsed by PyNvGopDecoder::parseSerializedPacketData:
+ * - Header: uint32 total_frames, followed by size_t frame_offsets[total_frames]
+ * - Per frame (at its offset): 7 x int32 metadata (color_range, codec_id, width, height, frame_size, gop_len,
+ *   first_frame_id), uint32 + int32[] packet sizes, uint32 + int32[] decode indices, uint64 + uint8[] packet
+ *   data
+ *
+ * In contrast to the decoder (which trusts its own output), all offsets and sizes are checked against the
+ * bundle size, as the data comes from files.
+ */
+static std::vector<GopBundleFrameInfo> parse_gop_bundle(const uint8_t* data, size_t size) {
+    size_t pos = 0;
+    const uint32_t total_frames = read_value<uint32_t>(data, size, pos, "total_frames");
+    if (total_frames > (size - pos) / sizeof(size_t)) {
+        DALI_FAIL("Truncated GOP bundle (offset table of " + std::to_string(total_frames) + " frames)");
+    }
+    const size_t header_size = pos + total_frames * sizeof(size_t);
+
+    std::vector<GopBundleFrameInfo> frames(total_frames);
+    for (uint32_t i = 0; i < total_frames; ++i) {
+        size_t frame_pos = read_value<size_t>(data, size, pos, "frame offset");
+        if (frame_pos < header_size || frame_pos >= size) {
+            DALI_FAIL("Invalid offset " + std::to_string(frame_pos) + " of frame " + std::to_string(i) +
+                      " in GOP bundle of size " + std::to_string(size));
+        }
+        GopBundleFrameInfo& frame = frames[i];
+        frame.color_range = read_value<int32_t>(data, size, frame_pos, "color_range");
+        frame.codec_id = read_value<int32_t>(data, size, frame_pos, "codec_id");
+        frame.width = read_value<int32_t>(data, size, frame_pos, "width");
+        frame.height = read_value<int32_t>(data, size, frame_pos, "height");
+        frame.frame_size = read_value<int32_t>(data, size, frame_pos, "frame_size");
+        frame.gop_len = read_value<int32_t>(data, size, frame_pos, "gop_len");
+        frame.first_frame_id = read_value<int32_t>(data, size, frame_pos, "first_frame_id");
+
+        const uint32_t num_packets = read_value<uint32_t>(data, size, frame_pos, "packet count");
+        if (num_packets > (size - frame_pos) / sizeof(int32_t)) {
+            DALI_FAIL("Truncated GOP bundle (packet sizes of frame " + std::to_string(i) + ")");
+        }
+        uint64_t packets_total_size = 0;
+        for (uint32_t p = 0; p < num_packets; ++p) {
+            const int32_t packet_size = read_value<int32_t>(data, size, frame_pos, "packet size");
+            if (packet_size < 0) {
+                DALI_FAIL("Negative packet size in frame " + std::to_string(i) + " of GOP bundle");
+            }
+            packets_total_size += static_cast<uint64_t>(packet_size);
+        }
+
+        const uint32_t num_decode_idxs = read_value<uint32_t>(data, size, frame_pos, "decode index count");
+        if (num_decode_idxs != num_packets) {
+            DALI_FAIL("Mismatch of packet count (" + std::to_string(num_packets) +
+                      ") and decode index count (" + std::to_string(num_decode_idxs) + ") in frame " +
+                      std::to_string(i) + " of GOP bundle");
+        }
+        if (num_decode_idxs > (size - frame_pos) / sizeof(int32_t)) {
+            DALI_FAIL("Truncated GOP bundle (decode indices of frame " + std::to_string(i) + ")");
+        }
+        frame_pos += num_decode_idxs * sizeof(int32_t);
+
+        const uint64_t payload_size = read_value<uint64_t>(data, size, frame_pos, "packet data size");
+        if (payload_size != packets_total_size) {
+            DALI_FAIL("Packet data size (" + std::to_string(payload_size) + ") of frame " +
+                      std::to_string(i) + " does not match the sum of the packet sizes (" +
+                      std::to_string(packets_total_size) + ") in GOP bundle");
+        }
+        if (payload_size > size - frame_pos) {
+            DALI_FAIL("Truncated GOP bundle (packet data of frame " + std::to_string(i) + ")");
+        }
+        frame.num_packets = static_cast<int32_t>(num_packets);
+        frame.payload_offset = static_cast<int64_t>(frame_pos);
+        frame.payload_size = static_cast<int64_t>(payload_size);
+    }
+    return frames;
+}
+
+static void load_gop_bundle(const GopBundleSource& source, std::vector<uint8_t>& buffer) {
+    std::ifstream file(source.path, std::ios::binary);
+    if (!file.is_open()) {
+        DALI_FAIL("Failed to open GOP bundle file: " + source.path);
+    }
+    uint64_t size = source.size;
+    if (size == 0) {
+        file.seekg(0, std::ios::end);
+        size = static_cast<uint64_t>(file.tellg());
+    }
+    buffer.resize(size);
+    file.seekg(static_cast<std::streamoff>(source.offset));
+    file.read(reinterpret_cast<char*>(buffer.data()), static_cast<std::streamsize>(size));
+    if (!file || static_cast<uint64_t>(file.gcount()) != size) {
+        DALI_FAIL("Failed to read " + std::to_string(size) + " bytes at offset " +
+                  std::to_string(source.offset) + " from GOP bundle file: " + source.path);
+    }
+}
+
+static std::vector<std::string> split_tabs(const std::string& line) {
+    std::vector<std::string> fields;
+    std::stringstream stream(line);
+    std::string field;
+    while (std::getline(stream, field, '\t')) {
+        fields.push_back(field);
+    }
+    return fields;
+}
+
+static uint64_t parse_index_number(const std::string& field, const std::string& index_file,
+                                   const std::string& line) {
+    size_t pos = 0;
+    uint64_t value = 0;
+    try {
+        value = std::stoull(field, &pos);
+    } catch (const std::exception&) {
+        pos = 0;
+    }
+    DALI_ENFORCE(!field.empty() && field.front() != '-' && pos == field.size(),
+                 "Invalid number '" + field + "' in GOP index file " + index_file + ": " + line);
+    return value;
+}
+
+/*
+ * Bundles of the completed jobs of a GOP extraction index (`gop_index.tsv`). The same rules as in the
+ * extraction driver apply: records of jobs without their terminating `J` record (interrupted extraction) are
+ * ignored, and as records are only appended after the data is on disk, parsing stops at the first torn or
+ * corrupt record (including a `J` record whose GOP count does not match the collected `G` records).
+ */
+static std::vector<GopBundleSource> read_gop_extraction_index(const std::string& index_file) {
+    std::ifstream file(index_file, std::ios::binary);
+    if (!file.is_open()) {
+        DALI_FAIL("Failed to open GOP index file: " + index_file);
+    }
+    const std::string content((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+    const size_t dir_end = index_file.find_last_of('/');
+    const std::string dir = dir_end == std::string::npos ? std::string() : index_file.substr(0, dir_end + 1);
+
+    std::vector<GopBundleSource> sources;
+    std::unordered_map<uint64_t, std::vector<GopBundleSource>> open_jobs;
+    uint64_t num_jobs = 0;
+    bool has_header = false;
+    size_t pos = 0;
+    while (pos < content.size()) {
+        const size_t end = content.find('\n', pos);
+        if (end == std::string::npos) {
+            break;  // Incomplete last record (interrupted write)
+        }
+        const std::string line = content.substr(pos, end - pos);
+        pos = end + 1;
+        const std::vector<std::string> fields = split_tabs(line);
+
+        if (!has_header) {
+            DALI_ENFORCE(fields.size() == 3 && fields[0] == "M", "Invalid GOP index header in " + index_file);
+            num_jobs = parse_index_number(fields[1], index_file, line);
+            has_header = true;
+        } else if (fields.size() == 9 && fields[0] == "G") {
+            const uint64_t job_id = parse_index_number(fields[1], index_file, line);
+            GopBundleSource source;
+            source.path = dir + fields[5];
+            source.offset = parse_index_number(fields[6], index_file, line);
+            source.size = parse_index_number(fields[7], index_file, line);
+            if (source.size == 0) {
+                break;
+            }
+            open_jobs[job_id].push_back(std::move(source));
+        } else if (fields.size() == 3 && fields[0] == "J") {
+            const uint64_t job_id = parse_index_number(fields[1], index_file, line);
+            const uint64_t num_gops = parse_index_number(fields[2], index_file, line);
+            auto job = open_jobs.find(job_id);
+            const size_t num_collected = job == open_jobs.end() ? 0 : job->second.size();
+            if (job_id >= num_jobs || num_collected != num_gops) {
+                break;
+            }
+            if (job != open_jobs.end()) {
+                sources.insert(sources.end(), job->second.begin(), job->second.end());
+                open_jobs.erase(job);
+            }
+        } else {
+            break;
+        }
+    }
+    return sources;
+}
+
+GopBundleReader::GopBundleReader(const ::dali::OpSpec& spec)
+    : ::dali::Operator<::dali::CPUBackend>(spec),
+      _batch_size(spec.GetArgument<int>("max_batch_size")),
+      _shard_id(spec.GetArgument<int>("shard_id")),
+      _num_shards(spec.GetArgument<int>("num_shards")),
+      _random_shuffle(spec.GetArgument<bool>("random_shuffle")),
+      _stick_to_shard(spec.GetArgument<bool>("stick_to_shard")),
+      _pad_last_batch(spec.GetArgument<bool>("pad_last_batch")),
+      _rng(spec.GetArgument<int64_t>("seed")) {
+    const std::vector<std::string> files = spec.GetRepeatedArgument<std::string>("files");
+    const std::string index_file = spec.GetArgument<std::string>("index_file");
+    DALI_ENFORCE(files.empty() != index_file.empty(), "Exactly one of files and index_file has to be set");
+
+    if (!files.empty()) {
+        const std::string file_root = spec.GetArgument<std::string>("file_root");
+        for (const auto& file : files) {
+            GopBundleSource source;
+            source.path = file_root.empty() || file.front() == '/' ? file : file_root + "/" + file;
+            _sources.push_back(std::move(source));
+        }
+    } else {
+        _sources = read_gop_extraction_index(index_file);
+    }
+
+    DALI_ENFORCE(_num_shards > 0, "num_shards has to be positive");
+    DALI_ENFORCE(_shard_id >= 0 && _shard_id < _num_shards, "shard_id has to be in [0, num_shards)");
+    DALI_ENFORCE(_sources.size() >= static_cast<size_t>(_num_shards),
+                 "Fewer GOP bundles (" + std::to_string(_sources.size()) + ") than shards (" +
+                     std::to_string(_num_shards) + ")");
+
+    StartEpoch();
+}
+
+GopBundleReader::~GopBundleReader() {}
+
+void GopBundleReader::StartEpoch() {
+    const int shard = _stick_to_shard ? _shard_id : (_shard_id + _epoch) % _num_shards;
+    const size_t begin = _sources.size() * shard / _num_shards;
+    const size_t end = _sources.size() * (shard + 1) / _num_shards;
+    _epoch_order.resize(end - begin);
+    std::iota(_epoch_order.begin(), _epoch_order.end(), begin);
+    if (_random_shuffle) {
+        std::shuffle(_epoch_order.begin(), _epoch_order.end(), _rng);
+    }
+    _epoch_position = 0;
+    ++_epoch;
+}
+
+::dali::ReaderMeta GopBundleReader::GetReaderMeta() const {
+    ::dali::ReaderMeta meta;
+    const size_t shard_size = _sources.size() * (_shard_id + 1) / _num_shards -
+                              _sources.size() * _shard_id / _num_shards;
+    meta.epoch_size = static_cast<::dali::Index>(_sources.size());
+    const size_t num_batches = (shard_size + _batch_size - 1) / _batch_size;
+    meta.epoch_size_padded = _pad_last_batch
+                                 ? static_cast<::dali::Index>(num_batches * _batch_size * _num_shards)
+                                 : meta.epoch_size;
+    meta.number_of_shards = _num_shards;
+    meta.shard_id = _shard_id;
+    meta.pad_last_batch = _pad_last_batch;
+    meta.stick_to_shard = _stick_to_shard;
+    return meta;
+}
+
+bool GopBundleReader::SetupImpl(std::vector<::dali::OutputDesc>& output_desc, const ::dali::Workspace& ws) {
+    // Select the samples of this batch. With pad_last_batch, the last batch of an epoch is filled up by
+    // repeating its last sample, otherwise it continues with the next epoch.
+    std::vector<size_t> batch_sources;
+    batch_sources.reserve(_batch_size);
+    for (int i = 0; i < _batch_size; ++i) {
+        if (_epoch_position == _epoch_order.size()) {
+            if (_pad_last_batch && i > 0) {
+                batch_sources.push_back(batch_sources.back());
+                continue;
+            }
+            StartEpoch();
+        }
+        batch_sources.push_back(_epoch_order[_epoch_position++]);
+    }
+
+    // Load and validate the bundles on the thread pool of the pipeline
+    _bundles.resize(_batch_size);
+    _frame_infos.resize(_batch_size);
+    auto& thread_pool = ws.GetThreadPool();
+    for (int s = 0; s < _batch_size; ++s) {
+        thread_pool.AddWork([s, &batch_sources, this](int thread_id) {
+            const GopBundleSource& source = this->_sources[batch_sources[s]];
+            load_gop_bundle(source, this->_bundles[s]);
+            try {
+                const std::vector<uint8_t>& bundle = this->_bundles[s];
+                this->_frame_infos[s] = parse_gop_bundle(bundle.data(), bundle.size());
+            } catch (const ::dali::DALIException& e) {
+                DALI_FAIL(std::string(e.what()) + " (" + source.path + ", offset " +
+                          std::to_string(source.offset) + ")");
+            }
+        });
+    }
+    thread_pool.RunAll();
+
+    std::vector<::dali::TensorShape<>> data_shapes;
+    std::vector<::dali::TensorShape<>> frame_info_shapes;
+    std::vector<::dali::TensorShape<>> payload_range_shapes;
+    for (int s = 0; s < _batch_size; ++s) {
+        const int64_t num_frames = static_cast<int64_t>(_frame_infos[s].size());
+        data_shapes.push_back(::dali::TensorShape<>{static_cast<int64_t>(_bundles[s].size())});
+        frame_info_shapes.push_back(::dali::TensorShape<>{num_frames, kGopBundleFrameInfoColumns});
+        payload_range_shapes.push_back(::dali::TensorShape<>{num_frames, 2});
+    }
+
+    output_desc.resize(3);
+    output_desc[0].shape = ::dali::TensorListShape<>(data_shapes);
+    output_desc[0].type = ::dali::DALIDataType::DALI_UINT8;
+    output_desc[1].shape = ::dali::TensorListShape<>(frame_info_shapes);
+    output_desc[1].type = ::dali::DALIDataType::DALI_INT32;
+    output_desc[2].shape = ::dali::TensorListShape<>(payload_range_shapes);
+    output_desc[2].type = ::dali::DALIDataType::DALI_INT64;
+    return true;
+}
+
+void GopBundleReader::RunImpl(::dali::Workspace& ws) {
+    auto& data = ws.Output<::dali::CPUBackend>(0);
+    auto& frame_info = ws.Output<::dali::CPUBackend>(1);
+    auto& payload_ranges = ws.Output<::dali::CPUBackend>(2);
+
+    auto& thread_pool = ws.GetThreadPool();
+    for (int s = 0; s < _batch_size; ++s) {
+        thread_pool.AddWork([s, &data, &frame_info, &payload_ranges, this](int thread_id) {
+            const std::vector<uint8_t>& bundle = this->_bundles[s];
+            std::memcpy(data.raw_mutable_tensor(s), bundle.data(), bundle.size());
+
+            int32_t* frame_info_sample = static_cast<int32_t*>(frame_info.raw_mutable_tensor(s));
+            int64_t* payload_ranges_sample = static_cast<int64_t*>(payload_ranges.raw_mutable_tensor(s));
+            for (const GopBundleFrameInfo& frame : this->_frame_infos[s]) {
+                const int32_t row[kGopBundleFrameInfoColumns] = {
+                    frame.color_range, frame.codec_id, frame.width,          frame.height,
+                    frame.frame_size,  frame.gop_len,  frame.first_frame_id, frame.num_packets};
+                std::memcpy(frame_info_sample, row, sizeof(row));
+                frame_info_sample += kGopBundleFrameInfoColumns;
+                *payload_ranges_sample++ = frame.payload_offset;
+                *payload_ranges_sample++ = frame.payload_size;
+            }
+        });
+    }
+    thread_pool.RunAll();
+}
+
+}  // namespace custom_operators
+
+DALI_REGISTER_OPERATOR(gop_bundle_reader, ::custom_operators::GopBundleReader, ::dali::CPU);
+
+DALI_SCHEMA(gop_bundle_reader)
+    .DocStr(
+        "Read serialized GOP bundles (from bundle files, or packed in the shard files of a GOP extraction "
+        "index). Outputs the bundle data, the per-frame metadata (color_range, codec_id, width, height, "
+        "frame_size, gop_len, first_frame_id, num_packets) and the range (offset, size) of the packet data "
+        "of each frame in the bundle")
+    .NumInput(0)
+    .NumOutput(3)
+    .AddOptionalArg("files", "List of GOP bundle files (one sample per file)", std::vector<std::string>())
+    .AddOptionalArg("file_root", "Directory prepended to relative paths in files", std::string())
+    .AddOptionalArg("index_file",
+                    "GOP extraction index (gop_index.tsv); one sample per GOP bundle of the completed jobs",
+                    std::string())
+    .AddOptionalArg("shard_id", "Index of the shard to read", 0)
+    .AddOptionalArg("num_shards", "Number of shards the data is split into", 1)
+    .AddOptionalArg("random_shuffle", "Shuffle the samples of the shard in each epoch", false)
+    .AddOptionalArg("stick_to_shard",
+                    "Keep reading the same shard in each epoch (otherwise, move to the next shard)", false)
+    .AddOptionalArg("pad_last_batch", "Pad the last batch of an epoch by repeating its last sample", false);
@@ -0,0 +1,107 @@
+/*
+ * Copyright (c) 2025, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef GOP_BUNDLE_READER_H_
+#define GOP_BUNDLE_READER_H_
+
+#include <cstdint>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "dali/core/error_handling.h"
+#include "dali/pipeline/data/types.h"
+#include "dali/pipeline/operator/operator.h"
+
+namespace custom_operators {
+
+// Location of one serialized GOP bundle (a whole file if `size` is 0)
+struct GopBundleSource {
+    std::string path;
+    uint64_t offset = 0;
+    uint64_t size = 0;
+};
+
+// Metadata of one frame entry of a serialized GOP bundle
+struct GopBundleFrameInfo {
+    int32_t color_range;
+    int32_t codec_id;
+    int32_t width;
+    int32_t height;
+    int32_t frame_size;
+    int32_t gop_len;
+    int32_t first_frame_id;
+    int32_t num_packets;
+    int64_t payload_offset;  // Offset of the concatenated packet data in the bundle
+    int64_t payload_size;
+};
+
+// Number of columns of the `frame_info` output (the int32 fields of GopBundleFrameInfo)
+constexpr int kGopBundleFrameInfoColumns = 8;
+
+/**
+ * Reads serialized GOP bundles (as written by PyNvGopDecoder::GetGOP / SavePacketsToFile, or packed into
+ * shard files by the GOP extraction driver) inside the pipeline.
+ *
+ * Each sample is one bundle. The bundles are loaded and validated in SetupImpl() on the thread pool of the
+ * pipeline, so GOP I/O is part of the prefetching of the pipeline. Sharding, shuffling and epoch handling
+ * follow the conventions of the DALI file readers (`shard_id`, `num_shards`, `random_shuffle`,
+ * `stick_to_shard`, `pad_last_batch`).
+ */
+class GopBundleReader : public ::dali::Operator<::dali::CPUBackend> {
+   public:
+    explicit GopBundleReader(const ::dali::OpSpec& spec);
+
+    virtual ~GopBundleReader();
+
+    GopBundleReader(const GopBundleReader&) = delete;
+    GopBundleReader& operator=(const GopBundleReader&) = delete;
+    GopBundleReader(GopBundleReader&&) = delete;
+    GopBundleReader& operator=(GopBundleReader&&) = delete;
+
+    ::dali::ReaderMeta GetReaderMeta() const override;
+
+   protected:
+    bool SetupImpl(std::vector<::dali::OutputDesc>& output_desc, const ::dali::Workspace& ws) override;
+
+    void RunImpl(::dali::Workspace& ws) override;
+
+   private:
+    // Select the shard of the next epoch and (optionally) shuffle its samples
+    void StartEpoch();
+
+    std::vector<GopBundleSource> _sources;
+
+    int _batch_size;
+    int _shard_id;
+    int _num_shards;
+    bool _random_shuffle;
+    bool _stick_to_shard;
+    bool _pad_last_batch;
+    std::mt19937_64 _rng;
+
+    int _epoch = 0;
+    std::vector<size_t> _epoch_order;  // Source indices of the current epoch
+    size_t _epoch_position = 0;
+
+    // Loaded bundles of the current batch
+    std::vector<std::vector<uint8_t>> _bundles;
+    std::vector<std::vector<GopBundleFrameInfo>> _frame_infos;
+};
+
+}  // namespace custom_operators
+
+#endif
@@ -0,0 +1,272 @@
+/*
+ * Copyright (c) 2025, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "PackedRecordReader.h"
+
+#include <fcntl.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <unordered_map>
+#include <utility>
+
+namespace custom_operators {
+
+// Index of a non-ragged column of the record index (has to match `PACKED_RECORD_INDEX_COLUMNS`)
+static int find_index_column(const ColumnarStore& index, const std::string& name, bool is_string,
+                             const std::string& index_file) {
+    const int column = index.FindColumn(name);
+    DALI_ENFORCE(column >= 0, "Column '" + name + "' missing in packed record index: " + index_file);
+    const ColumnarColumn& c = index.Columns()[column];
+    const bool type_matches = is_string ? (c.is_string && c.dtype == ColumnarDType::Int32)
+                                        : (!c.is_string && c.dtype == ColumnarDType::UInt64);
+    DALI_ENFORCE(!c.is_ragged && c.element_shape.empty() && type_matches,
+                 "Unexpected format of column '" + name + "' in packed record index: " + index_file);
+    return column;
+}
+
+template <typename T>
+static T get_index_value(const ColumnarStore& index, int column, int64_t record) {
+    return *static_cast<const T*>(index.Get(column, record).data);
+}
+
+// Read `size` bytes at `offset`, failing on errors & if the file ends before
+static void pread_fully(const PackedRecordShard& shard, uint8_t* out, uint64_t size, uint64_t offset) {
+    while (size > 0) {
+        const ssize_t num_read = ::pread(shard.fd, out, size, static_cast<off_t>(offset));
+        if (num_read < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            DALI_FAIL("Failed to read " + std::to_string(size) + " bytes at offset " +
+                      std::to_string(offset) + " from record shard " + shard.path + ": " +
+                      std::strerror(errno));
+        }
+        if (num_read == 0) {
+            DALI_FAIL("Truncated record shard (offset " + std::to_string(offset) + "): " + shard.path);
+        }
+        out += num_read;
+        offset += static_cast<uint64_t>(num_read);
+        size -= static_cast<uint64_t>(num_read);
+    }
+}
+
+PackedRecordShard::PackedRecordShard(PackedRecordShard&& other) noexcept
+    : path(std::move(other.path)), fd(other.fd) {
+    other.fd = -1;
+}
+
+PackedRecordShard& PackedRecordShard::operator=(PackedRecordShard&& other) noexcept {
+    std::swap(path, other.path);
+    std::swap(fd, other.fd);
+    return *this;
+}
+
+PackedRecordShard::~PackedRecordShard() {
+    if (fd >= 0) {
+        ::close(fd);
+    }
+}
+
+PackedRecordReader::PackedRecordReader(const ::dali::OpSpec& spec)
+    : ::dali::Operator<::dali::CPUBackend>(spec),
+      _read_annotations(spec.GetArgument<bool>("read_annotations")),
+      _max_gap(static_cast<uint64_t>(spec.GetArgument<int64_t>("max_gap"))),
+      _max_read_size(static_cast<uint64_t>(spec.GetArgument<int64_t>("max_read_size"))),
+      _read_ahead(static_cast<uint64_t>(spec.GetArgument<int64_t>("read_ahead"))) {
+    const std::string index_file = spec.GetArgument<std::string>("index_file");
+    _index = std::make_unique<ColumnarStore>(index_file);
+    const int shard_column = find_index_column(*_index, "shard", true, index_file);
+    _offset_column = find_index_column(*_index, "offset", false, index_file);
+    _size_column = find_index_column(*_index, "size", false, index_file);
+    _annotation_offset_column = find_index_column(*_index, "annotation_offset", false, index_file);
+    _annotation_size_column = find_index_column(*_index, "annotation_size", false, index_file);
+
+    // Open each shard file once. Shard files are located in the directory of the index.
+    const size_t dir_end = index_file.find_last_of('/');
+    const std::string dir = dir_end == std::string::npos ? std::string() : index_file.substr(0, dir_end + 1);
+    std::unordered_map<int32_t, int32_t> shard_of_name;
+    _record_shards.resize(_index->NumSamples());
+    for (int64_t r = 0; r < _index->NumSamples(); ++r) {
+        const int32_t name_id = get_index_value<int32_t>(*_index, shard_column, r);
+        auto shard = shard_of_name.find(name_id);
+        if (shard == shard_of_name.end()) {
+            PackedRecordShard new_shard;
+            new_shard.path = dir + std::string(_index->String(name_id));
+            new_shard.fd = ::open(new_shard.path.c_str(), O_RDONLY | O_CLOEXEC);
+            if (new_shard.fd < 0) {
+                DALI_FAIL("Failed to open record shard: " + new_shard.path);
+            }
+            _shards.push_back(std::move(new_shard));
+            shard = shard_of_name.emplace(name_id, static_cast<int32_t>(_shards.size() - 1)).first;
+        }
+        _record_shards[r] = shard->second;
+    }
+}
+
+PackedRecordReader::~PackedRecordReader() = default;
+
+bool PackedRecordReader::SetupImpl(std::vector<::dali::OutputDesc>& output_desc,
+                                   const ::dali::Workspace& ws) {
+    const int num_inputs = ws.NumInput();
+    const int num_outputs = _read_annotations ? 2 * num_inputs : num_inputs;
+    const int batch_size = ws.Input<::dali::CPUBackend>(0).shape().num_samples();
+    const int64_t num_records = _index->NumSamples();
+
+    // Requests of all inputs & samples. The sizes are known from the index, so that the data can be read
+    // directly into the outputs in RunImpl().
+    _requests.clear();
+    std::vector<std::vector<::dali::TensorShape<>>> shapes(num_outputs);
+    for (int i = 0; i < num_inputs; ++i) {
+        const auto& input = ws.Input<::dali::CPUBackend>(i);
+        DALI_ENFORCE(input.type() == ::dali::DALIDataType::DALI_INT64 ||
+                         input.type() == ::dali::DALIDataType::DALI_INT32,
+                     "Record indices (input " + std::to_string(i) + ") have to be of type INT64 or INT32");
+        for (int s = 0; s < batch_size; ++s) {
+            DALI_ENFORCE(::dali::volume(input.shape()[s]) == 1,
+                         "Input " + std::to_string(i) + " has to contain one record index per sample");
+            const int64_t record = input.type() == ::dali::DALIDataType::DALI_INT64
+                                       ? *static_cast<const int64_t*>(input.raw_tensor(s))
+                                       : *static_cast<const int32_t*>(input.raw_tensor(s));
+            DALI_ENFORCE(record >= 0 && record < num_records,
+                         "Record index " + std::to_string(record) + " out of range [0, " +
+                             std::to_string(num_records) + ")");
+
+            const int shard = _record_shards[record];
+            const uint64_t size = get_index_value<uint64_t>(*_index, _size_column, record);
+            shapes[i].push_back(::dali::TensorShape<>{static_cast<int64_t>(size)});
+            if (size > 0) {
+                _requests.push_back(PackedRecordRequest{
+                    i, s, shard, get_index_value<uint64_t>(*_index, _offset_column, record), size});
+            }
+            if (_read_annotations) {
+                const int o = num_inputs + i;
+                const uint64_t annotation_size =
+                    get_index_value<uint64_t>(*_index, _annotation_size_column, record);
+                shapes[o].push_back(::dali::TensorShape<>{static_cast<int64_t>(annotation_size)});
+                if (annotation_size > 0) {
+                    const uint64_t annotation_offset =
+                        get_index_value<uint64_t>(*_index, _annotation_offset_column, record);
+                    _requests.push_back(PackedRecordRequest{o, s, shard, annotation_offset, annotation_size});
+                }
+            }
+        }
+    }
+    PlanReads();
+
+    output_desc.resize(num_outputs);
+    for (int o = 0; o < num_outputs; ++o) {
+        output_desc[o].shape = ::dali::TensorListShape<>(shapes[o]);
+        output_desc[o].type = ::dali::DALIDataType::DALI_UINT8;
+    }
+    return true;
+}
+
+void PackedRecordReader::PlanReads() {
+    std::sort(_requests.begin(), _requests.end(),
+              [](const PackedRecordRequest& a, const PackedRecordRequest& b) {
+                  return a.shard != b.shard ? a.shard < b.shard : a.offset < b.offset;
+              });
+
+    _reads.clear();
+    for (size_t r = 0; r < _requests.size(); ++r) {
+        const PackedRecordRequest& request = _requests[r];
+        const uint64_t end = request.offset + request.size;
+        if (!_reads.empty()) {
+            PackedRecordRead& read = _reads.back();
+            const uint64_t merged_end = std::max(read.end, end);
+            if (read.shard == request.shard && request.offset <= read.end + _max_gap &&
+                merged_end - read.begin <= _max_read_size) {
+                read.end = merged_end;
+                read.last_request = r + 1;
+                continue;
+            }
+        }
+        _reads.push_back(PackedRecordRead{request.shard, request.offset, end, r, r + 1});
+    }
+}
+
+void PackedRecordReader::PerformRead(const PackedRecordRead& read,
+                                     const std::vector<uint8_t*>& destinations) const {
+    const PackedRecordShard& shard = _shards[read.shard];
+    const PackedRecordRequest& first = _requests[read.first_request];
+    if (read.last_request - read.first_request == 1) {
+        // Single record: read directly into the output
+        pread_fully(shard, destinations[read.first_request], first.size, first.offset);
+        return;
+    }
+    std::vector<uint8_t> buffer(read.end - read.begin);
+    pread_fully(shard, buffer.data(), buffer.size(), read.begin);
+    for (size_t r = read.first_request; r < read.last_request; ++r) {
+        const PackedRecordRequest& request = _requests[r];
+        std::memcpy(destinations[r], buffer.data() + (request.offset - read.begin), request.size);
+    }
+}
+
+void PackedRecordReader::RunImpl(::dali::Workspace& ws) {
+    std::vector<uint8_t*> destinations(_requests.size());
+    for (size_t r = 0; r < _requests.size(); ++r) {
+        const PackedRecordRequest& request = _requests[r];
+        auto& output = ws.Output<::dali::CPUBackend>(request.output);
+        destinations[r] = static_cast<uint8_t*>(output.raw_mutable_tensor(request.sample));
+    }
+
+    // Request read-ahead of the region following the last record of each used shard. This is done before
+    // the reads of this batch, so that it is performed in the background while the batch is processed.
+    if (_read_ahead > 0) {
+        for (size_t i = 0; i < _reads.size(); ++i) {
+            const bool is_last_of_shard = i + 1 == _reads.size() || _reads[i + 1].shard != _reads[i].shard;
+            if (is_last_of_shard) {
+                ::posix_fadvise(_shards[_reads[i].shard].fd, static_cast<off_t>(_reads[i].end),
+                                static_cast<off_t>(_read_ahead), POSIX_FADV_WILLNEED);
+            }
+        }
+    }
+
+    auto& thread_pool = ws.GetThreadPool();
+    for (size_t i = 0; i < _reads.size(); ++i) {
+        thread_pool.AddWork(
+            [i, &destinations, this](int thread_id) { this->PerformRead(this->_reads[i], destinations); },
+            static_cast<int64_t>(_reads[i].end - _reads[i].begin));
+    }
+    thread_pool.RunAll();
+}
+
+}  // namespace custom_operators
+
+DALI_REGISTER_OPERATOR(packed_record_reader, ::custom_operators::PackedRecordReader, ::dali::CPU);
+
+DALI_SCHEMA(packed_record_reader)
+    .DocStr(
+        "Read packed image records by index. Each input contains one record index per sample. Outputs the "
+        "encoded image of each input, followed by the annotation blob of each input if read_annotations is "
+        "set")
+    .NumInput(1, 64)
+    .OutputFn([](const ::dali::OpSpec& spec) {
+        return spec.NumRegularInput() * (spec.GetArgument<bool>("read_annotations") ? 2 : 1);
+    })
+    .AddArg("index_file", "Packed record index (as written by pack_image_records)",
+            ::dali::DALIDataType::DALI_STRING)
+    .AddOptionalArg("read_annotations", "Also output the annotation blobs of the records", false)
+    .AddOptionalArg("max_gap", "Maximum gap (in bytes) between records to read them with a single read",
+                    static_cast<int64_t>(64 << 10))
+    .AddOptionalArg("max_read_size", "Maximum size (in bytes) of a single (coalesced) read",
+                    static_cast<int64_t>(16 << 20))
+    .AddOptionalArg("read_ahead",
+                    "Size (in bytes) of the region to request read-ahead for per shard (0 to disable)",
+                    static_cast<int64_t>(4 << 20));
@@ -0,0 +1,120 @@
+/*
+ * Copyright (c) 2025, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef PACKED_RECORD_READER_H_
+#define PACKED_RECORD_READER_H_
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "ColumnarStore.h"
+#include "dali/core/error_handling.h"
+#include "dali/pipeline/data/types.h"
+#include "dali/pipeline/operator/operator.h"
+
+namespace custom_operators {
+
+// Shard file of packed records. Owns the file descriptor, so shards opened before a failure in the
+// constructor of the reader are closed as well.
+struct PackedRecordShard {
+    PackedRecordShard() = default;
+    PackedRecordShard(const PackedRecordShard&) = delete;
+    PackedRecordShard& operator=(const PackedRecordShard&) = delete;
+    PackedRecordShard(PackedRecordShard&& other) noexcept;
+    PackedRecordShard& operator=(PackedRecordShard&& other) noexcept;
+    ~PackedRecordShard();
+
+    std::string path;
+    int fd = -1;
+};
+
+// One byte range to copy to an output (image or annotation of one record for one input & sample)
+struct PackedRecordRequest {
+    int output;
+    int sample;
+    int shard;
+    uint64_t offset;
+    uint64_t size;
+};
+
+// One (coalesced) read, covering the requests [first_request, last_request) in sorted order
+struct PackedRecordRead {
+    int shard;
+    uint64_t begin;
+    uint64_t end;
+    size_t first_request;
+    size_t last_request;
+};
+
+/**
+ * Reads packed image records (as written by `pack_image_records()` in `inputs/packed_image_records.py`) by
+ * index.
+ *
+ * Each input contains one record index per sample. The requests of all inputs & samples of a batch are
+ * sorted by shard and offset and coalesced into reads of neighboring byte ranges (with gaps of at most
+ * `max_gap` bytes), which are performed with `pread()` on the thread pool of the pipeline. The shard files
+ * are opened once (instead of one file open per image), and with each batch, read-ahead is requested for
+ * the region following the last read record of each used shard.
+ *
+ * The outputs are the encoded images (one output per input) and optionally the annotation blobs (one
+ * additional output per input).
+ */
+class PackedRecordReader : public ::dali::Operator<::dali::CPUBackend> {
+   public:
+    explicit PackedRecordReader(const ::dali::OpSpec& spec);
+
+    virtual ~PackedRecordReader();
+
+    PackedRecordReader(const PackedRecordReader&) = delete;
+    PackedRecordReader& operator=(const PackedRecordReader&) = delete;
+    PackedRecordReader(PackedRecordReader&&) = delete;
+    PackedRecordReader& operator=(PackedRecordReader&&) = delete;
+
+   protected:
+    bool SetupImpl(std::vector<::dali::OutputDesc>& output_desc, const ::dali::Workspace& ws) override;
+
+    void RunImpl(::dali::Workspace& ws) override;
+
+   private:
+    // Sort the requests of the current batch and coalesce them into reads
+    void PlanReads();
+
+    // Perform one read and copy the data of the covered requests to the outputs
+    void PerformRead(const PackedRecordRead& read, const std::vector<uint8_t*>& destinations) const;
+
+    std::unique_ptr<ColumnarStore> _index;
+    int _offset_column;
+    int _size_column;
+    int _annotation_offset_column;
+    int _annotation_size_column;
+    std::vector<int32_t> _record_shards;  // Shard index per record
+    std::vector<PackedRecordShard> _shards;
+
+    bool _read_annotations;
+    uint64_t _max_gap;
+    uint64_t _max_read_size;
+    uint64_t _read_ahead;
+
+    // Requests & reads of the current batch
+    std::vector<PackedRecordRequest> _requests;
+    std::vector<PackedRecordRead> _reads;
+};
+
+}  // namespace custom_operators
+
+#endif
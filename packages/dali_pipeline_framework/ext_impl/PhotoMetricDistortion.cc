@@ -0,0 +1,271 @@
+/*
+ * Copyright (c) 2025, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "PhotoMetricDistortion.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <string>
+#include <type_traits>
+
+namespace custom_operators {
+
+// Number of pixels processed by one work item of the thread pool (rounded to full rows)
+constexpr int64_t kPixelsPerBlock = 1 << 16;
+
+using Mat3 = std::array<double, 9>;
+
+static Mat3 mat_mul(const Mat3& a, const Mat3& b) {
+    Mat3 res{};
+    for (int r = 0; r < 3; ++r) {
+        for (int c = 0; c < 3; ++c) {
+            for (int k = 0; k < 3; ++k) {
+                res[r * 3 + c] += a[r * 3 + k] * b[k * 3 + c];
+            }
+        }
+    }
+    return res;
+}
+
+// Transformation of an RGB pixel applied by `fn.hue` / `fn.saturation` (rotation / scaling of the chroma
+// components in YIQ space)
+static Mat3 yiq_transformation(double hue_degrees, double saturation) {
+    const Mat3 rgb_to_yiq = {.299, .587, .114, .596, -.274, -.321, .211, -.523, .311};
+    const Mat3 yiq_to_rgb = {1.0, .956, .621, 1.0, -.272, -.647, 1.0, -1.107, 1.705};
+    const double h_rad = hue_degrees * M_PI / 180.0;
+    const double c = std::cos(h_rad) * saturation;
+    const double s = std::sin(h_rad) * saturation;
+    const Mat3 chroma = {1.0, 0.0, 0.0, 0.0, c, s, 0.0, -s, c};
+    return mat_mul(yiq_to_rgb, mat_mul(chroma, rgb_to_yiq));
+}
+
+static float clamp01(float value) { return std::min(std::max(value, 0.0f), 1.0f); }
+
+// Apply the distortion to `num_pixels` consecutive HWC pixels
+template <typename T>
+static void distort_pixels(const T* in, T* out, int64_t num_pixels,
+                           const PhotoMetricDistortionParams& params) {
+    constexpr bool is_uint8 = std::is_same<T, uint8_t>::value;
+    // Work in float domain in [0, 1], as the brightness delta is in the range of the image type
+    const float intensity_factor = is_uint8 ? 1.0f / 255.0f : 1.0f;
+    const float delta = params.delta * intensity_factor;
+    const float alpha = params.alpha;
+    const float* m = params.color_matrix.data();
+    const int* perm = params.channel_permutation.data();
+    const bool contrast_before = params.aug_contrast && params.contrast_first;
+    const bool contrast_after = params.aug_contrast && !params.contrast_first;
+
+    for (int64_t i = 0; i < num_pixels; ++i, in += 3, out += 3) {
+        float x[3] = {static_cast<float>(in[0]) * intensity_factor,
+                      static_cast<float>(in[1]) * intensity_factor,
+                      static_cast<float>(in[2]) * intensity_factor};
+        if (params.aug_brightness) {
+            for (int c = 0; c < 3; ++c) x[c] = clamp01(x[c] + delta);
+        }
+        if (contrast_before) {
+            for (int c = 0; c < 3; ++c) x[c] = clamp01(x[c] * alpha);
+        }
+        if (params.aug_color) {
+            const float y[3] = {m[0] * x[0] + m[1] * x[1] + m[2] * x[2],
+                                m[3] * x[0] + m[4] * x[1] + m[5] * x[2],
+                                m[6] * x[0] + m[7] * x[1] + m[8] * x[2]};
+            std::copy(y, y + 3, x);
+        }
+        if (contrast_after) {
+            for (int c = 0; c < 3; ++c) x[c] = clamp01(x[c] * alpha);
+        }
+        for (int c = 0; c < 3; ++c) {
+            const float value = clamp01(x[perm[c]]);
+            if (is_uint8) {
+                out[c] = static_cast<T>(std::nearbyint(value * 255.0f));
+            } else {
+                out[c] = static_cast<T>(value);
+            }
+        }
+    }
+}
+
+PhotoMetricDistortion::PhotoMetricDistortion(const ::dali::OpSpec& spec)
+    : ::dali::Operator<::dali::CPUBackend>(spec),
+      _min_max_brightness(spec.GetRepeatedArgument<float>("min_max_brightness")),
+      _min_max_contrast(spec.GetRepeatedArgument<float>("min_max_contrast")),
+      _min_max_saturation(spec.GetRepeatedArgument<float>("min_max_saturation")),
+      _min_max_hue(spec.GetRepeatedArgument<float>("min_max_hue")),
+      _prob_brightness_aug(spec.GetArgument<float>("prob_brightness_aug")),
+      _prob_contrast_aug(spec.GetArgument<float>("prob_contrast_aug")),
+      _prob_saturation_aug(spec.GetArgument<float>("prob_saturation_aug")),
+      _prob_hue_aug(spec.GetArgument<float>("prob_hue_aug")),
+      _prob_swap_channels(spec.GetArgument<float>("prob_swap_channels")),
+      _is_bgr(spec.GetArgument<bool>("is_bgr")),
+      _rng(spec.GetArgument<int64_t>("seed")) {
+    for (const auto* min_max :
+         {&_min_max_brightness, &_min_max_contrast, &_min_max_saturation, &_min_max_hue}) {
+        DALI_ENFORCE(min_max->size() == 2 && (*min_max)[0] <= (*min_max)[1],
+                     "Ranges have to be given as [min, max] with min <= max");
+    }
+}
+
+PhotoMetricDistortion::~PhotoMetricDistortion() {}
+
+float PhotoMetricDistortion::DrawInRange(const std::vector<float>& min_max) {
+    if (min_max[0] == min_max[1]) {
+        return min_max[0];
+    }
+    return std::uniform_real_distribution<float>(min_max[0], min_max[1])(_rng);
+}
+
+PhotoMetricDistortionParams PhotoMetricDistortion::DrawParams() {
+    // Enumerated permutations (as in the Python implementation, one random number selects the permutation)
+    static const std::array<std::array<int, 3>, 6> permutations = {
+        {{0, 1, 2}, {0, 2, 1}, {1, 0, 2}, {2, 1, 0}, {2, 0, 1}, {1, 2, 0}}};
+
+    std::uniform_real_distribution<float> uniform(0.0f, 1.0f);
+    PhotoMetricDistortionParams params;
+    params.aug_brightness = uniform(_rng) < _prob_brightness_aug;
+    params.aug_contrast = uniform(_rng) < _prob_contrast_aug;
+    const bool aug_saturation = uniform(_rng) < _prob_saturation_aug;
+    const bool aug_hue = uniform(_rng) < _prob_hue_aug;
+    params.aug_swap_channels = uniform(_rng) < _prob_swap_channels;
+    params.contrast_first = std::uniform_int_distribution<int>(0, 1)(_rng) == 1;
+
+    if (params.aug_brightness) {
+        params.delta = DrawInRange(_min_max_brightness);
+    }
+    if (params.aug_contrast) {
+        params.alpha = DrawInRange(_min_max_contrast);
+    }
+    const float hue = aug_hue ? DrawInRange(_min_max_hue) : 0.0f;
+    const float saturation = aug_saturation ? DrawInRange(_min_max_saturation) : 1.0f;
+    if (params.aug_swap_channels) {
+        params.channel_permutation = permutations[std::uniform_int_distribution<int>(0, 5)(_rng)];
+    }
+
+    params.aug_color = aug_saturation || aug_hue;
+    if (params.aug_color) {
+        // Saturation is applied before hue. The two are kept as separate transformations (instead of
+        // combining hue & saturation in YIQ space) to match `fn.saturation` followed by `fn.hue`.
+        Mat3 color = {1.0, 0.0, 0.0, 0.0, 1.0, 0.0, 0.0, 0.0, 1.0};
+        if (aug_saturation) {
+            color = yiq_transformation(0.0, saturation);
+        }
+        if (aug_hue) {
+            color = mat_mul(yiq_transformation(hue, 1.0), color);
+        }
+        for (int r = 0; r < 3; ++r) {
+            for (int c = 0; c < 3; ++c) {
+                // For BGR images, the transformation is defined on the reversed channel order
+                const int src = _is_bgr ? (2 - r) * 3 + (2 - c) : r * 3 + c;
+                params.color_matrix[r * 3 + c] = static_cast<float>(color[src]);
+            }
+        }
+    }
+    return params;
+}
+
+bool PhotoMetricDistortion::SetupImpl(std::vector<::dali::OutputDesc>& output_desc,
+                                      const ::dali::Workspace& ws) {
+    const int num_inputs = ws.NumInput();
+    output_desc.resize(num_inputs);
+    for (int i = 0; i < num_inputs; ++i) {
+        const auto& input = ws.Input<::dali::CPUBackend>(i);
+        const auto& shape = input.shape();
+        DALI_ENFORCE(input.type() == ::dali::DALIDataType::DALI_UINT8 ||
+                         input.type() == ::dali::DALIDataType::DALI_FLOAT,
+                     "Images have to be of type UINT8 or FLOAT (input " + std::to_string(i) + ")");
+        for (int s = 0; s < shape.num_samples(); ++s) {
+            DALI_ENFORCE(shape[s].size() == 3 && shape[s][2] == 3,
+                         "Images have to be in HWC layout with 3 channels (input " + std::to_string(i) + ")");
+        }
+        DALI_ENFORCE(shape.num_samples() == ws.Input<::dali::CPUBackend>(0).shape().num_samples(),
+                     "All inputs have to have the same batch size");
+        output_desc[i].shape = shape;
+        output_desc[i].type = input.type();
+    }
+    return true;
+}
+
+void PhotoMetricDistortion::RunImpl(::dali::Workspace& ws) {
+    const int num_inputs = ws.NumInput();
+    const int batch_size = ws.Input<::dali::CPUBackend>(0).shape().num_samples();
+
+    // Draw sequentially, so that the parameters only depend on the seed
+    _params.resize(batch_size);
+    for (int s = 0; s < batch_size; ++s) {
+        _params[s] = DrawParams();
+    }
+
+    auto& thread_pool = ws.GetThreadPool();
+    for (int i = 0; i < num_inputs; ++i) {
+        const auto& input = ws.Input<::dali::CPUBackend>(i);
+        auto& output = ws.Output<::dali::CPUBackend>(i);
+        output.SetLayout(input.GetLayout());
+        const bool is_uint8 = input.type() == ::dali::DALIDataType::DALI_UINT8;
+
+        for (int s = 0; s < batch_size; ++s) {
+            const auto& sample_shape = input.shape()[s];
+            const int64_t height = sample_shape[0];
+            const int64_t width = sample_shape[1];
+            const int64_t rows_per_block =
+                std::max<int64_t>(1, kPixelsPerBlock / std::max<int64_t>(width, 1));
+
+            for (int64_t row = 0; row < height; row += rows_per_block) {
+                const int64_t first_pixel = row * width;
+                const int64_t num_pixels = std::min(rows_per_block, height - row) * width;
+                // All captured references remain valid until RunAll() returns; `s` and the block are captured
+                // by value as they change while the work is added.
+                thread_pool.AddWork(
+                    [s, first_pixel, num_pixels, is_uint8, &input, &output, this](int thread_id) {
+                        const PhotoMetricDistortionParams& params = this->_params[s];
+                        if (is_uint8) {
+                            const uint8_t* in = static_cast<const uint8_t*>(input.raw_tensor(s));
+                            uint8_t* out = static_cast<uint8_t*>(output.raw_mutable_tensor(s));
+                            distort_pixels(in + first_pixel * 3, out + first_pixel * 3, num_pixels, params);
+                        } else {
+                            const float* in = static_cast<const float*>(input.raw_tensor(s));
+                            float* out = static_cast<float*>(output.raw_mutable_tensor(s));
+                            distort_pixels(in + first_pixel * 3, out + first_pixel * 3, num_pixels, params);
+                        }
+                    },
+                    num_pixels);
+            }
+        }
+    }
+    thread_pool.RunAll();
+}
+
+}  // namespace custom_operators
+
+DALI_REGISTER_OPERATOR(photo_metric_distortion, ::custom_operators::PhotoMetricDistortion, ::dali::CPU);
+
+DALI_SCHEMA(photo_metric_distortion)
+    .DocStr(
+        "Photometric distortion (brightness, contrast, saturation, hue, channel swap) of HWC images in a "
+        "single pass. The random parameters are drawn once per sample and shared by all inputs.")
+    .NumInput(1, 64)
+    .OutputFn([](const ::dali::OpSpec& spec) { return spec.NumRegularInput(); })
+    .AddArg("min_max_brightness", "Minimum and maximum brightness delta (in the range of the image type)",
+            ::dali::DALIDataType::DALI_FLOAT_VEC)
+    .AddArg("min_max_contrast", "Minimum and maximum contrast factor", ::dali::DALIDataType::DALI_FLOAT_VEC)
+    .AddArg("min_max_saturation", "Minimum and maximum saturation factor",
+            ::dali::DALIDataType::DALI_FLOAT_VEC)
+    .AddArg("min_max_hue", "Minimum and maximum hue change (degrees)", ::dali::DALIDataType::DALI_FLOAT_VEC)
+    .AddOptionalArg("prob_brightness_aug", "Probability to apply the brightness augmentation", 0.5f)
+    .AddOptionalArg("prob_contrast_aug", "Probability to apply the contrast augmentation", 0.5f)
+    .AddOptionalArg("prob_saturation_aug", "Probability to apply the saturation augmentation", 0.5f)
+    .AddOptionalArg("prob_hue_aug", "Probability to apply the hue augmentation", 0.5f)
+    .AddOptionalArg("prob_swap_channels", "Probability to randomly permute the color channels", 0.5f)
+    .AddOptionalArg("is_bgr", "Whether the images are in BGR format (RGB otherwise)", false);
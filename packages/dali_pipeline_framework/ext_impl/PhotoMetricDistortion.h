@@ -0,0 +1,94 @@
+/*
+ * Copyright (c) 2025, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef PHOTO_METRIC_DISTORTION_H_
+#define PHOTO_METRIC_DISTORTION_H_
+
+#include <array>
+#include <random>
+#include <vector>
+
+#include "dali/core/error_handling.h"
+#include "dali/pipeline/data/types.h"
+#include "dali/pipeline/operator/operator.h"
+
+namespace custom_operators {
+
+// Randomly drawn distortion of one sample (shared by all images of the sample)
+struct PhotoMetricDistortionParams {
+    bool aug_brightness = false;
+    bool aug_contrast = false;
+    bool contrast_first = false;  // Contrast before (mode 1) or after (mode 0) saturation & hue
+    bool aug_color = false;       // Saturation and/or hue
+    bool aug_swap_channels = false;
+    float delta = 0.0f;  // In the range of the parameters, i.e. not scaled to [0, 1] for uint8 images
+    float alpha = 1.0f;
+    // Saturation & hue as one linear transformation of the (RGB or BGR) pixel, row-major
+    std::array<float, 9> color_matrix = {1.0f, 0.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 0.0f, 1.0f};
+    std::array<int, 3> channel_permutation = {0, 1, 2};
+};
+
+/**
+ * Photometric distortion of HWC images with 3 channels (uint8 or float), in one pass over each image.
+ *
+ * Equivalent to the chain of DALI operators built by the Python `PhotoMetricDistorter` step: the same
+ * augmentations, with the same probabilities and in the same order (brightness, contrast if mode 1,
+ * saturation, hue, contrast if mode 0, channel swap). Saturation and hue follow `fn.saturation` / `fn.hue`
+ * (linear approximation in YIQ space).
+ *
+ * Each input is one image field. The parameters are drawn once per sample and applied to all inputs, so that
+ * e.g. all camera images of a sample are distorted consistently. Images are split into row blocks, which are
+ * processed on the thread pool of the pipeline.
+ */
+class PhotoMetricDistortion : public ::dali::Operator<::dali::CPUBackend> {
+   public:
+    explicit PhotoMetricDistortion(const ::dali::OpSpec& spec);
+
+    virtual ~PhotoMetricDistortion();
+
+    PhotoMetricDistortion(const PhotoMetricDistortion&) = delete;
+    PhotoMetricDistortion& operator=(const PhotoMetricDistortion&) = delete;
+    PhotoMetricDistortion(PhotoMetricDistortion&&) = delete;
+    PhotoMetricDistortion& operator=(PhotoMetricDistortion&&) = delete;
+
+   protected:
+    bool SetupImpl(std::vector<::dali::OutputDesc>& output_desc, const ::dali::Workspace& ws) override;
+
+    void RunImpl(::dali::Workspace& ws) override;
+
+   private:
+    PhotoMetricDistortionParams DrawParams();
+
+    float DrawInRange(const std::vector<float>& min_max);
+
+    std::vector<float> _min_max_brightness;
+    std::vector<float> _min_max_contrast;
+    std::vector<float> _min_max_saturation;
+    std::vector<float> _min_max_hue;
+    float _prob_brightness_aug;
+    float _prob_contrast_aug;
+    float _prob_saturation_aug;
+    float _prob_hue_aug;
+    float _prob_swap_channels;
+    bool _is_bgr;
+    std::mt19937_64 _rng;
+
+    std::vector<PhotoMetricDistortionParams> _params;  // Parameters of the samples of the current batch
+};
+
+}  // namespace custom_operators
+
+#endif
@@ -0,0 +1,168 @@
+/*
+ * Copyright (c) 2025, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "RandomParameters.h"
+
+#include <cmath>
+#include <string>
+
+namespace custom_operators {
+
+std::array<uint32_t, 4> philox4x32_10(std::array<uint32_t, 4> counter, std::array<uint32_t, 2> key) {
+    constexpr uint32_t kMultiplier0 = 0xD2511F53u;
+    constexpr uint32_t kMultiplier1 = 0xCD9E8D57u;
+    constexpr uint32_t kWeyl0 = 0x9E3779B9u;
+    constexpr uint32_t kWeyl1 = 0xBB67AE85u;
+    for (int round = 0; round < 10; ++round) {
+        const uint64_t product_0 = static_cast<uint64_t>(kMultiplier0) * counter[0];
+        const uint64_t product_1 = static_cast<uint64_t>(kMultiplier1) * counter[2];
+        counter = {static_cast<uint32_t>(product_1 >> 32) ^ counter[1] ^ key[0],
+                   static_cast<uint32_t>(product_1),
+                   static_cast<uint32_t>(product_0 >> 32) ^ counter[3] ^ key[1],
+                   static_cast<uint32_t>(product_0)};
+        key[0] += kWeyl0;
+        key[1] += kWeyl1;
+    }
+    return counter;
+}
+
+RandomParameters::RandomParameters(const ::dali::OpSpec& spec) : ::dali::Operator<::dali::CPUBackend>(spec) {
+    const std::vector<int> kinds = spec.GetRepeatedArgument<int>("kinds");
+    const std::vector<int> ids = spec.GetRepeatedArgument<int>("ids");
+    const std::vector<float> lows = spec.GetRepeatedArgument<float>("lows");
+    const std::vector<float> highs = spec.GetRepeatedArgument<float>("highs");
+    DALI_ENFORCE(!kinds.empty() && ids.size() == kinds.size() && lows.size() == kinds.size() &&
+                     highs.size() == kinds.size(),
+                 "kinds, ids, lows and highs have to be non-empty and of the same length");
+
+    for (size_t p = 0; p < kinds.size(); ++p) {
+        const RandomParameterDesc desc{static_cast<RandomParameterKind>(kinds[p]),
+                                       static_cast<uint32_t>(ids[p]), lows[p], highs[p]};
+        const std::string name = "Parameter " + std::to_string(p);
+        switch (desc.kind) {
+            case RandomParameterKind::Uniform:
+                DALI_ENFORCE(desc.low <= desc.high, name + ": low has to be less than or equal to high");
+                break;
+            case RandomParameterKind::Bernoulli:
+                DALI_ENFORCE(desc.low >= 0.0f && desc.low <= 1.0f, name + ": probability not in [0, 1]");
+                break;
+            case RandomParameterKind::Integer:
+                DALI_ENFORCE(desc.low <= desc.high && std::floor(desc.low) == desc.low &&
+                                 std::floor(desc.high) == desc.high,
+                             name + ": integer range has to be given by integral values with low <= high");
+                break;
+            default:
+                DALI_FAIL(name + ": unknown kind " + std::to_string(kinds[p]));
+        }
+        _parameters.push_back(desc);
+    }
+
+    const uint64_t seed = static_cast<uint64_t>(spec.GetArgument<int64_t>("key"));
+    _key = {static_cast<uint32_t>(seed), static_cast<uint32_t>(seed >> 32)};
+}
+
+RandomParameters::~RandomParameters() {}
+
+void RandomParameters::DrawRecord(int64_t epoch, int64_t sample_index, float* record) const {
+    const uint64_t index = static_cast<uint64_t>(sample_index);
+    for (size_t p = 0; p < _parameters.size(); ++p) {
+        const RandomParameterDesc& desc = _parameters[p];
+        const uint32_t bits = philox4x32_10({static_cast<uint32_t>(index), static_cast<uint32_t>(index >> 32),
+                                             static_cast<uint32_t>(epoch), desc.id},
+                                            _key)[0];
+        // 24 random bits, i.e. exactly representable as float
+        const float uniform_01 = static_cast<float>(bits >> 8) * (1.0f / 16777216.0f);
+        switch (desc.kind) {
+            case RandomParameterKind::Uniform: {
+                // The product is exact in double, so that the result does not depend on whether the
+                // compiler fuses the multiply-add
+                const double range = static_cast<double>(desc.high) - static_cast<double>(desc.low);
+                record[p] = static_cast<float>(static_cast<double>(desc.low) + range * uniform_01);
+                break;
+            }
+            case RandomParameterKind::Bernoulli:
+                record[p] = uniform_01 < desc.low ? 1.0f : 0.0f;
+                break;
+            case RandomParameterKind::Integer: {
+                const uint64_t num_values = static_cast<uint64_t>(desc.high - desc.low) + 1;
+                record[p] = desc.low + static_cast<float>((static_cast<uint64_t>(bits) * num_values) >> 32);
+                break;
+            }
+        }
+    }
+}
+
+bool RandomParameters::SetupImpl(std::vector<::dali::OutputDesc>& output_desc, const ::dali::Workspace& ws) {
+    const bool has_input = ws.NumInput() > 0;
+    const int batch_size =
+        has_input ? ws.Input<::dali::CPUBackend>(0).shape().num_samples() : ws.GetRequestedBatchSize(0);
+
+    _positions.resize(batch_size);
+    for (int s = 0; s < batch_size; ++s) {
+        if (!has_input) {
+            _positions[s] = {0, _num_processed_samples + s};
+            continue;
+        }
+        const auto& input = ws.Input<::dali::CPUBackend>(0);
+        const bool is_int64 = input.type() == ::dali::DALIDataType::DALI_INT64;
+        DALI_ENFORCE(is_int64 || input.type() == ::dali::DALIDataType::DALI_INT32,
+                     "Sample positions have to be of type INT64 or INT32");
+        const int64_t num_elements = ::dali::volume(input.shape()[s]);
+        DALI_ENFORCE(num_elements == 1 || num_elements == 2,
+                     "Sample position has to be given as sample index or as (epoch, sample index)");
+        std::array<int64_t, 2> values = {0, 0};
+        for (int64_t e = 0; e < num_elements; ++e) {
+            values[e] = is_int64 ? static_cast<const int64_t*>(input.raw_tensor(s))[e]
+                                 : static_cast<const int32_t*>(input.raw_tensor(s))[e];
+        }
+        _positions[s] = num_elements == 1 ? std::array<int64_t, 2>{0, values[0]} : values;
+    }
+
+    output_desc.resize(1);
+    output_desc[0].shape = ::dali::uniform_list_shape(batch_size, {static_cast<int64_t>(_parameters.size())});
+    output_desc[0].type = ::dali::DALIDataType::DALI_FLOAT;
+    return true;
+}
+
+void RandomParameters::RunImpl(::dali::Workspace& ws) {
+    auto& output = ws.Output<::dali::CPUBackend>(0);
+    // Drawing a record is cheap compared to the overhead of distributing work to the thread pool. The values
+    // do not depend on the processing order.
+    for (size_t s = 0; s < _positions.size(); ++s) {
+        DrawRecord(_positions[s][0], _positions[s][1], static_cast<float*>(output.raw_mutable_tensor(s)));
+    }
+    _num_processed_samples += static_cast<int64_t>(_positions.size());
+}
+
+}  // namespace custom_operators
+
+DALI_REGISTER_OPERATOR(random_parameters, ::custom_operators::RandomParameters, ::dali::CPU);
+
+DALI_SCHEMA(random_parameters)
+    .DocStr(
+        "Draw a record of random parameters per sample with a counter-based (Philox4x32-10) generator. Each "
+        "value only depends on the key, the epoch, the sample index and the id of the parameter.")
+    .NumInput(0, 1)
+    .NumOutput(1)
+    .AddArg("key", "Key (seed) of the generator", ::dali::DALIDataType::DALI_INT64)
+    .AddArg("kinds", "Kind of each parameter (0: uniform, 1: Bernoulli, 2: integer)",
+            ::dali::DALIDataType::DALI_INT_VEC)
+    .AddArg("ids", "Id of each parameter (part of the counter of the generator)",
+            ::dali::DALIDataType::DALI_INT_VEC)
+    .AddArg("lows", "Lower bound (uniform & integer) or probability (Bernoulli) of each parameter",
+            ::dali::DALIDataType::DALI_FLOAT_VEC)
+    .AddArg("highs", "Upper bound of each parameter (not used for Bernoulli parameters)",
+            ::dali::DALIDataType::DALI_FLOAT_VEC);
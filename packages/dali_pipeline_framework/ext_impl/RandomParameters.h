@@ -0,0 +1,90 @@
+/*
+ * Copyright (c) 2025, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef RANDOM_PARAMETERS_H_
+#define RANDOM_PARAMETERS_H_
+
+#include <array>
+#include <cstdint>
+#include <vector>
+
+#include "dali/core/error_handling.h"
+#include "dali/pipeline/data/types.h"
+#include "dali/pipeline/operator/operator.h"
+
+namespace custom_operators {
+
+// Kinds of parameters. Has to match `RandomParameterKind` in `operators_impl/random_parameters.py`.
+enum class RandomParameterKind : int32_t {
+    Uniform = 0,    // Float in [low, high)
+    Bernoulli = 1,  // 1 with probability `low`, 0 otherwise
+    Integer = 2,    // Integer in [low, high]
+};
+
+struct RandomParameterDesc {
+    RandomParameterKind kind;
+    uint32_t id;
+    float low;
+    float high;
+};
+
+// Philox4x32-10 counter-based generator (Salmon et al., "Parallel Random Numbers: As Easy as 1, 2, 3")
+std::array<uint32_t, 4> philox4x32_10(std::array<uint32_t, 4> counter, std::array<uint32_t, 2> key);
+
+/**
+ * Draws a record of random parameters per sample with a counter-based generator.
+ *
+ * Each parameter value is a pure function of (seed, epoch, sample index, parameter id): the counter of the
+ * Philox generator is formed from the sample index, the epoch and the parameter id, and the seed is used as
+ * the key. This means that the values do not depend on the order in which the operators of the pipeline
+ * are created, on the other parameters in the record, on the batch composition, or on the number of threads.
+ *
+ * The (optional) input contains the position of each sample, either as the sample index (1 element) or as
+ * (epoch, sample index) (2 elements). Without input, the samples are numbered consecutively in the order in
+ * which they are processed by the operator (epoch 0). The output is one float record per sample, containing
+ * the parameters in the order of the arguments.
+ */
+class RandomParameters : public ::dali::Operator<::dali::CPUBackend> {
+   public:
+    explicit RandomParameters(const ::dali::OpSpec& spec);
+
+    virtual ~RandomParameters();
+
+    RandomParameters(const RandomParameters&) = delete;
+    RandomParameters& operator=(const RandomParameters&) = delete;
+    RandomParameters(RandomParameters&&) = delete;
+    RandomParameters& operator=(RandomParameters&&) = delete;
+
+   protected:
+    bool SetupImpl(std::vector<::dali::OutputDesc>& output_desc, const ::dali::Workspace& ws) override;
+
+    void RunImpl(::dali::Workspace& ws) override;
+
+   private:
+    void DrawRecord(int64_t epoch, int64_t sample_index, float* record) const;
+
+    std::vector<RandomParameterDesc> _parameters;
+    std::array<uint32_t, 2> _key;
+    // Number of samples processed so far (used as sample index if no input is given)
+    int64_t _num_processed_samples = 0;
+
+    // (epoch, sample index) of the samples of the current batch
+    std::vector<std::array<int64_t, 2>> _positions;
+};
+
+}  // namespace custom_operators
+
+#endif
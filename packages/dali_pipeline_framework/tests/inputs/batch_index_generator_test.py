@@ -0,0 +1,222 @@
+# Copyright (c) 2025, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+import pickle
+
+import numpy as np
+import pytest
+
+from accvlab.dali_pipeline_framework.inputs.sampler_base import SamplerBase
+from accvlab.dali_pipeline_framework.inputs.shuffled_batch_sampler import ShuffledBatchSampler
+from accvlab.dali_pipeline_framework.inputs.batch_index_generator import BatchIndexGenerator
+
+try:
+    from typing import override
+except ImportError:
+    from typing_extensions import override
+
+
+# --------------------------------------------------------------------------------------------------
+# Definitions of classes used in tests
+# --------------------------------------------------------------------------------------------------
+
+
+class _CountingEpochSampler(SamplerBase):
+    """Epoch-based sampler (not random-access) with a varying number of batches per epoch."""
+
+    def __init__(self, batch_size: int):
+        self._batch_size = batch_size
+        self._curr_epoch = 0
+        self._b_in_epoch = 0
+
+    def _num_batches(self, epoch):
+        return 3 + epoch % 2
+
+    @property
+    @override
+    def is_epoch_based(self) -> bool:
+        return True
+
+    @override
+    def reset(self):
+        self._curr_epoch += 1
+        self._b_in_epoch = 0
+
+    @override
+    def get_next_batch_indices(self):
+        if self._b_in_epoch >= self._num_batches(self._curr_epoch):
+            raise StopIteration
+        base = self._curr_epoch * 1000 + self._b_in_epoch * self._batch_size
+        self._b_in_epoch += 1
+        return [base + i for i in range(self._batch_size)]
+
+    @property
+    @override
+    def length(self):
+        return None
+
+
+class _UnseededSampler(SamplerBase):
+    """Sampler creating an unseeded random generator lazily (i.e. not deterministic)."""
+
+    def __init__(self, num_samples: int, batch_size: int):
+        self._num_samples = num_samples
+        self._batch_size = batch_size
+        self._rng = None
+
+    @property
+    @override
+    def is_epoch_based(self) -> bool:
+        return False
+
+    @override
+    def reset(self):
+        pass
+
+    @override
+    def get_next_batch_indices(self):
+        if self._rng is None:
+            self._rng = np.random.default_rng()
+        return self._rng.choice(self._num_samples, self._batch_size, replace=False).tolist()
+
+    @property
+    @override
+    def length(self):
+        return None
+
+
+def _iterate_sequentially(sampler, num_epochs):
+    epochs = []
+    for _ in range(num_epochs):
+        epoch = []
+        try:
+            while True:
+                epoch.append(sampler.get_next_batch_indices())
+        except StopIteration:
+            sampler.reset()
+        epochs.append(epoch)
+    return epochs
+
+
+_SAMPLER_FACTORIES = [lambda: ShuffledBatchSampler(40, 4), lambda: _CountingEpochSampler(4)]
+
+
+# --------------------------------------------------------------------------------------------------
+# Tests
+# --------------------------------------------------------------------------------------------------
+
+
+@pytest.mark.parametrize("num_samples", [1, 24, 1000, 1003])
+def test_shuffled_batch_sampler_epochs_are_permutations(num_samples):
+    batch_size = 1 if num_samples == 1 else 8
+    sampler = ShuffledBatchSampler(num_samples, batch_size, seed=3)
+    num_batches = num_samples // batch_size
+    assert sampler.get_num_batches(0) == num_batches
+
+    epochs = []
+    for epoch in range(3):
+        indices = [i for b in range(num_batches) for i in sampler.get_batch_indices(epoch, b)]
+        # Each sample at most once per epoch (the incomplete last batch is dropped)
+        assert len(indices) == num_batches * batch_size
+        assert len(set(indices)) == len(indices)
+        assert all(0 <= i < num_samples for i in indices)
+        epochs.append(indices)
+    if num_samples >= 1000:
+        assert epochs[0] != epochs[1] and epochs[1] != epochs[2]
+        assert epochs[0] != sorted(epochs[0])
+
+    # Deterministic for the same seed, independent of the order of access
+    other = ShuffledBatchSampler(num_samples, batch_size, seed=3)
+    assert other.get_batch_indices(2, num_batches - 1) == epochs[2][-batch_size:]
+    assert other.get_batch_indices(0, 0) == epochs[0][:batch_size]
+    if num_samples >= 1000:
+        assert ShuffledBatchSampler(num_samples, batch_size, seed=4).get_batch_indices(0, 0) != epochs[0][:8]
+
+
+def test_shuffled_batch_sampler_sequential_interface():
+    sampler = ShuffledBatchSampler(50, 10, seed=1)
+    expected = [[sampler.get_batch_indices(e, b) for b in range(5)] for e in range(2)]
+    assert _iterate_sequentially(ShuffledBatchSampler(50, 10, seed=1), 2) == expected
+    assert list(range(10)) == ShuffledBatchSampler(50, 10, shuffle=False).get_batch_indices(0, 0)
+
+
+@pytest.mark.parametrize("make_sampler", _SAMPLER_FACTORIES)
+def test_generator_matches_sequential_sampler(make_sampler):
+    expected = _iterate_sequentially(make_sampler(), 4)
+    generator = BatchIndexGenerator(make_sampler(), look_ahead_window=2)
+    for epoch, batches in enumerate(expected):
+        assert generator.get_num_batches(epoch) == len(batches)
+        for b, batch in enumerate(batches):
+            assert generator.get_batch(epoch, b) == batch
+        assert generator.get_batch(epoch, len(batches)) is None
+
+
+def test_generator_window_is_bounded_and_replays():
+    expected = _iterate_sequentially(_CountingEpochSampler(2), 3)
+    sampler = _CountingEpochSampler(2)
+    generator = BatchIndexGenerator(sampler, look_ahead_window=2)
+
+    assert generator.get_batch(2, 1) == expected[2][1]
+    assert len(generator._window_batches) <= 2
+    # Batch dropped from the window is obtained by replaying
+    assert generator.get_batch(0, 1) == expected[0][1]
+    assert generator.get_batch(2, 2) == expected[2][2]
+    # The sampler passed to the generator is not advanced
+    assert sampler.get_next_batch_indices() == expected[0][0]
+
+
+@pytest.mark.parametrize("make_sampler", _SAMPLER_FACTORIES)
+def test_generator_resume(make_sampler):
+    generator = BatchIndexGenerator(make_sampler())
+    state = generator.get_resume_state(1, 2)
+    assert state == {"epoch": 1, "batch": 2}
+
+    resumed = BatchIndexGenerator(make_sampler(), resume_state=pickle.loads(pickle.dumps(state)))
+    assert resumed.get_num_batches(0) == generator.get_num_batches(1) - 2
+    assert resumed.get_batch(0, 0) == generator.get_batch(1, 2)
+    assert resumed.get_batch(0, resumed.get_num_batches(0)) is None
+    assert resumed.get_batch(1, 0) == generator.get_batch(2, 0)
+    # Resuming from a resumed run refers to absolute positions
+    assert resumed.get_resume_state(1, 1) == {"epoch": 2, "batch": 1}
+
+
+@pytest.mark.parametrize("make_sampler", _SAMPLER_FACTORIES)
+def test_generator_resume_at_end_of_epoch(make_sampler):
+    generator = BatchIndexGenerator(make_sampler())
+    num_batches = generator.get_num_batches(1)
+    state = generator.get_resume_state(1, num_batches)
+    assert state == {"epoch": 2, "batch": 0}
+
+    # Also states pointing past the end of an epoch (e.g. stored by an earlier version) are accepted
+    for resume_state in [state, {"epoch": 1, "batch": num_batches}]:
+        resumed = BatchIndexGenerator(make_sampler(), resume_state=resume_state)
+        assert resumed.get_num_batches(0) == generator.get_num_batches(2)
+        assert resumed.get_batch(0, 0) == generator.get_batch(2, 0)
+
+
+def test_generator_rejects_non_deterministic_sampler():
+    with pytest.raises(ValueError):
+        BatchIndexGenerator(_UnseededSampler(1000, 8))
+
+
+def test_generator_is_picklable_after_use():
+    generator = BatchIndexGenerator(_CountingEpochSampler(2))
+    batch = generator.get_batch(1, 1)
+    restored = pickle.loads(pickle.dumps(generator))
+    assert len(restored._window_batches) == 0
+    assert restored.get_batch(1, 1) == batch
+
+
+if __name__ == "__main__":
+    pytest.main([__file__])
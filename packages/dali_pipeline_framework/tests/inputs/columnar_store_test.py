@@ -0,0 +1,148 @@
+# Copyright (c) 2025, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+import os
+import pickle
+
+import numpy as np
+import pytest
+
+from accvlab.dali_pipeline_framework.inputs import ColumnarStore, write_columnar_store
+from accvlab.dali_pipeline_framework.inputs.columnar_store import _COLUMN, _HEADER
+
+
+def _write_test_store(path):
+    rng = np.random.default_rng(0)
+    columns = {
+        "timestamp": np.array([10, 20, 30], dtype=np.int64),
+        "ego_pose": rng.random((3, 4, 4)),
+        "boxes": [rng.random((n, 7)).astype(np.float32) for n in (3, 0, 5)],
+        "image_path": ["a.jpg", None, "c.jpg"],
+        "categories": [["car", "pedestrian", "car"], [], ["bus"] * 5],
+    }
+    write_columnar_store(path, columns, sample_keys=["token_c", "token_a", "token_b"])
+    return columns
+
+
+def test_round_trip_of_fixed_size_and_ragged_columns(tmp_path):
+    path = str(tmp_path / "store.acs")
+    columns = _write_test_store(path)
+    store = ColumnarStore(path)
+
+    assert len(store) == 3
+    assert store.column_names == list(columns.keys())
+    assert not store.is_ragged("timestamp")
+    assert store.is_ragged("boxes")
+    for i in range(3):
+        assert store.get("timestamp", i) == columns["timestamp"][i]
+        assert np.array_equal(store.get("ego_pose", i), columns["ego_pose"][i])
+        boxes = store.get("boxes", i)
+        assert boxes.shape == columns["boxes"][i].shape
+        assert boxes.dtype == np.float32
+        assert np.array_equal(boxes, columns["boxes"][i])
+        assert store.get("image_path", i) == columns["image_path"][i]
+        assert store.get("categories", i) == columns["categories"][i]
+
+    sample = store.get_sample(2, ["timestamp", "categories"])
+    assert set(sample.keys()) == {"timestamp", "categories"}
+
+    with pytest.raises(IndexError):
+        store.get("timestamp", 3)
+
+
+def test_list_of_scalars_is_fixed_size_column(tmp_path):
+    path = str(tmp_path / "store.acs")
+    write_columnar_store(path, {"a": [1.0, 2.0, 3.0], "b": [np.int32(4), np.int32(5), np.int32(6)]})
+    store = ColumnarStore(path)
+
+    assert not store.is_ragged("a") and not store.is_ragged("b")
+    assert [store.get("a", i) for i in range(3)] == [1.0, 2.0, 3.0]
+    assert store.get("b", 1) == 5 and store.get("b", 1).dtype == np.int32
+
+
+def test_index_of_sample_keys(tmp_path):
+    path = str(tmp_path / "store.acs")
+    _write_test_store(path)
+    store = ColumnarStore(path)
+
+    assert [store.index_of(key) for key in ["token_a", "token_b", "token_c"]] == [1, 2, 0]
+    with pytest.raises(KeyError):
+        store.index_of("token_d")
+
+
+def test_data_is_read_only_view_and_pickled_by_path(tmp_path):
+    path = str(tmp_path / "store.acs")
+    _write_test_store(path)
+    store = ColumnarStore(path)
+
+    boxes = store.get("boxes", 0)
+    assert not boxes.flags.writeable
+    with pytest.raises(ValueError):
+        boxes[0, 0] = 1.0
+
+    data = pickle.dumps(store)
+    assert len(data) < 1024
+    restored = pickle.loads(data)
+    assert restored.path == path
+    assert np.array_equal(restored.get("boxes", 2), store.get("boxes", 2))
+
+
+def test_invalid_inputs_are_rejected(tmp_path):
+    path = str(tmp_path / "store.acs")
+    with pytest.raises(ValueError):
+        write_columnar_store(path, {"a": np.zeros(3), "b": np.zeros(2)})
+    with pytest.raises(ValueError):
+        write_columnar_store(path, {"a": np.zeros(2)}, sample_keys=["x", "x"])
+    with pytest.raises(ValueError):
+        write_columnar_store(path, {"a": [np.zeros((1, 2)), np.zeros((1, 3))]})
+    with pytest.raises(ValueError):
+        write_columnar_store(path, {"a": [1.0, np.zeros(2)]})
+    # Failed writes leave no (partial) file behind
+    assert os.listdir(tmp_path) == []
+
+    with open(path, "wb") as f:
+        f.write(b"\0" * 256)
+    with pytest.raises(ValueError):
+        ColumnarStore(path)
+
+
+def _overwrite_uint64(path, offset, value):
+    with open(path, "r+b") as f:
+        f.seek(offset)
+        f.write(np.uint64(value).tobytes())
+
+
+def test_corrupt_offsets_and_keys_are_rejected(tmp_path):
+    path = str(tmp_path / "store.acs")
+    _write_test_store(path)
+    with open(path, "rb") as f:
+        header = _HEADER.unpack_from(f.read(_HEADER.size))
+    columns_offset, sorted_keys_offset = header[4], header[9]
+    store = ColumnarStore(path)
+    ragged_column = store.column_names.index("boxes")
+    del store
+
+    # Decreasing offsets of a ragged column
+    with open(path, "rb") as f:
+        f.seek(columns_offset + ragged_column * _COLUMN.size)
+        offsets_offset = _COLUMN.unpack(f.read(_COLUMN.size))[-1]
+    _overwrite_uint64(path, offsets_offset + 8, 4)
+    with pytest.raises(ValueError, match="corrupt column offsets"):
+        ColumnarStore(path)
+
+    # Sorted key pointing past the last sample
+    _write_test_store(path)
+    _overwrite_uint64(path, sorted_keys_offset, 3)
+    with pytest.raises(ValueError, match="invalid sample keys"):
+        ColumnarStore(path)
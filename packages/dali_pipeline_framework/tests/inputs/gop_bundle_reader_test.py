@@ -0,0 +1,186 @@
+# Copyright (c) 2025, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+import os
+import struct
+
+import numpy as np
+import pytest
+
+from nvidia.dali import pipeline_def
+
+from accvlab.dali_pipeline_framework.inputs import gop_bundle_reader
+
+
+def _make_bundle(bundle_id: int, packet_sizes_per_frame):
+    '''Serialize a GOP bundle (same layout as ``PyNvGopDecoder.GetGOP``) with recognizable contents.'''
+    frames = []
+    for frame_idx, packet_sizes in enumerate(packet_sizes_per_frame):
+        payload = bytes((bundle_id + frame_idx + i) % 256 for i in range(sum(packet_sizes)))
+        # color_range, codec_id, width, height, frame_size, gop_len, first_frame_id
+        frame = struct.pack("<7i", 1, 8, 64, 48, 64 * 48 * 3 // 2, 30, bundle_id * 30)
+        frame += struct.pack(f"<I{len(packet_sizes)}i", len(packet_sizes), *packet_sizes)
+        frame += struct.pack(f"<I{len(packet_sizes)}i", len(packet_sizes), *range(len(packet_sizes)))
+        frame += struct.pack("<Q", len(payload)) + payload
+        frames.append(frame)
+
+    header_size = 4 + 8 * len(frames)
+    offsets = np.cumsum([header_size] + [len(f) for f in frames[:-1]]).tolist()
+    return struct.pack(f"<I{len(frames)}Q", len(frames), *offsets) + b"".join(frames)
+
+
+def _write_bundles(directory, num_bundles):
+    paths = []
+    bundles = []
+    for i in range(num_bundles):
+        bundle = _make_bundle(i, [[5, 3], [7]] if i % 2 == 0 else [[11, 1, 2]])
+        path = os.path.join(directory, f"bundle_{i:03d}.bin")
+        with open(path, "wb") as f:
+            f.write(bundle)
+        paths.append(path)
+        bundles.append(bundle)
+    return paths, bundles
+
+
+def _run_reader(batch_size, num_batches, **reader_kwargs):
+    @pipeline_def(batch_size=batch_size, num_threads=2, device_id=None, prefetch_queue_depth=2)
+    def pipe_def():
+        return gop_bundle_reader(name="Reader", **reader_kwargs)
+
+    pipe = pipe_def()
+    pipe.build()
+    outputs = []
+    for _ in range(num_batches):
+        data, frame_info, payload_ranges = pipe.run()
+        for s in range(batch_size):
+            outputs.append((data.at(s).tobytes(), np.array(frame_info.at(s)), np.array(payload_ranges.at(s))))
+    return pipe, outputs
+
+
+def test_reads_bundle_files_with_metadata(tmp_path):
+    paths, bundles = _write_bundles(str(tmp_path), 4)
+    _, outputs = _run_reader(batch_size=2, num_batches=2, files=paths)
+
+    for bundle_id, (data, frame_info, payload_ranges) in enumerate(outputs):
+        assert data == bundles[bundle_id]
+        expected_num_packets = [2, 1] if bundle_id % 2 == 0 else [3]
+        assert frame_info.shape == (len(expected_num_packets), 8)
+        assert frame_info[:, 2].tolist() == [64] * len(expected_num_packets)
+        assert frame_info[:, 6].tolist() == [bundle_id * 30] * len(expected_num_packets)
+        assert frame_info[:, 7].tolist() == expected_num_packets
+        for frame_idx, (offset, size) in enumerate(payload_ranges):
+            payload = data[offset : offset + size]
+            assert payload == bytes((bundle_id + frame_idx + i) % 256 for i in range(size))
+
+
+def test_reads_completed_jobs_of_gop_index(tmp_path):
+    bundles = [_make_bundle(i, [[4, 4]]) for i in range(3)]
+    shard = b"".join(bundles)
+    with open(tmp_path / "gops_00000.bin", "wb") as f:
+        f.write(shard)
+    offsets = np.cumsum([0] + [len(b) for b in bundles[:-1]]).tolist()
+    records = [
+        "M\t2\t1234",
+        f"G\t0\t0\t0\t30\tgops_00000.bin\t{offsets[0]}\t{len(bundles[0])}\tcam0.mp4",
+        f"G\t0\t40\t30\t30\tgops_00000.bin\t{offsets[1]}\t{len(bundles[1])}\tcam0.mp4",
+        "J\t0\t2",
+        # Job without terminating record (interrupted extraction) is ignored
+        f"G\t1\t0\t0\t30\tgops_00000.bin\t{offsets[2]}\t{len(bundles[2])}\tcam1.mp4",
+    ]
+    with open(tmp_path / "gop_index.tsv", "w") as f:
+        f.write("\n".join(records) + "\n")
+
+    pipe, outputs = _run_reader(batch_size=2, num_batches=1, index_file=str(tmp_path / "gop_index.tsv"))
+    assert [data for data, _, _ in outputs] == bundles[:2]
+    assert pipe.reader_meta("Reader")["epoch_size"] == 2
+
+
+def test_gop_index_parsing_stops_at_corrupt_record(tmp_path):
+    bundles = [_make_bundle(i, [[4, 4]]) for i in range(3)]
+    with open(tmp_path / "gops_00000.bin", "wb") as f:
+        f.write(b"".join(bundles))
+    offsets = np.cumsum([0] + [len(b) for b in bundles[:-1]]).tolist()
+    records = [
+        "M\t3\t1234",
+        f"G\t0\t0\t0\t30\tgops_00000.bin\t{offsets[0]}\t{len(bundles[0])}\tcam0.mp4",
+        "J\t0\t1",
+        # GOP count does not match the collected records; this and all following records are ignored
+        f"G\t1\t0\t0\t30\tgops_00000.bin\t{offsets[1]}\t{len(bundles[1])}\tcam1.mp4",
+        "J\t1\t2",
+        f"G\t2\t0\t0\t30\tgops_00000.bin\t{offsets[2]}\t{len(bundles[2])}\tcam2.mp4",
+        "J\t2\t1",
+    ]
+    with open(tmp_path / "gop_index.tsv", "w") as f:
+        # Torn last record without line break
+        f.write("\n".join(records) + "\nG\t2\t0")
+
+    pipe, outputs = _run_reader(batch_size=1, num_batches=1, index_file=str(tmp_path / "gop_index.tsv"))
+    assert [data for data, _, _ in outputs] == bundles[:1]
+    assert pipe.reader_meta("Reader")["epoch_size"] == 1
+
+
+def test_gop_index_invalid_number_is_rejected(tmp_path):
+    records = ["M\t1\t1234", "G\t0\t0\t0\t30\tgops_00000.bin\tx12\t100\tcam0.mp4", "J\t0\t1"]
+    with open(tmp_path / "gop_index.tsv", "w") as f:
+        f.write("\n".join(records) + "\n")
+    with pytest.raises(RuntimeError, match="Invalid number 'x12' in GOP index file"):
+        _run_reader(batch_size=1, num_batches=1, index_file=str(tmp_path / "gop_index.tsv"))
+
+
+@pytest.mark.parametrize("random_shuffle", [False, True])
+def test_shards_cover_data_once_per_epoch(tmp_path, random_shuffle):
+    paths, bundles = _write_bundles(str(tmp_path), 12)
+    num_shards = 3
+    seen = []
+    for shard_id in range(num_shards):
+        _, outputs = _run_reader(
+            batch_size=2,
+            num_batches=2,
+            files=paths,
+            shard_id=shard_id,
+            num_shards=num_shards,
+            random_shuffle=random_shuffle,
+            stick_to_shard=True,
+            seed=42,
+        )
+        shard_bundles = [bundles.index(data) for data, _, _ in outputs]
+        assert sorted(shard_bundles) == list(range(shard_id * 4, (shard_id + 1) * 4))
+        seen.extend(shard_bundles)
+    assert sorted(seen) == list(range(12))
+
+
+def test_pad_last_batch_repeats_last_sample(tmp_path):
+    paths, bundles = _write_bundles(str(tmp_path), 3)
+    pipe, outputs = _run_reader(batch_size=2, num_batches=3, files=paths, pad_last_batch=True)
+    assert [bundles.index(data) for data, _, _ in outputs] == [0, 1, 2, 2, 0, 1]
+    assert pipe.reader_meta("Reader")["epoch_size_padded"] == 4
+
+
+def test_corrupt_bundle_is_rejected(tmp_path):
+    paths, bundles = _write_bundles(str(tmp_path), 2)
+    with open(paths[1], "wb") as f:
+        f.write(bundles[1][:-3])
+    with pytest.raises(RuntimeError, match="Truncated GOP bundle"):
+        _run_reader(batch_size=2, num_batches=1, files=paths)
+
+
+def test_requires_exactly_one_source():
+    with pytest.raises(ValueError):
+        gop_bundle_reader()
+    with pytest.raises(ValueError):
+        gop_bundle_reader(files=["a.bin"], index_file="gop_index.tsv")
+
+
+if __name__ == "__main__":
+    pytest.main([__file__])
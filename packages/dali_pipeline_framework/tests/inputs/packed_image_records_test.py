@@ -0,0 +1,139 @@
+# Copyright (c) 2025, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+import os
+import pickle
+
+import numpy as np
+import pytest
+
+import nvidia.dali.fn as fn
+import nvidia.dali.types as types
+from nvidia.dali import pipeline_def
+
+from accvlab.dali_pipeline_framework.inputs import (
+    pack_image_records,
+    packed_record_reader,
+    PackedImageRecords,
+    ColumnarStore,
+)
+
+
+def _write_images(directory, num_images):
+    '''Write files with recognizable contents of varying size (the content does not need to be decodable).'''
+    files = []
+    contents = []
+    os.makedirs(os.path.join(directory, "images"), exist_ok=True)
+    for i in range(num_images):
+        content = bytes((i * 7 + j) % 256 for j in range(100 + 37 * i))
+        file = f"images/cam_{i % 3}_{i:03d}.jpg"
+        with open(os.path.join(directory, file), "wb") as f:
+            f.write(content)
+        files.append(file)
+        contents.append(content)
+    return files, contents
+
+
+def _pack(tmp_path, num_images, **kwargs):
+    files, contents = _write_images(str(tmp_path), num_images)
+    index_file = pack_image_records(str(tmp_path / "packed"), files, file_root=str(tmp_path), **kwargs)
+    return index_file, files, contents
+
+
+def test_pack_and_read_on_cpu(tmp_path):
+    annotations = [f"annotation {i}".encode() if i % 2 == 0 else None for i in range(10)]
+    index_file, files, contents = _pack(tmp_path, 10, annotations=annotations, max_shard_size=1000)
+    records = PackedImageRecords(index_file)
+
+    assert len(records) == 10
+    # Records are split into multiple shards
+    index = ColumnarStore(index_file)
+    assert len({index.get("shard", i) for i in range(10)}) > 1
+    for i in range(10):
+        assert records.index_of(files[i]) == i
+        assert records.read(i).tobytes() == contents[i]
+        assert records.read_annotation(i).tobytes() == (annotations[i] or b"")
+
+    restored = pickle.loads(pickle.dumps(records))
+    assert restored.read(3).tobytes() == contents[3]
+
+
+def test_pack_with_keys_and_missing_file(tmp_path):
+    files, _ = _write_images(str(tmp_path), 3)
+    keys = ["token_a", "token_b", "token_c"]
+    index_file = pack_image_records(str(tmp_path / "packed"), files, keys=keys, file_root=str(tmp_path))
+    assert PackedImageRecords(index_file).index_of("token_b") == 1
+
+    with pytest.raises(FileNotFoundError):
+        pack_image_records(str(tmp_path / "packed_2"), files + ["missing.jpg"], file_root=str(tmp_path))
+    # No index is written for incomplete packing runs
+    assert not os.path.exists(tmp_path / "packed_2" / "records_index.acs")
+
+
+def _run_reader(batch_size, record_indices_per_input, **reader_kwargs):
+    num_inputs = len(record_indices_per_input)
+
+    @pipeline_def(batch_size=batch_size, num_threads=2, device_id=None, prefetch_queue_depth=1)
+    def pipe_def():
+        inputs = [
+            fn.external_source(
+                source=lambda info, i=i: np.array(record_indices_per_input[i][info.idx_in_batch], np.int64),
+                batch=False,
+                dtype=types.INT64,
+            )
+            for i in range(num_inputs)
+        ]
+        outputs = packed_record_reader(*inputs, **reader_kwargs)
+        if isinstance(outputs, tuple):
+            return tuple(outputs[0]) + tuple(outputs[1])
+        return tuple(outputs)
+
+    pipe = pipe_def()
+    pipe.build()
+    outputs = pipe.run()
+    return [[outputs[o].at(s).tobytes() for s in range(batch_size)] for o in range(len(outputs))]
+
+
+@pytest.mark.parametrize("max_gap", [0, 1 << 16])
+def test_native_reader_matches_packed_contents(tmp_path, max_gap):
+    index_file, _, contents = _pack(tmp_path, 12, max_shard_size=2000)
+    # Unsorted indices, including a repeated record, spread over multiple shards
+    record_indices = [[5, 0, 11, 3], [4, 4, 1, 10]]
+    outputs = _run_reader(4, record_indices, index_file=index_file, max_gap=max_gap)
+
+    assert len(outputs) == 2
+    for i in range(2):
+        assert outputs[i] == [contents[r] for r in record_indices[i]]
+
+
+def test_native_reader_outputs_annotations(tmp_path):
+    annotations = [f"annotation {i}".encode() if i != 2 else None for i in range(4)]
+    index_file, _, contents = _pack(tmp_path, 4, annotations=annotations)
+    record_indices = [[0, 2], [3, 1]]
+    outputs = _run_reader(2, record_indices, index_file=index_file, read_annotations=True)
+
+    assert len(outputs) == 4
+    for i in range(2):
+        assert outputs[i] == [contents[r] for r in record_indices[i]]
+        assert outputs[2 + i] == [annotations[r] or b"" for r in record_indices[i]]
+
+
+def test_native_reader_rejects_invalid_record_index(tmp_path):
+    index_file, _, _ = _pack(tmp_path, 3)
+    with pytest.raises(RuntimeError, match="out of range"):
+        _run_reader(2, [[0, 3]], index_file=index_file)
+
+
+if __name__ == "__main__":
+    pytest.main([__file__])
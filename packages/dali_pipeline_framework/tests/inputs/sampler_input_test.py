@@ -20,6 +20,7 @@ from accvlab.dali_pipeline_framework.pipeline import PipelineDefinition, DALIStr
 from accvlab.dali_pipeline_framework.inputs.sampler_base import SamplerBase
 from accvlab.dali_pipeline_framework.inputs.sampler_input_callable import SamplerInputCallable
 from accvlab.dali_pipeline_framework.inputs.sampler_input_iterable import SamplerInputIterable
+from accvlab.dali_pipeline_framework.inputs.shuffled_batch_sampler import ShuffledBatchSampler
 
 from _test_helpers import build_pipeline_and_iterator, SimpleDataProvider
 
@@ -419,6 +420,58 @@ def test_sampler_inputs_sharding_across_epoch_boundaries(input_kind: str):
         del pipe1
 
 
+def test_sampler_input_callable_resume_with_random_access_sampler():
+    batch_size = 4
+    num_test_batches = 5
+    provider = SimpleDataProvider()
+
+    input0 = SamplerInputCallable(
+        data_provider=provider,
+        sampler=ShuffledBatchSampler(40, batch_size, seed=5),
+    )
+    assert input0.length == 10
+    _, pipe0, it0 = build_pipeline_and_iterator(input0, batch_size, num_test_batches)
+
+    # Resume after the second batch
+    resume_state = input0.get_resume_state(0, 2)
+    input1 = SamplerInputCallable(
+        data_provider=provider,
+        sampler=ShuffledBatchSampler(40, batch_size, seed=5),
+        resume_state=resume_state,
+    )
+    assert input1.length == 8
+    _, pipe1, it1 = build_pipeline_and_iterator(input1, batch_size, num_test_batches - 2)
+
+    try:
+        iter0 = iter(it0)
+        iter1 = iter(it1)
+        ids0 = [next(iter0)["id"].tolist() for _ in range(num_test_batches)]
+        ids1 = [next(iter1)["id"].tolist() for _ in range(num_test_batches - 2)]
+        assert ids1 == ids0[2:]
+        assert len({i for ids in ids0 for i in ids}) == num_test_batches * batch_size
+    finally:
+        del it0
+        del it1
+        del pipe0
+        del pipe1
+
+
+def test_sampler_input_callable_resume_at_end_of_epoch():
+    batch_size = 4
+    input0 = SamplerInputCallable(
+        data_provider=SimpleDataProvider(), sampler=ShuffledBatchSampler(40, batch_size, seed=5)
+    )
+    # Checkpoint after the last batch of the first epoch
+    resume_state = input0.get_resume_state(0, input0.length)
+    assert resume_state == {"epoch": 1, "batch": 0}
+    input1 = SamplerInputCallable(
+        data_provider=SimpleDataProvider(),
+        sampler=ShuffledBatchSampler(40, batch_size, seed=5),
+        resume_state=resume_state,
+    )
+    assert input1.length == 10
+
+
 if __name__ == "__main__":
     # test_sampler_input_iterable_continuous_across_epoch_boundaries()
     pytest.main([__file__])
@@ -0,0 +1,54 @@
+# Copyright (c) 2025, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+import pytest
+
+from accvlab.dali_pipeline_framework.internal_helpers.mini_parser import Parser, OpCode, compile_to_bytecode
+
+
+def test_compile_to_bytecode():
+    expression = Parser("res = a > -1.5 and not (b == 2 or a <= 3) and c").parse().expression
+    bytecode = compile_to_bytecode(expression)
+
+    assert bytecode.variable_names == ["a", "b", "c"]
+    assert bytecode.constants == [1.5, 2.0, 3.0]
+    expected_program = [
+        (OpCode.LOAD_INPUT, 0),
+        (OpCode.LOAD_CONST, 0),
+        (OpCode.NEG, 0),
+        (OpCode.GT, 0),
+        (OpCode.LOAD_INPUT, 1),
+        (OpCode.LOAD_CONST, 1),
+        (OpCode.EQ, 0),
+        (OpCode.LOAD_INPUT, 0),
+        (OpCode.LOAD_CONST, 2),
+        (OpCode.LE, 0),
+        (OpCode.OR, 0),
+        (OpCode.NOT, 0),
+        (OpCode.AND, 0),
+        (OpCode.LOAD_INPUT, 2),
+        (OpCode.AND, 0),
+    ]
+    assert bytecode.program == expected_program
+    assert bytecode.flat_program == [int(v) for instruction in expected_program for v in instruction]
+
+
+def test_compile_to_bytecode_without_variables():
+    bytecode = compile_to_bytecode(Parser("res = 1 < 2").parse().expression)
+    assert bytecode.variable_names == []
+    assert bytecode.program == [(OpCode.LOAD_CONST, 0), (OpCode.LOAD_CONST, 1), (OpCode.LT, 0)]
+
+
+if __name__ == "__main__":
+    pytest.main([__file__])
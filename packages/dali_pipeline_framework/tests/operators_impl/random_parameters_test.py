@@ -0,0 +1,120 @@
+# Copyright (c) 2025, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+import numpy as np
+import pytest
+
+import nvidia.dali.fn as fn
+import nvidia.dali.types as types
+from nvidia.dali import pipeline_def
+
+from accvlab.dali_pipeline_framework.operators_impl.random_parameters import (
+    RandomParameter,
+    draw_random_parameters_reference,
+    philox4x32_10,
+    random_parameters,
+)
+
+_PARAMETERS = [
+    RandomParameter.uniform("angle", -0.5, 1.5),
+    RandomParameter.bernoulli("flip", 0.3),
+    RandomParameter.integer("permutation_index", 0, 5),
+    RandomParameter.uniform("fixed_scale", 2.0, 2.0),
+]
+
+
+def test_philox_known_answers():
+    # Known-answer tests of the Random123 reference implementation
+    counters = np.array(
+        [[0, 0, 0, 0], [0xFFFFFFFF] * 4, [0x243F6A88, 0x85A308D3, 0x13198A2E, 0x03707344]], dtype=np.uint64
+    )
+    keys = [(0, 0), (0xFFFFFFFF, 0xFFFFFFFF), (0xA4093822, 0x299F31D0)]
+    expected = [
+        [0x6627E8D5, 0xE169C58D, 0xBC57AC4C, 0x9B00DBD8],
+        [0x408F276D, 0x41C83B0E, 0xA20BC7C6, 0x6D5451FD],
+        [0xD16CFE09, 0x94FDCCEB, 0x5001E420, 0x24126EA1],
+    ]
+    for counter, key, exp in zip(counters, keys, expected):
+        assert philox4x32_10(counter, key).tolist() == exp
+
+
+def test_reference_values_are_keyed_by_position():
+    records = draw_random_parameters_reference(_PARAMETERS, 7, np.arange(2000), epochs=1)
+    assert records.shape == (2000, 4) and records.dtype == np.float32
+
+    assert np.all((records[:, 0] >= -0.5) & (records[:, 0] < 1.5))
+    assert abs(records[:, 1].mean() - 0.3) < 0.05
+    assert set(records[:, 2].tolist()) == {0.0, 1.0, 2.0, 3.0, 4.0, 5.0}
+    assert np.all(records[:, 3] == 2.0)
+
+    # Each value only depends on (seed, epoch, sample index, parameter name)
+    single = draw_random_parameters_reference(_PARAMETERS[::-1], 7, 1234, epochs=1)
+    assert np.array_equal(single[0, ::-1], records[1234])
+    other_epoch = draw_random_parameters_reference(_PARAMETERS, 7, 1234, epochs=2)
+    other_seed = draw_random_parameters_reference(_PARAMETERS, 8, 1234, epochs=1)
+    assert not np.array_equal(other_epoch[0], records[1234])
+    assert not np.array_equal(other_seed[0], records[1234])
+
+
+def test_invalid_parameters():
+    with pytest.raises(ValueError):
+        RandomParameter.uniform("a", 1.0, 0.0)
+    with pytest.raises(ValueError):
+        RandomParameter.bernoulli("a", 1.5)
+    with pytest.raises(ValueError):
+        RandomParameter.integer("a", 0, 2.5)
+    with pytest.raises(ValueError, match="same name"):
+        draw_random_parameters_reference([RandomParameter.bernoulli("a", 0.5)] * 2, 0, 0)
+
+
+def _run_random_parameters(positions, batch_size, num_iterations, num_threads, seed=21):
+    @pipeline_def(batch_size=batch_size, num_threads=num_threads, device_id=None, prefetch_queue_depth=1)
+    def pipe_def():
+        sample_position = None
+        if positions is not None:
+            sample_position = fn.external_source(
+                source=lambda info: positions[info.iteration * batch_size + info.idx_in_batch],
+                batch=False,
+                dtype=types.INT64,
+            )
+        values = random_parameters(_PARAMETERS, seed=seed, sample_position=sample_position)
+        return tuple(values[p.name] for p in _PARAMETERS)
+
+    pipe = pipe_def()
+    pipe.build()
+    records = []
+    for _ in range(num_iterations):
+        outputs = pipe.run()
+        for s in range(batch_size):
+            records.append([float(np.array(o.at(s))) for o in outputs])
+    return np.array(records, dtype=np.float32)
+
+
+@pytest.mark.parametrize("num_threads", [1, 4])
+def test_native_operator_matches_reference(num_threads):
+    positions = [np.array([e, i], dtype=np.int64) for e, i in [(0, 5), (3, 1 << 33), (1, 0), (1, 5)]]
+    records = _run_random_parameters(positions, batch_size=2, num_iterations=2, num_threads=num_threads)
+    expected = draw_random_parameters_reference(
+        _PARAMETERS, 21, [p[1] for p in positions], epochs=[p[0] for p in positions]
+    )
+    assert np.array_equal(records, expected)
+
+
+def test_native_operator_without_positions_numbers_samples_consecutively():
+    records = _run_random_parameters(None, batch_size=3, num_iterations=2, num_threads=2)
+    assert np.array_equal(records, draw_random_parameters_reference(_PARAMETERS, 21, np.arange(6)))
+
+
+if __name__ == "__main__":
+    pytest.main([__file__])
@@ -0,0 +1,141 @@
+# Copyright (c) 2025, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+import numpy as np
+import pytest
+
+try:
+    from typing import override
+except ImportError:
+    from typing_extensions import override
+
+import nvidia.dali.fn as fn
+from nvidia.dali.types import DALIDataType
+
+from accvlab.dali_pipeline_framework.inputs import ShuffledShardedInputCallable, DataProvider
+from accvlab.dali_pipeline_framework.pipeline import SampleDataGroup, PipelineDefinition
+from accvlab.dali_pipeline_framework.processing_steps import PipelineStepBase
+
+
+class _ArrayProvider(DataProvider):
+    """Provides a single float array per sample."""
+
+    @override
+    def get_data(self, sample_id: int) -> SampleDataGroup:
+        res = self.sample_data_structure
+        res["values"] = np.full((16,), sample_id, dtype=np.float32)
+        return res
+
+    @override
+    def get_number_of_samples(self) -> int:
+        return 8
+
+    @property
+    @override
+    def sample_data_structure(self) -> SampleDataGroup:
+        res = SampleDataGroup()
+        res.add_data_field("values", DALIDataType.FLOAT)
+        return res
+
+
+class _ScaleStep(PipelineStepBase):
+    """Scales the values (2 operators)."""
+
+    @override
+    def _process(self, data: SampleDataGroup) -> SampleDataGroup:
+        data["values"] = fn.cast(data["values"] * 2.0, dtype=DALIDataType.FLOAT)
+        return data
+
+    @override
+    def _check_and_adjust_data_format_input_to_output(self, data_empty: SampleDataGroup) -> SampleDataGroup:
+        return data_empty
+
+
+class _PythonSumStep(PipelineStepBase):
+    """Adds the sum of the values, computed with a ``python_function`` operator."""
+
+    @override
+    def _process(self, data: SampleDataGroup) -> SampleDataGroup:
+        data["sum"] = fn.python_function(
+            data["values"], function=lambda v: np.array([v.sum()], dtype=np.float32), num_outputs=1
+        )
+        return data
+
+    @override
+    def _check_and_adjust_data_format_input_to_output(self, data_empty: SampleDataGroup) -> SampleDataGroup:
+        data_empty.add_data_field("sum", DALIDataType.FLOAT)
+        return data_empty
+
+
+class _NestingStep(PipelineStepBase):
+    """Applies a nested step."""
+
+    def __init__(self, inner_step: PipelineStepBase):
+        self._inner_step = inner_step
+
+    @override
+    def _process(self, data: SampleDataGroup) -> SampleDataGroup:
+        return self._inner_step(data)
+
+    @override
+    def _check_and_adjust_data_format_input_to_output(self, data_empty: SampleDataGroup) -> SampleDataGroup:
+        return self._inner_step.check_input_data_format_and_set_output_data_format(data_empty)
+
+
+def _get_pipeline_definition(batch_size):
+    input_callable = ShuffledShardedInputCallable(
+        _ArrayProvider(), batch_size=batch_size, num_shards=1, shard_id=0, shuffle=False
+    )
+    return PipelineDefinition(
+        data_loading_callable_iterable=input_callable,
+        preprocess_functors=[_ScaleStep(), _NestingStep(_PythonSumStep())],
+        check_data_format=False,
+    )
+
+
+def test_profile_steps():
+    batch_size = 4
+    report = _get_pipeline_definition(batch_size).profile_steps(
+        batch_size=batch_size, num_iterations=3, num_warmup_iterations=1
+    )
+
+    expected_paths = ["", "0:_ScaleStep", "1:_NestingStep", "1:_NestingStep/_PythonSumStep"]
+    assert [s.path for s in report.steps] == expected_paths
+
+    scale = report.get_step("0:_ScaleStep")
+    assert scale.num_operators >= 2
+    assert scale.num_python_function_operators == 0 and scale.num_numba_function_operators == 0
+    # The nested step is counted for the nesting step as well
+    nesting = report.get_step("1:_NestingStep")
+    nested = report.get_step("1:_NestingStep/_PythonSumStep")
+    # One operator, which is called once per sample (i.e. `batch_size` times per iteration)
+    assert nested.num_python_function_operators == 1 and nesting.num_python_function_operators == 1
+    assert nesting.num_operators == nested.num_operators >= 1
+
+    # Timings and output sizes are available for the top-level steps only
+    assert nested.wall_time is None and nested.output_bytes is None
+    assert all(s.wall_time is not None for s in report.steps if s.is_top_level)
+    assert sum(s.wall_time for s in report.steps if s.is_top_level) == pytest.approx(report.total_wall_time)
+    # Each output is attributed to the step writing it last
+    assert report.get_step("").output_bytes == batch_size * 16 * 4
+    assert scale.output_bytes == batch_size * 16 * 4
+    assert nesting.output_bytes == batch_size * 4
+
+    assert len(report.get_top_level_steps_by_wall_time()) == 3
+    table = str(report)
+    assert "<data loading>" in table and "0:_ScaleStep" in table and "_PythonSumStep" in table
+
+
+if __name__ == "__main__":
+    pytest.main([__file__])
@@ -734,6 +734,60 @@ def test_negative_values_and_unary_minus():
     assert torch.equal(res2["annotation"]["negative_lidar"][0], expected_result2)
 
 
+@pytest.mark.parametrize(
+    "condition",
+    [
+        "res = num_lidar_points >= 1",
+        "res = (num_lidar_points >= 1 or num_radar_points >= 1) and visibility_levels > 0",
+        "res = not (visibility_levels > 1)",
+        "res = num_lidar_points and num_radar_points",
+        "res = -visibility_levels <= -1 or other_field > 25.5 and other_field <= 55.0",
+        "res = num_lidar_points != num_radar_points and not is_bbox_in_range",
+    ],
+)
+def test_fused_operator_matches_dali_operators(condition):
+    """The native condition evaluation gives the same results as the evaluation with DALI operators."""
+    provider = TestProvider()
+    results = []
+    for use_fused_operator in (False, True):
+        input_callable = ShuffledShardedInputCallable(
+            provider,
+            batch_size=1,
+            num_shards=1,
+            shard_id=0,
+            shuffle=False,
+        )
+        step = AnnotationElementConditionEval(
+            annotation_field_name="annotation",
+            condition=condition,
+            remove_data_fields_used_in_condition=True,
+            use_fused_operator=use_fused_operator,
+        )
+        pipeline_def = PipelineDefinition(
+            data_loading_callable_iterable=input_callable,
+            preprocess_functors=[step],
+        )
+        pipeline = pipeline_def.get_dali_pipeline(
+            enable_conditionals=True,
+            batch_size=1,
+            prefetch_queue_depth=1,
+            num_threads=1,
+            py_start_method="spawn",
+        )
+        iterator = DALIStructuredOutputIterator(
+            10, pipeline, pipeline_def.check_and_get_output_data_structure()
+        )
+        results.append(next(iter(iterator)))
+
+    reference, fused = results
+    assert fused["annotation"]["res"][0].dtype == torch.bool
+    assert torch.equal(fused["annotation"]["res"][0], reference["annotation"]["res"][0])
+    # Nested annotation (evaluated independently)
+    assert torch.equal(
+        fused["annotation"]["annotation"]["res"][0], reference["annotation"]["annotation"]["res"][0]
+    )
+
+
 if __name__ == "__main__":
     test_negative_values_and_unary_minus()
     pytest.main([__file__])
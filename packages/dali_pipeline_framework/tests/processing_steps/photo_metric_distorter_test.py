@@ -34,6 +34,10 @@ from accvlab.dali_pipeline_framework.pipeline import (
     DALIStructuredOutputIterator,
 )
 from accvlab.dali_pipeline_framework.processing_steps import PhotoMetricDistorter
+from accvlab.dali_pipeline_framework.operators_impl.random_parameters import (
+    RandomParameter,
+    draw_random_parameters_reference,
+)
 
 # @TODO:
 #  - Decide whether to use accurate transformations instead of the used approximations
@@ -870,5 +874,218 @@ def test_photometric_distorter_no_images_found():
         )
 
 
+def run_distorter_and_get_images(step, use_uint8, batch_size=1, provider=None):
+    """Run a pipeline with the given step and return the images of all samples as numpy arrays."""
+    if provider is None:
+        provider = TestProvider(use_uint8=use_uint8)
+    input_callable = ShuffledShardedInputCallable(
+        provider,
+        batch_size=batch_size,
+        num_shards=1,
+        shard_id=0,
+        shuffle=False,
+    )
+    pipeline_def = PipelineDefinition(
+        data_loading_callable_iterable=input_callable,
+        preprocess_functors=[step],
+    )
+    pipeline = pipeline_def.get_dali_pipeline(
+        enable_conditionals=True,
+        batch_size=batch_size,
+        prefetch_queue_depth=1,
+        num_threads=2,
+        py_start_method="spawn",
+    )
+    iterator = DALIStructuredOutputIterator(1, pipeline, pipeline_def.check_and_get_output_data_structure())
+    res = next(iter(iterator))
+    return [
+        [
+            res["image"][i].cpu().numpy(),
+            res["camera"]["image"][i].cpu().numpy(),
+            res["camera"]["annotation"]["image"][i].cpu().numpy(),
+            res["red"]["image"][i].cpu().numpy(),
+        ]
+        for i in range(batch_size)
+    ]
+
+
+@pytest.mark.parametrize("use_uint8", [False, True])
+@pytest.mark.parametrize(
+    "probs,ranges",
+    [
+        # Brightness & contrast (the contrast mode does not change the result without saturation & hue)
+        ([1.0, 0.0, 1.0, 0.0], [[0.1, 0.1], [0.0, 0.0], [1.3, 1.3], [1.0, 1.0]]),
+        # Saturation & hue
+        ([0.0, 1.0, 0.0, 1.0], [[0.0, 0.0], [12.0, 12.0], [1.0, 1.0], [0.7, 0.7]]),
+    ],
+)
+def test_photometric_distorter_fused_matches_chained(use_uint8, probs, ranges):
+    """The fused operator applies the same distortion as the chain of DALI operators."""
+    prob_brightness, prob_hue, prob_contrast, prob_saturation = probs
+    min_max_brightness, min_max_hue, min_max_contrast, min_max_saturation = ranges
+    if use_uint8:
+        min_max_brightness = [v * 255.0 for v in min_max_brightness]
+
+    results = []
+    for use_fused_operator in (False, True):
+        step = PhotoMetricDistorter(
+            image_name="image",
+            min_max_brightness=min_max_brightness,
+            min_max_hue=min_max_hue,
+            min_max_contrast=min_max_contrast,
+            min_max_saturation=min_max_saturation,
+            prob_brightness_aug=prob_brightness,
+            prob_hue_aug=prob_hue,
+            prob_contrast_aug=prob_contrast,
+            prob_saturation_aug=prob_saturation,
+            prob_swap_channels=0.0,
+            enforce_process_on_gpu=False,
+            use_fused_operator=use_fused_operator,
+        )
+        results.append(run_distorter_and_get_images(step, use_uint8)[0])
+
+    for chained, fused in zip(*results):
+        assert fused.dtype == chained.dtype
+        assert fused.shape == chained.shape
+        assert np.allclose(to_float01(fused), to_float01(chained), atol=1.5 / 255.0)
+
+
+@pytest.mark.parametrize("use_uint8", [False, True])
+def test_photometric_distorter_fused_channel_swap_shared_by_images(use_uint8):
+    """With the fused operator, all images of a sample get the same (random) channel permutation."""
+    step = PhotoMetricDistorter(
+        image_name="image",
+        min_max_brightness=[0.0, 0.0],
+        min_max_hue=[0.0, 0.0],
+        min_max_contrast=[1.0, 1.0],
+        min_max_saturation=[1.0, 1.0],
+        prob_brightness_aug=0.0,
+        prob_hue_aug=0.0,
+        prob_contrast_aug=0.0,
+        prob_saturation_aug=0.0,
+        prob_swap_channels=1.0,
+        enforce_process_on_gpu=False,
+        use_fused_operator=True,
+    )
+    batch_size = 8
+    samples = run_distorter_and_get_images(step, use_uint8, batch_size=batch_size)
+
+    original_data = TestProvider(use_uint8=use_uint8).get_data(0)
+    originals = [
+        original_data["image"],
+        original_data["camera"]["image"],
+        original_data["camera"]["annotation"]["image"],
+        original_data["red"]["image"],
+    ]
+    permutations = [[0, 1, 2], [0, 2, 1], [1, 0, 2], [2, 1, 0], [2, 0, 1], [1, 2, 0]]
+    for images in samples:
+        # The main image has distinct channels, so the permutation is unique
+        matching = [p for p in permutations if np.array_equal(images[0], originals[0][:, :, p])]
+        assert len(matching) == 1
+        for image, original in zip(images, originals):
+            assert np.array_equal(image, original[:, :, matching[0]])
+
+
+@pytest.mark.parametrize("use_uint8", [False, True])
+def test_photometric_distorter_counter_based_parameters(use_uint8):
+    """With a parameter seed, the channel permutation of each sample is given by the counter-based record."""
+    seed = 1234
+    step = PhotoMetricDistorter(
+        image_name="image",
+        min_max_brightness=[0.0, 0.0],
+        min_max_hue=[0.0, 0.0],
+        min_max_contrast=[1.0, 1.0],
+        min_max_saturation=[1.0, 1.0],
+        prob_brightness_aug=0.0,
+        prob_hue_aug=0.0,
+        prob_contrast_aug=0.0,
+        prob_saturation_aug=0.0,
+        prob_swap_channels=1.0,
+        enforce_process_on_gpu=False,
+        parameter_seed=seed,
+    )
+    batch_size = 8
+    samples = run_distorter_and_get_images(step, use_uint8, batch_size=batch_size)
+
+    # Samples are numbered consecutively by the operator
+    expected_indices = draw_random_parameters_reference(
+        [RandomParameter.integer("permutation_index", 0, 5)], seed, np.arange(batch_size)
+    )[:, 0].astype(np.int64)
+    original_image = TestProvider(use_uint8=use_uint8).get_data(0)["image"]
+    permutations = [[0, 1, 2], [0, 2, 1], [1, 0, 2], [2, 1, 0], [2, 0, 1], [1, 2, 0]]
+    for images, permutation_index in zip(samples, expected_indices):
+        assert np.array_equal(images[0], original_image[:, :, permutations[permutation_index]])
+
+
+class PositionTestProvider(TestProvider):
+    """Test data provider additionally providing the sample position as (epoch, sample index)."""
+
+    EPOCH = 3
+
+    @override
+    def get_data(self, sample_id: int) -> SampleDataGroup:
+        res = super().get_data(sample_id)
+        res["sample_position"] = np.array([self.EPOCH, sample_id], dtype=np.int64)
+        return res
+
+    @property
+    @override
+    def sample_data_structure(self) -> SampleDataGroup:
+        res = super().sample_data_structure
+        res.add_data_field("sample_position", DALIDataType.INT64)
+        return res
+
+
+@pytest.mark.parametrize("use_uint8", [False, True])
+def test_photometric_distorter_counter_based_parameters_with_sample_position(use_uint8):
+    """With a sample position field, the record of each sample is given by its (epoch, sample index)."""
+    seed = 1234
+    step = PhotoMetricDistorter(
+        image_name="image",
+        min_max_brightness=[0.0, 0.0],
+        min_max_hue=[0.0, 0.0],
+        min_max_contrast=[1.0, 1.0],
+        min_max_saturation=[1.0, 1.0],
+        prob_brightness_aug=0.0,
+        prob_hue_aug=0.0,
+        prob_contrast_aug=0.0,
+        prob_saturation_aug=0.0,
+        prob_swap_channels=1.0,
+        enforce_process_on_gpu=False,
+        parameter_seed=seed,
+        parameter_sample_position_name="sample_position",
+    )
+    batch_size = 8
+    samples = run_distorter_and_get_images(
+        step, use_uint8, batch_size=batch_size, provider=PositionTestProvider(use_uint8=use_uint8)
+    )
+
+    # The samples are not shuffled, i.e. the sample indices of the first batch are 0, 1, ...
+    expected_indices = draw_random_parameters_reference(
+        [RandomParameter.integer("permutation_index", 0, 5)],
+        seed,
+        np.arange(batch_size),
+        epochs=PositionTestProvider.EPOCH,
+    )[:, 0].astype(np.int64)
+    original_image = TestProvider(use_uint8=use_uint8).get_data(0)["image"]
+    permutations = [[0, 1, 2], [0, 2, 1], [1, 0, 2], [2, 1, 0], [2, 0, 1], [1, 2, 0]]
+    for images, permutation_index in zip(samples, expected_indices):
+        assert np.array_equal(images[0], original_image[:, :, permutations[permutation_index]])
+
+
+def test_photometric_distorter_sample_position_field_missing():
+    step = PhotoMetricDistorter(
+        image_name="image",
+        min_max_brightness=[0.0, 0.0],
+        min_max_hue=[0.0, 0.0],
+        min_max_contrast=[1.0, 1.0],
+        min_max_saturation=[1.0, 1.0],
+        parameter_seed=1,
+        parameter_sample_position_name="sample_position",
+    )
+    with pytest.raises(KeyError):
+        step.check_input_data_format_and_set_output_data_format(TestProvider().sample_data_structure)
+
+
 if __name__ == "__main__":
     pytest.main([__file__])
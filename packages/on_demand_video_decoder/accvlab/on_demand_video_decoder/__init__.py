@@ -75,6 +75,9 @@ from ._internal.types import Codec, GopRef
 # Utility functions
 from ._internal.utils import drop_videos_cache, DropCacheStatus
 
+# Decode-cost-aware frame selection
+from ._internal.frame_snapping import GopStructure, SnapResult, snap_frames
+
 # Shared GOP store (cross-process cache)
 from ._internal.shared_gop_store import SharedGopStore
 
@@ -87,16 +90,37 @@ __all__ = [
     'FastStreamInfo',
     'DecodedFrameExt',
     'RGBFrame',
+    'MemoryDeviceType',
     'CreateSampleReader',
     'CreateBatchAsyncStreamReader',
     'GetFastInitInfo',
     'SavePacketsToFile',
+    'CrcVariant',
+    'ComputeCRC',
+    'CombineCRC',
+    'GetCRCBackend',
+    'BitDepthRounding',
+    'ConvertBitDepth16To8',
+    'ConvertBitDepth8To16',
+    'ConvertNV12ToRGBHost',
+    'ConvertP016ToRGBHost',
+    'MultiStreamTimestampIndex',
+    'GopExtractionDriver',
+    'VideoDatasetBuilder',
+    'RemuxForRandomAccess',
+    'HostMemoryPool',
+    'RequestReusePlanner',
+    'FingerprintFrame',
     # Python decoder with caching
     'CachedGopDecoder',
     'CreateGopDecoder',
     # Type definitions
     'Codec',
     'GopRef',
+    # Decode-cost-aware frame selection
+    'GopStructure',
+    'SnapResult',
+    'snap_frames',
     # Shared GOP store
     'SharedGopStore',
     # Utility functions
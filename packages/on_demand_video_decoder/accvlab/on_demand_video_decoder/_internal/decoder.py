@@ -273,6 +273,8 @@ class CachedGopDecoder:
         frame_ids: List[int],
         fastStreamInfos: List[Any] = [],
         useGOPCache: bool = False,
+        max_files_per_wave: int = 0,
+        memory_budget: int = 0,
     ) -> List[Tuple[np.ndarray, List[int], List[int]]]:
         """
         Extract per-video GOP data with optional caching support.
@@ -291,6 +293,10 @@ class CachedGopDecoder:
             frame_ids: List of frame IDs to extract GOP data for (one per file)
             fastStreamInfos: Optional list of FastStreamInfo objects for fast initialization
             useGOPCache: If True, enables GOP caching. Default is False.
+            max_files_per_wave: Maximum number of files demuxed at once (0: ``maxfiles``). See
+                :meth:`PyNvGopDecoder.GetGOPList`.
+            memory_budget: Memory budget (in bytes) for overlapping waves (0: no limit). See
+                :meth:`PyNvGopDecoder.GetGOPList`.
 
         Returns:
             List of tuples, one per video file, each containing
@@ -317,7 +323,9 @@ class CachedGopDecoder:
         if not useGOPCache:
             # No caching, directly call C++ implementation
             self._last_cache_hits = [False] * len(filepaths)
-            return self._decoder.GetGOPList(filepaths, frame_ids, fastStreamInfos)
+            return self._decoder.GetGOPList(
+                filepaths, frame_ids, fastStreamInfos, max_files_per_wave, memory_budget
+            )
 
         # Check cache hits for each file
         cache_hits = [self._is_cache_hit(fp, fid) for fp, fid in zip(filepaths, frame_ids)]
@@ -332,7 +340,9 @@ class CachedGopDecoder:
             miss_frame_ids = [frame_ids[i] for i in miss_indices]
             miss_fast_infos = [fastStreamInfos[i] for i in miss_indices] if fastStreamInfos else []
 
-            miss_results = self._decoder.GetGOPList(miss_filepaths, miss_frame_ids, miss_fast_infos)
+            miss_results = self._decoder.GetGOPList(
+                miss_filepaths, miss_frame_ids, miss_fast_infos, max_files_per_wave, memory_budget
+            )
 
             # Update cache with new data
             for idx, (packets, first_frame_ids_list, gop_lens_list) in zip(miss_indices, miss_results):
@@ -0,0 +1,255 @@
+# Copyright (c) 2025, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+"""
+Decode-cost-aware frame snapping.
+
+Samplers which accept any frame within ``+/- tolerance`` of a target frame (temporal jitter augmentation,
+approximate synchronization) can pick the frame which is cheapest to decode instead of the target itself.
+Decoding a frame requires decoding the keyframe of its GOP and all reference frames between the keyframe
+and the frame, so frames early in a GOP are cheap, while frames at the end of a GOP are expensive.
+
+Cost model (in decoded frames) for a frame ``f`` in the GOP starting at keyframe ``k``:
+
+- Without reference flags, every frame is assumed to be a reference frame: ``cost(f) = f - k + 1``.
+- With reference flags: ``cost(f) = 1 + #{reference frames in [k, f)}``.
+
+In batch mode, frames of the same GOP share the decoded prefix. The cost of a GOP for a set ``S`` of
+selected frames with maximum ``m`` is the number of frames in ``[k, m]`` which are either reference frames
+or selected, i.e. selecting a frame inside an already needed prefix is (nearly) free.
+"""
+
+import bisect
+import itertools
+from typing import Dict, List, NamedTuple, Optional, Sequence, Tuple, Union
+
+
+class GopStructure:
+    """GOP structure of a video file, used to estimate decode costs.
+
+    Args:
+        keyframe_ids: Frame ids (in presentation order) of the keyframes, i.e. the first frames of the GOPs.
+        num_frames: Total number of frames of the video.
+        is_reference: Optional per-frame flags (length ``num_frames``) indicating whether a frame is used as
+            a reference by other frames. If not given, all frames are assumed to be reference frames.
+
+    Note:
+        Frames before the first keyframe cannot be decoded on their own and are never selected.
+    """
+
+    def __init__(
+        self,
+        keyframe_ids: Sequence[int],
+        num_frames: int,
+        is_reference: Optional[Sequence[bool]] = None,
+    ) -> None:
+        keyframe_ids = sorted(set(int(k) for k in keyframe_ids if 0 <= k < num_frames))
+        if len(keyframe_ids) == 0:
+            raise ValueError("At least one keyframe id in [0, num_frames) is required")
+        self.keyframe_ids = keyframe_ids
+        self.num_frames = int(num_frames)
+        if is_reference is None:
+            self.is_reference = None
+            self._num_refs_before = None
+        else:
+            is_reference = [bool(flag) for flag in is_reference]
+            if len(is_reference) != self.num_frames:
+                raise ValueError(
+                    f"is_reference must have length num_frames={self.num_frames}, got {len(is_reference)}"
+                )
+            # Keyframes are always needed for decoding the rest of the GOP
+            for keyframe in keyframe_ids:
+                is_reference[keyframe] = True
+            self.is_reference = is_reference
+            # _num_refs_before[i] is the number of reference frames in [0, i)
+            self._num_refs_before = list(itertools.accumulate(is_reference, initial=0))
+
+    def gop_start(self, frame_id: int) -> int:
+        """Keyframe id of the GOP containing ``frame_id`` (-1 for frames before the first keyframe)."""
+        idx = bisect.bisect_right(self.keyframe_ids, frame_id) - 1
+        return self.keyframe_ids[idx] if idx >= 0 else -1
+
+    def _num_refs(self, begin: int, end: int) -> int:
+        # Number of reference frames in [begin, end)
+        if self._num_refs_before is None:
+            return end - begin
+        return self._num_refs_before[end] - self._num_refs_before[begin]
+
+    def _is_reference(self, frame_id: int) -> bool:
+        return self.is_reference is None or self.is_reference[frame_id]
+
+    def decode_cost(self, frame_id: int) -> int:
+        """Number of frames which need to be decoded to obtain ``frame_id`` on its own."""
+        keyframe = self.gop_start(frame_id)
+        if keyframe < 0 or frame_id >= self.num_frames:
+            raise ValueError(f"Frame {frame_id} cannot be decoded (num_frames={self.num_frames})")
+        return self._num_refs(keyframe, frame_id) + 1
+
+    def gop_cost(self, keyframe: int, selected: Sequence[int]) -> int:
+        """Number of frames which need to be decoded to obtain all ``selected`` frames of the GOP starting at
+        ``keyframe``."""
+        if len(selected) == 0:
+            return 0
+        last = max(selected)
+        num_selected_non_ref = sum(
+            1 for frame_id in set(selected) if frame_id == last or not self._is_reference(frame_id)
+        )
+        return self._num_refs(keyframe, last) + num_selected_non_ref
+
+
+class SnapResult(NamedTuple):
+    """Result of :func:`snap_frames`.
+
+    Attributes:
+        frame_ids: Selected frame id for each request.
+        costs: Decode cost estimate (in decoded frames) of each selected frame on its own.
+        total_cost: Decode cost estimate of the whole batch, counting shared GOP prefixes once.
+    """
+
+    frame_ids: List[int]
+    costs: List[int]
+    total_cost: int
+
+
+def _candidates(gop: GopStructure, frame_id: int, tolerance: int) -> List[int]:
+    begin = max(frame_id - tolerance, gop.keyframe_ids[0])
+    end = min(frame_id + tolerance, gop.num_frames - 1)
+    candidates = list(range(begin, end + 1))
+    # Prefer frames close to the target on equal cost (earlier frame first on equal distance)
+    candidates.sort(key=lambda f: (abs(f - frame_id), f))
+    return candidates
+
+
+def snap_frames(
+    filepaths: List[str],
+    frame_ids: List[int],
+    tolerances: Union[int, List[int]],
+    gop_structures: Dict[str, GopStructure],
+    batch_aware: bool = True,
+    max_iterations: int = 4,
+) -> SnapResult:
+    """
+    Select, for each requested frame, the frame within the tolerance which is cheapest to decode.
+
+    See the module documentation for the cost model. Among frames with equal cost, the frame closest to the
+    requested one is selected.
+
+    Args:
+        filepaths: Video file of each request.
+        frame_ids: Requested (target) frame id of each request.
+        tolerances: Maximum allowed distance (in frames) between the requested and selected frame, either one
+            value for all requests or one per request. Use 0 for requests which must not be changed.
+        gop_structures: GOP structure for each file in ``filepaths``.
+        batch_aware: If ``True``, frames are selected jointly so that requests for the same file prefer
+            GOP prefixes which are already needed by other requests of the batch. If ``False``, each request
+            is handled independently.
+        max_iterations: Maximum number of refinement passes in batch-aware mode.
+
+    Returns:
+        :class:`SnapResult`. The selected ``frame_ids`` can be passed together with ``filepaths`` to the
+        decode APIs.
+
+    Raises:
+        ValueError: If the input lists have different lengths, a tolerance is negative, a GOP structure is
+            missing, or no decodable frame lies within the tolerance of a request.
+
+    Example:
+        >>> gops = {path: GopStructure(keyframe_ids=[0, 30, 60], num_frames=90)}
+        >>> res = snap_frames([path, path], [40, 44], tolerances=2, gop_structures=gops)
+        >>> res.frame_ids  # frame 42 lies in the prefix needed for frame 40 anyway
+        [40, 42]
+        >>> res.costs, res.total_cost
+        ([11, 13], 13)
+    """
+    num_requests = len(filepaths)
+    if len(frame_ids) != num_requests:
+        raise ValueError(
+            f"filepaths and frame_ids must have the same length ({num_requests} vs {len(frame_ids)})"
+        )
+    if isinstance(tolerances, int):
+        tolerances = [tolerances] * num_requests
+    elif len(tolerances) != num_requests:
+        raise ValueError(
+            f"tolerances must have the same length as filepaths ({len(tolerances)} vs {num_requests})"
+        )
+
+    candidates = []
+    for filepath, frame_id, tolerance in zip(filepaths, frame_ids, tolerances):
+        if tolerance < 0:
+            raise ValueError(f"Tolerance must be non-negative, got {tolerance}")
+        if filepath not in gop_structures:
+            raise ValueError(f"No GOP structure given for file: {filepath}")
+        request_candidates = _candidates(gop_structures[filepath], frame_id, tolerance)
+        if len(request_candidates) == 0:
+            raise ValueError(
+                f"No decodable frame within tolerance {tolerance} of frame {frame_id} in {filepath}"
+            )
+        candidates.append(request_candidates)
+
+    # Independent selection: cheapest frame on its own (also the starting point of the batch-aware mode)
+    selected = [
+        min(request_candidates, key=gop_structures[filepath].decode_cost)
+        for filepath, request_candidates in zip(filepaths, candidates)
+    ]
+
+    # Selected frames of the other requests, per (file, GOP)
+    gop_selection: Dict[Tuple[str, int], List[int]] = {}
+
+    def gop_key(i: int, frame_id: int) -> Tuple[str, int]:
+        return filepaths[i], gop_structures[filepaths[i]].gop_start(frame_id)
+
+    for i, frame_id in enumerate(selected):
+        gop_selection.setdefault(gop_key(i, frame_id), []).append(frame_id)
+
+    if batch_aware:
+        # Coordinate descent: move each request to the frame with the smallest marginal batch cost given the
+        # selection of all other requests. The total cost never increases, so this converges.
+        for _ in range(max_iterations):
+            changed = False
+            for i in range(num_requests):
+                gop = gop_structures[filepaths[i]]
+                gop_selection[gop_key(i, selected[i])].remove(selected[i])
+
+                best_frame, best_cost = None, None
+                for frame_id in candidates[i]:
+                    key = gop_key(i, frame_id)
+                    others = gop_selection.get(key, [])
+                    marginal = gop.gop_cost(key[1], others + [frame_id]) - gop.gop_cost(key[1], others)
+                    if best_cost is None or marginal < best_cost:
+                        best_frame, best_cost = frame_id, marginal
+                        if marginal == 0:
+                            break
+
+                if best_frame != selected[i]:
+                    # Only move if strictly better (cheaper, or closer to the target on equal cost), so that
+                    # the selection does not oscillate
+                    key = gop_key(i, selected[i])
+                    others = gop_selection.get(key, [])
+                    current = gop.gop_cost(key[1], others + [selected[i]]) - gop.gop_cost(key[1], others)
+                    best_dist = abs(best_frame - frame_ids[i])
+                    if (best_cost, best_dist) < (current, abs(selected[i] - frame_ids[i])):
+                        selected[i] = best_frame
+                        changed = True
+                gop_selection.setdefault(gop_key(i, selected[i]), []).append(selected[i])
+            if not changed:
+                break
+
+    costs = [
+        gop_structures[filepath].decode_cost(frame_id) for filepath, frame_id in zip(filepaths, selected)
+    ]
+    total_cost = sum(
+        gop_structures[filepath].gop_cost(keyframe, frames)
+        for (filepath, keyframe), frames in gop_selection.items()
+    )
+    return SnapResult(frame_ids=selected, costs=costs, total_cost=total_cost)
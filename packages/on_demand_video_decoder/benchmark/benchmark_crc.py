@@ -0,0 +1,66 @@
+# Copyright (c) 2025, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+"""
+Benchmark the host CRC engine (ComputeCRC) in GB/s and compare against zlib.crc32.
+"""
+
+import argparse
+import time
+import zlib
+
+import numpy as np
+
+import accvlab.on_demand_video_decoder as nvc
+
+
+def _measure(fn, data, num_iters):
+    fn(data)  # warm-up
+    start = time.perf_counter()
+    for _ in range(num_iters):
+        fn(data)
+    elapsed = time.perf_counter() - start
+    return data.nbytes * num_iters / elapsed / 1e9
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__)
+    parser.add_argument("--sizes-mb", type=float, nargs="+", default=[0.0625, 1, 16, 256])
+    parser.add_argument("--iters", type=int, default=10)
+    parser.add_argument("--threads", type=int, nargs="+", default=[1, 0])
+    args = parser.parse_args()
+
+    print(
+        f"backends: CRC32={nvc.GetCRCBackend(nvc.CrcVariant.CRC32)}, "
+        f"CRC32C={nvc.GetCRCBackend(nvc.CrcVariant.CRC32C)}"
+    )
+    print(f"{'size [MB]':>10} {'impl':>24} {'GB/s':>8}")
+    rng = np.random.default_rng(0)
+    for size_mb in args.sizes_mb:
+        data = rng.integers(0, 256, size=int(size_mb * (1 << 20)), dtype=np.uint8)
+        num_iters = max(1, int(args.iters * 256 / max(size_mb, 1)))
+        results = [("zlib.crc32", _measure(lambda d: zlib.crc32(d), data, num_iters))]
+        for variant in (nvc.CrcVariant.CRC32, nvc.CrcVariant.CRC32C):
+            for threads in args.threads:
+                name = f"{variant.name} threads={threads if threads else 'all'}"
+                gbps = _measure(
+                    lambda d: nvc.ComputeCRC(d, variant=variant, num_threads=threads), data, num_iters
+                )
+                results.append((name, gbps))
+        for name, gbps in results:
+            print(f"{size_mb:>10.4g} {name:>24} {gbps:>8.2f}")
+
+
+if __name__ == "__main__":
+    main()
@@ -17,9 +17,15 @@
 #ifndef DLPACKUTILS_HPP
 #define DLPACKUTILS_HPP
 
+#include <cuda.h>
 #include <pybind11/buffer_info.h>
+#include <pybind11/pybind11.h>
 #include <dlpack/dlpack.h>
 
+#include <memory>
+#include <string>
+#include <vector>
+
 namespace py = pybind11;
 
 class DLPackTensor final {
@@ -45,5 +51,55 @@ class DLPackTensor final {
 };
 
 bool IsCudaAccessible(DLDeviceType devType);
+bool IsHostAccessible(DLDeviceType devType);
+
+/**
+ * @brief Convert an array interface typestr (e.g. "|u1", "<u2", "<f4") to a DLPack data type.
+ */
+DLDataType TypestrToDLDataType(const std::string& typestr);
+
+/**
+ * @brief Convert an array interface typestr to a Python buffer protocol format (e.g. "B", "H").
+ */
+std::string TypestrToBufferFormat(const std::string& typestr);
+
+/**
+ * @brief Build the `__array_interface__` dict for host-accessible memory.
+ *
+ * @param strides Strides in bytes.
+ */
+py::dict MakeArrayInterface(const std::vector<size_t>& shape, const std::vector<size_t>& strides,
+                            const std::string& typestr, void* data, bool readOnly);
+
+/**
+ * @brief Describe host-accessible memory for the Python buffer protocol.
+ *
+ * @param strides Strides in bytes.
+ */
+py::buffer_info MakeHostBufferInfo(const std::vector<size_t>& shape, const std::vector<size_t>& strides,
+                                   const std::string& typestr, void* data, bool readOnly);
+
+/**
+ * @brief Export memory as a "dltensor" capsule.
+ *
+ * @param strides Strides in bytes; converted to element strides as required by DLPack.
+ * @param owner Kept alive until the consumer deletes the tensor.
+ */
+py::capsule MakeDLPackCapsule(const std::vector<size_t>& shape, const std::vector<size_t>& strides,
+                              const std::string& typestr, void* data, const DLDevice& device,
+                              std::shared_ptr<const void> owner);
+
+/**
+ * @brief Order a `__dlpack__` consumer after the work queued on the producer stream.
+ *
+ * `stream` follows the DLPack convention: `None` (legacy default stream), `-1` (no synchronization),
+ * `1` (legacy default stream), `2` (per-thread default stream) or a `cudaStream_t` handle. For device
+ * memory, an event recorded on `producer` is waited on by the consumer stream (no-op if both are the
+ * same). Host memory (kDLCPU, kDLCUDAHost) is read without a stream, so only `None` and `-1` are
+ * accepted and `None` synchronizes `producer` (if set) on the host.
+ *
+ * @param producer Stream the memory was written on; `nullptr` denotes the legacy default stream.
+ */
+void SyncDLPackConsumerStream(const DLDevice& device, CUstream producer, const py::object& stream);
 
 #endif  // DLPACKUTILS_HPP
@@ -0,0 +1,129 @@
+/*
+ * Copyright (c) 2025, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "PyNvGopDemuxer.hpp"
+
+struct DemuxerPoolStats {
+    uint64_t num_opened = 0;     // Demuxers created by opening the file (cache misses)
+    uint64_t num_reused = 0;     // Leases served by an idle pooled demuxer (cache hits)
+    uint64_t num_evicted = 0;    // Idle demuxers closed because the pool exceeded its capacity
+    uint64_t num_discarded = 0;  // Demuxers closed because they could not be reset for reuse
+    size_t num_idle = 0;         // Demuxers currently held open by the pool
+    size_t capacity = 0;         // Maximum number of idle demuxers (i.e. open files) held by the pool
+};
+
+/**
+ * Bounded, thread-safe pool of open demuxers, keyed by file path
+ *
+ * Opening a demuxer (avformat_open_input, stream probing, AVIO buffer and bitstream filter setup) is
+ * expensive compared to seeking in an already open file. Instead of destroying the demuxers at the end of a
+ * request, they are returned to this pool and reused by later requests for the same file.
+ *
+ * Semantics:
+ * - Acquire() hands out a demuxer for exclusive use by the caller (lease). An idle demuxer for the same path
+ *   is reused if available; it is rewound to the start of the stream first, so that it behaves like a newly
+ *   opened one. Otherwise (or if rewinding fails), a new demuxer is opened.
+ * - Release() returns a demuxer to the pool. Idle demuxers are evicted in least recently used order once
+ *   more than `capacity` are held, which bounds the number of file descriptors kept open by the pool.
+ *   A capacity of 0 disables pooling.
+ * - Several demuxers for the same path can be held (e.g. if a file appears multiple times in a batch).
+ *
+ * Note that the pool assumes that files are not modified while being pooled. Call Clear() if files may have
+ * changed on disk.
+ */
+class DemuxerPool {
+   public:
+    explicit DemuxerPool(size_t capacity);
+
+    DemuxerPool(const DemuxerPool&) = delete;
+    DemuxerPool& operator=(const DemuxerPool&) = delete;
+
+    /**
+     * Lease a demuxer for the given file (same interface as PyNvGopDecoder::CreateDemuxer)
+     *
+     * Thread Safety: Safe to call concurrently; opening a new demuxer is done without holding the lock.
+     *
+     * @param demuxer Output demuxer. Check IsValid() to see whether opening the file succeeded.
+     * @param filepath Path of the video file
+     * @param fastStreamInfo Optional stream info used if a new demuxer needs to be opened
+     */
+    void Acquire(std::unique_ptr<PyNvGopDemuxer>& demuxer, const std::string& filepath,
+                 const FastStreamInfo* fastStreamInfo);
+
+    /**
+     * Return a leased demuxer to the pool. Invalid demuxers or demuxers in an error state are closed.
+     */
+    void Release(std::unique_ptr<PyNvGopDemuxer> demuxer);
+
+    /**
+     * Return all (non-null) demuxers of a request to the pool. The vector is cleared.
+     */
+    void ReleaseAll(std::vector<std::unique_ptr<PyNvGopDemuxer>>& demuxers);
+
+    /**
+     * Close all idle demuxers
+     */
+    void Clear();
+
+    /**
+     * Set the maximum number of idle demuxers. Excess idle demuxers are closed immediately.
+     */
+    void SetCapacity(size_t capacity);
+
+    DemuxerPoolStats GetStats() const;
+
+    /**
+     * Returns the demuxers of a request to the pool when going out of scope, also if the request fails
+     * with an exception.
+     */
+    class LeaseGuard {
+       public:
+        LeaseGuard(DemuxerPool& pool, std::vector<std::unique_ptr<PyNvGopDemuxer>>& demuxers)
+            : pool(pool), demuxers(demuxers) {}
+        ~LeaseGuard();
+
+        LeaseGuard(const LeaseGuard&) = delete;
+        LeaseGuard& operator=(const LeaseGuard&) = delete;
+
+       private:
+        DemuxerPool& pool;
+        std::vector<std::unique_ptr<PyNvGopDemuxer>>& demuxers;
+    };
+
+   private:
+    // Idle demuxers, most recently used first
+    using IdleList = std::list<std::unique_ptr<PyNvGopDemuxer>>;
+
+    // Move idle demuxers exceeding the capacity to `to_close`. Must be called with `mtx` held; the demuxers
+    // are closed by the caller after releasing the lock.
+    void EvictExcess(std::vector<std::unique_ptr<PyNvGopDemuxer>>& to_close);
+
+    mutable std::mutex mtx;
+    size_t capacity;
+    IdleList idle;
+    std::unordered_multimap<std::string, IdleList::iterator> idle_by_path;
+    DemuxerPoolStats stats;
+};
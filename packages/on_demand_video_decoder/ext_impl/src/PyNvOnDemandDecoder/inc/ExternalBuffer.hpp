@@ -44,17 +44,19 @@ class ExternalBuffer final : public std::enable_shared_from_this<ExternalBuffer>
     ExternalBuffer() = default;
     py::capsule dlpack(py::object stream) const;
     int LoadDLPack(std::vector<size_t> _shape, std::vector<size_t> _stride, std::string _typeStr,
-                   size_t _streamid, CUdeviceptr _data, bool _readOnly);
+                   size_t _streamid, CUdeviceptr _data, bool _readOnly, DLDeviceType _deviceType = kDLCUDA,
+                   int _deviceId = 0);
+
+    // __dlpack_device__ implementation
+    py::tuple dlpackDevice() const;
 
    private:
     friend py::detail::type_caster<ExternalBuffer>;
 
     DLPackTensor m_dlTensor;
-
-    // __dlpack__ implementation
-
-    // __dlpack_device__ implementation
-    py::tuple dlpackDevice() const;
+    std::string m_typestr = "|u1";
+    // Stream the buffer is written on (consumers of __dlpack__ are ordered after it)
+    CUstream m_stream = nullptr;
 };
 
 #endif  // EXTERNAL_BUFFER_HPP
@@ -20,12 +20,24 @@
 #include <stddef.h>
 #include <stdint.h>
 
+#include "SegmentedMemoryPool.hpp"
+
+/**
+ * Device memory pool for decoded frames, backed by a SegmentedMemoryPool
+ *
+ * AddElement() grows the pool by chaining a new segment if the reserved size is exceeded, so frames handed
+ * out earlier stay valid. Soft resets (EnsureSizeAndSoftReset(), SoftRelease()) invalidate all frames handed
+ * out so far.
+ */
 class GPUMemoryPool {
    public:
-    GPUMemoryPool() = default;
+    GPUMemoryPool();
 
     GPUMemoryPool(size_t size_hint);
 
+    GPUMemoryPool(GPUMemoryPool&&) = default;
+    GPUMemoryPool& operator=(GPUMemoryPool&&) = default;
+
     void* AddElement(size_t num_bytes);
 
     void EnsureSizeAndSoftReset(size_t num_bytes_to_store, bool shrink_if_smaller);
@@ -34,10 +46,10 @@ class GPUMemoryPool {
 
     void HardRelease();
 
+    MemoryPoolStats GetStats() const;
+
     ~GPUMemoryPool();
 
    private:
-    uint8_t* data_ = nullptr;
-    size_t curr_size_ = 0;
-    size_t allocated_size_ = 0;
-};
\ No newline at end of file
+    SegmentedMemoryPool<CudaDeviceAllocator> pool_;
+};
@@ -0,0 +1,218 @@
+/*
+ * Copyright (c) 2025, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "PyNvGopDecoder.hpp"
+
+struct GopExtractionConfig {
+    std::string output_dir;
+    int num_workers = 8;
+    // A new shard file is started once the current one exceeds this size
+    uint64_t shard_size_bytes = 1ull << 30;
+    // Workers block while more than this amount of extracted data is waiting to be written
+    uint64_t max_pending_bytes = 256ull << 20;
+    // Maximum number of completed jobs per checkpoint (the writer also checkpoints when it runs idle)
+    int checkpoint_interval = 64;
+    // Interval of the progress log records (INFO level); <= 0 disables them
+    double progress_interval_s = 30.0;
+};
+
+struct GopExtractionStats {
+    uint64_t num_jobs = 0;          // Jobs in the manifest
+    uint64_t num_jobs_resumed = 0;  // Jobs skipped because they were completed by a previous run
+    uint64_t num_jobs_done = 0;     // Jobs completed (and checkpointed) by this run
+    uint64_t num_jobs_failed = 0;   // Jobs which failed in this run (not checkpointed, retried on resume)
+    uint64_t num_gops = 0;          // GOP bundles written by this run
+    uint64_t num_bytes = 0;         // Bytes written to the shard files by this run
+    double elapsed_s = 0.0;
+    std::vector<std::pair<uint64_t, std::string>> failed_jobs;  // (job id, error message)
+};
+
+/**
+ * One GOP bundle of the output, as recorded in the index
+ */
+struct GopIndexRecord {
+    uint64_t job_id;
+    std::string filepath;
+    int frame_id;        // Requested frame which caused the GOP to be extracted
+    int first_frame_id;  // First frame of the GOP
+    int gop_len;
+    std::string shard;  // Shard file name (relative to the output directory)
+    uint64_t offset;    // Byte offset of the bundle in the shard file
+    uint64_t size;      // Size of the bundle (same format as GetGOP / SavePacketsToFile output)
+};
+
+/**
+ * GOP bundle extracted for a requested frame of a job
+ */
+struct ExtractedGop {
+    int frame_id;  // Requested frame which caused the GOP to be extracted
+    SerializedPacketBundle bundle;
+};
+
+/**
+ * Resumable bulk GOP extraction for whole datasets (CPU only, no CUDA context is created)
+ *
+ * Takes a manifest of jobs, each a video file and a set of frame ids. For each job, the GOPs containing the
+ * requested frames are extracted (every GOP once, even if several requested frames lie in it) and serialized
+ * in the same format as PyNvGopDecoder::get_gop_list.
+ *
+ * Pipeline:
+ * - `num_workers` worker threads demux and serialize jobs, each using its own PyNvGopDecoder (which only
+ *   uses its demuxing part). Workers block while more than `max_pending_bytes` are waiting to be written
+ *   (backpressure on the output I/O).
+ * - A single writer thread appends the bundles to large sequential shard files (`gops_XXXXX.bin`).
+ * - Completed jobs are checkpointed in the index file (`gop_index.tsv`): the shard data is flushed to disk
+ *   (fdatasync) before the index records of the jobs are appended, and a job only counts as completed once
+ *   its terminating record has been written completely.
+ *
+ * Resume: Running again with the same output directory and manifest skips all completed jobs. Data written
+ * after the last checkpoint (e.g. before a crash) is truncated from the shard files. The manifest is
+ * fingerprinted, and resuming with a different manifest is rejected.
+ *
+ * Index file format (tab separated, one record per line):
+ * - `M <num_jobs> <manifest fingerprint>`: header
+ * - `G <job id> <frame id> <first frame id> <gop len> <shard> <offset> <size> <file path>`: GOP bundle
+ * - `J <job id> <num gops>`: job completed (written after all its `G` records)
+ */
+class GopExtractionDriver {
+   public:
+    /**
+     * Extracts the GOP bundles of one job (video file, requested frame ids). One extractor is created per
+     * worker thread, so it may keep state (e.g. a decoder instance).
+     */
+    using GopExtractor =
+        std::function<std::vector<ExtractedGop>(const std::string&, const std::vector<int>&)>;
+
+    explicit GopExtractionDriver(const GopExtractionConfig& config);
+
+    /**
+     * Use a custom extractor factory instead of the default PyNvGopDecoder based one
+     */
+    GopExtractionDriver(const GopExtractionConfig& config, std::function<GopExtractor()> extractor_factory);
+
+    GopExtractionDriver(const GopExtractionDriver&) = delete;
+    GopExtractionDriver& operator=(const GopExtractionDriver&) = delete;
+
+    /**
+     * Run (or resume) the extraction. Blocks until all jobs are processed or Stop() is called.
+     *
+     * @param filepaths Video file of each job
+     * @param frame_ids Requested frame ids of each job
+     * @return Statistics of this run
+     */
+    GopExtractionStats Run(const std::vector<std::string>& filepaths,
+                           const std::vector<std::vector<int>>& frame_ids);
+
+    /**
+     * Request the running extraction to stop. Jobs in flight are finished and checkpointed.
+     * Thread Safety: Safe to call from any thread.
+     */
+    void Stop() { stop_requested = true; }
+
+    /**
+     * Statistics of the current (or last) run. Thread Safety: Safe to call while Run() is executing.
+     */
+    GopExtractionStats GetStats() const;
+
+    /**
+     * Read the index of the completed jobs of an output directory
+     */
+    static std::vector<GopIndexRecord> ReadIndex(const std::string& output_dir);
+
+    /**
+     * The default extractor, using the demuxing part of a PyNvGopDecoder
+     */
+    static GopExtractor MakeDefaultExtractor();
+
+    static constexpr const char* kIndexFileName = "gop_index.tsv";
+
+   private:
+    struct ExtractedJob {
+        uint64_t job_id;
+        std::vector<ExtractedGop> gops;
+        uint64_t num_bytes = 0;
+    };
+
+    // State recovered from an existing index file
+    struct ResumeState {
+        bool has_header = false;
+        uint64_t num_jobs = 0;
+        uint64_t fingerprint = 0;
+        std::vector<bool> completed;
+        std::map<std::string, uint64_t> shard_ends;  // Committed size of each shard
+        uint64_t valid_index_size = 0;               // Size of the complete records
+    };
+
+    static ResumeState ParseIndex(const std::string& index_path, std::vector<GopIndexRecord>* records);
+    static uint64_t ManifestFingerprint(const std::vector<std::string>& filepaths,
+                                        const std::vector<std::vector<int>>& frame_ids);
+    static std::string ShardName(int shard_id);
+
+    void WorkerLoop(const std::vector<std::string>& filepaths, const std::vector<std::vector<int>>& frame_ids,
+                    const std::vector<uint64_t>& pending_jobs);
+    void WriterLoop(const std::vector<std::string>& filepaths);
+    // Write a job to the current shard and append its records to `index_buffer`
+    void WriteJob(const ExtractedJob& job, const std::string& filepath, std::string& index_buffer);
+    // Flush the shard data, then append the index records of the written jobs
+    void Checkpoint(std::string& index_buffer, uint64_t num_jobs, uint64_t num_gops, uint64_t num_bytes);
+    void OpenNextShard();
+    // Record the error (if it is the first one) and stop the run
+    void SetRunError(std::exception_ptr error);
+    void LogProgress(bool force);
+
+    GopExtractionConfig config;
+    std::function<GopExtractor()> extractor_factory;
+
+    std::atomic<bool> stop_requested{false};
+
+    // Queue between the workers and the writer
+    std::mutex queue_mtx;
+    std::condition_variable queue_not_full;
+    std::condition_variable queue_not_empty;
+    std::deque<ExtractedJob> queue;
+    uint64_t pending_bytes = 0;
+    int num_active_workers = 0;
+
+    std::atomic<uint64_t> next_pending_job{0};
+
+    // Output state (writer thread only)
+    int shard_fd = -1;
+    int index_fd = -1;
+    int shard_id = 0;
+    uint64_t shard_offset = 0;
+    std::exception_ptr run_error;  // First error of the writer or of a worker setup; rethrown by Run()
+    bool running = false;
+
+    mutable std::mutex stats_mtx;
+    GopExtractionStats stats;
+    std::chrono::steady_clock::time_point start_time;
+    std::chrono::steady_clock::time_point last_progress_time;
+};
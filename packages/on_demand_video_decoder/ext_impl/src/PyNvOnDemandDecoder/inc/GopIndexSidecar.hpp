@@ -0,0 +1,48 @@
+/*
+ * Copyright (c) 2025, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <string>
+#include <utility>
+#include <vector>
+
+/**
+ * GOP index sidecar of a video file (`<video>.gop_index.json`), written by the tools producing videos
+ *
+ * JSON object with the metadata fields, followed by `num_frames`, `keyframe_ids` (frame ids of the keyframes
+ * in presentation order) and `gop_lens`. `keyframe_ids` and `num_frames` can directly be used to create a
+ * `GopStructure` for decode-cost-aware sampling.
+ */
+struct GopIndexSidecar {
+    int num_frames = 0;
+    std::vector<int> keyframe_ids;
+    // Additional fields as (key, JSON encoded value), written in this order
+    std::vector<std::pair<std::string, std::string>> metadata;
+
+    void AddMetadata(const std::string& key, int value);
+    void AddMetadata(const std::string& key, double value);
+    void AddMetadata(const std::string& key, bool value);
+    void AddMetadata(const std::string& key, const std::string& value);
+    void AddMetadata(const std::string& key, const char* value) { AddMetadata(key, std::string(value)); }
+
+    static std::string PathFor(const std::string& video_path) { return video_path + ".gop_index.json"; }
+
+    /**
+     * Write the sidecar of `video_path` (atomically, via a temporary file)
+     */
+    void Write(const std::string& video_path) const;
+};
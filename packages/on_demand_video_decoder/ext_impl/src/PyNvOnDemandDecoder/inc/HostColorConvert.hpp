@@ -0,0 +1,68 @@
+/*
+ * Copyright (c) 2025, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+/**
+ * @brief CPU counterparts of BitDepth.cu and ColorConvertKernels.cu.
+ *
+ * All pitches are in bytes. 16-bit samples are MSB-aligned as produced by NVDEC (P010/P016).
+ * The colour conversion uses the same BT.601 coefficients and integer/float paths as
+ * convert_nv12_to_rgb(), so results match the GPU output.
+ */
+
+/**
+ * @brief How 16-bit samples are reduced to 8 bits.
+ */
+enum class BitDepthRounding {
+    Truncate = 0,  ///< Keep the high byte; identical to ConvertUInt16ToUInt8 in BitDepth.cu.
+    Round = 1,     ///< Round to nearest, saturating at 255.
+    Dither = 2,    ///< 4x4 ordered (Bayer) dither before truncation, avoids banding on gradients.
+};
+
+/**
+ * @brief Convert a 16-bit plane to 8 bits.
+ */
+void convert_uint16_to_uint8_host(const uint16_t* src, size_t src_pitch, uint8_t* dst, size_t dst_pitch,
+                                  int width, int height, BitDepthRounding rounding);
+
+/**
+ * @brief Expand an 8-bit plane to MSB-aligned 16 bits; identical to ConvertUInt8ToUInt16 in BitDepth.cu.
+ */
+void convert_uint8_to_uint16_host(const uint8_t* src, size_t src_pitch, uint16_t* dst, size_t dst_pitch,
+                                  int width, int height);
+
+/**
+ * @brief Convert NV12 (Y plane + interleaved UV plane) to packed RGB/BGR.
+ *
+ * @param dst Output with 3 interleaved channels per pixel.
+ */
+void convert_nv12_to_rgb_host(const uint8_t* y, size_t y_pitch, const uint8_t* uv, size_t uv_pitch,
+                              uint8_t* dst, size_t dst_pitch, int width, int height, bool is_full_range,
+                              bool as_bgr);
+
+/**
+ * @brief Convert P016/P010 to packed 8-bit RGB/BGR in one pass.
+ *
+ * Rows are reduced to 8 bits into a small scratch buffer and converted immediately, so no
+ * intermediate NV12 frame is materialized.
+ */
+void convert_p016_to_rgb_host(const uint16_t* y, size_t y_pitch, const uint16_t* uv, size_t uv_pitch,
+                              uint8_t* dst, size_t dst_pitch, int width, int height, bool is_full_range,
+                              bool as_bgr, BitDepthRounding rounding);
@@ -0,0 +1,49 @@
+/*
+ * Copyright (c) 2025, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdlib>
+#include <new>
+
+// Allocator backends of SegmentedMemoryPool. A backend provides `static void* Allocate(size_t num_bytes)`
+// (throwing on failure) and `static void Free(void* ptr)`.
+
+// Pageable host memory (no CUDA dependency)
+struct HostAllocator {
+    static void* Allocate(size_t num_bytes) {
+        void* ptr = std::malloc(num_bytes);
+        if (ptr == nullptr) {
+            throw std::bad_alloc();
+        }
+        return ptr;
+    }
+
+    static void Free(void* ptr) { std::free(ptr); }
+};
+
+// Page-locked host memory (cuMemAllocHost); requires a current CUDA context
+struct PinnedHostAllocator {
+    static void* Allocate(size_t num_bytes);
+    static void Free(void* ptr);
+};
+
+// Device memory (cuMemAlloc); requires a current CUDA context
+struct CudaDeviceAllocator {
+    static void* Allocate(size_t num_bytes);
+    static void Free(void* ptr);
+};
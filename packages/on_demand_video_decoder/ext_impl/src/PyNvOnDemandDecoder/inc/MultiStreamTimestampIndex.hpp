@@ -0,0 +1,123 @@
+/*
+ * Copyright (c) 2025, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+/**
+ * Frames selected from several streams by a timestamp query.
+ *
+ * `filepaths` and `frame_ids` are parallel lists which can be passed directly to the batched decode APIs
+ * (e.g. PyNvGopDecoder::Decode / GetGOP). `stream_ids` gives the stream each entry belongs to.
+ */
+struct StreamFrameSelection {
+    std::vector<std::string> filepaths;
+    std::vector<int> frame_ids;
+    std::vector<int> stream_ids;
+};
+
+/**
+ * Timestamp index over the frames of several synchronised video streams (e.g. the cameras of a
+ * surround-view rig).
+ *
+ * The per-stream presentation timestamp tables are merged into one flat structure: the (timestamp,
+ * frame id) pairs of all streams are stored contiguously, sorted by timestamp within each stream, with
+ * per-stream offsets into the shared arrays. Queries perform one binary search per stream, i.e. they take
+ * O(N log n) for N streams with n frames each (plus the size of the output for range queries).
+ *
+ * Timestamps are in an arbitrary but common unit (seconds if the stream is added from a video file). Each
+ * stream has an offset which is added to all of its timestamps, e.g. to map stream-relative times to the
+ * timestamps of a dataset.
+ *
+ * Thread Safety: Queries are safe to run concurrently; adding streams is not.
+ */
+class MultiStreamTimestampIndex {
+   public:
+    MultiStreamTimestampIndex() = default;
+
+    /**
+     * Add a stream from a timestamp table (e.g. a persisted index)
+     *
+     * @param filepath Path of the video file, returned by the queries
+     * @param timestamps Timestamp of each frame, indexed by frame id. Does not need to be sorted.
+     * @param offset Offset added to all timestamps of the stream
+     * @return Id of the added stream
+     */
+    int AddStream(const std::string& filepath, const std::vector<double>& timestamps, double offset = 0.0);
+
+    /**
+     * Add a stream by scanning the packets of a video file (no decoding is performed)
+     *
+     * Frame ids are assigned in presentation order, consistent with the frame ids used by the decoders.
+     * Timestamps are in seconds, relative to the first presented frame of the file.
+     *
+     * @param filepath Path of the video file
+     * @param offset Offset added to all timestamps of the stream
+     * @return Id of the added stream
+     */
+    int AddStreamFromFile(const std::string& filepath, double offset = 0.0);
+
+    /**
+     * Scan a video file and return the timestamp (in seconds, relative to the first presented frame) of
+     * each frame, indexed by frame id. Useful to persist the index.
+     */
+    static std::vector<double> ScanFrameTimestamps(const std::string& filepath);
+
+    size_t GetNumStreams() const { return filepaths.size(); }
+
+    const std::vector<std::string>& GetFilepaths() const { return filepaths; }
+
+    size_t GetNumFrames(int stream_id) const;
+
+    /**
+     * Timestamps of a stream (including the offset), indexed by frame id
+     */
+    std::vector<double> GetTimestamps(int stream_id) const;
+
+    /**
+     * For each stream, find the frame with the timestamp nearest to `t` (ties resolve to the earlier frame)
+     *
+     * @param t Query timestamp
+     * @param max_distance Streams without a frame within this distance of `t` are omitted from the result
+     */
+    StreamFrameSelection FindNearest(double t, double max_distance) const;
+
+    /**
+     * For each stream, find the nearest frame to each of the given timestamps. The result contains the
+     * entries for `ts[0]` (ordered by stream), followed by the ones for `ts[1]`, and so on.
+     */
+    StreamFrameSelection FindNearestBatch(const std::vector<double>& ts, double max_distance) const;
+
+    /**
+     * Find all frames with timestamps in [t0, t1], ordered by stream and by timestamp within each stream
+     */
+    StreamFrameSelection FindRange(double t0, double t1) const;
+
+   private:
+    void CheckStreamId(int stream_id) const;
+
+    // Append the nearest frame of each stream to `res`
+    void AppendNearest(double t, double max_distance, StreamFrameSelection& res) const;
+
+    std::vector<std::string> filepaths;
+    // Entries of stream i are at [stream_begin[i], stream_begin[i + 1]), sorted by timestamp
+    std::vector<size_t> stream_begin{0};
+    std::vector<double> times;
+    std::vector<int> frame_ids;
+};
@@ -94,15 +94,20 @@ struct CAIMemoryView {
     CUstream stream = nullptr;
     CUdeviceptr data;
     bool readOnly;
+    // Where `data` lives. Host views (kDLCPU, kDLCUDAHost) expose __array_interface__ and the
+    // buffer protocol, device views __cuda_array_interface__; both expose DLPack.
+    DLDevice device{kDLCUDA, 0};
 
     CAIMemoryView(const std::vector<size_t>& _shape, const std::vector<size_t>& _stride,
-                  const std::string& _typeStr, size_t _streamid, CUdeviceptr _data, bool _readOnly) {
+                  const std::string& _typeStr, size_t _streamid, CUdeviceptr _data, bool _readOnly,
+                  DLDeviceType _deviceType = kDLCUDA, int _deviceId = 0) {
         shape = _shape;
         stride = _stride;
         typestr = _typeStr;
         data = _data;
         readOnly = _readOnly;
         stream = reinterpret_cast<CUstream>(_streamid);
+        device = DLDevice{_deviceType, _deviceId};
     }
     CAIMemoryView() {
         shape = {0};
@@ -114,32 +119,83 @@ struct CAIMemoryView {
         // but why 2?
         stream = (CUstream)2;
     }
+
+    bool isHost() const { return IsHostAccessible(device.device_type); }
+
     static void Export(py::module& m) {
-        py::class_<CAIMemoryView, std::shared_ptr<CAIMemoryView>>(m, "CAIMemoryView", py::module_local())
-            .def(py::init<std::vector<size_t>, std::vector<size_t>, std::string, size_t, CUdeviceptr, bool>())
+        py::class_<CAIMemoryView, std::shared_ptr<CAIMemoryView>>(m, "CAIMemoryView", py::module_local(),
+                                                                  py::buffer_protocol())
+            .def(py::init<std::vector<size_t>, std::vector<size_t>, std::string, size_t, CUdeviceptr, bool,
+                          DLDeviceType, int>(),
+                 py::arg("shape"), py::arg("stride"), py::arg("typestr"), py::arg("streamid"), py::arg("data"),
+                 py::arg("readOnly"), py::arg("device_type") = kDLCUDA, py::arg("device_id") = 0)
             .def_readonly("shape", &CAIMemoryView::shape)
             .def_readonly("stride", &CAIMemoryView::stride)
             .def_readonly("dataptr", &CAIMemoryView::data)
+            .def_property_readonly("device_type",
+                                   [](std::shared_ptr<CAIMemoryView>& self) { return self->device.device_type; })
+            .def_property_readonly("device_id",
+                                   [](std::shared_ptr<CAIMemoryView>& self) { return self->device.device_id; })
             .def("__repr__",
                  [](std::shared_ptr<CAIMemoryView>& self) {
                      std::stringstream ss;
                      ss << "<CAIMemoryView ";
                      ss << py::str(py::cast(self->shape));
+                     if (self->isHost()) {
+                         ss << " host";
+                     }
                      ss << ">";
                      return ss.str();
                  })
             .def_readonly("data", &CAIMemoryView::data)
-            .def_property_readonly("__cuda_array_interface__", [](std::shared_ptr<CAIMemoryView>& self) {
-                py::dict dict;
-                dict["version"] = 3;
-                dict["shape"] = self->shape;
-                dict["strides"] = self->stride;
-                dict["typestr"] = self->typestr;
-                dict["stream"] = self->stream == 0 ? int(size_t(self->stream)) : 2;
-                dict["data"] = std::make_pair(self->data, false);
-                dict["gpuIdx"] = 0;  // TODO
-                return dict;
-            });
+            .def_property_readonly("__cuda_array_interface__",
+                                   [](std::shared_ptr<CAIMemoryView>& self) {
+                                       if (!IsCudaAccessible(self->device.device_type)) {
+                                           throw py::attribute_error(
+                                               "Host memory view has no __cuda_array_interface__");
+                                       }
+                                       py::dict dict;
+                                       dict["version"] = 3;
+                                       dict["shape"] = self->shape;
+                                       dict["strides"] = self->stride;
+                                       dict["typestr"] = self->typestr;
+                                       dict["stream"] = self->stream == 0 ? int(size_t(self->stream)) : 2;
+                                       dict["data"] = std::make_pair(self->data, false);
+                                       dict["gpuIdx"] = self->device.device_id;
+                                       return dict;
+                                   })
+            .def_property_readonly("__array_interface__",
+                                   [](std::shared_ptr<CAIMemoryView>& self) {
+                                       if (!self->isHost()) {
+                                           throw py::attribute_error(
+                                               "Device memory view has no __array_interface__");
+                                       }
+                                       return MakeArrayInterface(self->shape, self->stride, self->typestr,
+                                                                 reinterpret_cast<void*>(self->data),
+                                                                 self->readOnly);
+                                   })
+            .def_buffer([](CAIMemoryView& self) -> py::buffer_info {
+                if (!self.isHost()) {
+                    throw std::runtime_error("Device memory view does not support the buffer protocol");
+                }
+                return MakeHostBufferInfo(self.shape, self.stride, self.typestr,
+                                          reinterpret_cast<void*>(self.data), self.readOnly);
+            })
+            .def(
+                "__dlpack__",
+                [](std::shared_ptr<CAIMemoryView>& self, py::object stream) {
+                    SyncDLPackConsumerStream(self->device, self->stream, stream);
+                    return MakeDLPackCapsule(self->shape, self->stride, self->typestr,
+                                             reinterpret_cast<void*>(self->data), self->device, self);
+                },
+                py::arg("stream") = py::none(), "Export the view as a DLPack tensor")
+            .def(
+                "__dlpack_device__",
+                [](std::shared_ptr<CAIMemoryView>& self) {
+                    return py::make_tuple(py::int_(static_cast<int>(self->device.device_type)),
+                                          py::int_(self->device.device_id));
+                },
+                "Get the device associated with the view");
     }
 };
 
@@ -149,10 +205,27 @@ struct DecodedFrame {
     Pixel_Format format;
     std::shared_ptr<ExternalBuffer> extBuf;
     DecodedFrame() { extBuf = std::make_shared<ExternalBuffer>(); }
+
+    /**
+     * @brief Device of the frame: taken from the loaded DLPack tensor, else from the first view.
+     */
+    DLDevice device() const {
+        if (extBuf && extBuf->data() != nullptr) {
+            return extBuf->dlTensor().device;
+        }
+        return views.empty() ? DLDevice{kDLCUDA, 0} : views.front().device;
+    }
+
+    py::tuple dlpackDevice() const {
+        const DLDevice dev = device();
+        return py::make_tuple(py::int_(static_cast<int>(dev.device_type)), py::int_(dev.device_id));
+    }
     static void Export(py::module& m) {
         py::class_<DecodedFrame, std::shared_ptr<DecodedFrame>>(m, "DecodedFrame", py::module_local())
             .def_readonly("timestamp", &DecodedFrame::timestamp)
             .def_readonly("format", &DecodedFrame::format)
+            .def_property_readonly("device_type",
+                                   [](std::shared_ptr<DecodedFrame>& self) { return self->device().device_type; })
             .def("__repr__",
                  [](std::shared_ptr<DecodedFrame>& self) {
                      std::stringstream ss;
@@ -254,16 +327,10 @@ struct DecodedFrame {
                 [](std::shared_ptr<DecodedFrame>& self, py::object stream) {
                     return self->extBuf->dlpack(stream);
                 },
-                py::arg("stream") = NULL, "Export the buffer as a DLPack tensor")
+                py::arg("stream") = py::none(), "Export the buffer as a DLPack tensor")
             .def(
                 "__dlpack_device__",
-                [](std::shared_ptr<DecodedFrame>& self) {
-                    // DLDevice ctx;
-                    // ctx.device_type = DLDeviceType::kDLCUDA;
-                    // ctx.device_id = 0;
-                    return py::make_tuple(py::int_(static_cast<int>(DLDeviceType::kDLCUDA)),
-                                          py::int_(static_cast<int>(0)));
-                },
+                [](std::shared_ptr<DecodedFrame>& self) { return self->dlpackDevice(); },
                 "Get the device associated with the buffer")
             .def(
                 "GetPtrToPlane",
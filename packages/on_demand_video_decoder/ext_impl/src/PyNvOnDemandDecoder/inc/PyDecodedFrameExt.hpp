@@ -73,6 +73,8 @@ struct DecodedFrameExt : public DecodedFrame {
             //.def_readonly("chroma_format", &DecodedFrameExt::chroma_format)
             .def_readonly("format", &DecodedFrameExt::format)
             .def_readonly("color_range", &DecodedFrameExt::color_range)
+            .def_property_readonly(
+                "device_type", [](std::shared_ptr<DecodedFrameExt>& self) { return self->device().device_type; })
             .def("__repr__",
                  [](std::shared_ptr<DecodedFrameExt>& self) {
                      std::stringstream ss;
@@ -176,16 +178,10 @@ struct DecodedFrameExt : public DecodedFrame {
                 [](std::shared_ptr<DecodedFrameExt>& self, py::object stream) {
                     return self->extBuf->dlpack(stream);
                 },
-                py::arg("stream") = NULL, "Export the buffer as a DLPack tensor")
+                py::arg("stream") = py::none(), "Export the buffer as a DLPack tensor")
             .def(
                 "__dlpack_device__",
-                [](std::shared_ptr<DecodedFrameExt>& self) {
-                    // DLDevice ctx;
-                    // ctx.device_type = DLDeviceType::kDLCUDA;
-                    // ctx.device_id = 0;
-                    return py::make_tuple(py::int_(static_cast<int>(DLDeviceType::kDLCUDA)),
-                                          py::int_(static_cast<int>(0)));
-                },
+                [](std::shared_ptr<DecodedFrameExt>& self) { return self->dlpackDevice(); },
                 "Get the device associated with the buffer")
 
             .def(
@@ -21,6 +21,7 @@
 #include "NvCodecUtils.h"
 #include "PyNvVideoReader.hpp"
 #include "PyRGBFrame.hpp"
+#include "RequestReusePlanner.hpp"
 #include "ThreadPool.hpp"
 
 #include <cuda.h>
@@ -29,6 +30,7 @@
 #include <memory>
 #include <mutex>
 #include <string>
+#include <utility>
 #include <vector>
 
 #ifdef IS_DEBUG_BUILD
@@ -46,9 +48,12 @@ class PyNvBatchAsyncStreamReader {
      *   max_frames_per_decode_call: maximum number of frames per video per decode call (F upper bound)
      *   iGpu: target GPU device id
      *   bSuppressNoColorRangeWarning: suppress warning if no color range can be extracted
+     *   reuse_frames: take over frames of the previous request instead of decoding them again
+     *                 (see RequestReusePlanner). Doubles the aggregator pool memory, as the
+     *                 previous result has to stay valid while the next one is assembled.
      */
     PyNvBatchAsyncStreamReader(int num_of_set, int num_of_file, int max_frames_per_decode_call, int iGpu,
-                               bool bSuppressNoColorRangeWarning = false);
+                               bool bSuppressNoColorRangeWarning = false, bool reuse_frames = false);
 
     ~PyNvBatchAsyncStreamReader();
 
@@ -113,6 +118,12 @@ class PyNvBatchAsyncStreamReader {
      */
     void clearDecodeResultBuffer();
 
+    /**
+     * Number of frames decoded and reused (taken over from the previous result) since construction.
+     * Waits for any pending async task first.
+     */
+    std::pair<size_t, size_t> GetReuseStats();
+
    private:
     struct DecodeResult2D {
         std::vector<std::string> file_path_list;
@@ -140,8 +151,13 @@ class PyNvBatchAsyncStreamReader {
     // Sync 1D decode over the owned VideoReaderMap. The 2D worker calls this
     // F times. Mirrors PyNvSampleReader::run_rgb_out but operates on this
     // class's reader pool so the two classes don't share decoder state.
+    // filepaths[i] is decoded by the readers of video slot slots[i].
     std::vector<RGBFrame> run_rgb_out_1d(const std::vector<std::string>& filepaths,
-                                         const std::vector<int>& frame_ids, bool as_bgr);
+                                         const std::vector<int>& frame_ids, const std::vector<int>& slots,
+                                         bool as_bgr);
+
+    // Forget the frames of the previous result (e.g. when the aggregator pools are released)
+    void clearResidentFrames();
 
    private:
     bool suppress_no_color_range_given_warning = false;
@@ -161,8 +177,20 @@ class PyNvBatchAsyncStreamReader {
     // pool sizes itself to F * (H_v * W_v * 3) at f==0 and reallocates only
     // when the slot's resolution grows across calls.
     // Only accessed by the single decode worker; no thread-safety required.
+    // With reuse_frames, there are two sets of num_of_file pools, used alternately
+    // (agg_pool_set selects the set of the next Decode()), so the frames of the
+    // previous result can be copied into the new result.
     std::vector<GPUMemoryPool> agg_pools;
 
+    // Frame reuse across Decode() calls. Only accessed by the decode worker (or
+    // after waiting for it).
+    bool reuse_frames = false;
+    int agg_pool_set = 0;
+    RequestReusePlanner reuse_planner;
+    std::vector<std::vector<RGBFrame>> resident_frames;  // Frames of the previous result
+    size_t num_decoded_frames = 0;
+    size_t num_reused_frames = 0;
+
     // Async machinery (mirrors PyNvSampleReader)
     ConcurrentQueue<DecodeResult2D> decode_result_queue;  // capacity = 1
     ThreadRunner decode_worker;
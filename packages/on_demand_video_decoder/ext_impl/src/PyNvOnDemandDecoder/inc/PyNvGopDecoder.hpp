@@ -16,6 +16,7 @@
 
 #pragma once
 
+#include "DemuxerPool.hpp"
 #include "FFmpegDemuxer.h"
 #include "GPUMemoryPool.hpp"
 #include "GopDecoderUtils.hpp"
@@ -112,14 +113,22 @@ class PyNvGopDecoder {
      * this method returns a separate SerializedPacketBundle for each video file.
      * This is useful when you want to cache or process each video's data independently.
      * 
+     * The number of files is not limited by max_num_files: the files are processed in waves of at most
+     * max_num_files (or max_files_per_wave) files. While the bundles of one wave are serialized, the demuxing
+     * of the next wave is started, as long as the packet data of two waves fits into memory_budget.
+     * 
      * @param filepaths Vector of video file paths
      * @param frame_ids Vector of frame IDs corresponding to each filepath
      * @param fastStreamInfos Optional array of FastStreamInfo for performance optimization
+     * @param max_files_per_wave Maximum number of files per wave (0: max_num_files)
+     * @param memory_budget Maximum packet data (in bytes) of two overlapping waves (0: always overlap). If
+     *        exceeded (estimated from the previous wave), the waves are processed one after the other.
      * @return Vector of SerializedPacketBundle, one for each video file
      */
     std::vector<SerializedPacketBundle> get_gop_list(const std::vector<std::string>& filepaths,
                                                      const std::vector<int> frame_ids,
-                                                     const FastStreamInfo* fastStreamInfos = nullptr);
+                                                     const FastStreamInfo* fastStreamInfos = nullptr,
+                                                     size_t max_files_per_wave = 0, size_t memory_budget = 0);
 
     void decode_from_gop(const uint8_t* data, size_t size, const std::vector<std::string>& filepaths,
                          const std::vector<int> frame_ids, bool convert_to_rgb, bool as_bgr,
@@ -135,7 +144,9 @@ class PyNvGopDecoder {
     /**
      * Decode frames from a list of serialized packet bundles (each as a contiguous byte array)
      * The method parses each bundle via parseSerializedPacketData, rebuilds packet queues, and
-     * calls main_decode once for all aggregated frames.
+     * calls main_decode for the aggregated frames. If there are more frames than max_num_files, the frames
+     * are decoded in waves of max_num_files frames (see decode_gop_list_wave()); the frame memory for all
+     * waves is reserved up front, so that the frames of all waves stay valid.
      * @param datas Vector of pointers to serialized packet data buffers
      * @param sizes Vector of sizes for each serialized packet data buffer
      * @param filepaths Vector of source filepaths corresponding to each target frame (aggregated)
@@ -280,6 +291,22 @@ class PyNvGopDecoder {
      */
     void ReleaseDecoder();
 
+    /**
+     * Get the counters of the demuxer pool (see InitializeDemuxers())
+     */
+    DemuxerPoolStats GetDemuxerPoolStats() const { return demuxer_pool.GetStats(); }
+
+    /**
+     * Set the maximum number of idle demuxers (i.e. open video files) kept by the demuxer pool.
+     * A capacity of 0 disables the reuse of demuxers across calls.
+     */
+    void SetDemuxerPoolCapacity(size_t capacity) { demuxer_pool.SetCapacity(capacity); }
+
+    /**
+     * Close all idle demuxers held by the demuxer pool (e.g. if video files were modified on disk)
+     */
+    void ClearDemuxerPool() { demuxer_pool.Clear(); }
+
    protected:
     int main_decode(
         const std::vector<int>& color_ranges, const std::vector<int>& codec_ids, std::vector<int>& widths,
@@ -287,6 +314,24 @@ class PyNvGopDecoder {
         const std::vector<int>& frame_ids, bool convert_to_rgb, bool as_bgr,
         std::vector<std::unique_ptr<ConcurrentQueue<std::tuple<uint8_t*, int, int>>>>& vpacket_queue,
         std::vector<DecodedFrameExt>* out_if_no_color_conversion,
+        std::vector<RGBFrame>* out_if_color_converted, bool init_gpu_mem_pool = true);
+
+    /**
+     * Decode the frames [wave_begin, wave_end) of the aggregated inputs of decode_from_gop_list()
+     * 
+     * Frame wave_begin + k uses decoder slot k. The decoded frames are appended to the output vector.
+     * If init_gpu_mem_pool is false, the frame memory has to be reserved by the caller (InitGpuMemPool()).
+     */
+    void decode_gop_list_wave(
+        int wave_begin, int wave_end, const std::vector<int>& color_ranges_all,
+        const std::vector<int>& codec_ids_all, const std::vector<int>& widths_all,
+        const std::vector<int>& heights_all, const std::vector<int>& frame_sizes_all,
+        const std::vector<int>& gop_lens_all, const std::vector<int>& first_frame_ids_all,
+        const std::vector<std::vector<int>>& packets_bytes_all,
+        const std::vector<std::vector<int>>& decode_idxs_all,
+        const std::vector<const uint8_t*>& packet_binary_data_ptrs_all,
+        const std::vector<std::string>& filepaths, const std::vector<int>& frame_ids, bool convert_to_rgb,
+        bool as_bgr, bool init_gpu_mem_pool, std::vector<DecodedFrameExt>* out_if_no_color_conversion,
         std::vector<RGBFrame>* out_if_color_converted);
 
     /**
@@ -618,6 +663,11 @@ class PyNvGopDecoder {
 
     /**
    * Initialize demuxers and allocate memory for video files
+   *
+   * The demuxers are leased from the demuxer pool, i.e. demuxers for files accessed by a previous call are
+   * reused (rewound to the start of the stream) instead of re-opening the files. The caller needs to return
+   * the demuxers to the pool when done, typically using a DemuxerPool::LeaseGuard.
+   *
    * @param filepaths List of file paths
    * @param demuxers Output vector of initialized demuxers
    * @param fastStreamInfos Pointer to array of FastStreamInfo
@@ -681,6 +731,9 @@ class PyNvGopDecoder {
     std::vector<ThreadRunner> decode_runners;
     std::vector<ThreadRunner> merge_runners;
 
+    // Open demuxers reused across calls; leased by InitializeDemuxers()
+    DemuxerPool demuxer_pool;
+
     // Lazy loading functions
     void ensureCudaContextInitialized();
     void ensureDemuxRunnersInitialized();
@@ -710,6 +763,23 @@ class PyNvGopDecoder {
         std::vector<std::vector<std::unique_ptr<uint8_t[]>>>& vpacket_array,
         std::vector<std::vector<int>>& all_gop_lens, std::vector<std::vector<int>>& all_first_frame_ids);
 
+    /**
+     * First part of get_gop_internal(): initialize the demuxers and start the packet extraction on the demux
+     * runners (one runner per file, so at most max_num_files files)
+     */
+    void start_gop_demux(
+        const std::vector<std::string>& filepaths, const std::vector<int>& frame_ids,
+        const FastStreamInfo* fastStreamInfos, std::vector<std::unique_ptr<PyNvGopDemuxer>>& demuxers,
+        std::vector<std::unique_ptr<ConcurrentQueue<std::tuple<uint8_t*, int, int>>>>& vpacket_queue,
+        std::vector<std::vector<std::unique_ptr<uint8_t[]>>>& vpacket_array,
+        std::vector<std::vector<int>>& all_gop_lens, std::vector<std::vector<int>>& all_first_frame_ids);
+
+    /**
+     * Second part of get_gop_internal(): wait for the packet extraction started by start_gop_demux() and
+     * validate its results
+     */
+    void finish_gop_demux(std::vector<std::vector<std::unique_ptr<uint8_t[]>>>& vpacket_array);
+
     /**
      * Create a SerializedPacketBundle from extracted packet data
      * 
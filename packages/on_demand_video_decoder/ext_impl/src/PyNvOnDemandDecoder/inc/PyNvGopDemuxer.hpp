@@ -58,6 +58,9 @@ class PyNvGopDemuxer {
 
     bool IsValid() { return demuxer->IsValid(); }
 
+    /*Reset to the start of the stream (state directly after opening), e.g. to reuse a pooled demuxer*/
+    bool Rewind() { return demuxer && demuxer->Rewind(); }
+
     AVColorSpace GetColorSpace() const;
 
     AVColorRange GetColorRange() const;
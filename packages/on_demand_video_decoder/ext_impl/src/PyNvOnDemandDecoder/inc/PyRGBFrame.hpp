@@ -37,44 +37,105 @@ class RGBFrame {
     CUdeviceptr data;
     bool readOnly;
     bool isBGR;
+    DLDevice device{kDLCUDA, 0};
 
     RGBFrame(const std::vector<size_t>& _shape, const std::vector<size_t>& _stride,
-             const std::string& _typeStr, size_t _streamid, CUdeviceptr _data, bool _readOnly, bool _isBRG);
+             const std::string& _typeStr, size_t _streamid, CUdeviceptr _data, bool _readOnly, bool _isBRG,
+             DLDeviceType _deviceType = kDLCUDA, int _deviceId = 0);
 
     RGBFrame(const CAIMemoryView& to_convert, bool _isBRG);
 
     RGBFrame();
 
+    /**
+     * @brief Free the device memory of the frame.
+     *
+     * Host frames do not own their memory, so only the data pointer is reset for them.
+     */
     void release_data();
 
     bool is_of_size(size_t height, size_t width);
+    bool isHost() const { return IsHostAccessible(device.device_type); }
+    std::vector<size_t> shapeVector() const {
+        return {std::get<0>(shape), std::get<1>(shape), std::get<2>(shape)};
+    }
+    std::vector<size_t> strideVector() const {
+        return {std::get<0>(stride), std::get<1>(stride), std::get<2>(stride)};
+    }
+
     static void Export(py::module& m) {
-        py::class_<RGBFrame, std::shared_ptr<RGBFrame>>(m, "RGBFrame")
-            .def(py::init<std::vector<size_t>, std::vector<size_t>, std::string, size_t, CUdeviceptr, bool,
-                          bool>())
+        py::class_<RGBFrame, std::shared_ptr<RGBFrame>>(m, "RGBFrame", py::buffer_protocol())
+            .def(py::init<std::vector<size_t>, std::vector<size_t>, std::string, size_t, CUdeviceptr, bool, bool,
+                          DLDeviceType, int>(),
+                 py::arg("shape"), py::arg("stride"), py::arg("typestr"), py::arg("streamid"), py::arg("data"),
+                 py::arg("readOnly"), py::arg("isBGR"), py::arg("device_type") = kDLCUDA,
+                 py::arg("device_id") = 0)
             .def_readonly("shape", &RGBFrame::shape)
             .def_readonly("stride", &RGBFrame::stride)
             .def_readonly("dataptr", &RGBFrame::data)
             .def_readonly("isBGR", &RGBFrame::isBGR)
+            .def_property_readonly("device_type",
+                                   [](std::shared_ptr<RGBFrame>& self) { return self->device.device_type; })
+            .def_property_readonly("device_id",
+                                   [](std::shared_ptr<RGBFrame>& self) { return self->device.device_id; })
             .def("__repr__",
                  [](std::shared_ptr<RGBFrame>& self) {
                      std::stringstream ss;
                      ss << "<RGBFrame ";
                      ss << py::str(py::cast(self->shape));
+                     if (self->isHost()) {
+                         ss << " host";
+                     }
                      ss << ">";
                      return ss.str();
                  })
             .def_readonly("data", &RGBFrame::data)
-            .def_property_readonly("__cuda_array_interface__", [](std::shared_ptr<RGBFrame>& self) {
-                py::dict dict;
-                dict["version"] = 3;
-                dict["shape"] = self->shape;
-                dict["strides"] = self->stride;
-                dict["typestr"] = self->typestr;
-                dict["stream"] = self->stream == 0 ? int(size_t(self->stream)) : 2;
-                dict["data"] = std::make_pair(self->data, false);
-                dict["gpuIdx"] = 0;  // TODO
-                return dict;
-            });
+            .def_property_readonly("__cuda_array_interface__",
+                                   [](std::shared_ptr<RGBFrame>& self) {
+                                       if (!IsCudaAccessible(self->device.device_type)) {
+                                           throw py::attribute_error("Host frame has no __cuda_array_interface__");
+                                       }
+                                       py::dict dict;
+                                       dict["version"] = 3;
+                                       dict["shape"] = self->shape;
+                                       dict["strides"] = self->stride;
+                                       dict["typestr"] = self->typestr;
+                                       dict["stream"] = self->stream == 0 ? int(size_t(self->stream)) : 2;
+                                       dict["data"] = std::make_pair(self->data, false);
+                                       dict["gpuIdx"] = self->device.device_id;
+                                       return dict;
+                                   })
+            .def_property_readonly("__array_interface__",
+                                   [](std::shared_ptr<RGBFrame>& self) {
+                                       if (!self->isHost()) {
+                                           throw py::attribute_error("Device frame has no __array_interface__");
+                                       }
+                                       return MakeArrayInterface(self->shapeVector(), self->strideVector(),
+                                                                 self->typestr,
+                                                                 reinterpret_cast<void*>(self->data),
+                                                                 self->readOnly);
+                                   })
+            .def_buffer([](RGBFrame& self) -> py::buffer_info {
+                if (!self.isHost()) {
+                    throw std::runtime_error("Device frame does not support the buffer protocol");
+                }
+                return MakeHostBufferInfo(self.shapeVector(), self.strideVector(), self.typestr,
+                                          reinterpret_cast<void*>(self.data), self.readOnly);
+            })
+            .def(
+                "__dlpack__",
+                [](std::shared_ptr<RGBFrame>& self, py::object stream) {
+                    SyncDLPackConsumerStream(self->device, self->stream, stream);
+                    return MakeDLPackCapsule(self->shapeVector(), self->strideVector(), self->typestr,
+                                             reinterpret_cast<void*>(self->data), self->device, self);
+                },
+                py::arg("stream") = py::none(), "Export the frame as a DLPack tensor")
+            .def(
+                "__dlpack_device__",
+                [](std::shared_ptr<RGBFrame>& self) {
+                    return py::make_tuple(py::int_(static_cast<int>(self->device.device_type)),
+                                          py::int_(self->device.device_id));
+                },
+                "Get the device associated with the frame");
     }
 };
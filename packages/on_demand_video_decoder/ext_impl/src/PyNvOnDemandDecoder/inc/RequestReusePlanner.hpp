@@ -0,0 +1,109 @@
+/*
+ * Copyright (c) 2025, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+/**
+ * 64-bit fingerprint of the frame `frame_id` of `filepath`. `variant` distinguishes outputs of the same frame
+ * which are not interchangeable (e.g. RGB and BGR output).
+ */
+uint64_t FingerprintFrame(const std::string& filepath, int frame_id, uint64_t variant = 0);
+
+// Position [video][frame] in a 2D request (see PyNvBatchAsyncStreamReader::Decode())
+struct FrameSlot {
+    int video;
+    int frame;
+};
+
+// Frame `dst` of the new request is available as frame `src` of the resident (buffered) request
+struct FrameReuse {
+    FrameSlot dst;
+    FrameSlot src;
+};
+
+// GOP, identified by the id of its first frame
+struct ResidentGop {
+    std::string filepath;
+    int first_frame_id;
+};
+
+struct ReusePlan {
+    std::vector<FrameReuse> reuse;
+    // Frames which have to be decoded, ordered by video, then by frame
+    std::vector<FrameSlot> decode;
+    // GOPs which contain frames of the new request (only for files with known GOP structure). GOPs of the
+    // resident request which are not listed are not needed anymore.
+    std::vector<ResidentGop> keep_resident;
+};
+
+/**
+ * Plans which frames of a 2D (file x frame) request can be taken over from the previous (resident) result
+ *
+ * The resident request is indexed by the fingerprints of its (file, frame) pairs. For a new request, each
+ * frame is looked up, so a sliding window such as [t..t+k] followed by [t+1..t+k+1] only has to decode the
+ * frame t+k+1. Hits are verified against the stored request, so a fingerprint collision only costs a decode.
+ *
+ * The GOP structure of a file is taken from SetGopBoundaries() if set, otherwise from the default GOP length
+ * (if > 0). Without either, no GOPs are reported in ReusePlan::keep_resident.
+ *
+ * Pure host component; not thread-safe (used by a single decode worker).
+ */
+class RequestReusePlanner {
+   public:
+    explicit RequestReusePlanner(int default_gop_length = 0);
+
+    /**
+     * Set the first frame ids of the GOPs of `filepath` (replaces earlier boundaries of the file)
+     */
+    void SetGopBoundaries(const std::string& filepath, std::vector<int> first_frame_ids);
+
+    /**
+     * Plan the new request against the resident request (does not change the resident request)
+     */
+    ReusePlan Plan(const std::vector<std::string>& filepaths, const std::vector<std::vector<int>>& frame_ids,
+                   uint64_t variant = 0) const;
+
+    /**
+     * Make the given request the resident one (i.e. its result is now buffered)
+     */
+    void SetResident(const std::vector<std::string>& filepaths, const std::vector<std::vector<int>>& frame_ids,
+                     uint64_t variant = 0);
+
+    /**
+     * Forget the resident request (e.g. after its buffers were released)
+     */
+    void Clear();
+
+    size_t NumResidentFrames() const { return resident_index.size(); }
+
+   private:
+    // First frame id of the GOP containing `frame_id`, or -1 if the GOP structure of the file is unknown
+    int GopStart(const std::string& filepath, int frame_id) const;
+
+    int default_gop_length;
+    std::unordered_map<std::string, std::vector<int>> gop_boundaries;  // Sorted first frame ids per file
+
+    std::vector<std::string> resident_filepaths;
+    std::vector<std::vector<int>> resident_frame_ids;
+    uint64_t resident_variant = 0;
+    std::unordered_map<uint64_t, FrameSlot> resident_index;  // Fingerprint -> first occurrence
+};
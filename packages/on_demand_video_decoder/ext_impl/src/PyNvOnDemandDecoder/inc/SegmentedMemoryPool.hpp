@@ -0,0 +1,283 @@
+/*
+ * Copyright (c) 2025, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <vector>
+
+#include "MemoryPoolBackends.hpp"
+
+struct SegmentedMemoryPoolConfig {
+    // Size of the first segment (0: size of the first request)
+    size_t initial_segment_size = 0;
+    // A new segment is at least `growth_factor` times the current capacity (and large enough for the request)
+    double growth_factor = 1.0;
+    // Alignment of the returned pointers (power of 2)
+    size_t alignment = 256;
+    // Trim policy: every `trim_interval` resets, the capacity is reduced to `trim_slack` times the high-water
+    // mark of these resets (0: never trim)
+    size_t trim_interval = 64;
+    double trim_slack = 1.25;
+};
+
+struct MemoryPoolStats {
+    size_t num_segments = 0;
+    size_t capacity = 0;          // Total size of all segments
+    size_t used = 0;              // Bytes handed out since the last reset (including alignment padding)
+    size_t high_water_mark = 0;   // Maximum of `used` in the current trim interval
+    size_t peak_used = 0;         // Maximum of `used` over the lifetime of the pool
+    size_t num_segment_allocs = 0;
+    size_t num_segment_frees = 0;
+};
+
+/**
+ * Bump allocator over a chain of segments obtained from an allocator backend (see MemoryPoolBackends.hpp)
+ *
+ * - Growth never moves existing allocations: if the current segment is full, the allocation continues in the
+ *   next segment, which is allocated if needed. Pointers stay valid until Rewind() / Reset(), Rollback() past
+ *   them, or Release().
+ * - GetMark() / Rollback() release all allocations made after the mark (e.g. the allocations of a failed
+ *   request), without affecting earlier ones.
+ * - Rewind() releases all allocations without calling the backend (safe in error paths).
+ * - Reset() releases all allocations. If the pool consists of several segments, they are coalesced into one,
+ *   so a pool sized by its first requests settles to a single segment. Every `trim_interval` resets, the
+ *   capacity is trimmed to the high-water mark of the interval (plus slack), so memory of rare peaks is
+ *   returned to the backend. Requires the same backend state as Allocate() (e.g. a current CUDA context).
+ *
+ * Thread Safety: Not thread-safe; each pool is expected to be used by one thread (or guarded by the owner).
+ */
+template <typename Allocator>
+class SegmentedMemoryPool {
+   public:
+    /**
+     * Position in the pool; rolling back to it releases all allocations made after it
+     */
+    struct Mark {
+        size_t segment = 0;
+        size_t offset = 0;
+        size_t used = 0;
+        uint64_t generation = 0;  // Marks are invalidated by Rewind(), Reset() and Release()
+    };
+
+    explicit SegmentedMemoryPool(const SegmentedMemoryPoolConfig& config = SegmentedMemoryPoolConfig())
+        : config_(config) {
+        if (config_.alignment == 0 || (config_.alignment & (config_.alignment - 1)) != 0) {
+            throw std::invalid_argument("[ERROR] Memory pool alignment has to be a power of 2");
+        }
+    }
+
+    SegmentedMemoryPool(const SegmentedMemoryPool&) = delete;
+    SegmentedMemoryPool& operator=(const SegmentedMemoryPool&) = delete;
+
+    SegmentedMemoryPool(SegmentedMemoryPool&& other) noexcept { *this = std::move(other); }
+    SegmentedMemoryPool& operator=(SegmentedMemoryPool&& other) noexcept {
+        if (this != &other) {
+            Release();
+            config_ = other.config_;
+            segments_ = std::move(other.segments_);
+            current_ = other.current_;
+            offset_ = other.offset_;
+            generation_ = other.generation_;
+            num_resets_ = other.num_resets_;
+            stats_ = other.stats_;
+            other.segments_.clear();
+            other.current_ = 0;
+            other.offset_ = 0;
+            other.stats_ = MemoryPoolStats();
+        }
+        return *this;
+    }
+
+    ~SegmentedMemoryPool() { Release(); }
+
+    /**
+     * Allocate `num_bytes` (aligned to the configured alignment). Never invalidates earlier allocations.
+     */
+    void* Allocate(size_t num_bytes) {
+        for (; current_ < segments_.size(); ++current_, offset_ = 0) {
+            if (void* ptr = AllocateFromCurrent(num_bytes)) {
+                return ptr;
+            }
+            // The rest of the segment is skipped for this cycle
+            const Segment& segment = segments_[current_];
+            stats_.used += segment.size - std::min(offset_, segment.size);
+        }
+
+        // No segment left with enough space: append a new one. The backend may return a less aligned pointer
+        // than configured, so the segment includes room for the padding.
+        const size_t grown_size = static_cast<size_t>(stats_.capacity * config_.growth_factor);
+        size_t segment_size = std::max(WithAlignmentSlack(num_bytes), grown_size);
+        if (segments_.empty() && config_.initial_segment_size > segment_size) {
+            segment_size = config_.initial_segment_size;
+        }
+        AppendSegment(std::max<size_t>(segment_size, 1));
+        current_ = segments_.size() - 1;
+        offset_ = 0;
+        return AllocateFromCurrent(num_bytes);
+    }
+
+    Mark GetMark() const { return Mark{current_, offset_, stats_.used, generation_}; }
+
+    /**
+     * Release all allocations made after `mark`
+     */
+    void Rollback(const Mark& mark) {
+        const bool is_after_current =
+            mark.segment > current_ || (mark.segment == current_ && mark.offset > offset_);
+        if (mark.generation != generation_ || is_after_current) {
+            throw std::invalid_argument("[ERROR] Memory pool mark is no longer valid");
+        }
+        current_ = mark.segment;
+        offset_ = mark.offset;
+        stats_.used = mark.used;
+    }
+
+    /**
+     * Release all allocations, keeping the segments as they are
+     */
+    void Rewind() {
+        stats_.high_water_mark = std::max(stats_.high_water_mark, stats_.used);
+        current_ = 0;
+        offset_ = 0;
+        stats_.used = 0;
+        ++generation_;
+    }
+
+    /**
+     * Release all allocations. Coalesces the segments into one and applies the trim policy.
+     */
+    void Reset() {
+        Rewind();
+        ++num_resets_;
+        const bool trim_due = config_.trim_interval > 0 && num_resets_ % config_.trim_interval == 0;
+        if (trim_due) {
+            const size_t target = static_cast<size_t>(stats_.high_water_mark * config_.trim_slack);
+            Rebuild(std::min(target, stats_.capacity));
+            stats_.high_water_mark = 0;
+        } else if (segments_.size() > 1) {
+            Rebuild(stats_.capacity);
+        }
+    }
+
+    /**
+     * Reset and make sure that at least `num_bytes` can be allocated from a single segment
+     */
+    void ResetAndReserve(size_t num_bytes) {
+        Reset();
+        if (segments_.empty() || segments_.front().size < WithAlignmentSlack(num_bytes)) {
+            Rebuild(std::max(WithAlignmentSlack(num_bytes), stats_.capacity));
+        }
+    }
+
+    /**
+     * Free all segments (invalidates all allocations)
+     */
+    void Release() {
+        for (Segment& segment : segments_) {
+            FreeSegment(segment);
+        }
+        segments_.clear();
+        current_ = 0;
+        offset_ = 0;
+        stats_.used = 0;
+        stats_.capacity = 0;
+        stats_.num_segments = 0;
+        ++generation_;
+    }
+
+    MemoryPoolStats GetStats() const {
+        MemoryPoolStats stats = stats_;
+        stats.high_water_mark = std::max(stats.high_water_mark, stats.used);
+        return stats;
+    }
+
+    const SegmentedMemoryPoolConfig& GetConfig() const { return config_; }
+
+   private:
+    struct Segment {
+        uint8_t* data;
+        size_t size;
+    };
+
+    // Offset of the first aligned address at or after `offset` in `segment`. The address (not the offset) is
+    // aligned, as the backends only guarantee their own alignment for the segment start.
+    size_t AlignUp(const Segment& segment, size_t offset) const {
+        const uintptr_t address = reinterpret_cast<uintptr_t>(segment.data) + offset;
+        const uintptr_t aligned = (address + config_.alignment - 1) & ~(uintptr_t(config_.alignment) - 1);
+        return offset + static_cast<size_t>(aligned - address);
+    }
+
+    // Segment size needed for an allocation of `num_bytes`, regardless of the alignment of the segment start
+    size_t WithAlignmentSlack(size_t num_bytes) const { return num_bytes + config_.alignment - 1; }
+
+    // Allocate from the current segment; returns nullptr if the rest of the segment is too small
+    void* AllocateFromCurrent(size_t num_bytes) {
+        Segment& segment = segments_[current_];
+        const size_t start = AlignUp(segment, offset_);
+        if (start > segment.size || segment.size - start < num_bytes) {
+            return nullptr;
+        }
+        stats_.used += start - offset_ + num_bytes;
+        offset_ = start + num_bytes;
+        UpdatePeak();
+        return segment.data + start;
+    }
+
+    void UpdatePeak() { stats_.peak_used = std::max(stats_.peak_used, stats_.used); }
+
+    void AppendSegment(size_t size) {
+        Segment segment{static_cast<uint8_t*>(Allocator::Allocate(size)), size};
+        segments_.push_back(segment);
+        stats_.capacity += size;
+        stats_.num_segments = segments_.size();
+        ++stats_.num_segment_allocs;
+    }
+
+    void FreeSegment(Segment& segment) {
+        Allocator::Free(segment.data);
+        stats_.capacity -= segment.size;
+        ++stats_.num_segment_frees;
+    }
+
+    // Replace all segments (which must not be in use) by a single segment of `size` bytes
+    void Rebuild(size_t size) {
+        if (segments_.size() == 1 && segments_.front().size == size) {
+            return;
+        }
+        for (Segment& segment : segments_) {
+            FreeSegment(segment);
+        }
+        segments_.clear();
+        stats_.num_segments = 0;
+        if (size > 0) {
+            AppendSegment(size);
+        }
+    }
+
+    SegmentedMemoryPoolConfig config_;
+    std::vector<Segment> segments_;
+    size_t current_ = 0;  // Segment of the next allocation; all segments after it are unused
+    size_t offset_ = 0;   // Offset of the next allocation in the current segment
+    uint64_t generation_ = 0;
+    uint64_t num_resets_ = 0;
+    MemoryPoolStats stats_;
+};
+
+using HostMemoryPool = SegmentedMemoryPool<HostAllocator>;
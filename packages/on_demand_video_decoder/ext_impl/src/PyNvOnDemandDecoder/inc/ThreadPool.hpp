@@ -22,6 +22,8 @@
 #include <exception>
 #include <iostream>
 
+#include "Logger.h"
+
 class ThreadRunner {
    public:
     ThreadRunner() : stopFlag(false), busy(false), hasException(false), exceptionPtr(nullptr) {
@@ -138,12 +140,12 @@ class ThreadRunner {
                 task();  // execute task
             } catch (const std::exception& e) {
                 // Capture exception with full information for later rethrow
-                std::cerr << "[ThreadRunner] Exception caught: " << e.what() << std::endl;
+                LOG(ERROR) << "[ThreadRunner] Exception caught: " << e.what();
                 exceptionPtr = std::current_exception();
                 hasException = true;
             } catch (...) {
                 // Capture unknown exception
-                std::cerr << "[ThreadRunner] Unknown exception caught" << std::endl;
+                LOG(ERROR) << "[ThreadRunner] Unknown exception caught";
                 exceptionPtr = std::current_exception();
                 hasException = true;
             }
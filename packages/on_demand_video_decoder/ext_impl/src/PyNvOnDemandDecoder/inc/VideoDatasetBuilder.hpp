@@ -0,0 +1,150 @@
+/*
+ * Copyright (c) 2025, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <map>
+#include <mutex>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "GopIndexSidecar.hpp"
+
+struct VideoDatasetBuilderConfig {
+    // Name of the (CPU) encoder in the linked FFmpeg build, e.g. "libx265", "libx264", "libsvtav1"
+    std::string encoder = "libx265";
+    // Encoder options (generic AVCodecContext options or private options of the encoder), e.g.
+    // {"x265-params": "lowdelay=1"}, {"preset": "fast"}, {"crf": "23"}
+    std::map<std::string, std::string> encoder_options;
+    // Pixel format of the encoded video
+    std::string pix_fmt = "yuv420p";
+    int fps = 12;
+    // A keyframe is forced every `gop_size` frames
+    int gop_size = 30;
+    int max_b_frames = 0;
+    // Number of linearly interpolated frames inserted between consecutive source images
+    int interpolation_num_frames = 0;
+    // Number of sequences encoded concurrently
+    int num_workers = 4;
+    // Number of threads decoding source images (shared by all sequences)
+    int num_decode_threads = 8;
+    // Maximum number of source images decoded ahead of the encoder, per sequence
+    int max_frames_ahead = 16;
+    // Threads per encoder instance (0: chosen by the encoder)
+    int encoder_threads = 0;
+    // Write the GOP index sidecar (`<output>.gop_index.json`) next to each video
+    bool write_gop_index = true;
+    // Skip sequences whose outputs already exist (the sidecar is written last, so it marks completion)
+    bool skip_existing = false;
+    // Interval of the progress log records (INFO level); <= 0 disables them
+    double progress_interval_s = 30.0;
+};
+
+struct VideoDatasetBuilderStats {
+    uint64_t num_sequences = 0;          // Sequences in the job list
+    uint64_t num_sequences_done = 0;     // Sequences encoded by this run
+    uint64_t num_sequences_skipped = 0;  // Sequences skipped because their outputs already exist
+    uint64_t num_sequences_failed = 0;   // Sequences which failed (no output is left behind)
+    uint64_t num_images = 0;             // Source images decoded
+    uint64_t num_frames = 0;             // Frames encoded (including interpolated frames)
+    uint64_t num_bytes = 0;              // Size of the written videos
+    double elapsed_s = 0.0;
+    std::vector<std::pair<uint64_t, std::string>> failed_sequences;  // (sequence id, error message)
+};
+
+/**
+ * Builds video datasets from image sequences in-process, using libavcodec / libavformat
+ *
+ * Each sequence (list of JPEG / PNG images in display order) is encoded to one video file:
+ * - Source images are decoded (and converted to the pixel format of the encoder) by a pool of
+ *   `num_decode_threads` threads shared by all sequences, up to `max_frames_ahead` images ahead of the
+ *   encoder.
+ * - `interpolation_num_frames` intermediate frames are linearly interpolated between consecutive images,
+ *   so source image `i` ends up at video frame `i * (interpolation_num_frames + 1)`.
+ * - `num_workers` sequences are encoded concurrently, each by its own encoder instance. A keyframe is forced
+ *   every `gop_size` frames.
+ * - The GOP index sidecar (see GopIndexSidecar) is written from the packets produced by the encoder, with
+ *   `num_source_frames`, `interpolation_num_frames`, `fps`, `width`, `height`, `encoder` and `pix_fmt` as
+ *   metadata.
+ *
+ * Outputs are written to temporary files and renamed when complete, so interrupted or failed sequences do not
+ * leave partial videos behind.
+ */
+class VideoDatasetBuilder {
+   public:
+    explicit VideoDatasetBuilder(const VideoDatasetBuilderConfig& config);
+
+    VideoDatasetBuilder(const VideoDatasetBuilder&) = delete;
+    VideoDatasetBuilder& operator=(const VideoDatasetBuilder&) = delete;
+
+    /**
+     * Encode all sequences. Blocks until all sequences are processed or Stop() is called.
+     *
+     * @param image_paths Source images of each sequence, in display order
+     * @param output_paths Output video of each sequence (the container is chosen by the file extension)
+     * @return Statistics of this run
+     */
+    VideoDatasetBuilderStats Build(const std::vector<std::vector<std::string>>& image_paths,
+                                   const std::vector<std::string>& output_paths);
+
+    /**
+     * Request the running build to stop. Sequences in progress are aborted and their outputs discarded.
+     * Thread Safety: Safe to call from any thread.
+     */
+    void Stop() { stop_requested = true; }
+
+    /**
+     * Statistics of the current (or last) run. Thread Safety: Safe to call while Build() is executing.
+     */
+    VideoDatasetBuilderStats GetStats() const;
+
+    /**
+     * Names of the CPU video encoders available in the linked FFmpeg build
+     */
+    static std::vector<std::string> AvailableEncoders();
+
+    /**
+     * Names of the source image decoders ("mjpeg", "png") available in the linked FFmpeg build
+     */
+    static std::vector<std::string> AvailableImageDecoders();
+
+    /**
+     * Path of the GOP index sidecar of a video
+     */
+    static std::string GopIndexPath(const std::string& output_path) {
+        return GopIndexSidecar::PathFor(output_path);
+    }
+
+   private:
+    class DecodePool;
+
+    // Encode one sequence; returns the size of the written video
+    uint64_t EncodeSequence(DecodePool& decode_pool, const std::vector<std::string>& image_paths,
+                            const std::string& output_path);
+    void LogProgress();
+
+    VideoDatasetBuilderConfig config;
+    std::atomic<bool> stop_requested{false};
+    bool running = false;
+
+    mutable std::mutex stats_mtx;
+    VideoDatasetBuilderStats stats;
+    std::chrono::steady_clock::time_point start_time;
+};
@@ -0,0 +1,86 @@
+/*
+ * Copyright (c) 2025, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <string>
+#include <vector>
+
+struct RemuxConfig {
+    // Flags of the mp4 muxer: one fragment per GOP (starting at each keyframe) and a single compact sidx
+    std::string movflags = "frag_keyframe+empty_moov+default_base_moof+global_sidx";
+    // Rewrite the timestamps to constant frame rate if the frame intervals allow it, otherwise only shift
+    // them to start at 0
+    bool normalize_timestamps = true;
+    // Timestamps count as CFR if all frame intervals are within this fraction of the median interval
+    double cfr_tolerance = 0.25;
+    // Videos with longer GOPs are flagged for re-encoding (<= 0 disables the check)
+    int max_gop_len = 64;
+    // Write the GOP index sidecar (see GopIndexSidecar) next to each output
+    bool write_gop_index = true;
+    // Number of files processed in parallel
+    int num_threads = 4;
+};
+
+/**
+ * Result and GOP statistics of one file
+ */
+struct RemuxResult {
+    std::string input_path;
+    std::string output_path;  // Empty if the file was only analyzed
+    bool ok = false;
+    std::string error;
+    int num_frames = 0;          // Frames in the output
+    int num_dropped_frames = 0;  // Frames before the first keyframe (not decodable on their own), dropped
+    int num_gops = 0;
+    int min_gop_len = 0;
+    int max_gop_len = 0;
+    double mean_gop_len = 0.0;
+    bool is_cfr = false;
+    double fps = 0.0;  // Frame rate (average frame rate for VFR videos)
+    bool needs_reencode = false;
+    std::vector<std::string> reencode_reasons;
+};
+
+/**
+ * Remux a video (without decoding) to a fragmented MP4 optimized for random access
+ *
+ * Only the video stream is kept. Packets before the first keyframe are dropped. With the default `movflags`,
+ * the output contains one fragment per GOP and a global `sidx`, so the demuxer can seek to any GOP without
+ * scanning the file. With `normalize_timestamps`, CFR timestamps (`frame id * frame duration`) are written
+ * whenever the source intervals are regular within `cfr_tolerance`, so the output is not detected as VFR.
+ *
+ * The GOP structure is taken from the keyframe flags of the source packets (including recovery points which
+ * the source demuxer reports as keyframes). Videos which still have overly long GOPs or irregular timestamps
+ * after remuxing are flagged in the result (`needs_reencode`).
+ *
+ * Errors are reported in the result instead of being thrown.
+ *
+ * @param input_path Source video
+ * @param output_path Output file (written via a temporary file); empty to only analyze the source
+ * @param config Remux configuration
+ */
+RemuxResult RemuxForRandomAccess(const std::string& input_path, const std::string& output_path,
+                                 const RemuxConfig& config);
+
+/**
+ * Remux many videos in parallel (`config.num_threads` files at a time)
+ *
+ * @param output_paths Output of each input, or empty to only analyze the inputs
+ */
+std::vector<RemuxResult> RemuxForRandomAccess(const std::vector<std::string>& input_paths,
+                                              const std::vector<std::string>& output_paths,
+                                              const RemuxConfig& config);
@@ -142,3 +142,182 @@ bool IsCudaAccessible(DLDeviceType devType) {
             return false;
     }
 }
+
+bool IsHostAccessible(DLDeviceType devType) {
+    switch (devType) {
+        case kDLCPU:
+        case kDLCUDAHost:
+        case kDLCUDAManaged:
+            return true;
+        default:
+            return false;
+    }
+}
+
+DLDataType TypestrToDLDataType(const std::string& typestr) {
+    if (typestr == "B") {
+        return DLDataType{kDLUInt, 8, 1};
+    }
+    // Byte order prefix ('|', '<', '=') followed by kind and item size, e.g. "<u2".
+    if (typestr.size() < 3 || typestr[0] == '>') {
+        throw std::runtime_error("Unsupported typestr: " + typestr);
+    }
+    const char kind = typestr[1];
+    const int itemSize = std::stoi(typestr.substr(2));
+    DLDataType dtype{};
+    switch (kind) {
+        case 'u':
+            dtype.code = kDLUInt;
+            break;
+        case 'i':
+            dtype.code = kDLInt;
+            break;
+        case 'f':
+            dtype.code = kDLFloat;
+            break;
+        default:
+            throw std::runtime_error("Unsupported typestr: " + typestr);
+    }
+    if (itemSize != 1 && itemSize != 2 && itemSize != 4 && itemSize != 8) {
+        throw std::runtime_error("Unsupported typestr: " + typestr);
+    }
+    dtype.bits = static_cast<uint8_t>(itemSize * 8);
+    dtype.lanes = 1;
+    return dtype;
+}
+
+std::string TypestrToBufferFormat(const std::string& typestr) {
+    const DLDataType dtype = TypestrToDLDataType(typestr);
+    switch (dtype.code) {
+        case kDLUInt:
+            return dtype.bits == 8 ? "B" : dtype.bits == 16 ? "H" : dtype.bits == 32 ? "I" : "Q";
+        case kDLInt:
+            return dtype.bits == 8 ? "b" : dtype.bits == 16 ? "h" : dtype.bits == 32 ? "i" : "q";
+        case kDLFloat:
+            if (dtype.bits == 8) {
+                throw std::runtime_error("Unsupported typestr: " + typestr);
+            }
+            return dtype.bits == 16 ? "e" : dtype.bits == 32 ? "f" : "d";
+        default:
+            throw std::runtime_error("Unsupported typestr: " + typestr);
+    }
+}
+
+py::dict MakeArrayInterface(const std::vector<size_t>& shape, const std::vector<size_t>& strides,
+                            const std::string& typestr, void* data, bool readOnly) {
+    py::dict dict;
+    dict["version"] = 3;
+    dict["shape"] = py::tuple(py::cast(shape));
+    dict["strides"] = py::tuple(py::cast(strides));
+    dict["typestr"] = typestr == "B" ? std::string("|u1") : typestr;
+    dict["data"] = py::make_tuple(reinterpret_cast<uintptr_t>(data), readOnly);
+    return dict;
+}
+
+py::buffer_info MakeHostBufferInfo(const std::vector<size_t>& shape, const std::vector<size_t>& strides,
+                                   const std::string& typestr, void* data, bool readOnly) {
+    const DLDataType dtype = TypestrToDLDataType(typestr);
+    std::vector<py::ssize_t> bufShape(shape.begin(), shape.end());
+    std::vector<py::ssize_t> bufStrides(strides.begin(), strides.end());
+    return py::buffer_info(data, dtype.bits / 8, TypestrToBufferFormat(typestr),
+                           static_cast<py::ssize_t>(shape.size()), bufShape, bufStrides, readOnly);
+}
+
+py::capsule MakeDLPackCapsule(const std::vector<size_t>& shape, const std::vector<size_t>& strides,
+                              const std::string& typestr, void* data, const DLDevice& device,
+                              std::shared_ptr<const void> owner) {
+    struct ManagerCtx {
+        DLManagedTensor tensor;
+        std::vector<int64_t> shape;
+        std::vector<int64_t> strides;
+        std::shared_ptr<const void> owner;
+    };
+
+    const DLDataType dtype = TypestrToDLDataType(typestr);
+    const size_t itemSize = dtype.bits / 8;
+
+    auto ctx = std::make_unique<ManagerCtx>();
+    ctx->owner = std::move(owner);
+    ctx->shape.assign(shape.begin(), shape.end());
+    for (size_t stride : strides) {
+        if (stride % itemSize != 0) {
+            throw std::runtime_error("Stride must be a multiple of the element size in bytes");
+        }
+        ctx->strides.push_back(static_cast<int64_t>(stride / itemSize));
+    }
+
+    DLTensor& dlTensor = ctx->tensor.dl_tensor;
+    dlTensor.data = data;
+    dlTensor.device = device;
+    dlTensor.ndim = static_cast<int32_t>(ctx->shape.size());
+    dlTensor.dtype = dtype;
+    dlTensor.shape = ctx->shape.data();
+    dlTensor.strides = ctx->strides.data();
+    dlTensor.byte_offset = 0;
+    ctx->tensor.manager_ctx = ctx.get();
+    ctx->tensor.deleter = [](DLManagedTensor* tensor) { delete static_cast<ManagerCtx*>(tensor->manager_ctx); };
+
+    py::capsule cap(&ctx->tensor, "dltensor", [](PyObject* ptr) {
+        if (PyCapsule_IsValid(ptr, "dltensor")) {
+            // If consumer didn't delete the tensor,
+            if (auto* dlTensor = static_cast<DLManagedTensor*>(PyCapsule_GetPointer(ptr, "dltensor"))) {
+                if (dlTensor->deleter != nullptr) {
+                    dlTensor->deleter(dlTensor);
+                }
+            }
+        }
+    });
+    ctx.release();
+    return cap;
+}
+
+static void CheckDLPackSyncCall(CUresult result, const char* call) {
+    if (result != CUDA_SUCCESS) {
+        const char* name = nullptr;
+        cuGetErrorName(result, &name);
+        throw std::runtime_error(std::string("__dlpack__ stream synchronization failed: ") + call + " returned " +
+                                 (name != nullptr ? name : std::to_string(static_cast<int>(result))));
+    }
+}
+
+void SyncDLPackConsumerStream(const DLDevice& device, CUstream producer, const py::object& stream) {
+    const bool skipSync = !stream.is_none() && stream.cast<int64_t>() == -1;
+    if (device.device_type == kDLCPU || device.device_type == kDLCUDAHost) {
+        if (!stream.is_none() && !skipSync) {
+            throw py::buffer_error("Host memory is not associated with a stream; stream must be None or -1");
+        }
+        if (!skipSync && producer != nullptr) {
+            CheckDLPackSyncCall(cuStreamSynchronize(producer), "cuStreamSynchronize");
+        }
+        return;
+    }
+    if (skipSync) {
+        return;
+    }
+
+    CUstream consumer = CU_STREAM_LEGACY;
+    if (!stream.is_none()) {
+        const int64_t value = stream.cast<int64_t>();
+        if (value == 0) {
+            throw py::buffer_error("stream=0 is ambiguous in DLPack; use 1 (legacy) or 2 (per-thread default)");
+        }
+        consumer = value == 1 ? CU_STREAM_LEGACY
+                              : (value == 2 ? CU_STREAM_PER_THREAD : reinterpret_cast<CUstream>(value));
+    }
+    if (producer == nullptr) {
+        producer = CU_STREAM_LEGACY;
+    }
+    if (consumer == producer) {
+        return;
+    }
+
+    CUevent event = nullptr;
+    CheckDLPackSyncCall(cuEventCreate(&event, CU_EVENT_DISABLE_TIMING), "cuEventCreate");
+    CUresult result = cuEventRecord(event, producer);
+    if (result == CUDA_SUCCESS) {
+        result = cuStreamWaitEvent(consumer, event, 0);
+    }
+    // Destroying the event is deferred by the driver until the wait has completed.
+    cuEventDestroy(event);
+    CheckDLPackSyncCall(result, "cuEventRecord/cuStreamWaitEvent");
+}
@@ -0,0 +1,142 @@
+/*
+ * Copyright (c) 2025, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "DemuxerPool.hpp"
+
+#include <iostream>
+#include <utility>
+
+#include "nvtx3/nvtx3.hpp"
+
+DemuxerPool::DemuxerPool(size_t capacity) : capacity(capacity) {}
+
+void DemuxerPool::Acquire(std::unique_ptr<PyNvGopDemuxer>& demuxer, const std::string& filepath,
+                          const FastStreamInfo* fastStreamInfo) {
+    std::unique_ptr<PyNvGopDemuxer> pooled;
+    {
+        std::lock_guard<std::mutex> lock(mtx);
+        auto it = idle_by_path.find(filepath);
+        if (it != idle_by_path.end()) {
+            pooled = std::move(*it->second);
+            idle.erase(it->second);
+            idle_by_path.erase(it);
+        }
+    }
+
+    if (pooled) {
+        nvtxRangePushA("DemuxerPool_Rewind");
+        const bool rewound = pooled->Rewind();
+        nvtxRangePop();
+        std::lock_guard<std::mutex> lock(mtx);
+        if (rewound) {
+            ++stats.num_reused;
+            demuxer = std::move(pooled);
+            return;
+        }
+        ++stats.num_discarded;
+    }
+    // Close the demuxer which could not be rewound (if any) before opening the file again
+    pooled.reset();
+
+    nvtxRangePushA("DemuxerPool_Open");
+    if (fastStreamInfo) {
+        demuxer.reset(new PyNvGopDemuxer(filepath, fastStreamInfo));
+    } else {
+        demuxer.reset(new PyNvGopDemuxer(filepath));
+    }
+    nvtxRangePop();
+    std::lock_guard<std::mutex> lock(mtx);
+    ++stats.num_opened;
+}
+
+void DemuxerPool::Release(std::unique_ptr<PyNvGopDemuxer> demuxer) {
+    if (!demuxer) {
+        return;
+    }
+    std::vector<std::unique_ptr<PyNvGopDemuxer>> to_close;
+    {
+        std::lock_guard<std::mutex> lock(mtx);
+        if (capacity == 0 || !demuxer->IsValid() || demuxer->HasDemuxError()) {
+            ++stats.num_discarded;
+            to_close.push_back(std::move(demuxer));
+        } else {
+            const std::string& filepath = demuxer->GetFilename();
+            idle.push_front(std::move(demuxer));
+            idle_by_path.emplace(filepath, idle.begin());
+            EvictExcess(to_close);
+        }
+    }
+    // `to_close` is destroyed here, i.e. the files are closed without holding the lock
+}
+
+void DemuxerPool::ReleaseAll(std::vector<std::unique_ptr<PyNvGopDemuxer>>& demuxers) {
+    for (auto& demuxer : demuxers) {
+        Release(std::move(demuxer));
+    }
+    demuxers.clear();
+}
+
+void DemuxerPool::Clear() {
+    IdleList to_close;
+    {
+        std::lock_guard<std::mutex> lock(mtx);
+        idle_by_path.clear();
+        to_close.swap(idle);
+    }
+}
+
+void DemuxerPool::SetCapacity(size_t capacity) {
+    std::vector<std::unique_ptr<PyNvGopDemuxer>> to_close;
+    {
+        std::lock_guard<std::mutex> lock(mtx);
+        this->capacity = capacity;
+        EvictExcess(to_close);
+    }
+}
+
+DemuxerPoolStats DemuxerPool::GetStats() const {
+    std::lock_guard<std::mutex> lock(mtx);
+    DemuxerPoolStats res = stats;
+    res.num_idle = idle.size();
+    res.capacity = capacity;
+    return res;
+}
+
+void DemuxerPool::EvictExcess(std::vector<std::unique_ptr<PyNvGopDemuxer>>& to_close) {
+    while (idle.size() > capacity) {
+        auto last = std::prev(idle.end());
+        auto range = idle_by_path.equal_range((*last)->GetFilename());
+        for (auto it = range.first; it != range.second; ++it) {
+            if (it->second == last) {
+                idle_by_path.erase(it);
+                break;
+            }
+        }
+        to_close.push_back(std::move(*last));
+        idle.erase(last);
+        ++stats.num_evicted;
+    }
+}
+
+DemuxerPool::LeaseGuard::~LeaseGuard() {
+    try {
+        pool.ReleaseAll(demuxers);
+    } catch (const std::exception& e) {
+        // Returning the demuxers is an optimization only; never let it escape from a destructor
+        std::cerr << "[WARNING] Failed to return demuxers to the pool: " << e.what() << std::endl;
+        demuxers.clear();
+    }
+}
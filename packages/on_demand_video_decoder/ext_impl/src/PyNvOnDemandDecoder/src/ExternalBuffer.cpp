@@ -45,11 +45,11 @@ static void CheckValidCUDABuffer(const void* ptr) {
 //}
 
 ExternalBuffer::ExternalBuffer(DLPackTensor&& dlTensor) {
-    if (!IsCudaAccessible(dlTensor->device.device_type)) {
-        throw std::runtime_error("Only CUDA memory buffers can be wrapped");
+    if (!IsCudaAccessible(dlTensor->device.device_type) && !IsHostAccessible(dlTensor->device.device_type)) {
+        throw std::runtime_error("Only CUDA or host memory buffers can be wrapped");
     }
 
-    if (dlTensor->data != nullptr) {
+    if (dlTensor->data != nullptr && IsCudaAccessible(dlTensor->device.device_type)) {
         CheckValidCUDABuffer(dlTensor->data);
     }
 
@@ -75,14 +75,13 @@ py::tuple ExternalBuffer::strides() const {
     return strides;
 }
 
-std::string ExternalBuffer::dtype() const {
-    return std::string("|u1");
-    //return (m_dlTensor->dtype);
-}
+std::string ExternalBuffer::dtype() const { return m_typestr; }
 
 void* ExternalBuffer::data() const { return m_dlTensor->data; }
 
 py::capsule ExternalBuffer::dlpack(py::object stream) const {
+    SyncDLPackConsumerStream(m_dlTensor->device, m_stream, stream);
+
     struct ManagerCtx {
         DLManagedTensor tensor;
         std::shared_ptr<const ExternalBuffer> extBuffer;
@@ -132,22 +131,28 @@ py::tuple ExternalBuffer::dlpackDevice() const {
 const DLTensor& ExternalBuffer::dlTensor() const { return *m_dlTensor; }
 
 void ExternalBuffer::Export(py::module& m) {
+    py::enum_<DLDeviceType>(m, "MemoryDeviceType", py::module_local())
+        .value("CPU", kDLCPU)
+        .value("CUDA", kDLCUDA)
+        .value("CUDAHost", kDLCUDAHost)
+        .value("CUDAManaged", kDLCUDAManaged);
+
     py::class_<ExternalBuffer, std::shared_ptr<ExternalBuffer>>(m, "ExternalBuffer", py::dynamic_attr())
         .def_property_readonly("shape", &ExternalBuffer::shape, "Get the shape of the buffer as an array")
         .def_property_readonly("strides", &ExternalBuffer::strides, "Get the strides of the buffer")
         .def_property_readonly("dtype", &ExternalBuffer::dtype, "Get the data type of the buffer")
-        .def("__dlpack__", &ExternalBuffer::dlpack, "stream"_a = 1, "Export the buffer as a DLPack tensor")
+        .def("__dlpack__", &ExternalBuffer::dlpack, "stream"_a = py::none(), "Export the buffer as a DLPack tensor")
         .def("__dlpack_device__", &ExternalBuffer::dlpackDevice, "Get the device associated with the buffer");
 }
 
 int ExternalBuffer::LoadDLPack(std::vector<size_t> _shape, std::vector<size_t> _stride, std::string _typeStr,
-                               size_t _streamid, CUdeviceptr _data, bool _readOnly) {
+                               size_t _streamid, CUdeviceptr _data, bool _readOnly, DLDeviceType _deviceType,
+                               int _deviceId) {
     m_dlTensor->byte_offset = 0;
 
-    // TODO: infer the device type from the memory buffer
-    m_dlTensor->device.device_type = kDLCUDA;
-    // TODO: infer the device from the memory buffer
-    m_dlTensor->device.device_id = 0;
+    m_dlTensor->device.device_type = _deviceType;
+    m_dlTensor->device.device_id = _deviceId;
+    m_stream = reinterpret_cast<CUstream>(_streamid);
 
     // Convert data
 
@@ -156,16 +161,13 @@ int ExternalBuffer::LoadDLPack(std::vector<size_t> _shape, std::vector<size_t> _
     m_dlTensor->data = ptr;
 
     // Convert DataType
-    if (_typeStr != "|u1" && _typeStr != "B")  // TODO: can also be other letters
-    {
+    try {
+        m_dlTensor->dtype = TypestrToDLDataType(_typeStr);
+    } catch (const std::exception&) {
         throw std::runtime_error("Could not create DL Pack tensor! Invalid typstr: " + _typeStr);
-        return -1;
     }
-    int itemSizeDT = sizeof(uint8_t);  // dt.itemsize()
-
-    m_dlTensor->dtype.code = kDLUInt;
-    m_dlTensor->dtype.bits = 8;
-    m_dlTensor->dtype.lanes = 1;
+    m_typestr = _typeStr;
+    int itemSizeDT = m_dlTensor->dtype.bits / 8;
 
     // Convert ndim
     m_dlTensor->ndim = _shape.size();
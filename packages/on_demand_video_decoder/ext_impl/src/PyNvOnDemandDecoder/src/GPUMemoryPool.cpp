@@ -16,61 +16,34 @@
 
 #include "GPUMemoryPool.hpp"
 
-#include <stdexcept>
-
-#include <cuda.h>
-#include <cuda_runtime.h>
-
-#include "NvCodecUtils.h"
-
-static void cuda_err_check() {
-    const cudaError last_error = cudaGetLastError();
-    if (last_error != cudaError::cudaSuccess) {
-        throw std::runtime_error("Cuda error encountered; Error code: " + std::to_string(last_error));
-    }
+static SegmentedMemoryPoolConfig gpu_memory_pool_config() {
+    SegmentedMemoryPoolConfig config;
+    // Frames are packed without padding (as before the pool was segmented), so that a reservation of the sum
+    // of the frame sizes is sufficient
+    config.alignment = 1;
+    return config;
 }
 
-GPUMemoryPool::GPUMemoryPool(size_t num_bytes_to_store) { EnsureSizeAndSoftReset(num_bytes_to_store, false); }
+GPUMemoryPool::GPUMemoryPool() : pool_(gpu_memory_pool_config()) {}
 
-void* GPUMemoryPool::AddElement(size_t num_bytes) {
-    const size_t size_needed = curr_size_ + num_bytes;
-    if (size_needed > allocated_size_) {
-        throw std::out_of_range(
-            "Memory pool does not have enough allocated "
-            "memory. Allow re-allocating when calling this "
-            "method or pre-allocate enough memory.");
-    }
-    uint8_t* pointer_to_new_element = data_ + curr_size_;
-    curr_size_ += num_bytes;
-    return static_cast<void*>(pointer_to_new_element);
+GPUMemoryPool::GPUMemoryPool(size_t num_bytes_to_store) : GPUMemoryPool() {
+    EnsureSizeAndSoftReset(num_bytes_to_store, false);
 }
 
-void GPUMemoryPool::EnsureSizeAndSoftReset(size_t num_bytes_to_store, bool shrink_if_smaller) {
-    const bool curr_too_small = curr_size_ < num_bytes_to_store;
-    if (curr_too_small || shrink_if_smaller) {
-        if (data_ != nullptr) {
-            cuMemFree(reinterpret_cast<CUdeviceptr>(data_));
-            cuda_err_check();
-        }
-        CUDA_DRVAPI_CALL(cuMemAlloc(reinterpret_cast<CUdeviceptr*>(&data_), num_bytes_to_store));
-        cuda_err_check();
+void* GPUMemoryPool::AddElement(size_t num_bytes) { return pool_.Allocate(num_bytes); }
 
-        allocated_size_ = num_bytes_to_store;
+void GPUMemoryPool::EnsureSizeAndSoftReset(size_t num_bytes_to_store, bool shrink_if_smaller) {
+    if (shrink_if_smaller) {
+        pool_.Release();
     }
-    curr_size_ = 0;
+    pool_.ResetAndReserve(num_bytes_to_store);
 }
 
-void GPUMemoryPool::SoftRelease() { curr_size_ = 0; }
+// Does not call into CUDA, so it can be used in error paths without a current context
+void GPUMemoryPool::SoftRelease() { pool_.Rewind(); }
 
-void GPUMemoryPool::HardRelease() {
-    // Only free if memory was actually allocated
-    // cuMemFree(0) is undefined behavior, unlike free(NULL) in C
-    if (data_ != nullptr) {
-        cuMemFree(reinterpret_cast<CUdeviceptr>(data_));
-    }
-    data_ = nullptr;
-    curr_size_ = 0;
-    allocated_size_ = 0;
-}
+void GPUMemoryPool::HardRelease() { pool_.Release(); }
+
+MemoryPoolStats GPUMemoryPool::GetStats() const { return pool_.GetStats(); }
 
 GPUMemoryPool::~GPUMemoryPool() { HardRelease(); }
@@ -0,0 +1,584 @@
+/*
+ * Copyright (c) 2025, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "GopExtractionDriver.hpp"
+
+#include <algorithm>
+#include <cerrno>
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iomanip>
+#include <sstream>
+#include <stdexcept>
+#include <thread>
+#include <unordered_map>
+#include <utility>
+
+#include <fcntl.h>
+#include <unistd.h>
+
+#include "nvtx3/nvtx3.hpp"
+
+namespace fs = std::filesystem;
+
+namespace {
+
+constexpr const char* kShardPrefix = "gops_";
+constexpr const char* kShardSuffix = ".bin";
+
+void WriteAll(int fd, const void* data, size_t size, const std::string& what) {
+    const char* ptr = static_cast<const char*>(data);
+    while (size > 0) {
+        const ssize_t written = ::write(fd, ptr, size);
+        if (written < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            throw std::runtime_error("[ERROR] Failed to write " + what + ": " + std::strerror(errno));
+        }
+        ptr += written;
+        size -= static_cast<size_t>(written);
+    }
+}
+
+void SyncFile(int fd, const std::string& what) {
+    if (::fdatasync(fd) != 0) {
+        throw std::runtime_error("[ERROR] Failed to flush " + what + ": " + std::strerror(errno));
+    }
+}
+
+// Split `line` at the first `max_fields - 1` tabs (the last field may contain tabs)
+std::vector<std::string> SplitFields(const std::string& line, size_t max_fields) {
+    std::vector<std::string> fields;
+    size_t begin = 0;
+    while (fields.size() + 1 < max_fields) {
+        const size_t end = line.find('\t', begin);
+        if (end == std::string::npos) {
+            break;
+        }
+        fields.push_back(line.substr(begin, end - begin));
+        begin = end + 1;
+    }
+    fields.push_back(line.substr(begin));
+    return fields;
+}
+
+uint64_t ParseUInt(const std::string& field, const std::string& line) {
+    try {
+        size_t pos = 0;
+        const uint64_t value = std::stoull(field, &pos);
+        if (pos == field.size()) {
+            return value;
+        }
+    } catch (const std::exception&) {
+    }
+    throw std::runtime_error("[ERROR] Corrupt GOP index record: " + line);
+}
+
+int ParseInt(const std::string& field, const std::string& line) {
+    try {
+        size_t pos = 0;
+        const int value = std::stoi(field, &pos);
+        if (pos == field.size()) {
+            return value;
+        }
+    } catch (const std::exception&) {
+    }
+    throw std::runtime_error("[ERROR] Corrupt GOP index record: " + line);
+}
+
+}  // namespace
+
+GopExtractionDriver::GopExtractionDriver(const GopExtractionConfig& config)
+    : GopExtractionDriver(config, &GopExtractionDriver::MakeDefaultExtractor) {}
+
+GopExtractionDriver::GopExtractionDriver(const GopExtractionConfig& config,
+                                         std::function<GopExtractor()> extractor_factory)
+    : config(config), extractor_factory(std::move(extractor_factory)) {
+    if (this->config.output_dir.empty()) {
+        throw std::invalid_argument("[ERROR] output_dir must not be empty");
+    }
+    if (this->config.num_workers <= 0) {
+        throw std::invalid_argument("[ERROR] num_workers must be positive");
+    }
+    if (this->config.checkpoint_interval <= 0) {
+        throw std::invalid_argument("[ERROR] checkpoint_interval must be positive");
+    }
+}
+
+GopExtractionDriver::GopExtractor GopExtractionDriver::MakeDefaultExtractor() {
+    // Only the demuxing part of the decoder is used, which does not create a CUDA context. With a single
+    // file per call, the decoder's demuxer pool keeps the file open across the frames of a job.
+    auto decoder = std::make_shared<PyNvGopDecoder>(1, 0, true);
+    return [decoder](const std::string& filepath, const std::vector<int>& frame_ids) {
+        std::vector<int> sorted_frame_ids(frame_ids);
+        std::sort(sorted_frame_ids.begin(), sorted_frame_ids.end());
+        sorted_frame_ids.erase(std::unique(sorted_frame_ids.begin(), sorted_frame_ids.end()),
+                               sorted_frame_ids.end());
+
+        std::vector<ExtractedGop> res;
+        for (const int frame_id : sorted_frame_ids) {
+            // Extract every GOP once, even if several of the requested frames lie in it
+            const bool is_covered = std::any_of(res.begin(), res.end(), [frame_id](const ExtractedGop& gop) {
+                const int first = gop.bundle.first_frame_ids[0];
+                return frame_id >= first && frame_id < first + gop.bundle.gop_lens[0];
+            });
+            if (is_covered) {
+                continue;
+            }
+            auto bundles = decoder->get_gop_list({filepath}, {frame_id});
+            res.push_back({frame_id, std::move(bundles.at(0))});
+        }
+        return res;
+    };
+}
+
+std::string GopExtractionDriver::ShardName(int shard_id) {
+    std::ostringstream ss;
+    ss << kShardPrefix << std::setw(5) << std::setfill('0') << shard_id << kShardSuffix;
+    return ss.str();
+}
+
+uint64_t GopExtractionDriver::ManifestFingerprint(const std::vector<std::string>& filepaths,
+                                                  const std::vector<std::vector<int>>& frame_ids) {
+    // 64-bit FNV-1a over the file paths and frame ids of all jobs
+    uint64_t hash = 14695981039346656037ull;
+    auto update = [&hash](const void* data, size_t size) {
+        const uint8_t* bytes = static_cast<const uint8_t*>(data);
+        for (size_t i = 0; i < size; ++i) {
+            hash = (hash ^ bytes[i]) * 1099511628211ull;
+        }
+    };
+    for (size_t i = 0; i < filepaths.size(); ++i) {
+        update(filepaths[i].data(), filepaths[i].size() + 1);  // Including the terminating '\0'
+        const uint64_t num_frames = frame_ids[i].size();
+        update(&num_frames, sizeof(num_frames));
+        update(frame_ids[i].data(), frame_ids[i].size() * sizeof(int));
+    }
+    return hash;
+}
+
+GopExtractionDriver::ResumeState GopExtractionDriver::ParseIndex(const std::string& index_path,
+                                                                 std::vector<GopIndexRecord>* records) {
+    ResumeState state;
+    std::ifstream file(index_path, std::ios::binary);
+    if (!file.is_open()) {
+        return state;
+    }
+    const std::string content((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+
+    // GOP records of jobs whose `J` record has not been seen yet
+    std::unordered_map<uint64_t, std::vector<GopIndexRecord>> open_jobs;
+    size_t pos = 0;
+    while (pos < content.size()) {
+        const size_t end = content.find('\n', pos);
+        if (end == std::string::npos) {
+            break;  // Incomplete last record (interrupted write)
+        }
+        const std::string line = content.substr(pos, end - pos);
+        pos = end + 1;
+
+        if (!state.has_header) {
+            const auto fields = SplitFields(line, 3);
+            if (fields.size() != 3 || fields[0] != "M") {
+                throw std::runtime_error("[ERROR] Invalid GOP index header in " + index_path);
+            }
+            state.has_header = true;
+            state.num_jobs = ParseUInt(fields[1], line);
+            state.fingerprint = ParseUInt(fields[2], line);
+            state.completed.assign(state.num_jobs, false);
+            state.valid_index_size = pos;
+            continue;
+        }
+
+        // Records are only appended after a checkpoint's data is on disk, so a malformed record can only be
+        // part of an interrupted write at the end of the file; stop there
+        try {
+            if (line.compare(0, 2, "G\t") == 0) {
+                const auto fields = SplitFields(line, 9);
+                if (fields.size() != 9) {
+                    throw std::runtime_error("[ERROR] Corrupt GOP index record: " + line);
+                }
+                GopIndexRecord record;
+                record.job_id = ParseUInt(fields[1], line);
+                record.frame_id = ParseInt(fields[2], line);
+                record.first_frame_id = ParseInt(fields[3], line);
+                record.gop_len = ParseInt(fields[4], line);
+                record.shard = fields[5];
+                record.offset = ParseUInt(fields[6], line);
+                record.size = ParseUInt(fields[7], line);
+                record.filepath = fields[8];
+                open_jobs[record.job_id].push_back(std::move(record));
+            } else if (line.compare(0, 2, "J\t") == 0) {
+                const auto fields = SplitFields(line, 3);
+                if (fields.size() != 3) {
+                    throw std::runtime_error("[ERROR] Corrupt GOP index record: " + line);
+                }
+                const uint64_t job_id = ParseUInt(fields[1], line);
+                const uint64_t num_gops = ParseUInt(fields[2], line);
+                auto gops = std::move(open_jobs[job_id]);
+                open_jobs.erase(job_id);
+                if (job_id >= state.num_jobs || gops.size() != num_gops) {
+                    throw std::runtime_error("[ERROR] Corrupt GOP index record: " + line);
+                }
+                state.completed[job_id] = true;
+                for (auto& record : gops) {
+                    uint64_t& shard_end = state.shard_ends[record.shard];
+                    shard_end = std::max(shard_end, record.offset + record.size);
+                    if (records) {
+                        records->push_back(std::move(record));
+                    }
+                }
+                state.valid_index_size = pos;
+            } else {
+                throw std::runtime_error("[ERROR] Corrupt GOP index record: " + line);
+            }
+        } catch (const std::runtime_error& e) {
+            LOG(WARNING) << "Ignoring GOP index records after an interrupted write: " << e.what();
+            break;
+        }
+    }
+    return state;
+}
+
+std::vector<GopIndexRecord> GopExtractionDriver::ReadIndex(const std::string& output_dir) {
+    const std::string index_path = (fs::path(output_dir) / kIndexFileName).string();
+    if (!fs::exists(index_path)) {
+        throw std::invalid_argument("[ERROR] No GOP index found in: " + output_dir);
+    }
+    std::vector<GopIndexRecord> records;
+    ParseIndex(index_path, &records);
+    return records;
+}
+
+GopExtractionStats GopExtractionDriver::GetStats() const {
+    std::lock_guard<std::mutex> lock(stats_mtx);
+    GopExtractionStats res = stats;
+    if (running) {
+        res.elapsed_s = std::chrono::duration<double>(std::chrono::steady_clock::now() - start_time).count();
+    }
+    return res;
+}
+
+void GopExtractionDriver::LogProgress(bool force) {
+    if (config.progress_interval_s <= 0) {
+        return;
+    }
+    const auto now = std::chrono::steady_clock::now();
+    const double since_last_progress = std::chrono::duration<double>(now - last_progress_time).count();
+    if (!force && since_last_progress < config.progress_interval_s) {
+        return;
+    }
+    last_progress_time = now;
+
+    const GopExtractionStats current = GetStats();
+    const double elapsed = std::max(current.elapsed_s, 1e-9);
+    const uint64_t num_finished = current.num_jobs_resumed + current.num_jobs_done;
+    LOG(INFO) << "[GopExtraction] jobs " << num_finished << "/" << current.num_jobs << " (resumed "
+              << current.num_jobs_resumed << ", failed " << current.num_jobs_failed << "), gops "
+              << current.num_gops << ", " << std::fixed << std::setprecision(1)
+              << current.num_bytes / (1024.0 * 1024.0) << " MB, " << current.num_jobs_done / elapsed
+              << " jobs/s, " << current.num_bytes / (1024.0 * 1024.0) / elapsed << " MB/s";
+}
+
+GopExtractionStats GopExtractionDriver::Run(const std::vector<std::string>& filepaths,
+                                            const std::vector<std::vector<int>>& frame_ids) {
+    if (filepaths.size() != frame_ids.size()) {
+        throw std::invalid_argument("[ERROR] filepaths and frame_ids must have the same length");
+    }
+    for (const auto& filepath : filepaths) {
+        if (filepath.find('\n') != std::string::npos) {
+            throw std::invalid_argument("[ERROR] File paths must not contain newlines: " + filepath);
+        }
+    }
+    nvtxRangePushA("GopExtractionDriver_Run");
+
+    fs::create_directories(config.output_dir);
+    const fs::path output_dir(config.output_dir);
+    const std::string index_path = (output_dir / kIndexFileName).string();
+    const uint64_t fingerprint = ManifestFingerprint(filepaths, frame_ids);
+
+    // Recover the state of a previous run and drop everything written after its last checkpoint
+    ResumeState resume = ParseIndex(index_path, nullptr);
+    if (resume.has_header && (resume.num_jobs != filepaths.size() || resume.fingerprint != fingerprint)) {
+        nvtxRangePop();
+        throw std::invalid_argument("[ERROR] The output directory " + config.output_dir +
+                                    " contains the results of a different manifest");
+    }
+    shard_id = 0;
+    for (const auto& entry : fs::directory_iterator(output_dir)) {
+        const std::string name = entry.path().filename().string();
+        if (name.rfind(kShardPrefix, 0) != 0 || entry.path().extension() != kShardSuffix) {
+            continue;
+        }
+        const auto it = resume.shard_ends.find(name);
+        if (it == resume.shard_ends.end()) {
+            fs::remove(entry.path());
+        } else {
+            fs::resize_file(entry.path(), it->second);
+        }
+    }
+    for (const auto& shard_end : resume.shard_ends) {
+        const std::string& name = shard_end.first;
+        const int id = std::stoi(name.substr(std::strlen(kShardPrefix)));
+        shard_id = std::max(shard_id, id + 1);
+    }
+
+    index_fd = ::open(index_path.c_str(), O_WRONLY | O_CREAT, 0644);
+    if (index_fd < 0) {
+        nvtxRangePop();
+        throw std::runtime_error("[ERROR] Failed to open GOP index " + index_path + ": " +
+                                 std::strerror(errno));
+    }
+    if (::ftruncate(index_fd, resume.has_header ? resume.valid_index_size : 0) != 0 ||
+        ::lseek(index_fd, 0, SEEK_END) < 0) {
+        ::close(index_fd);
+        index_fd = -1;
+        nvtxRangePop();
+        throw std::runtime_error("[ERROR] Failed to truncate GOP index " + index_path);
+    }
+    if (!resume.has_header) {
+        const std::string header =
+            "M\t" + std::to_string(filepaths.size()) + "\t" + std::to_string(fingerprint) + "\n";
+        WriteAll(index_fd, header.data(), header.size(), "GOP index");
+        SyncFile(index_fd, "GOP index");
+    }
+
+    std::vector<uint64_t> pending_jobs;
+    for (uint64_t i = 0; i < filepaths.size(); ++i) {
+        if (!resume.has_header || !resume.completed[i]) {
+            pending_jobs.push_back(i);
+        }
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(stats_mtx);
+        stats = GopExtractionStats();
+        stats.num_jobs = filepaths.size();
+        stats.num_jobs_resumed = filepaths.size() - pending_jobs.size();
+        start_time = std::chrono::steady_clock::now();
+        last_progress_time = start_time;
+        running = true;
+    }
+    stop_requested = false;
+    next_pending_job = 0;
+    run_error = nullptr;
+    queue.clear();
+    pending_bytes = 0;
+    shard_fd = -1;
+    shard_offset = 0;
+
+    const int num_workers =
+        static_cast<int>(std::min<size_t>(config.num_workers, std::max<size_t>(pending_jobs.size(), 1)));
+    num_active_workers = num_workers;
+    std::thread writer(&GopExtractionDriver::WriterLoop, this, std::cref(filepaths));
+    std::vector<std::thread> workers;
+    workers.reserve(num_workers);
+    for (int i = 0; i < num_workers; ++i) {
+        workers.emplace_back(&GopExtractionDriver::WorkerLoop, this, std::cref(filepaths),
+                             std::cref(frame_ids), std::cref(pending_jobs));
+    }
+    for (auto& worker : workers) {
+        worker.join();
+    }
+    writer.join();
+
+    if (shard_fd >= 0) {
+        ::close(shard_fd);
+        shard_fd = -1;
+    }
+    ::close(index_fd);
+    index_fd = -1;
+
+    {
+        std::lock_guard<std::mutex> lock(stats_mtx);
+        const auto now = std::chrono::steady_clock::now();
+        stats.elapsed_s = std::chrono::duration<double>(now - start_time).count();
+        running = false;
+    }
+    LogProgress(true);
+    nvtxRangePop();  // GopExtractionDriver_Run
+
+    if (run_error) {
+        std::rethrow_exception(run_error);
+    }
+    return GetStats();
+}
+
+void GopExtractionDriver::WorkerLoop(const std::vector<std::string>& filepaths,
+                                     const std::vector<std::vector<int>>& frame_ids,
+                                     const std::vector<uint64_t>& pending_jobs) {
+    GopExtractor extractor;
+    try {
+        extractor = extractor_factory();
+    } catch (const std::exception& e) {
+        LOG(ERROR) << "Failed to create GOP extractor: " << e.what();
+        SetRunError(std::current_exception());
+    }
+
+    while (!stop_requested) {
+        const uint64_t idx = next_pending_job++;
+        if (idx >= pending_jobs.size()) {
+            break;
+        }
+        ExtractedJob job;
+        job.job_id = pending_jobs[idx];
+        try {
+            job.gops = extractor(filepaths[job.job_id], frame_ids[job.job_id]);
+        } catch (const std::exception& e) {
+            std::lock_guard<std::mutex> lock(stats_mtx);
+            ++stats.num_jobs_failed;
+            stats.failed_jobs.emplace_back(job.job_id, e.what());
+            continue;
+        }
+        for (const auto& gop : job.gops) {
+            job.num_bytes += gop.bundle.size;
+        }
+
+        // Backpressure: wait while too much data is waiting to be written (a single job is always accepted)
+        std::unique_lock<std::mutex> lock(queue_mtx);
+        queue_not_full.wait(lock, [this] {
+            return queue.empty() || pending_bytes < config.max_pending_bytes || run_error != nullptr;
+        });
+        if (run_error) {
+            break;
+        }
+        pending_bytes += job.num_bytes;
+        queue.push_back(std::move(job));
+        queue_not_empty.notify_one();
+    }
+
+    std::lock_guard<std::mutex> lock(queue_mtx);
+    --num_active_workers;
+    queue_not_empty.notify_one();
+}
+
+void GopExtractionDriver::OpenNextShard() {
+    if (shard_fd >= 0) {
+        SyncFile(shard_fd, ShardName(shard_id - 1));
+        ::close(shard_fd);
+    }
+    const std::string path = (fs::path(config.output_dir) / ShardName(shard_id)).string();
+    shard_fd = ::open(path.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644);
+    if (shard_fd < 0) {
+        throw std::runtime_error("[ERROR] Failed to open GOP shard " + path + ": " + std::strerror(errno));
+    }
+    ++shard_id;
+    shard_offset = 0;
+}
+
+void GopExtractionDriver::WriteJob(const ExtractedJob& job, const std::string& filepath,
+                                   std::string& index_buffer) {
+    if (shard_fd < 0 || shard_offset >= config.shard_size_bytes) {
+        OpenNextShard();
+    }
+    const std::string shard = ShardName(shard_id - 1);
+    for (const auto& gop : job.gops) {
+        WriteAll(shard_fd, gop.bundle.data.get(), gop.bundle.size, "GOP shard " + shard);
+        index_buffer += "G\t" + std::to_string(job.job_id) + "\t" + std::to_string(gop.frame_id) + "\t" +
+                        std::to_string(gop.bundle.first_frame_ids.at(0)) + "\t" +
+                        std::to_string(gop.bundle.gop_lens.at(0)) + "\t" + shard + "\t" +
+                        std::to_string(shard_offset) + "\t" + std::to_string(gop.bundle.size) + "\t" +
+                        filepath + "\n";
+        shard_offset += gop.bundle.size;
+    }
+    index_buffer += "J\t" + std::to_string(job.job_id) + "\t" + std::to_string(job.gops.size()) + "\n";
+}
+
+void GopExtractionDriver::Checkpoint(std::string& index_buffer, uint64_t num_jobs, uint64_t num_gops,
+                                     uint64_t num_bytes) {
+    if (index_buffer.empty()) {
+        return;
+    }
+    nvtxRangePushA("GopExtractionDriver_Checkpoint");
+    // The data must be on disk before the index records referring to it
+    if (shard_fd >= 0) {
+        SyncFile(shard_fd, ShardName(shard_id - 1));
+    }
+    WriteAll(index_fd, index_buffer.data(), index_buffer.size(), "GOP index");
+    SyncFile(index_fd, "GOP index");
+    index_buffer.clear();
+    nvtxRangePop();
+
+    std::lock_guard<std::mutex> lock(stats_mtx);
+    stats.num_jobs_done += num_jobs;
+    stats.num_gops += num_gops;
+    stats.num_bytes += num_bytes;
+}
+
+void GopExtractionDriver::WriterLoop(const std::vector<std::string>& filepaths) {
+    // Completed jobs are checkpointed in groups, or once no new job arrived for this long
+    constexpr auto kIdleCheckpointDelay = std::chrono::seconds(1);
+
+    std::string index_buffer;
+    uint64_t num_jobs = 0;
+    uint64_t num_gops = 0;
+    uint64_t num_bytes = 0;
+    try {
+        while (true) {
+            ExtractedJob job;
+            {
+                std::unique_lock<std::mutex> lock(queue_mtx);
+                auto has_work = [this] { return !queue.empty() || num_active_workers == 0; };
+                if (num_jobs > 0 && !queue_not_empty.wait_for(lock, kIdleCheckpointDelay, has_work)) {
+                    lock.unlock();
+                    Checkpoint(index_buffer, num_jobs, num_gops, num_bytes);
+                    num_jobs = num_gops = num_bytes = 0;
+                    lock.lock();
+                }
+                queue_not_empty.wait(lock, has_work);
+                if (queue.empty()) {
+                    break;  // All workers finished
+                }
+                job = std::move(queue.front());
+                queue.pop_front();
+            }
+
+            WriteJob(job, filepaths[job.job_id], index_buffer);
+            ++num_jobs;
+            num_gops += job.gops.size();
+            num_bytes += job.num_bytes;
+            if (num_jobs >= static_cast<uint64_t>(config.checkpoint_interval)) {
+                Checkpoint(index_buffer, num_jobs, num_gops, num_bytes);
+                num_jobs = num_gops = num_bytes = 0;
+            }
+
+            // Only release the backpressure once the data is written
+            {
+                std::lock_guard<std::mutex> lock(queue_mtx);
+                pending_bytes -= job.num_bytes;
+            }
+            queue_not_full.notify_all();
+            LogProgress(false);
+        }
+        Checkpoint(index_buffer, num_jobs, num_gops, num_bytes);
+    } catch (const std::exception& e) {
+        LOG(ERROR) << "GOP extraction writer failed: " << e.what();
+        SetRunError(std::current_exception());
+    }
+}
+
+void GopExtractionDriver::SetRunError(std::exception_ptr error) {
+    stop_requested = true;
+    std::lock_guard<std::mutex> lock(queue_mtx);
+    if (!run_error) {
+        run_error = error;
+    }
+    queue.clear();
+    queue_not_full.notify_all();
+}
@@ -0,0 +1,110 @@
+/*
+ * Copyright (c) 2025, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "GopIndexSidecar.hpp"
+
+#include <algorithm>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <iomanip>
+#include <sstream>
+#include <stdexcept>
+
+namespace {
+
+std::string JsonString(const std::string& value) {
+    std::ostringstream out;
+    out << '"';
+    for (const char c : value) {
+        switch (c) {
+            case '"':
+                out << "\\\"";
+                break;
+            case '\\':
+                out << "\\\\";
+                break;
+            case '\n':
+                out << "\\n";
+                break;
+            case '\t':
+                out << "\\t";
+                break;
+            default:
+                if (static_cast<unsigned char>(c) < 0x20) {
+                    char buf[8];
+                    std::snprintf(buf, sizeof(buf), "\\u%04x", c);
+                    out << buf;
+                } else {
+                    out << c;
+                }
+        }
+    }
+    out << '"';
+    return out.str();
+}
+
+}  // namespace
+
+void GopIndexSidecar::AddMetadata(const std::string& key, int value) {
+    metadata.emplace_back(key, std::to_string(value));
+}
+
+void GopIndexSidecar::AddMetadata(const std::string& key, double value) {
+    std::ostringstream out;
+    out << std::setprecision(17) << value;
+    metadata.emplace_back(key, out.str());
+}
+
+void GopIndexSidecar::AddMetadata(const std::string& key, bool value) {
+    metadata.emplace_back(key, value ? "true" : "false");
+}
+
+void GopIndexSidecar::AddMetadata(const std::string& key, const std::string& value) {
+    metadata.emplace_back(key, JsonString(value));
+}
+
+void GopIndexSidecar::Write(const std::string& video_path) const {
+    std::vector<int> keyframes = keyframe_ids;
+    std::sort(keyframes.begin(), keyframes.end());
+
+    std::ostringstream json;
+    json << "{\n";
+    for (const auto& field : metadata) {
+        json << "  " << JsonString(field.first) << ": " << field.second << ",\n";
+    }
+    json << "  \"num_frames\": " << num_frames << ",\n  \"keyframe_ids\": [";
+    for (size_t i = 0; i < keyframes.size(); ++i) {
+        json << (i > 0 ? ", " : "") << keyframes[i];
+    }
+    json << "],\n  \"gop_lens\": [";
+    for (size_t i = 0; i < keyframes.size(); ++i) {
+        const int gop_end = i + 1 < keyframes.size() ? keyframes[i + 1] : num_frames;
+        json << (i > 0 ? ", " : "") << gop_end - keyframes[i];
+    }
+    json << "]\n}\n";
+
+    const std::string path = PathFor(video_path);
+    const std::string tmp_path = path + ".tmp";
+    {
+        std::ofstream file(tmp_path, std::ios::trunc);
+        file << json.str();
+        if (!file) {
+            throw std::runtime_error("[ERROR] Failed to write GOP index: " + tmp_path);
+        }
+    }
+    std::filesystem::rename(tmp_path, path);
+}
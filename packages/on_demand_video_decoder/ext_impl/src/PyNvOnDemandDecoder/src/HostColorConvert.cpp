@@ -0,0 +1,192 @@
+/*
+ * Copyright (c) 2025, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "HostColorConvert.hpp"
+
+#include <algorithm>
+#include <vector>
+
+#if defined(__SSE2__) || defined(_M_X64)
+#define HOST_COLOR_CONVERT_SSE2 1
+#include <emmintrin.h>
+#endif
+
+namespace {
+
+// 4x4 Bayer matrix scaled to [0, 256), centered in each bucket.
+constexpr uint16_t kBayer4x4[4][4] = {
+    {8, 136, 40, 168},
+    {200, 72, 232, 104},
+    {56, 184, 24, 152},
+    {248, 120, 216, 88},
+};
+
+inline uint16_t GetRoundingBias(BitDepthRounding rounding, int x, int y) {
+    switch (rounding) {
+        case BitDepthRounding::Round:
+            return 128;
+        case BitDepthRounding::Dither:
+            return kBayer4x4[y & 3][x & 3];
+        default:
+            return 0;
+    }
+}
+
+inline uint8_t ReduceSample(uint16_t v, uint16_t bias) {
+    const uint32_t biased = std::min<uint32_t>(0xFFFFu, static_cast<uint32_t>(v) + bias);
+    return static_cast<uint8_t>(biased >> 8);
+}
+
+/*
+ * Reduce one row of `count` 16-bit samples. The bias pattern repeats every 4 samples, so an
+ * 8-lane SSE2 register holds two periods as long as the row starts at x = 0.
+ */
+void ReduceRow(const uint16_t* src, uint8_t* dst, int count, int y, BitDepthRounding rounding) {
+    int x = 0;
+#ifdef HOST_COLOR_CONVERT_SSE2
+    const __m128i bias =
+        _mm_setr_epi16(GetRoundingBias(rounding, 0, y), GetRoundingBias(rounding, 1, y),
+                       GetRoundingBias(rounding, 2, y), GetRoundingBias(rounding, 3, y),
+                       GetRoundingBias(rounding, 4, y), GetRoundingBias(rounding, 5, y),
+                       GetRoundingBias(rounding, 6, y), GetRoundingBias(rounding, 7, y));
+    for (; x + 16 <= count; x += 16) {
+        __m128i lo = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + x));
+        __m128i hi = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + x + 8));
+        lo = _mm_srli_epi16(_mm_adds_epu16(lo, bias), 8);
+        hi = _mm_srli_epi16(_mm_adds_epu16(hi, bias), 8);
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + x), _mm_packus_epi16(lo, hi));
+    }
+#endif
+    for (; x < count; x++) {
+        dst[x] = ReduceSample(src[x], GetRoundingBias(rounding, x, y));
+    }
+}
+
+void ExpandRow(const uint8_t* src, uint16_t* dst, int count) {
+    int x = 0;
+#ifdef HOST_COLOR_CONVERT_SSE2
+    const __m128i zero = _mm_setzero_si128();
+    for (; x + 16 <= count; x += 16) {
+        const __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + x));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + x), _mm_unpacklo_epi8(zero, v));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + x + 8), _mm_unpackhi_epi8(zero, v));
+    }
+#endif
+    for (; x < count; x++) {
+        dst[x] = static_cast<uint16_t>(src[x]) << 8;
+    }
+}
+
+inline int DescaleClamp(int x) {
+    constexpr int shift = 20;
+    return std::min(255, std::max(0, (x + (1 << (shift - 1))) >> shift));
+}
+
+// Same fixed-point BT.601 limited range conversion as yuv42xxp_to_rgb_kernel().
+inline void YuvToRgbLimited(int Y, int U, int V, uint8_t& r, uint8_t& g, uint8_t& b) {
+    constexpr int C0 = 1220542, C1 = 1673527, C2 = -852492, C3 = -409993, C4 = 2116026;
+    const int yy = std::max(0, Y - 16) * C0;
+    const int uu = U - 128;
+    const int vv = V - 128;
+    r = static_cast<uint8_t>(DescaleClamp(yy + C1 * vv));
+    g = static_cast<uint8_t>(DescaleClamp(yy + C2 * vv + C3 * uu));
+    b = static_cast<uint8_t>(DescaleClamp(yy + C4 * uu));
+}
+
+// Same full range conversion as yuv42xxp_to_rgb_kernel_full_range().
+inline void YuvToRgbFull(int Y, int U, int V, uint8_t& r, uint8_t& g, uint8_t& b) {
+    constexpr float C0 = 1048230.1882352941f;
+    constexpr float C1 = 1470078.6196078432f;
+    constexpr float C2 = -748855.7176470588f;
+    constexpr float C3 = -360150.7137254902f;
+    constexpr float C4 = 1858783.6235294119f;
+    const float yy = std::max(0.0f, static_cast<float>(Y)) * C0;
+    const float uu = static_cast<float>(U) - 127.5f;
+    const float vv = static_cast<float>(V) - 127.5f;
+    r = static_cast<uint8_t>(DescaleClamp(static_cast<int32_t>(yy + C1 * vv + 0.5f)));
+    g = static_cast<uint8_t>(DescaleClamp(static_cast<int32_t>(yy + C2 * vv + C3 * uu + 0.5f)));
+    b = static_cast<uint8_t>(DescaleClamp(static_cast<int32_t>(yy + C4 * uu + 0.5f)));
+}
+
+void Nv12RowToRgb(const uint8_t* y_row, const uint8_t* uv_row, uint8_t* dst, int width, bool is_full_range,
+                  bool as_bgr) {
+    const int r_idx = as_bgr ? 2 : 0;
+    const int b_idx = as_bgr ? 0 : 2;
+    for (int x = 0; x < width; x++) {
+        const int x_uv = x & ~1;
+        uint8_t r, g, b;
+        if (is_full_range) {
+            YuvToRgbFull(y_row[x], uv_row[x_uv], uv_row[x_uv + 1], r, g, b);
+        } else {
+            YuvToRgbLimited(y_row[x], uv_row[x_uv], uv_row[x_uv + 1], r, g, b);
+        }
+        uint8_t* pixel = dst + 3 * x;
+        pixel[r_idx] = r;
+        pixel[1] = g;
+        pixel[b_idx] = b;
+    }
+}
+
+template <typename T>
+inline const T* RowPtr(const T* base, size_t pitch, int row) {
+    return reinterpret_cast<const T*>(reinterpret_cast<const uint8_t*>(base) + pitch * row);
+}
+
+template <typename T>
+inline T* RowPtr(T* base, size_t pitch, int row) {
+    return reinterpret_cast<T*>(reinterpret_cast<uint8_t*>(base) + pitch * row);
+}
+
+}  // namespace
+
+void convert_uint16_to_uint8_host(const uint16_t* src, size_t src_pitch, uint8_t* dst, size_t dst_pitch,
+                                  int width, int height, BitDepthRounding rounding) {
+    for (int row = 0; row < height; row++) {
+        ReduceRow(RowPtr(src, src_pitch, row), RowPtr(dst, dst_pitch, row), width, row, rounding);
+    }
+}
+
+void convert_uint8_to_uint16_host(const uint8_t* src, size_t src_pitch, uint16_t* dst, size_t dst_pitch,
+                                  int width, int height) {
+    for (int row = 0; row < height; row++) {
+        ExpandRow(RowPtr(src, src_pitch, row), RowPtr(dst, dst_pitch, row), width);
+    }
+}
+
+void convert_nv12_to_rgb_host(const uint8_t* y, size_t y_pitch, const uint8_t* uv, size_t uv_pitch,
+                              uint8_t* dst, size_t dst_pitch, int width, int height, bool is_full_range,
+                              bool as_bgr) {
+    for (int row = 0; row < height; row++) {
+        Nv12RowToRgb(RowPtr(y, y_pitch, row), RowPtr(uv, uv_pitch, row / 2), RowPtr(dst, dst_pitch, row),
+                     width, is_full_range, as_bgr);
+    }
+}
+
+void convert_p016_to_rgb_host(const uint16_t* y, size_t y_pitch, const uint16_t* uv, size_t uv_pitch,
+                              uint8_t* dst, size_t dst_pitch, int width, int height, bool is_full_range,
+                              bool as_bgr, BitDepthRounding rounding) {
+    // The interleaved UV row holds `width` samples (rounded up for odd widths).
+    const int uv_count = (width + 1) & ~1;
+    std::vector<uint8_t> y_row(width);
+    std::vector<uint8_t> uv_row(uv_count);
+    for (int row = 0; row < height; row++) {
+        ReduceRow(RowPtr(y, y_pitch, row), y_row.data(), width, row, rounding);
+        if ((row & 1) == 0) {
+            ReduceRow(RowPtr(uv, uv_pitch, row / 2), uv_row.data(), uv_count, row / 2, rounding);
+        }
+        Nv12RowToRgb(y_row.data(), uv_row.data(), RowPtr(dst, dst_pitch, row), width, is_full_range, as_bgr);
+    }
+}
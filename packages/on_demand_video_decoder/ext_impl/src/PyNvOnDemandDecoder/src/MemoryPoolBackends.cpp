@@ -0,0 +1,46 @@
+/*
+ * Copyright (c) 2025, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "MemoryPoolBackends.hpp"
+
+#include <cuda.h>
+
+#include "NvCodecUtils.h"
+
+void* PinnedHostAllocator::Allocate(size_t num_bytes) {
+    void* ptr = nullptr;
+    CUDA_DRVAPI_CALL(cuMemAllocHost(&ptr, num_bytes));
+    return ptr;
+}
+
+void PinnedHostAllocator::Free(void* ptr) {
+    if (ptr != nullptr) {
+        cuMemFreeHost(ptr);
+    }
+}
+
+void* CudaDeviceAllocator::Allocate(size_t num_bytes) {
+    CUdeviceptr ptr = 0;
+    CUDA_DRVAPI_CALL(cuMemAlloc(&ptr, num_bytes));
+    return reinterpret_cast<void*>(ptr);
+}
+
+void CudaDeviceAllocator::Free(void* ptr) {
+    // cuMemFree(0) is undefined behavior, unlike free(NULL) in C
+    if (ptr != nullptr) {
+        cuMemFree(reinterpret_cast<CUdeviceptr>(ptr));
+    }
+}
@@ -0,0 +1,171 @@
+/*
+ * Copyright (c) 2025, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "MultiStreamTimestampIndex.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <memory>
+#include <numeric>
+#include <stdexcept>
+
+#include "FFmpegDemuxer.h"
+#include "nvtx3/nvtx3.hpp"
+
+int MultiStreamTimestampIndex::AddStream(const std::string& filepath, const std::vector<double>& timestamps,
+                                         double offset) {
+    for (size_t i = 0; i < timestamps.size(); ++i) {
+        if (!std::isfinite(timestamps[i])) {
+            throw std::invalid_argument("[ERROR] Timestamp of frame " + std::to_string(i) + " of " + filepath +
+                                        " is not finite");
+        }
+    }
+
+    std::vector<int> order(timestamps.size());
+    std::iota(order.begin(), order.end(), 0);
+    std::stable_sort(order.begin(), order.end(),
+                     [&timestamps](int a, int b) { return timestamps[a] < timestamps[b]; });
+
+    times.reserve(times.size() + order.size());
+    frame_ids.reserve(frame_ids.size() + order.size());
+    for (const int frame_id : order) {
+        times.push_back(timestamps[frame_id] + offset);
+        frame_ids.push_back(frame_id);
+    }
+    filepaths.push_back(filepath);
+    stream_begin.push_back(times.size());
+    return static_cast<int>(filepaths.size()) - 1;
+}
+
+int MultiStreamTimestampIndex::AddStreamFromFile(const std::string& filepath, double offset) {
+    return AddStream(filepath, ScanFrameTimestamps(filepath), offset);
+}
+
+std::vector<double> MultiStreamTimestampIndex::ScanFrameTimestamps(const std::string& filepath) {
+    nvtxRangePushA("ScanFrameTimestamps");
+    std::unique_ptr<FFmpegDemuxer> demuxer(new FFmpegDemuxer(filepath.c_str()));
+    if (!demuxer->IsValid()) {
+        nvtxRangePop();
+        throw std::invalid_argument("[ERROR] Failed to open video file: " + filepath);
+    }
+
+    // Same frame numbering as PyNvVideoReader::parse_keyframe_idx: frame ids are assigned in pts order
+    std::vector<int64_t> pts_list;
+    int nVideoBytes = 0;
+    uint8_t* pVideo = nullptr;
+    int64_t pts = 0;
+    do {
+        const bool ret = demuxer->Demux(&pVideo, &nVideoBytes, &pts);
+        if (!ret && demuxer->HasDemuxError()) {
+            nvtxRangePop();
+            throw std::invalid_argument("[ERROR] Demux error for file: " + filepath + ": " +
+                                        demuxer->GetLastDemuxError());
+        }
+        if (nVideoBytes) {
+            if (pts == AV_NOPTS_VALUE) {
+                nvtxRangePop();
+                throw std::invalid_argument("[ERROR] Video file contains packets without timestamps: " +
+                                            filepath);
+            }
+            pts_list.push_back(pts);
+        }
+    } while (nVideoBytes);
+    std::sort(pts_list.begin(), pts_list.end());
+
+    std::vector<double> timestamps;
+    timestamps.reserve(pts_list.size());
+    for (const int64_t frame_pts : pts_list) {
+        timestamps.push_back(demuxer->TimeFromTs(frame_pts - pts_list.front()));
+    }
+    nvtxRangePop();
+    return timestamps;
+}
+
+void MultiStreamTimestampIndex::CheckStreamId(int stream_id) const {
+    if (stream_id < 0 || static_cast<size_t>(stream_id) >= filepaths.size()) {
+        throw std::out_of_range("[ERROR] Stream id " + std::to_string(stream_id) + " out of range [0, " +
+                                std::to_string(filepaths.size()) + ")");
+    }
+}
+
+size_t MultiStreamTimestampIndex::GetNumFrames(int stream_id) const {
+    CheckStreamId(stream_id);
+    return stream_begin[stream_id + 1] - stream_begin[stream_id];
+}
+
+std::vector<double> MultiStreamTimestampIndex::GetTimestamps(int stream_id) const {
+    CheckStreamId(stream_id);
+    std::vector<double> res(GetNumFrames(stream_id));
+    for (size_t i = stream_begin[stream_id]; i < stream_begin[stream_id + 1]; ++i) {
+        res[frame_ids[i]] = times[i];
+    }
+    return res;
+}
+
+void MultiStreamTimestampIndex::AppendNearest(double t, double max_distance, StreamFrameSelection& res) const {
+    for (size_t stream = 0; stream < filepaths.size(); ++stream) {
+        const auto begin = times.begin() + stream_begin[stream];
+        const auto end = times.begin() + stream_begin[stream + 1];
+        if (begin == end) {
+            continue;
+        }
+        // First entry not before `t`; the nearest entry is either this one or its predecessor
+        auto it = std::lower_bound(begin, end, t);
+        if (it == end || (it != begin && t - *(it - 1) <= *it - t)) {
+            --it;
+        }
+        if (std::abs(*it - t) > max_distance) {
+            continue;
+        }
+        res.filepaths.push_back(filepaths[stream]);
+        res.frame_ids.push_back(frame_ids[it - times.begin()]);
+        res.stream_ids.push_back(static_cast<int>(stream));
+    }
+}
+
+StreamFrameSelection MultiStreamTimestampIndex::FindNearest(double t, double max_distance) const {
+    StreamFrameSelection res;
+    AppendNearest(t, max_distance, res);
+    return res;
+}
+
+StreamFrameSelection MultiStreamTimestampIndex::FindNearestBatch(const std::vector<double>& ts,
+                                                                 double max_distance) const {
+    StreamFrameSelection res;
+    for (const double t : ts) {
+        AppendNearest(t, max_distance, res);
+    }
+    return res;
+}
+
+StreamFrameSelection MultiStreamTimestampIndex::FindRange(double t0, double t1) const {
+    StreamFrameSelection res;
+    if (t1 < t0) {
+        return res;
+    }
+    for (size_t stream = 0; stream < filepaths.size(); ++stream) {
+        const auto begin = times.begin() + stream_begin[stream];
+        const auto end = times.begin() + stream_begin[stream + 1];
+        const auto first = std::lower_bound(begin, end, t0);
+        const auto last = std::upper_bound(first, end, t1);
+        for (auto it = first; it != last; ++it) {
+            res.filepaths.push_back(filepaths[stream]);
+            res.frame_ids.push_back(frame_ids[it - times.begin()]);
+            res.stream_ids.push_back(static_cast<int>(stream));
+        }
+    }
+    return res;
+}
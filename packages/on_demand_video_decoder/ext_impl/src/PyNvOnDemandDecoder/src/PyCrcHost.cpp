@@ -0,0 +1,115 @@
+/*
+ * Copyright (c) 2025, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "CrcHost.h"
+
+#include <pybind11/pybind11.h>
+#include <stdexcept>
+
+namespace py = pybind11;
+
+namespace {
+
+/**
+ * @brief Get pointer and byte size of a C-contiguous Python buffer.
+ */
+std::pair<const uint8_t*, size_t> GetContiguousBytes(const py::buffer& data) {
+    py::buffer_info info = data.request();
+    py::ssize_t expected_stride = info.itemsize;
+    for (py::ssize_t i = info.ndim - 1; i >= 0; --i) {
+        if (info.shape[i] > 1 && info.strides[i] != expected_stride) {
+            throw std::invalid_argument("[ERROR] CRC input buffer must be C-contiguous");
+        }
+        expected_stride *= info.shape[i];
+    }
+    return {static_cast<const uint8_t*>(info.ptr), static_cast<size_t>(info.size * info.itemsize)};
+}
+
+}  // namespace
+
+void Init_PyCrcHost(py::module& m) {
+    py::enum_<CrcVariant>(m, "CrcVariant", py::module_local())
+        .value("CRC32", CrcVariant::CRC32)
+        .value("CRC32C", CrcVariant::CRC32C);
+
+    m.def(
+        "ComputeCRC",
+        [](const py::buffer& data, uint32_t crc, CrcVariant variant, int num_threads) {
+            try {
+                const auto bytes = GetContiguousBytes(data);
+                py::gil_scoped_release release;
+                if (num_threads == 1) {
+                    return ComputeCRCHost(bytes.first, bytes.second, crc, variant);
+                }
+                const uint32_t data_crc =
+                    ComputeCRCHostParallel(bytes.first, bytes.second, num_threads, variant);
+                return crc == 0 ? data_crc : CombineCRCHost(crc, data_crc, bytes.second, variant);
+            } catch (const std::exception& e) {
+                throw std::runtime_error(e.what());
+            }
+        },
+        py::arg("data"), py::arg("crc") = 0, py::arg("variant") = CrcVariant::CRC32,
+        py::arg("num_threads") = 1,
+        R"pbdoc(
+        Computes a CRC over a host buffer on the CPU.
+
+        CRC32 uses the same polynomial and init/final inversion as the GPU ComputeCRC
+        kernel, so the result is identical to ``zlib.crc32``. CRC32C uses the Castagnoli
+        polynomial. Hardware acceleration (PCLMUL / SSE4.2) is used when available.
+
+        Args:
+            data: Any C-contiguous object supporting the buffer protocol (bytes, numpy array, ...)
+            crc: CRC of the preceding data when computing a running CRC, 0 to start a new one
+            variant: CrcVariant.CRC32 (default) or CrcVariant.CRC32C
+            num_threads: Number of threads used for large buffers, 0 to use all cores
+
+        Returns:
+            The finalized CRC as unsigned 32-bit integer
+
+        Raises:
+            RuntimeError: If the buffer is not contiguous
+
+        Example:
+            >>> packets, first_ids, gop_lens = decoder.GetGOP(['v0.mp4'], [0])
+            >>> crc = ComputeCRC(packets, num_threads=0)
+        )pbdoc");
+
+    m.def(
+        "CombineCRC",
+        [](uint32_t crc1, uint32_t crc2, size_t size2, CrcVariant variant) {
+            return CombineCRCHost(crc1, crc2, size2, variant);
+        },
+        py::arg("crc1"), py::arg("crc2"), py::arg("size2"), py::arg("variant") = CrcVariant::CRC32,
+        R"pbdoc(
+        Combines the CRCs of two adjacent buffers without touching the data.
+
+        Args:
+            crc1: CRC of the first buffer
+            crc2: CRC of the second buffer
+            size2: Size of the second buffer in bytes
+            variant: CRC variant used for both CRCs
+
+        Returns:
+            CRC of the concatenation of both buffers
+        )pbdoc");
+
+    m.def(
+        "GetCRCBackend", [](CrcVariant variant) { return std::string(GetCRCHostBackend(variant)); },
+        py::arg("variant") = CrcVariant::CRC32,
+        R"pbdoc(
+        Returns the CPU implementation used for a CRC variant ("pclmul", "sse4.2" or "slice-by-8").
+        )pbdoc");
+}
@@ -0,0 +1,171 @@
+/*
+ * Copyright (c) 2025, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "GopExtractionDriver.hpp"
+
+#include <filesystem>
+#include <memory>
+#include <pybind11/pybind11.h>
+#include <pybind11/stl.h>
+
+namespace py = pybind11;
+
+namespace {
+
+py::dict StatsToDict(const GopExtractionStats& stats) {
+    const double elapsed = stats.elapsed_s > 0.0 ? stats.elapsed_s : 1e-9;
+    py::dict res;
+    res["num_jobs"] = stats.num_jobs;
+    res["num_jobs_resumed"] = stats.num_jobs_resumed;
+    res["num_jobs_done"] = stats.num_jobs_done;
+    res["num_jobs_failed"] = stats.num_jobs_failed;
+    res["num_gops"] = stats.num_gops;
+    res["num_bytes"] = stats.num_bytes;
+    res["elapsed_s"] = stats.elapsed_s;
+    res["jobs_per_s"] = stats.num_jobs_done / elapsed;
+    res["mb_per_s"] = stats.num_bytes / (1024.0 * 1024.0) / elapsed;
+    res["failed_jobs"] = stats.failed_jobs;
+    return res;
+}
+
+}  // namespace
+
+void Init_PyGopExtractionDriver(py::module& m) {
+    py::class_<GopExtractionDriver, std::shared_ptr<GopExtractionDriver>>(m, "GopExtractionDriver",
+                                                                           py::module_local(),
+                                                                           R"pbdoc(
+        Resumable bulk GOP extraction for whole datasets.
+
+        Extracts the GOPs containing the requested frames of many videos and writes them to large sequential
+        shard files in the output directory, together with an index (``gop_index.tsv``). Runs entirely on the
+        CPU (only the demuxing part of the decoder is used).
+
+        - Jobs are processed by a bounded pool of worker threads. Workers block while too much extracted
+          data is waiting to be written (backpressure on the output I/O).
+        - Completed jobs are checkpointed atomically: shard data is flushed to disk before the index records
+          referring to it are appended.
+        - Running again on the same output directory with the same manifest resumes the extraction: completed
+          jobs are skipped and data written after the last checkpoint is discarded. Failed jobs are not
+          checkpointed and are retried.
+
+        Each GOP bundle in the shards has the same format as the output of :meth:`PyNvGopDecoder.GetGOP` /
+        :func:`SavePacketsToFile`, so it can be decoded with :meth:`PyNvGopDecoder.DecodeFromGOP`.
+
+        Example:
+            >>> driver = GopExtractionDriver("/data/gop_cache", num_workers=16)
+            >>> stats = driver.run(video_paths, [[0, 30, 60]] * len(video_paths))
+            >>> index = GopExtractionDriver.read_index("/data/gop_cache")
+            >>> data = np.fromfile(index["shards"][0], dtype=np.uint8, count=index["sizes"][0],
+            ...                    offset=index["offsets"][0])
+        )pbdoc")
+        .def(py::init([](const std::string& output_dir, int num_workers, double shard_size_mb,
+                         double max_pending_mb, int checkpoint_interval, double progress_interval_s) {
+                 GopExtractionConfig config;
+                 config.output_dir = output_dir;
+                 config.num_workers = num_workers;
+                 config.shard_size_bytes = static_cast<uint64_t>(shard_size_mb * 1024.0 * 1024.0);
+                 config.max_pending_bytes = static_cast<uint64_t>(max_pending_mb * 1024.0 * 1024.0);
+                 config.checkpoint_interval = checkpoint_interval;
+                 config.progress_interval_s = progress_interval_s;
+                 return std::make_shared<GopExtractionDriver>(config);
+             }),
+             py::arg("output_dir"), py::arg("num_workers") = 8, py::arg("shard_size_mb") = 1024.0,
+             py::arg("max_pending_mb") = 256.0, py::arg("checkpoint_interval") = 64,
+             py::arg("progress_interval_s") = 30.0,
+             R"pbdoc(
+            Args:
+                output_dir: Directory for the shard files and the index (created if needed)
+                num_workers: Number of worker threads demuxing and serializing jobs
+                shard_size_mb: A new shard file is started once the current one exceeds this size
+                max_pending_mb: Workers block while more than this amount of data is waiting to be written
+                checkpoint_interval: Maximum number of completed jobs per checkpoint
+                progress_interval_s: Interval of the progress log records (INFO level); 0 disables them
+            )pbdoc")
+        .def(
+            "run",
+            [](GopExtractionDriver& driver, const std::vector<std::string>& filepaths,
+               const std::vector<std::vector<int>>& frame_ids) {
+                GopExtractionStats stats;
+                {
+                    py::gil_scoped_release release;
+                    stats = driver.Run(filepaths, frame_ids);
+                }
+                return StatsToDict(stats);
+            },
+            py::arg("filepaths"), py::arg("frame_ids"),
+            R"pbdoc(
+            Runs (or resumes) the extraction. Blocks until all jobs are processed or :meth:`stop` is called.
+
+            The GIL is released while running, so :meth:`stop` and :meth:`get_stats` can be called from
+            other Python threads.
+
+            Args:
+                filepaths: Video file of each job
+                frame_ids: Requested frame ids of each job. Every GOP containing one of them is extracted
+                    (once, even if several requested frames lie in the same GOP).
+
+            Returns:
+                Dict with the statistics of this run: ``num_jobs``, ``num_jobs_resumed``, ``num_jobs_done``,
+                ``num_jobs_failed``, ``num_gops``, ``num_bytes``, ``elapsed_s``, ``jobs_per_s``, ``mb_per_s``
+                and ``failed_jobs`` (list of ``(job id, error message)``)
+
+            Raises:
+                ValueError: If the output directory contains the results of a different manifest
+                RuntimeError: If writing the output fails
+            )pbdoc")
+        .def("stop", &GopExtractionDriver::Stop,
+             R"pbdoc(Requests a running extraction to stop after checkpointing the jobs in flight.)pbdoc")
+        .def(
+            "get_stats", [](const GopExtractionDriver& driver) { return StatsToDict(driver.GetStats()); },
+            R"pbdoc(Returns the statistics of the current (or last) run, see :meth:`run`.)pbdoc")
+        .def_static(
+            "read_index",
+            [](const std::string& output_dir) {
+                const auto records = GopExtractionDriver::ReadIndex(output_dir);
+                std::vector<uint64_t> job_ids, offsets, sizes;
+                std::vector<std::string> filepaths, shards;
+                std::vector<int> frame_ids, first_frame_ids, gop_lens;
+                for (const auto& record : records) {
+                    job_ids.push_back(record.job_id);
+                    filepaths.push_back(record.filepath);
+                    frame_ids.push_back(record.frame_id);
+                    first_frame_ids.push_back(record.first_frame_id);
+                    gop_lens.push_back(record.gop_len);
+                    shards.push_back((std::filesystem::path(output_dir) / record.shard).string());
+                    offsets.push_back(record.offset);
+                    sizes.push_back(record.size);
+                }
+                py::dict res;
+                res["job_ids"] = job_ids;
+                res["filepaths"] = filepaths;
+                res["frame_ids"] = frame_ids;
+                res["first_frame_ids"] = first_frame_ids;
+                res["gop_lens"] = gop_lens;
+                res["shards"] = shards;
+                res["offsets"] = offsets;
+                res["sizes"] = sizes;
+                return res;
+            },
+            py::arg("output_dir"),
+            R"pbdoc(
+            Reads the index of the completed jobs of an output directory.
+
+            Returns:
+                Dict of parallel lists with one entry per GOP bundle: ``job_ids``, ``filepaths``,
+                ``frame_ids`` (requested frame which caused the GOP to be extracted), ``first_frame_ids``,
+                ``gop_lens``, ``shards`` (path of the shard file), ``offsets`` and ``sizes`` (in bytes)
+            )pbdoc");
+}
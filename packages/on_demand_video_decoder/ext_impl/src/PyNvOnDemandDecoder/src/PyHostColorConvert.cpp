@@ -0,0 +1,227 @@
+/*
+ * Copyright (c) 2025, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "HostColorConvert.hpp"
+
+#include <pybind11/numpy.h>
+#include <pybind11/pybind11.h>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace py = pybind11;
+
+namespace {
+
+template <typename T>
+using HostPlane = py::array_t<T, py::array::c_style | py::array::forcecast>;
+
+/**
+ * @brief Interpret a plane of shape (H, W) or (H, W, C) as H rows of W * C samples.
+ */
+template <typename T>
+std::pair<int, int> GetRowsAndRowLength(const HostPlane<T>& plane, const char* name) {
+    if (plane.ndim() < 2 || plane.ndim() > 3) {
+        throw std::invalid_argument(std::string("[ERROR] ") + name +
+                                    " must have shape (H, W) or (H, W, C), got ndim=" +
+                                    std::to_string(plane.ndim()));
+    }
+    const py::ssize_t row_length = plane.ndim() == 3 ? plane.shape(1) * plane.shape(2) : plane.shape(1);
+    return {static_cast<int>(plane.shape(0)), static_cast<int>(row_length)};
+}
+
+template <typename T>
+void CheckChromaPlane(const HostPlane<T>& uv, int width, int height) {
+    const auto rows_and_length = GetRowsAndRowLength(uv, "uv");
+    if (rows_and_length.first < (height + 1) / 2 || rows_and_length.second < ((width + 1) & ~1)) {
+        throw std::invalid_argument("[ERROR] uv plane is too small for a " + std::to_string(width) + "x" +
+                                    std::to_string(height) + " luma plane");
+    }
+}
+
+py::array_t<uint8_t> AllocateRgb(int width, int height) {
+    return py::array_t<uint8_t>({static_cast<py::ssize_t>(height), static_cast<py::ssize_t>(width),
+                                 static_cast<py::ssize_t>(3)});
+}
+
+}  // namespace
+
+void Init_PyHostColorConvert(py::module& m) {
+    py::enum_<BitDepthRounding>(m, "BitDepthRounding", py::module_local())
+        .value("Truncate", BitDepthRounding::Truncate)
+        .value("Round", BitDepthRounding::Round)
+        .value("Dither", BitDepthRounding::Dither);
+
+    m.def(
+        "ConvertBitDepth16To8",
+        [](const HostPlane<uint16_t>& src, BitDepthRounding rounding) {
+            try {
+                const auto rows_and_length = GetRowsAndRowLength(src, "src");
+                std::vector<py::ssize_t> shape(src.shape(), src.shape() + src.ndim());
+                py::array_t<uint8_t> dst(shape);
+                const uint16_t* src_ptr = src.data();
+                uint8_t* dst_ptr = dst.mutable_data();
+                {
+                    py::gil_scoped_release release;
+                    convert_uint16_to_uint8_host(src_ptr, rows_and_length.second * sizeof(uint16_t), dst_ptr,
+                                                 rows_and_length.second, rows_and_length.second,
+                                                 rows_and_length.first, rounding);
+                }
+                return dst;
+            } catch (const std::exception& e) {
+                throw std::runtime_error(e.what());
+            }
+        },
+        py::arg("src"), py::arg("rounding") = BitDepthRounding::Truncate,
+        R"pbdoc(
+        Converts a 16-bit (P010/P016, MSB-aligned) host plane to 8 bits on the CPU.
+
+        With ``BitDepthRounding.Truncate`` the result is identical to the GPU bit-depth
+        conversion (high byte of each sample).
+
+        Args:
+            src: uint16 numpy array of shape (H, W) or (H, W, C)
+            rounding: BitDepthRounding.Truncate, Round or Dither
+
+        Returns:
+            uint8 numpy array with the same shape as src
+
+        Raises:
+            RuntimeError: If src does not have 2 or 3 dimensions
+
+        Example:
+            >>> y8 = ConvertBitDepth16To8(y16, rounding=BitDepthRounding.Dither)
+        )pbdoc");
+
+    m.def(
+        "ConvertBitDepth8To16",
+        [](const HostPlane<uint8_t>& src) {
+            try {
+                const auto rows_and_length = GetRowsAndRowLength(src, "src");
+                std::vector<py::ssize_t> shape(src.shape(), src.shape() + src.ndim());
+                py::array_t<uint16_t> dst(shape);
+                const uint8_t* src_ptr = src.data();
+                uint16_t* dst_ptr = dst.mutable_data();
+                {
+                    py::gil_scoped_release release;
+                    convert_uint8_to_uint16_host(src_ptr, rows_and_length.second, dst_ptr,
+                                                 rows_and_length.second * sizeof(uint16_t),
+                                                 rows_and_length.second, rows_and_length.first);
+                }
+                return dst;
+            } catch (const std::exception& e) {
+                throw std::runtime_error(e.what());
+            }
+        },
+        py::arg("src"),
+        R"pbdoc(
+        Expands an 8-bit host plane to MSB-aligned 16 bits (value << 8) on the CPU.
+
+        Args:
+            src: uint8 numpy array of shape (H, W) or (H, W, C)
+
+        Returns:
+            uint16 numpy array with the same shape as src
+        )pbdoc");
+
+    m.def(
+        "ConvertNV12ToRGBHost",
+        [](const HostPlane<uint8_t>& y, const HostPlane<uint8_t>& uv, bool is_full_range, bool as_bgr) {
+            try {
+                const auto rows_and_length = GetRowsAndRowLength(y, "y");
+                const int height = rows_and_length.first;
+                const int width = rows_and_length.second;
+                CheckChromaPlane(uv, width, height);
+                py::array_t<uint8_t> dst = AllocateRgb(width, height);
+                const uint8_t* y_ptr = y.data();
+                const uint8_t* uv_ptr = uv.data();
+                const size_t uv_pitch = GetRowsAndRowLength(uv, "uv").second;
+                uint8_t* dst_ptr = dst.mutable_data();
+                {
+                    py::gil_scoped_release release;
+                    convert_nv12_to_rgb_host(y_ptr, width, uv_ptr, uv_pitch, dst_ptr, width * 3, width, height,
+                                             is_full_range, as_bgr);
+                }
+                return dst;
+            } catch (const std::exception& e) {
+                throw std::runtime_error(e.what());
+            }
+        },
+        py::arg("y"), py::arg("uv"), py::arg("is_full_range") = false, py::arg("as_bgr") = false,
+        R"pbdoc(
+        Converts NV12 host planes to packed RGB/BGR on the CPU.
+
+        Uses the same BT.601 conversion as the GPU RGB decode path.
+
+        Args:
+            y: uint8 luma plane of shape (H, W) or (H, W, 1)
+            uv: uint8 interleaved chroma plane of shape (H/2, W/2, 2) or (H/2, W)
+            is_full_range: Whether the source uses full (JPEG) range
+            as_bgr: Output channel order BGR instead of RGB
+
+        Returns:
+            uint8 numpy array of shape (H, W, 3)
+
+        Raises:
+            RuntimeError: If the planes have unexpected shapes
+        )pbdoc");
+
+    m.def(
+        "ConvertP016ToRGBHost",
+        [](const HostPlane<uint16_t>& y, const HostPlane<uint16_t>& uv, bool is_full_range, bool as_bgr,
+           BitDepthRounding rounding) {
+            try {
+                const auto rows_and_length = GetRowsAndRowLength(y, "y");
+                const int height = rows_and_length.first;
+                const int width = rows_and_length.second;
+                CheckChromaPlane(uv, width, height);
+                py::array_t<uint8_t> dst = AllocateRgb(width, height);
+                const uint16_t* y_ptr = y.data();
+                const uint16_t* uv_ptr = uv.data();
+                const size_t uv_pitch = GetRowsAndRowLength(uv, "uv").second * sizeof(uint16_t);
+                uint8_t* dst_ptr = dst.mutable_data();
+                {
+                    py::gil_scoped_release release;
+                    convert_p016_to_rgb_host(y_ptr, width * sizeof(uint16_t), uv_ptr, uv_pitch, dst_ptr,
+                                             width * 3, width, height, is_full_range, as_bgr, rounding);
+                }
+                return dst;
+            } catch (const std::exception& e) {
+                throw std::runtime_error(e.what());
+            }
+        },
+        py::arg("y"), py::arg("uv"), py::arg("is_full_range") = false, py::arg("as_bgr") = false,
+        py::arg("rounding") = BitDepthRounding::Truncate,
+        R"pbdoc(
+        Converts P010/P016 host planes to packed 8-bit RGB/BGR on the CPU in a single pass.
+
+        Args:
+            y: uint16 luma plane of shape (H, W) or (H, W, 1)
+            uv: uint16 interleaved chroma plane of shape (H/2, W/2, 2) or (H/2, W)
+            is_full_range: Whether the source uses full (JPEG) range
+            as_bgr: Output channel order BGR instead of RGB
+            rounding: How samples are reduced to 8 bits before the colour conversion
+
+        Returns:
+            uint8 numpy array of shape (H, W, 3)
+
+        Raises:
+            RuntimeError: If the planes have unexpected shapes
+
+        Example:
+            >>> rgb = ConvertP016ToRGBHost(y16, uv16, rounding=BitDepthRounding.Round)
+        )pbdoc");
+}
@@ -0,0 +1,132 @@
+/*
+ * Copyright (c) 2025, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "SegmentedMemoryPool.hpp"
+
+#include <cstdint>
+#include <memory>
+#include <pybind11/pybind11.h>
+
+namespace py = pybind11;
+
+namespace {
+
+py::dict StatsToDict(const MemoryPoolStats& stats) {
+    py::dict result;
+    result["num_segments"] = stats.num_segments;
+    result["capacity"] = stats.capacity;
+    result["used"] = stats.used;
+    result["high_water_mark"] = stats.high_water_mark;
+    result["peak_used"] = stats.peak_used;
+    result["num_segment_allocs"] = stats.num_segment_allocs;
+    result["num_segment_frees"] = stats.num_segment_frees;
+    return result;
+}
+
+}  // namespace
+
+void Init_PyMemoryPool(py::module& m) {
+    py::class_<HostMemoryPool, std::shared_ptr<HostMemoryPool>> pool(m, "HostMemoryPool", py::module_local(),
+                                                                     R"pbdoc(
+        Segmented host memory pool.
+
+        Host instantiation of the segmented pool which backs the GPU frame pools of the decoders. It allows
+        inspecting the allocation behavior (growth, rollback, coalescing and trimming) without a GPU.
+
+        Allocations are bump-allocated from a chain of segments. When a segment is full, a new one is
+        chained, so earlier allocations are never moved. ``reset`` coalesces the segments into one and
+        periodically trims the capacity to the high-water mark of the recent resets.
+        )pbdoc");
+
+    py::class_<HostMemoryPool::Mark>(pool, "Mark", py::module_local(),
+                                     R"pbdoc(
+        Position in a ``HostMemoryPool``, obtained with ``get_mark``.
+        )pbdoc");
+
+    pool.def(py::init([](size_t initial_segment_size, double growth_factor, size_t alignment,
+                         size_t trim_interval, double trim_slack) {
+                 SegmentedMemoryPoolConfig config;
+                 config.initial_segment_size = initial_segment_size;
+                 config.growth_factor = growth_factor;
+                 config.alignment = alignment;
+                 config.trim_interval = trim_interval;
+                 config.trim_slack = trim_slack;
+                 return std::make_shared<HostMemoryPool>(config);
+             }),
+             py::arg("initial_segment_size") = 0, py::arg("growth_factor") = 1.0, py::arg("alignment") = 256,
+             py::arg("trim_interval") = 64, py::arg("trim_slack") = 1.25,
+             R"pbdoc(
+            Args:
+                initial_segment_size: Size of the first segment in bytes (0: size of the first allocation)
+                growth_factor: A new segment is at least ``growth_factor`` times the current capacity
+                alignment: Alignment of the allocations in bytes (power of 2)
+                trim_interval: Number of resets after which the capacity is trimmed (0: never trim)
+                trim_slack: Capacity after trimming, relative to the high-water mark of the interval
+            )pbdoc")
+        .def(
+            "allocate",
+            [](HostMemoryPool& self, size_t num_bytes) {
+                return reinterpret_cast<uintptr_t>(self.Allocate(num_bytes));
+            },
+            py::arg("num_bytes"),
+            R"pbdoc(
+            Allocates memory from the pool. Earlier allocations stay valid.
+
+            Args:
+                num_bytes: Size of the allocation in bytes
+
+            Returns:
+                Address of the allocation (e.g. for use with ``ctypes``)
+            )pbdoc")
+        .def("get_mark", &HostMemoryPool::GetMark,
+             R"pbdoc(
+            Returns the current position, to be passed to ``rollback``.
+            )pbdoc")
+        .def("rollback", &HostMemoryPool::Rollback, py::arg("mark"),
+             R"pbdoc(
+            Releases all allocations made after ``mark``.
+
+            Raises:
+                ValueError: If the mark was invalidated by ``rewind``, ``reset`` or ``release``, or lies after
+                    the current position
+            )pbdoc")
+        .def("rewind", &HostMemoryPool::Rewind,
+             R"pbdoc(
+            Releases all allocations, keeping the segments.
+            )pbdoc")
+        .def("reset", &HostMemoryPool::Reset,
+             R"pbdoc(
+            Releases all allocations, coalesces the segments into one and applies the trim policy.
+            )pbdoc")
+        .def("reset_and_reserve", &HostMemoryPool::ResetAndReserve, py::arg("num_bytes"),
+             R"pbdoc(
+            Like ``reset``, and makes sure that ``num_bytes`` can be allocated without chaining a segment.
+            )pbdoc")
+        .def("release", &HostMemoryPool::Release,
+             R"pbdoc(
+            Frees all segments.
+            )pbdoc")
+        .def(
+            "get_stats", [](const HostMemoryPool& self) { return StatsToDict(self.GetStats()); },
+            R"pbdoc(
+            Returns the occupancy statistics of the pool.
+
+            Returns:
+                Dict with ``num_segments``, ``capacity``, ``used``, ``high_water_mark`` (of the current trim
+                interval), ``peak_used`` (over the lifetime of the pool), ``num_segment_allocs`` and
+                ``num_segment_frees``
+            )pbdoc");
+}
@@ -0,0 +1,145 @@
+/*
+ * Copyright (c) 2025, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "MultiStreamTimestampIndex.hpp"
+
+#include <limits>
+#include <memory>
+#include <pybind11/pybind11.h>
+#include <pybind11/stl.h>
+
+namespace py = pybind11;
+
+namespace {
+
+py::tuple ToTuple(StreamFrameSelection&& selection) {
+    return py::make_tuple(std::move(selection.filepaths), std::move(selection.frame_ids),
+                          std::move(selection.stream_ids));
+}
+
+}  // namespace
+
+void Init_PyMultiStreamTimestampIndex(py::module& m) {
+    py::class_<MultiStreamTimestampIndex, std::shared_ptr<MultiStreamTimestampIndex>>(
+        m, "MultiStreamTimestampIndex", py::module_local(),
+        R"pbdoc(
+        Timestamp index over the frames of several synchronised video streams.
+
+        Translates timestamps (e.g. the sample timestamps of a multi-camera dataset) into one frame id per
+        camera video. The per-stream timestamp tables are merged into one structure and each query performs
+        one binary search per stream.
+
+        The queries return ``(filepaths, frame_ids, stream_ids)``. ``filepaths`` and ``frame_ids`` can be
+        passed directly to the batched decode APIs (e.g. ``Decode``, ``DecodeN12ToRGB`` or ``GetGOP``).
+
+        Example:
+            >>> index = MultiStreamTimestampIndex()
+            >>> for cam, path in enumerate(camera_videos):
+            ...     index.add_stream_from_file(path, offset=scene_start_time)
+            >>> filepaths, frame_ids, _ = index.find_nearest(sample_time, max_distance=0.05)
+            >>> frames = decoder.DecodeN12ToRGB(filepaths, frame_ids, True)
+        )pbdoc")
+        .def(py::init<>())
+        .def("add_stream", &MultiStreamTimestampIndex::AddStream, py::arg("filepath"), py::arg("timestamps"),
+             py::arg("offset") = 0.0,
+             R"pbdoc(
+            Adds a stream from a timestamp table, e.g. a persisted index.
+
+            Args:
+                filepath: Path of the video file (returned by the queries)
+                timestamps: Timestamp of each frame, indexed by frame id. Does not need to be sorted.
+                offset: Offset added to all timestamps of the stream
+
+            Returns:
+                Id of the added stream
+            )pbdoc")
+        .def("add_stream_from_file", &MultiStreamTimestampIndex::AddStreamFromFile, py::arg("filepath"),
+             py::arg("offset") = 0.0, py::call_guard<py::gil_scoped_release>(),
+             R"pbdoc(
+            Adds a stream by scanning the packets of a video file (no decoding is performed).
+
+            Frame ids are assigned in presentation order. The timestamps are in seconds, relative to the first
+            presented frame of the file.
+
+            Args:
+                filepath: Path of the video file
+                offset: Offset added to all timestamps of the stream
+
+            Returns:
+                Id of the added stream
+
+            Raises:
+                ValueError: If the file cannot be demuxed or contains packets without timestamps
+            )pbdoc")
+        .def_static("scan_frame_timestamps", &MultiStreamTimestampIndex::ScanFrameTimestamps,
+                    py::arg("filepath"), py::call_guard<py::gil_scoped_release>(),
+                    R"pbdoc(
+            Returns the timestamps (in seconds, relative to the first presented frame) of all frames of a video
+            file, indexed by frame id. The result can be persisted and later passed to :meth:`add_stream`.
+            )pbdoc")
+        .def_property_readonly("num_streams", &MultiStreamTimestampIndex::GetNumStreams,
+                               R"pbdoc(Number of streams in the index)pbdoc")
+        .def_property_readonly("filepaths", &MultiStreamTimestampIndex::GetFilepaths,
+                               R"pbdoc(File paths of the streams, indexed by stream id)pbdoc")
+        .def("get_num_frames", &MultiStreamTimestampIndex::GetNumFrames, py::arg("stream_id"),
+             R"pbdoc(Returns the number of frames of a stream)pbdoc")
+        .def("get_timestamps", &MultiStreamTimestampIndex::GetTimestamps, py::arg("stream_id"),
+             R"pbdoc(Returns the timestamps (including the offset) of a stream, indexed by frame id)pbdoc")
+        .def(
+            "find_nearest",
+            [](const MultiStreamTimestampIndex& index, double t, double max_distance) {
+                return ToTuple(index.FindNearest(t, max_distance));
+            },
+            py::arg("t"), py::arg("max_distance") = std::numeric_limits<double>::infinity(),
+            R"pbdoc(
+            Finds the frame nearest to timestamp ``t`` in each stream.
+
+            Ties are resolved to the earlier frame.
+
+            Args:
+                t: Query timestamp
+                max_distance: Streams without a frame within this distance of ``t`` are omitted
+
+            Returns:
+                Tuple ``(filepaths, frame_ids, stream_ids)`` with one entry per stream, ordered by stream id
+            )pbdoc")
+        .def(
+            "find_nearest_batch",
+            [](const MultiStreamTimestampIndex& index, const std::vector<double>& ts, double max_distance) {
+                return ToTuple(index.FindNearestBatch(ts, max_distance));
+            },
+            py::arg("ts"), py::arg("max_distance") = std::numeric_limits<double>::infinity(),
+            R"pbdoc(
+            Same as :meth:`find_nearest` for several timestamps at once.
+
+            Returns:
+                Tuple ``(filepaths, frame_ids, stream_ids)`` containing the entries for ``ts[0]``, followed by
+                the entries for ``ts[1]``, and so on
+            )pbdoc")
+        .def(
+            "find_range",
+            [](const MultiStreamTimestampIndex& index, double t0, double t1) {
+                return ToTuple(index.FindRange(t0, t1));
+            },
+            py::arg("t0"), py::arg("t1"),
+            R"pbdoc(
+            Finds all frames with timestamps in ``[t0, t1]``.
+
+            Returns:
+                Tuple ``(filepaths, frame_ids, stream_ids)``, ordered by stream id and by timestamp within each
+                stream
+            )pbdoc");
+}
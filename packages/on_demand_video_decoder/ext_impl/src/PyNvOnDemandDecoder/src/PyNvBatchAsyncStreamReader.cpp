@@ -75,12 +75,13 @@ std::vector<T> process_frames_in_parallel(const std::vector<std::string>& filepa
 
 PyNvBatchAsyncStreamReader::PyNvBatchAsyncStreamReader(int num_of_set, int num_of_file,
                                                        int max_frames_per_decode_call, int iGpu,
-                                                       bool bSuppressNoColorRangeWarning)
+                                                       bool bSuppressNoColorRangeWarning, bool reuse_frames)
     : suppress_no_color_range_given_warning(bSuppressNoColorRangeWarning),
       gpu_id(iGpu),
       num_of_file(num_of_file),
       num_of_set(num_of_set),
       max_frames_per_decode_call(max_frames_per_decode_call),
+      reuse_frames(reuse_frames),
       decode_result_queue(1),  // Buffer size = 1
       has_pending_task(false) {
     if (num_of_set <= 0) {
@@ -130,10 +131,10 @@ PyNvBatchAsyncStreamReader::PyNvBatchAsyncStreamReader(int num_of_set, int num_o
         VideoReaderMap.emplace_back(this->num_of_set);
     }
 
-    // One aggregator pool per video slot. Each pool starts empty (data_=nullptr,
-    // allocated_size_=0) and lazy-sizes itself on the first Decode() call that
-    // populates that slot.
-    agg_pools.resize(this->num_of_file);
+    // One aggregator pool per video slot (two with frame reuse). Each pool starts
+    // empty (data_=nullptr, allocated_size_=0) and lazy-sizes itself on the first
+    // Decode() call that populates that slot.
+    agg_pools.resize(static_cast<size_t>(this->num_of_file) * (this->reuse_frames ? 2 : 1));
 }
 
 PyNvBatchAsyncStreamReader::~PyNvBatchAsyncStreamReader() {
@@ -216,6 +217,17 @@ void PyNvBatchAsyncStreamReader::ReleaseMemPools() {
         }
         ck(cuCtxPopCurrent(NULL));
     }
+    clearResidentFrames();
+}
+
+void PyNvBatchAsyncStreamReader::clearResidentFrames() {
+    reuse_planner.Clear();
+    resident_frames.clear();
+}
+
+std::pair<size_t, size_t> PyNvBatchAsyncStreamReader::GetReuseStats() {
+    waitForPendingAsyncTask();
+    return {num_decoded_frames, num_reused_frames};
 }
 
 void PyNvBatchAsyncStreamReader::ReleaseDecoder() {
@@ -296,6 +308,7 @@ void PyNvBatchAsyncStreamReader::validate_decode_input(const std::vector<std::st
 
 std::vector<RGBFrame> PyNvBatchAsyncStreamReader::run_rgb_out_1d(const std::vector<std::string>& filepaths,
                                                                  const std::vector<int>& frame_ids,
+                                                                 const std::vector<int>& slots,
                                                                  bool as_bgr) {
     // Caller (the worker) has already validated outer/inner sizes via
     // validate_decode_input. Here we only resolve readers and dispatch in parallel.
@@ -303,7 +316,7 @@ std::vector<RGBFrame> PyNvBatchAsyncStreamReader::run_rgb_out_1d(const std::vect
 
     nvtxRangePushA("Get Video Readers (2D worker)");
     for (size_t i = 0; i < filepaths.size(); ++i) {
-        FixedSizeVideoReaderMap& reader_map = this->VideoReaderMap[i];
+        FixedSizeVideoReaderMap& reader_map = this->VideoReaderMap[slots[i]];
         PyNvVideoReader* video_reader = nullptr;
         // Only allocate a new reader when there's room AND the file isn't already
         // cached, matching PyNvSampleReader::run_rgb_out's memory-leak guard.
@@ -392,45 +405,73 @@ void PyNvBatchAsyncStreamReader::Decode(const std::vector<std::string>& filepath
             std::vector<std::string> ref_typestr(V);
             std::vector<size_t> v_bytes(V, 0);
 
-            for (int f = 0; f < F; ++f) {
-                std::vector<int> fids_at_f(V);
-                for (int v = 0; v < V; ++v) fids_at_f[v] = frame_ids_cap[v][f];
+            // With frame reuse, frames of the previous result (in the other pool set)
+            // are copied instead of decoded; reused[v][f] points to the source frame.
+            std::vector<std::vector<const RGBFrame*>> reused(V, std::vector<const RGBFrame*>(F, nullptr));
+            size_t num_reused = 0;
+            if (this->reuse_frames) {
+                const ReusePlan plan = reuse_planner.Plan(filepaths_cap, frame_ids_cap, as_bgr_cap);
+                for (const FrameReuse& entry : plan.reuse) {
+                    reused[entry.dst.video][entry.dst.frame] =
+                        &resident_frames[entry.src.video][entry.src.frame];
+                }
+                num_reused = plan.reuse.size();
+            }
+            GPUMemoryPool* pools = agg_pools.data() + static_cast<size_t>(agg_pool_set) * this->num_of_file;
 
-                auto frames = this->run_rgb_out_1d(filepaths_cap, fids_at_f, as_bgr_cap);
+            for (int f = 0; f < F; ++f) {
+                // Decode the frames at position f which are not reused, each on the readers of its slot
+                std::vector<std::string> files_at_f;
+                std::vector<int> fids_at_f;
+                std::vector<int> slots_at_f;
+                for (int v = 0; v < V; ++v) {
+                    if (!reused[v][f]) {
+                        files_at_f.push_back(filepaths_cap[v]);
+                        fids_at_f.push_back(frame_ids_cap[v][f]);
+                        slots_at_f.push_back(v);
+                    }
+                }
+                std::vector<RGBFrame> decoded;
+                if (!slots_at_f.empty()) {
+                    decoded = this->run_rgb_out_1d(files_at_f, fids_at_f, slots_at_f, as_bgr_cap);
+                }
 
+                size_t next_decoded = 0;
                 for (int v = 0; v < V; ++v) {
+                    const RGBFrame& frame = reused[v][f] ? *reused[v][f] : decoded[next_decoded++];
                     if (f == 0) {
                         // First frame for this video in this call — snapshot shape
-                        // and (re)size that video's aggregator pool. EnsureSize
+                        // and reserve that video's aggregator pool. EnsureSize
                         // realloc's only when the existing capacity is smaller
                         // than what we need, so resolution growth across calls
                         // triggers a re-alloc automatically; same-or-smaller
-                        // resolutions reuse the existing allocation.
-                        ref_shape[v] = frames[v].shape;
-                        ref_stride[v] = frames[v].stride;
-                        ref_typestr[v] = frames[v].typestr;
+                        // resolutions reuse the existing allocation. Under-
+                        // reserving is not fatal: the pool chains a segment.
+                        ref_shape[v] = frame.shape;
+                        ref_stride[v] = frame.stride;
+                        ref_typestr[v] = frame.typestr;
                         const size_t H = std::get<0>(ref_shape[v]);
                         const size_t W = std::get<1>(ref_shape[v]);
                         v_bytes[v] = H * W * 3;
 
-                        agg_pools[v].EnsureSizeAndSoftReset(static_cast<size_t>(F) * v_bytes[v], false);
+                        pools[v].EnsureSizeAndSoftReset(static_cast<size_t>(F) * v_bytes[v], false);
                     } else {
                         // Subsequent frames from the same video must keep the
                         // same shape. Files don't change resolution mid-stream
-                        // in practice; if they did, AddElement would over-run
-                        // the pool below. Defensive check.
-                        if (frames[v].shape != ref_shape[v]) {
+                        // in practice; if they did, the stacked batch would be
+                        // ragged. Defensive check.
+                        if (frame.shape != ref_shape[v]) {
                             std::ostringstream oss;
                             oss << "PyNvBatchAsyncStreamReader: video " << v
                                 << " changed resolution mid-call: f=0 was " << std::get<0>(ref_shape[v])
                                 << "x" << std::get<1>(ref_shape[v]) << ", f=" << f << " is "
-                                << std::get<0>(frames[v].shape) << "x" << std::get<1>(frames[v].shape) << ".";
+                                << std::get<0>(frame.shape) << "x" << std::get<1>(frame.shape) << ".";
                             throw std::runtime_error(oss.str());
                         }
                     }
 
-                    void* dst = agg_pools[v].AddElement(v_bytes[v]);
-                    CUDA_DRVAPI_CALL(cuMemcpyDtoDAsync(reinterpret_cast<CUdeviceptr>(dst), frames[v].data,
+                    void* dst = pools[v].AddElement(v_bytes[v]);
+                    CUDA_DRVAPI_CALL(cuMemcpyDtoDAsync(reinterpret_cast<CUdeviceptr>(dst), frame.data,
                                                        v_bytes[v], cu_stream));
 
                     const std::vector<size_t> shape_vec = {std::get<0>(ref_shape[v]),
@@ -449,6 +490,16 @@ void PyNvBatchAsyncStreamReader::Decode(const std::vector<std::string>& filepath
             // GPU-visible to any consumer stream by the time GetBuffer returns.
             CUDA_DRVAPI_CALL(cuStreamSynchronize(cu_stream));
 
+            num_reused_frames += num_reused;
+            num_decoded_frames += static_cast<size_t>(V) * F - num_reused;
+            if (this->reuse_frames) {
+                // The new result becomes the source of the next Decode(), which
+                // assembles its frames in the other pool set.
+                reuse_planner.SetResident(filepaths_cap, frame_ids_cap, as_bgr_cap);
+                resident_frames = result.decoded_frames;
+                agg_pool_set ^= 1;
+            }
+
             result.is_ready = true;
             decode_result_queue.push_back(result);
 
@@ -460,6 +511,7 @@ void PyNvBatchAsyncStreamReader::Decode(const std::vector<std::string>& filepath
             for (auto& p : agg_pools) {
                 p.SoftRelease();
             }
+            clearResidentFrames();
             result.decoded_frames.clear();
             result.exception = std::current_exception();
             result.is_ready = true;
@@ -518,12 +570,13 @@ void Init_PyNvBatchAsyncStreamReader(py::module& m) {
     m.def(
         "CreateBatchAsyncStreamReader",
         [](int num_of_set, int num_of_file, int max_frames_per_decode_call, int iGpu,
-           bool suppressNoColorRangeWarning) {
-            return std::make_shared<PyNvBatchAsyncStreamReader>(
-                num_of_set, num_of_file, max_frames_per_decode_call, iGpu, suppressNoColorRangeWarning);
+           bool suppressNoColorRangeWarning, bool reuse_frames) {
+            return std::make_shared<PyNvBatchAsyncStreamReader>(num_of_set, num_of_file,
+                                                                max_frames_per_decode_call, iGpu,
+                                                                suppressNoColorRangeWarning, reuse_frames);
         },
         py::arg("num_of_set"), py::arg("num_of_file"), py::arg("max_frames_per_decode_call"),
-        py::arg("iGpu") = 0, py::arg("suppressNoColorRangeWarning") = false,
+        py::arg("iGpu") = 0, py::arg("suppressNoColorRangeWarning") = false, py::arg("reuse_frames") = false,
         R"pbdoc(
             Create a PyNvBatchAsyncStreamReader for 2D async stream decoding.
 
@@ -541,6 +594,10 @@ void Init_PyNvBatchAsyncStreamReader(py::module& m) {
                 iGpu: GPU device id.
                 suppressNoColorRangeWarning: Suppress warning when no color range
                     can be extracted (limited / MPEG range is assumed).
+                reuse_frames: Take over frames of the previous ``Decode()`` call
+                    (same file, frame id and ``as_bgr``) instead of decoding them
+                    again, e.g. for sliding temporal windows. Doubles the memory of
+                    the aggregator pool.
 
             Returns:
                 :class:`PyNvBatchAsyncStreamReader` instance configured with the specified parameters
@@ -627,6 +684,18 @@ void Init_PyNvBatchAsyncStreamReader(py::module& m) {
         of any given video must share the same shape — this is normally
         true since the F frames come from a single mp4 file.
 
+        Frame reuse
+        ~~~~~~~~~~~
+
+        With ``reuse_frames=True``, frames requested by the previous
+        ``Decode()`` call (same file, frame id and ``as_bgr``) are copied from
+        its result instead of being decoded again (see
+        :class:`~accvlab.on_demand_video_decoder.RequestReusePlanner`). For a
+        sliding window ``[t..t+k]`` followed by ``[t+1..t+k+1]``, only frame
+        ``t+k+1`` is decoded, and the stream decoders do not have to seek back.
+        The two most recent results use separate pools, so the aggregator
+        memory is doubled. Contract 2 is unchanged.
+
         .. seealso::
 
             - ``samples/SampleBatchAsyncStreamAccess.py`` for the canonical
@@ -634,9 +703,9 @@ void Init_PyNvBatchAsyncStreamReader(py::module& m) {
             - :class:`~accvlab.on_demand_video_decoder.PyNvSampleReader` for
               the 1-frame-per-video API.
         )pbdoc")
-        .def(py::init<int, int, int, int, bool>(), py::arg("num_of_set"), py::arg("num_of_file"),
+        .def(py::init<int, int, int, int, bool, bool>(), py::arg("num_of_set"), py::arg("num_of_file"),
              py::arg("max_frames_per_decode_call"), py::arg("iGpu") = 0,
-             py::arg("suppressNoColorRangeWarning") = false)
+             py::arg("suppressNoColorRangeWarning") = false, py::arg("reuse_frames") = false)
         .def(
             "Decode",
             [](std::shared_ptr<PyNvBatchAsyncStreamReader>& reader, const std::vector<std::string>& filepaths,
@@ -745,6 +814,19 @@ void Init_PyNvBatchAsyncStreamReader(py::module& m) {
             Release per-reader memory pools and the 2D aggregator pool.
             Decoder state is preserved for efficient forward decoding.
             )pbdoc")
+        .def(
+            "get_reuse_stats",
+            [](std::shared_ptr<PyNvBatchAsyncStreamReader>& reader) {
+                const std::pair<size_t, size_t> stats = reader->GetReuseStats();
+                py::dict result;
+                result["num_decoded_frames"] = stats.first;
+                result["num_reused_frames"] = stats.second;
+                return result;
+            },
+            R"pbdoc(
+            Return the number of decoded and reused frames since construction (see ``reuse_frames``).
+            Waits for pending async task first.
+            )pbdoc")
         .def(
             "release_decoder",
             [](std::shared_ptr<PyNvBatchAsyncStreamReader>& reader) { reader->ReleaseDecoder(); },
@@ -536,13 +536,9 @@ int PyNvGopDecoder::InitializeDemuxers(const std::vector<std::string>& filepaths
 #ifdef PROCESS_SYNC
     for (int i = 0; i < num_of_files; ++i) {
         nvtxRangePushA((std::string("Demuxer creation : ") + std::to_string(i)).c_str());
-        if (fastStreamInfos) {
-            CreateDemuxer(demuxers[i], filepaths[i], fastStreamInfos + i);
-        } else {
-            CreateDemuxer(demuxers[i], filepaths[i], nullptr);
-        }
+        demuxer_pool.Acquire(demuxers[i], filepaths[i], fastStreamInfos ? fastStreamInfos + i : nullptr);
         if (!demuxers[i]->IsValid()) {
-            LOG(ERROR) << "create demuxer failed with video files: " << filepaths[i];
+            LOG(ERROR) << "create demuxer failed" << simplelogger::LogField("file", filepaths[i]);
             nvtxRangePop();  // Demuxer creation
             nvtxRangePop();  // Initialize Demuxers
             return -1;
@@ -555,13 +551,8 @@ int PyNvGopDecoder::InitializeDemuxers(const std::vector<std::string>& filepaths
     for (int i = 0; i < num_of_files; ++i) {
         nvtxRangePushA((std::string("Demuxer creation thread start: ") + std::to_string(i)).c_str());
         demux_runners[i].join();
-        if (fastStreamInfos) {
-            demux_runners[i].start(PyNvGopDecoder::CreateDemuxer, std::ref(demuxers[i]), filepaths[i],
-                                   fastStreamInfos + i);
-        } else {
-            demux_runners[i].start(PyNvGopDecoder::CreateDemuxer, std::ref(demuxers[i]), filepaths[i],
-                                   nullptr);
-        }
+        demux_runners[i].start(&DemuxerPool::Acquire, &demuxer_pool, std::ref(demuxers[i]), filepaths[i],
+                               fastStreamInfos ? fastStreamInfos + i : nullptr);
         nvtxRangePop();  // Demuxer creation thread start
     }
 
@@ -573,7 +564,7 @@ int PyNvGopDecoder::InitializeDemuxers(const std::vector<std::string>& filepaths
             for (int index = i; index < num_of_files; index++) {
                 demux_runners[index].join();
             }
-            LOG(ERROR) << "create demuxer failed with video files " << filepaths[i];
+            LOG(ERROR) << "create demuxer failed" << simplelogger::LogField("file", filepaths[i]);
             nvtxRangePop();  // Demuxer creation thread join
             nvtxRangePop();  // Initialize Demuxers
             return -1;
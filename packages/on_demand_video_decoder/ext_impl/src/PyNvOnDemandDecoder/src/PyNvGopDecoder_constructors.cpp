@@ -178,7 +178,8 @@ void PyNvGopDecoder::ensureMergeRunnersInitialized() {
 PyNvGopDecoder::PyNvGopDecoder(int iMaxFileNum, int iGpu, bool bSuppressNoColorRangeWarning)
     : max_num_files(iMaxFileNum),
       gpu_id(iGpu),
-      suppress_no_color_range_given_warning(bSuppressNoColorRangeWarning) {
+      suppress_no_color_range_given_warning(bSuppressNoColorRangeWarning),
+      demuxer_pool(static_cast<size_t>(std::max(iMaxFileNum, 0))) {
 #ifdef IS_DEBUG_BUILD
     std::cout << "New PyNvGopDecoder object" << std::endl;
 #endif
@@ -559,14 +560,17 @@ void Init_PyNvGopDecoder(py::module& m) {
         .def(
             "GetGOPList",
             [](std::shared_ptr<PyNvGopDecoder>& dec, const std::vector<std::string>& filepaths,
-               const std::vector<int> frame_ids, std::vector<FastStreamInfo> fastStreamInfos) {
+               const std::vector<int> frame_ids, std::vector<FastStreamInfo> fastStreamInfos,
+               size_t max_files_per_wave, size_t memory_budget) {
                 try {
                     std::vector<SerializedPacketBundle> bundles;
                     // Release GIL for file I/O and demuxing
                     {
                         py::gil_scoped_release release;
-                        bundles = dec->get_gop_list(
-                            filepaths, frame_ids, fastStreamInfos.empty() ? nullptr : fastStreamInfos.data());
+                        const FastStreamInfo* infos =
+                            fastStreamInfos.empty() ? nullptr : fastStreamInfos.data();
+                        bundles = dec->get_gop_list(filepaths, frame_ids, infos, max_files_per_wave,
+                                                    memory_budget);
                     }
                     // GIL is re-acquired here for creating Python objects
 
@@ -594,13 +598,18 @@ void Init_PyNvGopDecoder(py::module& m) {
                 }
             },
             py::arg("filepaths"), py::arg("frame_ids"),
-            py::arg("fastStreamInfos") = std::vector<FastStreamInfo>{},
+            py::arg("fastStreamInfos") = std::vector<FastStreamInfo>{}, py::arg("max_files_per_wave") = 0,
+            py::arg("memory_budget") = 0,
             R"pbdoc(
             Extracts video GOP data for multiple videos and returns them as separate bundles.
             
             This method is similar to :meth:`GetGOP` but returns a separate bundle for each video file
             instead of merging all data into one bundle. This is useful when you want to cache
             or process each video's data independently.
+
+            The number of files is not limited by ``maxfiles``: the files are processed in waves of at
+            most ``maxfiles`` files, and the demuxing of the next wave overlaps with the serialization of
+            the current one. The results are the same as for separate calls per wave.
             
             Args:
                 filepaths: List of video file paths to extract GOP data from
@@ -608,6 +617,11 @@ void Init_PyNvGopDecoder(py::module& m) {
                 fastStreamInfos: Optional list of FastStreamInfo objects containing pre-extracted 
                                 stream information by :func:`GetFastInitInfo`. If provided, this can 
                                 improve performance by avoiding stream analysis.
+                max_files_per_wave: Maximum number of files per wave (0: ``maxfiles``). Smaller waves
+                                reduce the peak memory usage.
+                memory_budget: Maximum size (in bytes) of the packet data of two overlapping waves
+                                (0: no limit). If the previous wave indicates that the budget would be
+                                exceeded, the next wave is only demuxed after the current one is done.
             
             Returns:
                 List of tuples, one per video file, each containing
@@ -877,7 +891,9 @@ void Init_PyNvGopDecoder(py::module& m) {
             
             Note:
                 The method parses each bundle, reconstructs per-frame packet queues, and decodes
-                via a unified pipeline.
+                via a unified pipeline. More than ``maxfiles`` frames can be requested: the frames are
+                then decoded in waves of ``maxfiles`` frames, and the GPU memory for all frames is
+                reserved before the first wave.
             )pbdoc")
         .def(
             "DecodeFromGOPList",
@@ -925,6 +941,9 @@ void Init_PyNvGopDecoder(py::module& m) {
             Returns:
                 List of DecodedFrameExt objects containing decoded native YUV frame data
 
+            Note:
+                As for :meth:`DecodeFromGOPListRGB`, more than ``maxfiles`` frames can be requested.
+
             Raises:
                 RuntimeError: If GOP data is invalid or decoding fails
                 ValueError: If input arrays have mismatched dimensions
@@ -1292,5 +1311,62 @@ void Init_PyNvGopDecoder(py::module& m) {
                 >>> decoder = PyNvGopDecoder(maxfiles=10)
                 >>> frames = decoder.Decode(['video1.mp4'], [0, 10, 20])
                 >>> decoder.release_decoder()  # Free decoder instances
+            )pbdoc")
+        .def(
+            "get_demuxer_pool_stats",
+            [](std::shared_ptr<PyNvGopDecoder>& dec) {
+                const DemuxerPoolStats stats = dec->GetDemuxerPoolStats();
+                py::dict res;
+                res["num_opened"] = stats.num_opened;
+                res["num_reused"] = stats.num_reused;
+                res["num_evicted"] = stats.num_evicted;
+                res["num_discarded"] = stats.num_discarded;
+                res["num_idle"] = stats.num_idle;
+                res["capacity"] = stats.capacity;
+                return res;
+            },
+            R"pbdoc(
+            Get the counters of the demuxer pool.
+
+            Demuxers (open video files) are kept in a pool across calls of ``Decode``, ``DecodeN12ToRGB``,
+            ``GetGOP`` and ``GetGOPList``, so that repeated access to the same videos does not re-open the
+            files. Reused demuxers are rewound to the start of the stream before use.
+
+            Returns:
+                Dictionary with the entries ``num_opened`` (files opened), ``num_reused`` (demuxers reused
+                from the pool), ``num_evicted`` (idle demuxers closed in least recently used order because
+                the pool was full), ``num_discarded`` (demuxers closed because they could not be reused),
+                ``num_idle`` (demuxers currently held open) and ``capacity``.
+
+            Example:
+                >>> decoder = PyNvGopDecoder(maxfiles=10)
+                >>> gop = decoder.GetGOP(['video1.mp4'], [0])
+                >>> gop = decoder.GetGOP(['video1.mp4'], [30])
+                >>> decoder.get_demuxer_pool_stats()['num_reused']
+                1
+            )pbdoc")
+        .def(
+            "set_demuxer_pool_capacity",
+            [](std::shared_ptr<PyNvGopDecoder>& dec, size_t capacity) {
+                dec->SetDemuxerPoolCapacity(capacity);
+            },
+            py::arg("capacity"), py::call_guard<py::gil_scoped_release>(),
+            R"pbdoc(
+            Set the maximum number of idle demuxers (open video files) kept by the demuxer pool.
+
+            The default capacity is ``maxfiles``. Excess idle demuxers are closed immediately, least recently
+            used first. A capacity of 0 disables the reuse of demuxers across calls.
+
+            Args:
+                capacity: Maximum number of idle demuxers
+            )pbdoc")
+        .def(
+            "clear_demuxer_pool", [](std::shared_ptr<PyNvGopDecoder>& dec) { dec->ClearDemuxerPool(); },
+            py::call_guard<py::gil_scoped_release>(),
+            R"pbdoc(
+            Close all idle demuxers held by the demuxer pool.
+
+            The pool assumes that video files are not modified while pooled; call this method if files may
+            have changed on disk.
             )pbdoc");
 }
@@ -83,6 +83,7 @@ void PyNvGopDecoder::decode_from_video(const std::vector<std::string>& filepaths
 
     // Initialize demuxers and calculate memory requirements
     std::vector<std::unique_ptr<PyNvGopDemuxer>> demuxers;
+    DemuxerPool::LeaseGuard demuxer_lease(demuxer_pool, demuxers);
     st = InitializeDemuxers(filepaths, demuxers, fastStreamInfos);
     if (st != 0) {
         throw std::runtime_error("[ERROR] InitializeDemuxers failed.");
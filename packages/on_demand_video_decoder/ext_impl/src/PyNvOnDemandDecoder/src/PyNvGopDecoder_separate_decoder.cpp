@@ -20,6 +20,7 @@
 #include <filesystem>
 #include <fstream>
 #include <functional>
+#include <iterator>
 #include <map>
 #include <string>
 #include <unordered_set>
@@ -39,6 +40,17 @@ void PyNvGopDecoder::get_gop_internal(
     std::vector<std::unique_ptr<ConcurrentQueue<std::tuple<uint8_t*, int, int>>>>& vpacket_queue,
     std::vector<std::vector<std::unique_ptr<uint8_t[]>>>& vpacket_array,
     std::vector<std::vector<int>>& all_gop_lens, std::vector<std::vector<int>>& all_first_frame_ids) {
+    start_gop_demux(filepaths, frame_ids, fastStreamInfos, demuxers, vpacket_queue, vpacket_array,
+                    all_gop_lens, all_first_frame_ids);
+    finish_gop_demux(vpacket_array);
+}
+
+void PyNvGopDecoder::start_gop_demux(
+    const std::vector<std::string>& filepaths, const std::vector<int>& frame_ids,
+    const FastStreamInfo* fastStreamInfos, std::vector<std::unique_ptr<PyNvGopDemuxer>>& demuxers,
+    std::vector<std::unique_ptr<ConcurrentQueue<std::tuple<uint8_t*, int, int>>>>& vpacket_queue,
+    std::vector<std::vector<std::unique_ptr<uint8_t[]>>>& vpacket_array,
+    std::vector<std::vector<int>>& all_gop_lens, std::vector<std::vector<int>>& all_first_frame_ids) {
     int st = 0;
     if (filepaths.size() != frame_ids.size()) {
         throw std::invalid_argument("[ERROR] filepaths and frame_ids must have the same length");
@@ -101,6 +113,10 @@ void PyNvGopDecoder::get_gop_internal(
         }
     }
     nvtxRangePop();  // Packet extraction
+}
+
+void PyNvGopDecoder::finish_gop_demux(std::vector<std::vector<std::unique_ptr<uint8_t[]>>>& vpacket_array) {
+    const size_t total_frames = vpacket_array.size();
 
     // Wait for all demux threads to complete
     nvtxRangePushA("Demux thread join");
@@ -134,6 +150,7 @@ SerializedPacketBundle PyNvGopDecoder::get_gop(const std::vector<std::string>& f
 
     // Use internal implementation to extract GOP data
     std::vector<std::unique_ptr<PyNvGopDemuxer>> demuxers;
+    DemuxerPool::LeaseGuard demuxer_lease(demuxer_pool, demuxers);
     std::vector<std::unique_ptr<ConcurrentQueue<std::tuple<uint8_t*, int, int>>>> vpacket_queue;
     std::vector<std::vector<std::unique_ptr<uint8_t[]>>> vpacket_array;
     std::vector<std::vector<int>> all_gop_lens;
@@ -152,52 +169,146 @@ SerializedPacketBundle PyNvGopDecoder::get_gop(const std::vector<std::string>& f
     return result;
 }
 
-std::vector<SerializedPacketBundle> PyNvGopDecoder::get_gop_list(const std::vector<std::string>& filepaths,
-                                                                 const std::vector<int> frame_ids,
-                                                                 const FastStreamInfo* fastStreamInfos) {
-    nvtxRangePushA("GetGOPList");
-    const size_t total_videos = frame_ids.size();
+namespace {
 
-    // Use internal implementation to extract GOP data
+// Demuxed (but not yet serialized) GOP data of one wave of get_gop_list(). The demuxers are returned to the
+// pool when the wave is destroyed.
+struct GopListWave {
+    GopListWave(DemuxerPool& pool, size_t begin, size_t end)
+        : begin(begin), end(end), lease(pool, demuxers) {}
+
+    size_t begin;
+    size_t end;
     std::vector<std::unique_ptr<PyNvGopDemuxer>> demuxers;
     std::vector<std::unique_ptr<ConcurrentQueue<std::tuple<uint8_t*, int, int>>>> vpacket_queue;
     std::vector<std::vector<std::unique_ptr<uint8_t[]>>> vpacket_array;
     std::vector<std::vector<int>> all_gop_lens;
     std::vector<std::vector<int>> all_first_frame_ids;
+    DemuxerPool::LeaseGuard lease;
+};
 
-    get_gop_internal(filepaths, frame_ids, fastStreamInfos, demuxers, vpacket_queue, vpacket_array,
-                     all_gop_lens, all_first_frame_ids);
-
-    // Create separate bundle for each video
-    nvtxRangePushA("CreateSerializedPacketBundles");
-    std::vector<SerializedPacketBundle> results;
-    results.reserve(total_videos);
+}  // namespace
 
-    for (size_t i = 0; i < total_videos; ++i) {
-        // Create temporary vectors containing only data for this video
-        std::vector<std::unique_ptr<PyNvGopDemuxer>> single_demuxer;
-        single_demuxer.push_back(std::move(demuxers[i]));
+std::vector<SerializedPacketBundle> PyNvGopDecoder::get_gop_list(const std::vector<std::string>& filepaths,
+                                                                 const std::vector<int> frame_ids,
+                                                                 const FastStreamInfo* fastStreamInfos,
+                                                                 size_t max_files_per_wave,
+                                                                 size_t memory_budget) {
+    if (filepaths.size() != frame_ids.size()) {
+        throw std::invalid_argument("[ERROR] filepaths and frame_ids must have the same length");
+    }
+    const size_t total_videos = frame_ids.size();
+    std::vector<SerializedPacketBundle> results(total_videos);
+    if (total_videos == 0) {
+        return results;
+    }
+    nvtxRangePushA("GetGOPList");
 
-        std::vector<std::vector<int>> single_gop_lens = {all_gop_lens[i]};
-        std::vector<std::vector<int>> single_first_frame_ids = {all_first_frame_ids[i]};
+    // The files are processed in waves of at most max_num_files files (the number of runner slots). While
+    // the bundles of one wave are serialized on the merge runners, the next wave is opened and demuxed on
+    // the demux runners. With a memory budget, the waves only overlap if the serialized data of two waves
+    // (estimated from the previous wave) fits into the budget.
+    size_t wave_size = static_cast<size_t>(this->max_num_files);
+    if (max_files_per_wave > 0) {
+        wave_size = std::min(wave_size, max_files_per_wave);
+    }
+    ensureMergeRunnersInitialized();
 
-        std::vector<std::unique_ptr<ConcurrentQueue<std::tuple<uint8_t*, int, int>>>> single_queue;
-        single_queue.push_back(std::move(vpacket_queue[i]));
+    // The waves are owned outside of the try block and only stored into `slot` before their demux runners are
+    // started: on an error, the runners are joined (force_join_all) before the waves they write to are freed.
+    auto start_wave = [&](size_t begin, std::unique_ptr<GopListWave>& slot) {
+        slot = std::make_unique<GopListWave>(demuxer_pool, begin, std::min(total_videos, begin + wave_size));
+        GopListWave& wave = *slot;
+        const std::vector<std::string> wave_filepaths(filepaths.begin() + wave.begin,
+                                                      filepaths.begin() + wave.end);
+        const std::vector<int> wave_frame_ids(frame_ids.begin() + wave.begin, frame_ids.begin() + wave.end);
+        start_gop_demux(wave_filepaths, wave_frame_ids, fastStreamInfos ? fastStreamInfos + begin : nullptr,
+                        wave.demuxers, wave.vpacket_queue, wave.vpacket_array, wave.all_gop_lens,
+                        wave.all_first_frame_ids);
+    };
 
-        std::vector<std::vector<std::unique_ptr<uint8_t[]>>> single_array;
-        single_array.push_back(std::move(vpacket_array[i]));
+    std::unique_ptr<GopListWave> current;
+    std::unique_ptr<GopListWave> next;
+    try {
+        start_wave(0, current);
+        finish_gop_demux(current->vpacket_array);
+        size_t last_wave_bytes = 0;
+
+        while (current) {
+            // Serialize the bundles of the current wave, one merge runner per video
+            nvtxRangePushA("CreateSerializedPacketBundles");
+            const size_t num_videos = current->end - current->begin;
+            std::vector<std::exception_ptr> exceptions(num_videos);
+            GopListWave& wave = *current;
+            for (size_t i = 0; i < num_videos; ++i) {
+                merge_runners[i].start([this, &wave, &results, &exceptions, i]() {
+                    try {
+                        // Create temporary vectors containing only data for this video
+                        std::vector<std::unique_ptr<PyNvGopDemuxer>> single_demuxer;
+                        single_demuxer.push_back(std::move(wave.demuxers[i]));
+                        std::vector<std::unique_ptr<ConcurrentQueue<std::tuple<uint8_t*, int, int>>>>
+                            single_queue;
+                        single_queue.push_back(std::move(wave.vpacket_queue[i]));
+                        std::vector<std::vector<std::unique_ptr<uint8_t[]>>> single_array;
+                        single_array.push_back(std::move(wave.vpacket_array[i]));
+
+                        results[wave.begin + i] = createSerializedPacketBundle(
+                            1, single_demuxer, {wave.all_gop_lens[i]}, {wave.all_first_frame_ids[i]},
+                            single_queue, single_array);
+
+                        // Restore demuxer so that it is returned to the pool
+                        wave.demuxers[i] = std::move(single_demuxer[0]);
+                    } catch (...) {
+                        exceptions[i] = std::current_exception();
+                    }
+                });
+            }
 
-        // Create bundle for this single video
-        SerializedPacketBundle bundle = createSerializedPacketBundle(
-            1,  // Only one frame per video
-            single_demuxer, single_gop_lens, single_first_frame_ids, single_queue, single_array);
+            // Meanwhile, open the files of the next wave and start extracting their packets
+            std::exception_ptr next_exception;
+            const bool has_next = current->end < total_videos;
+            const bool overlap =
+                memory_budget == 0 || (last_wave_bytes > 0 && 2 * last_wave_bytes <= memory_budget);
+            if (has_next && overlap) {
+                try {
+                    start_wave(current->end, next);
+                } catch (...) {
+                    next_exception = std::current_exception();
+                }
+            }
 
-        // Restore demuxer for proper cleanup (moved it back from single_demuxer)
-        demuxers[i] = std::move(single_demuxer[0]);
+            for (size_t i = 0; i < num_videos; ++i) {
+                merge_runners[i].join();
+            }
+            nvtxRangePop();  // CreateSerializedPacketBundles
+            for (const auto& ex : exceptions) {
+                if (ex) {
+                    std::rethrow_exception(ex);
+                }
+            }
+            if (next_exception) {
+                std::rethrow_exception(next_exception);
+            }
 
-        results.push_back(std::move(bundle));
+            last_wave_bytes = 0;
+            for (size_t i = current->begin; i < current->end; ++i) {
+                last_wave_bytes += results[i].size;
+            }
+            if (has_next && !next) {
+                const size_t next_begin = current->end;
+                current.reset();
+                start_wave(next_begin, next);
+            }
+            current = std::move(next);
+            if (current) {
+                finish_gop_demux(current->vpacket_array);
+            }
+        }
+    } catch (...) {
+        this->force_join_all();
+        nvtxRangePop();  // GetGOPList
+        throw;
     }
-    nvtxRangePop();  // CreateSerializedPacketBundles
 
     nvtxRangePop();  // GetGOPList
     return results;
@@ -536,19 +647,63 @@ void PyNvGopDecoder::decode_from_gop_list(const std::vector<const uint8_t*>& dat
 
     const int total_frames = static_cast<int>(aggregated_frames);
 
-    if (total_frames > this->max_num_files) {
+    // Frames are decoded in waves of at most max_num_files frames (the number of decoder slots). The frame
+    // memory of all waves is reserved up front, so that the frames of earlier waves stay valid.
+    const int wave_size = this->max_num_files;
+    const bool multiple_waves = total_frames > wave_size;
+    if (convert_to_rgb) {
+        out_if_color_converted->clear();
+        out_if_color_converted->reserve(total_frames);
+    } else {
+        out_if_no_color_conversion->clear();
+        out_if_no_color_conversion->reserve(total_frames);
+    }
+    try {
+        if (multiple_waves) {
+            ensureCudaContextInitialized();
+            if (InitGpuMemPool(heights_all, widths_all, frame_sizes_all, convert_to_rgb) != 0) {
+                throw std::runtime_error("[ERROR] InitGpuMemPool failed.");
+            }
+        }
+        for (int wave_begin = 0; wave_begin < total_frames; wave_begin += wave_size) {
+            const int wave_end = std::min(total_frames, wave_begin + wave_size);
+            decode_gop_list_wave(wave_begin, wave_end, color_ranges_all, codec_ids_all, widths_all,
+                                 heights_all, frame_sizes_all, gop_lens_all, first_frame_ids_all,
+                                 packets_bytes_all, decode_idxs_all, packet_binary_data_ptrs_all, filepaths,
+                                 frame_ids, convert_to_rgb, as_bgr, !multiple_waves,
+                                 out_if_no_color_conversion, out_if_color_converted);
+        }
+    } catch (...) {
         nvtxRangePop();
-        throw std::invalid_argument("[ERROR] total frames exceed max_num_files");
+        throw;
     }
 
-    // Reconstruct packet queues per frame
+    nvtxRangePop();
+}
+
+void PyNvGopDecoder::decode_gop_list_wave(
+    int wave_begin, int wave_end, const std::vector<int>& color_ranges_all,
+    const std::vector<int>& codec_ids_all, const std::vector<int>& widths_all,
+    const std::vector<int>& heights_all, const std::vector<int>& frame_sizes_all,
+    const std::vector<int>& gop_lens_all, const std::vector<int>& first_frame_ids_all,
+    const std::vector<std::vector<int>>& packets_bytes_all,
+    const std::vector<std::vector<int>>& decode_idxs_all,
+    const std::vector<const uint8_t*>& packet_binary_data_ptrs_all,
+    const std::vector<std::string>& filepaths, const std::vector<int>& frame_ids, bool convert_to_rgb,
+    bool as_bgr, bool init_gpu_mem_pool, std::vector<DecodedFrameExt>* out_if_no_color_conversion,
+    std::vector<RGBFrame>* out_if_color_converted) {
+    const int total_frames = wave_end - wave_begin;
+
+    // Reconstruct packet queues per frame; frame `wave_begin + i` is decoded in slot `i`
     std::vector<std::unique_ptr<ConcurrentQueue<std::tuple<uint8_t*, int, int>>>> vpacket_queue;
     vpacket_queue.resize(total_frames);
 
-    for (int i = 0; i < total_frames; ++i) {
+    for (int slot = 0; slot < total_frames; ++slot) {
+        const int i = wave_begin + slot;
+        LastDecodedFrameInfo& last_decoded = this->last_decoded_frame_infos[slot];
         int skip_packets = 0;
-        const int last_frame_id = this->last_decoded_frame_infos[i].frame_id;
-        if (this->last_decoded_frame_infos[i].filename != filepaths[i]) {
+        const int last_frame_id = last_decoded.frame_id;
+        if (last_decoded.filename != filepaths[i]) {
             skip_packets = 0;
         } else if (last_frame_id < first_frame_ids_all[i] ||
                    last_frame_id >= first_frame_ids_all[i] + gop_lens_all[i]) {
@@ -556,14 +711,14 @@ void PyNvGopDecoder::decode_from_gop_list(const std::vector<const uint8_t*>& dat
         } else if (last_frame_id >= frame_ids[i]) {
             skip_packets = 0;
         } else {
-            skip_packets = this->last_decoded_frame_infos[i].packet_id;
+            skip_packets = last_decoded.packet_id;
         }
         if (skip_packets == 0) {
-            reset_last_decoded_frame_info(this->last_decoded_frame_infos[i]);
+            reset_last_decoded_frame_info(last_decoded);
         }
 
-        vpacket_queue[i] = std::make_unique<ConcurrentQueue<std::tuple<uint8_t*, int, int>>>();
-        vpacket_queue[i]->setSize(MAX_SIZE);
+        vpacket_queue[slot] = std::make_unique<ConcurrentQueue<std::tuple<uint8_t*, int, int>>>();
+        vpacket_queue[slot]->setSize(MAX_SIZE);
 
         size_t offset = 0;
         const int num_packets = static_cast<int>(packets_bytes_all[i].size());
@@ -580,29 +735,43 @@ void PyNvGopDecoder::decode_from_gop_list(const std::vector<const uint8_t*>& dat
             }
 
             if (packet_bytes == -1) {
-                vpacket_queue[i]->push_back(std::make_tuple(nullptr, -1, 0));
+                vpacket_queue[slot]->push_back(std::make_tuple(nullptr, -1, 0));
             } else if (packet_bytes == 0) {
-                vpacket_queue[i]->push_back(std::make_tuple(nullptr, 0, 0));
+                vpacket_queue[slot]->push_back(std::make_tuple(nullptr, 0, 0));
             } else {
                 uint8_t* pVideo = const_cast<uint8_t*>(packet_binary_data_ptrs_all[i] + offset);
                 offset += packet_bytes;
 
                 // Timestamp encoding: keep consistent with existing logic
                 decode_idx = decode_idx * 2;
-                vpacket_queue[i]->push_back(std::make_tuple(pVideo, packet_bytes, decode_idx));
+                vpacket_queue[slot]->push_back(std::make_tuple(pVideo, packet_bytes, decode_idx));
             }
         }
     }
 
-    int st = main_decode(color_ranges_all, codec_ids_all, widths_all, heights_all, frame_sizes_all, filepaths,
-                         frame_ids, convert_to_rgb, as_bgr, vpacket_queue, out_if_no_color_conversion,
-                         out_if_color_converted);
+    auto slice = [&](const auto& all) {
+        return std::vector<typename std::decay_t<decltype(all)>::value_type>(all.begin() + wave_begin,
+                                                                             all.begin() + wave_end);
+    };
+    std::vector<int> widths = slice(widths_all);
+    std::vector<int> heights = slice(heights_all);
+    std::vector<int> frame_sizes = slice(frame_sizes_all);
+
+    std::vector<DecodedFrameExt> wave_frames;
+    std::vector<RGBFrame> wave_rgb_frames;
+    int st = main_decode(slice(color_ranges_all), slice(codec_ids_all), widths, heights, frame_sizes,
+                         slice(filepaths), slice(frame_ids), convert_to_rgb, as_bgr, vpacket_queue,
+                         convert_to_rgb ? nullptr : &wave_frames, convert_to_rgb ? &wave_rgb_frames : nullptr,
+                         init_gpu_mem_pool);
     if (st != 0) {
-        nvtxRangePop();
         throw std::runtime_error("[ERROR] main_decode failed.");
     }
-
-    nvtxRangePop();
+    if (convert_to_rgb) {
+        std::move(wave_rgb_frames.begin(), wave_rgb_frames.end(),
+                  std::back_inserter(*out_if_color_converted));
+    } else {
+        std::move(wave_frames.begin(), wave_frames.end(), std::back_inserter(*out_if_no_color_conversion));
+    }
 }
 
 int PyNvGopDecoder::main_decode(
@@ -610,7 +779,8 @@ int PyNvGopDecoder::main_decode(
     std::vector<int>& heights, std::vector<int>& frame_sizes, const std::vector<std::string>& filepaths,
     const std::vector<int>& frame_ids, bool convert_to_rgb, bool as_bgr,
     std::vector<std::unique_ptr<ConcurrentQueue<std::tuple<uint8_t*, int, int>>>>& vpacket_queue,
-    std::vector<DecodedFrameExt>* out_if_no_color_conversion, std::vector<RGBFrame>* out_if_color_converted) {
+    std::vector<DecodedFrameExt>* out_if_no_color_conversion, std::vector<RGBFrame>* out_if_color_converted,
+    bool init_gpu_mem_pool) {
     // start decoding process
     int st = 0;
 
@@ -618,10 +788,12 @@ int PyNvGopDecoder::main_decode(
     ensureCudaContextInitialized();
     ensureDecodeRunnersInitialized();
 
-    st = InitGpuMemPool(heights, widths, frame_sizes, convert_to_rgb);
-    if (st != 0) {
-        LOG(ERROR) << "InitGpuMemPool failed.";
-        return st;
+    if (init_gpu_mem_pool) {
+        st = InitGpuMemPool(heights, widths, frame_sizes, convert_to_rgb);
+        if (st != 0) {
+            LOG(ERROR) << "InitGpuMemPool failed.";
+            return st;
+        }
     }
 
     st = InitializeDecoders(codec_ids);
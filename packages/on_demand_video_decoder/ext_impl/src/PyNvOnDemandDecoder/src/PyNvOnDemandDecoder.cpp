@@ -54,11 +54,27 @@ void Init_PyNvGopDecoder(py::module& m);
 void Init_PyNvVideoReader(py::module& m);
 void Init_PyNvSampleReader(py::module& m);
 void Init_PyNvBatchAsyncStreamReader(py::module& m);
+void Init_PyCrcHost(py::module& m);
+void Init_PyHostColorConvert(py::module& m);
+void Init_PyMultiStreamTimestampIndex(py::module& m);
+void Init_PyGopExtractionDriver(py::module& m);
+void Init_PyVideoDatasetBuilder(py::module& m);
+void Init_PyVideoRemuxer(py::module& m);
+void Init_PyMemoryPool(py::module& m);
+void Init_PyRequestReusePlanner(py::module& m);
 PYBIND11_MODULE(_PyNvOnDemandDecoder, m) {
     Init_PyNvVideoReader(m);
     Init_PyNvGopDecoder(m);
     Init_PyNvSampleReader(m);
     Init_PyNvBatchAsyncStreamReader(m);
+    Init_PyCrcHost(m);
+    Init_PyHostColorConvert(m);
+    Init_PyMultiStreamTimestampIndex(m);
+    Init_PyGopExtractionDriver(m);
+    Init_PyVideoDatasetBuilder(m);
+    Init_PyVideoRemuxer(m);
+    Init_PyMemoryPool(m);
+    Init_PyRequestReusePlanner(m);
 
     m.doc() = R"pbdoc(
         accvlab.on_demand_video_decoder
@@ -18,7 +18,7 @@
 
 RGBFrame::RGBFrame(const std::vector<size_t>& _shape, const std::vector<size_t>& _stride,
                    const std::string& _typeStr, size_t _streamid, CUdeviceptr _data, bool _readOnly,
-                   bool _isBRG) {
+                   bool _isBRG, DLDeviceType _deviceType, int _deviceId) {
     assert(_shape.size() == 3 && _stride.size() == 3 && "_shape and _stride need to have size of 3");
     assert(_shape[2] == 3 && "IMage has to have 3 chaneels, i.e. _shape[2] has to be 3");
     shape = {_shape[0], _shape[1], 3};
@@ -27,7 +27,8 @@ RGBFrame::RGBFrame(const std::vector<size_t>& _shape, const std::vector<size_t>&
     data = _data;
     readOnly = _readOnly;
     stream = reinterpret_cast<CUstream>(_streamid);
-    isBGR = isBGR;
+    isBGR = _isBRG;
+    device = DLDevice{_deviceType, _deviceId};
 }
 
 RGBFrame::RGBFrame(const CAIMemoryView& to_convert, bool _isBRG) {
@@ -41,7 +42,8 @@ RGBFrame::RGBFrame(const CAIMemoryView& to_convert, bool _isBRG) {
     data = to_convert.data;
     readOnly = to_convert.readOnly;
     stream = to_convert.stream;
-    isBGR = isBGR;
+    isBGR = _isBRG;
+    device = to_convert.device;
 }
 
 RGBFrame::RGBFrame() {
@@ -57,7 +59,10 @@ RGBFrame::RGBFrame() {
 }
 
 void RGBFrame::release_data() {
-    CUDA_DRVAPI_CALL(cuMemFree(data));
+    // Host frames wrap memory allocated elsewhere, which is not owned by the frame
+    if (!isHost()) {
+        CUDA_DRVAPI_CALL(cuMemFree(data));
+    }
     data = reinterpret_cast<CUdeviceptr>(nullptr);
 }
 
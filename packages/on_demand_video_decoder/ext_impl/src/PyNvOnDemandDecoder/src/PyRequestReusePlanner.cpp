@@ -0,0 +1,118 @@
+/*
+ * Copyright (c) 2025, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "RequestReusePlanner.hpp"
+
+#include <memory>
+#include <pybind11/pybind11.h>
+#include <pybind11/stl.h>
+
+namespace py = pybind11;
+
+namespace {
+
+py::tuple SlotToTuple(const FrameSlot& slot) { return py::make_tuple(slot.video, slot.frame); }
+
+py::dict PlanToDict(const ReusePlan& plan) {
+    py::list reuse;
+    for (const FrameReuse& entry : plan.reuse) {
+        reuse.append(py::make_tuple(SlotToTuple(entry.dst), SlotToTuple(entry.src)));
+    }
+    py::list decode;
+    for (const FrameSlot& slot : plan.decode) {
+        decode.append(SlotToTuple(slot));
+    }
+    py::list keep_resident;
+    for (const ResidentGop& gop : plan.keep_resident) {
+        keep_resident.append(py::make_tuple(gop.filepath, gop.first_frame_id));
+    }
+    py::dict result;
+    result["reuse"] = reuse;
+    result["decode"] = decode;
+    result["keep_resident"] = keep_resident;
+    return result;
+}
+
+}  // namespace
+
+void Init_PyRequestReusePlanner(py::module& m) {
+    m.def("FingerprintFrame", &FingerprintFrame, py::arg("filepath"), py::arg("frame_id"),
+          py::arg("variant") = 0,
+          R"pbdoc(
+        Returns the 64-bit fingerprint of a (file, frame) pair, as used by :class:`RequestReusePlanner`.
+
+        Args:
+            filepath: Path of the video file
+            frame_id: Frame index
+            variant: Distinguishes non-interchangeable outputs of the same frame (e.g. RGB / BGR)
+        )pbdoc");
+
+    py::class_<RequestReusePlanner, std::shared_ptr<RequestReusePlanner>>(m, "RequestReusePlanner",
+                                                                          py::module_local(), R"pbdoc(
+        Plans which frames of a 2D request can be taken over from the previous (resident) result.
+
+        The frames of the resident request are indexed by 64-bit fingerprints of their (file, frame) pairs.
+        For a sliding window such as ``[t..t+k]`` followed by ``[t+1..t+k+1]``, only frame ``t+k+1`` has
+        to be decoded. This is the planner used by :class:`PyNvBatchAsyncStreamReader` with
+        ``reuse_frames=True``; it is a pure host component.
+        )pbdoc")
+        .def(py::init([](int default_gop_length) {
+                 return std::make_shared<RequestReusePlanner>(default_gop_length);
+             }),
+             py::arg("default_gop_length") = 0,
+             R"pbdoc(
+            Args:
+                default_gop_length: GOP length assumed for files without GOP boundaries (0: unknown)
+            )pbdoc")
+        .def("set_gop_boundaries", &RequestReusePlanner::SetGopBoundaries, py::arg("filepath"),
+             py::arg("first_frame_ids"),
+             R"pbdoc(
+            Sets the first frame ids of the GOPs of ``filepath``.
+            )pbdoc")
+        .def(
+            "plan",
+            [](const RequestReusePlanner& self, const std::vector<std::string>& filepaths,
+               const std::vector<std::vector<int>>& frame_ids, uint64_t variant) {
+                return PlanToDict(self.Plan(filepaths, frame_ids, variant));
+            },
+            py::arg("filepaths"), py::arg("frame_ids"), py::arg("variant") = 0,
+            R"pbdoc(
+            Plans a request against the resident request (which is not changed).
+
+            Args:
+                filepaths: Video file paths (one per video)
+                frame_ids: 2D list of frame ids, ``frame_ids[v][f]`` being the f-th frame of video v
+                variant: Output variant; frames are only reused within the same variant
+
+            Returns:
+                Dict with
+
+                - ``reuse``: List of ``((v, f), (v_resident, f_resident))`` pairs
+                - ``decode``: List of ``(v, f)`` of the frames to decode, ordered by video and frame
+                - ``keep_resident``: List of ``(filepath, first_frame_id)`` of the GOPs containing
+                  requested frames (for files with known GOP structure)
+            )pbdoc")
+        .def("set_resident", &RequestReusePlanner::SetResident, py::arg("filepaths"), py::arg("frame_ids"),
+             py::arg("variant") = 0,
+             R"pbdoc(
+            Makes the given request the resident one.
+            )pbdoc")
+        .def("clear", &RequestReusePlanner::Clear,
+             R"pbdoc(
+            Forgets the resident request.
+            )pbdoc")
+        .def_property_readonly("num_resident_frames", &RequestReusePlanner::NumResidentFrames);
+}
@@ -0,0 +1,173 @@
+/*
+ * Copyright (c) 2025, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "VideoDatasetBuilder.hpp"
+
+#include <map>
+#include <memory>
+#include <pybind11/pybind11.h>
+#include <pybind11/stl.h>
+
+namespace py = pybind11;
+
+namespace {
+
+py::dict StatsToDict(const VideoDatasetBuilderStats& stats) {
+    const double elapsed = stats.elapsed_s > 0.0 ? stats.elapsed_s : 1e-9;
+    py::dict res;
+    res["num_sequences"] = stats.num_sequences;
+    res["num_sequences_done"] = stats.num_sequences_done;
+    res["num_sequences_skipped"] = stats.num_sequences_skipped;
+    res["num_sequences_failed"] = stats.num_sequences_failed;
+    res["num_images"] = stats.num_images;
+    res["num_frames"] = stats.num_frames;
+    res["num_bytes"] = stats.num_bytes;
+    res["elapsed_s"] = stats.elapsed_s;
+    res["images_per_s"] = stats.num_images / elapsed;
+    res["frames_per_s"] = stats.num_frames / elapsed;
+    res["failed_sequences"] = stats.failed_sequences;
+    return res;
+}
+
+}  // namespace
+
+void Init_PyVideoDatasetBuilder(py::module& m) {
+    py::class_<VideoDatasetBuilder, std::shared_ptr<VideoDatasetBuilder>>(m, "VideoDatasetBuilder",
+                                                                           py::module_local(),
+                                                                           R"pbdoc(
+        Builds video datasets from image sequences in-process (libavcodec / libavformat).
+
+        Each sequence (list of JPEG / PNG images in display order) is encoded to one video file:
+
+        - Source images are decoded by a pool of threads shared by all sequences, ahead of the encoders.
+        - Optionally, linearly interpolated frames are inserted between consecutive images, so that source
+          image ``i`` ends up at video frame ``i * (interpolation_num_frames + 1)``.
+        - Several sequences are encoded concurrently. A keyframe is forced every ``gop_size`` frames.
+        - A GOP index sidecar (``<output>.gop_index.json``) is written for each video, containing
+          ``num_frames``, ``keyframe_ids`` and ``gop_lens`` as produced by the encoder (plus the encoding
+          parameters). ``keyframe_ids`` and ``num_frames`` can directly be used to create a
+          :class:`GopStructure`.
+
+        Any CPU video encoder of the FFmpeg build the package is linked against can be used
+        (see :meth:`available_encoders`). Outputs are written to temporary files and renamed when complete, so
+        failed or interrupted sequences do not leave partial videos behind.
+
+        Example:
+            >>> builder = VideoDatasetBuilder(
+            ...     encoder="libx265", encoder_options={"x265-params": "lowdelay=1"}, fps=12, gop_size=30
+            ... )
+            >>> stats = builder.build([front_images, back_images], ["seq/CAM_FRONT.mp4", "seq/CAM_BACK.mp4"])
+        )pbdoc")
+        .def(py::init([](const std::string& encoder,
+                         const std::map<std::string, std::string>& encoder_options,
+                         const std::string& pix_fmt, int fps, int gop_size, int max_b_frames,
+                         int interpolation_num_frames, int num_workers, int num_decode_threads,
+                         int max_frames_ahead, int encoder_threads, bool write_gop_index, bool skip_existing,
+                         double progress_interval_s) {
+                 VideoDatasetBuilderConfig config;
+                 config.encoder = encoder;
+                 config.encoder_options = encoder_options;
+                 config.pix_fmt = pix_fmt;
+                 config.fps = fps;
+                 config.gop_size = gop_size;
+                 config.max_b_frames = max_b_frames;
+                 config.interpolation_num_frames = interpolation_num_frames;
+                 config.num_workers = num_workers;
+                 config.num_decode_threads = num_decode_threads;
+                 config.max_frames_ahead = max_frames_ahead;
+                 config.encoder_threads = encoder_threads;
+                 config.write_gop_index = write_gop_index;
+                 config.skip_existing = skip_existing;
+                 config.progress_interval_s = progress_interval_s;
+                 return std::make_shared<VideoDatasetBuilder>(config);
+             }),
+             py::arg("encoder") = "libx265",
+             py::arg("encoder_options") = std::map<std::string, std::string>(),
+             py::arg("pix_fmt") = "yuv420p", py::arg("fps") = 12, py::arg("gop_size") = 30,
+             py::arg("max_b_frames") = 0, py::arg("interpolation_num_frames") = 0, py::arg("num_workers") = 4,
+             py::arg("num_decode_threads") = 8, py::arg("max_frames_ahead") = 16,
+             py::arg("encoder_threads") = 0, py::arg("write_gop_index") = true,
+             py::arg("skip_existing") = false, py::arg("progress_interval_s") = 30.0,
+             R"pbdoc(
+            Args:
+                encoder: Name of the CPU video encoder, e.g. ``"libx265"``, ``"libx264"``, ``"libsvtav1"``
+                encoder_options: Encoder options (generic codec options or private options of the encoder),
+                    e.g. ``{"x265-params": "lowdelay=1"}``, ``{"preset": "fast", "crf": "23"}``
+                pix_fmt: Pixel format of the encoded videos
+                fps: Frame rate of the encoded videos
+                gop_size: A keyframe is forced every ``gop_size`` frames
+                max_b_frames: Maximum number of consecutive B-frames
+                interpolation_num_frames: Number of linearly interpolated frames inserted between consecutive
+                    source images
+                num_workers: Number of sequences encoded concurrently
+                num_decode_threads: Number of threads decoding source images (shared by all sequences)
+                max_frames_ahead: Maximum number of source images decoded ahead of the encoder, per sequence
+                encoder_threads: Threads per encoder instance (0: chosen by the encoder)
+                write_gop_index: Write the GOP index sidecar next to each video
+                skip_existing: Skip sequences whose outputs already exist (resume an interrupted build)
+                progress_interval_s: Interval of the progress log records (INFO level); 0 disables them
+
+            Raises:
+                ValueError: If the encoder is not available, an encoder option or the pixel format is unknown,
+                    or a parameter is out of range
+            )pbdoc")
+        .def(
+            "build",
+            [](VideoDatasetBuilder& builder, const std::vector<std::vector<std::string>>& image_paths,
+               const std::vector<std::string>& output_paths) {
+                VideoDatasetBuilderStats stats;
+                {
+                    py::gil_scoped_release release;
+                    stats = builder.Build(image_paths, output_paths);
+                }
+                return StatsToDict(stats);
+            },
+            py::arg("image_paths"), py::arg("output_paths"),
+            R"pbdoc(
+            Encodes all sequences. Blocks until all sequences are processed or :meth:`stop` is called.
+
+            The GIL is released while running, so :meth:`stop` and :meth:`get_stats` can be called from
+            other Python threads. Failing sequences do not stop the build; they are reported in the result.
+
+            Args:
+                image_paths: Source images of each sequence, in display order. All images of a sequence are
+                    scaled to the size of its first image.
+                output_paths: Output video of each sequence. The container is chosen by the file extension;
+                    missing directories are created.
+
+            Returns:
+                Dict with the statistics of this run: ``num_sequences``, ``num_sequences_done``,
+                ``num_sequences_skipped``, ``num_sequences_failed``, ``num_images``, ``num_frames``,
+                ``num_bytes``, ``elapsed_s``, ``images_per_s``, ``frames_per_s`` and ``failed_sequences``
+                (list of ``(sequence index, error message)``)
+            )pbdoc")
+        .def("stop", &VideoDatasetBuilder::Stop,
+             R"pbdoc(Requests a running build to stop. Sequences in progress are discarded.)pbdoc")
+        .def(
+            "get_stats", [](const VideoDatasetBuilder& builder) { return StatsToDict(builder.GetStats()); },
+            R"pbdoc(Returns the statistics of the current (or last) run, see :meth:`build`.)pbdoc")
+        .def_static("available_encoders", &VideoDatasetBuilder::AvailableEncoders,
+                    R"pbdoc(
+            Returns the names of the CPU video encoders available in the linked FFmpeg build.
+            )pbdoc")
+        .def_static("available_image_decoders", &VideoDatasetBuilder::AvailableImageDecoders,
+                    R"pbdoc(
+            Returns the names of the source image decoders (``"mjpeg"``, ``"png"``) available in the linked
+            FFmpeg build.
+            )pbdoc")
+        .def_static("gop_index_path", &VideoDatasetBuilder::GopIndexPath, py::arg("output_path"),
+                    R"pbdoc(Returns the path of the GOP index sidecar of a video.)pbdoc");
+}
@@ -0,0 +1,117 @@
+/*
+ * Copyright (c) 2025, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "VideoRemuxer.hpp"
+
+#include <pybind11/pybind11.h>
+#include <pybind11/stl.h>
+
+namespace py = pybind11;
+
+namespace {
+
+py::dict ResultToDict(const RemuxResult& result) {
+    py::dict res;
+    res["input_path"] = result.input_path;
+    res["output_path"] = result.output_path;
+    res["ok"] = result.ok;
+    res["error"] = result.error;
+    res["num_frames"] = result.num_frames;
+    res["num_dropped_frames"] = result.num_dropped_frames;
+    res["num_gops"] = result.num_gops;
+    res["min_gop_len"] = result.min_gop_len;
+    res["max_gop_len"] = result.max_gop_len;
+    res["mean_gop_len"] = result.mean_gop_len;
+    res["is_cfr"] = result.is_cfr;
+    res["fps"] = result.fps;
+    res["needs_reencode"] = result.needs_reencode;
+    res["reencode_reasons"] = result.reencode_reasons;
+    return res;
+}
+
+}  // namespace
+
+void Init_PyVideoRemuxer(py::module& m) {
+    m.def(
+        "RemuxForRandomAccess",
+        [](const std::vector<std::string>& input_paths, const std::vector<std::string>& output_paths,
+           int num_threads, int max_gop_len, double cfr_tolerance, bool normalize_timestamps,
+           bool write_gop_index, const std::string& movflags) {
+            RemuxConfig config;
+            config.num_threads = num_threads;
+            config.max_gop_len = max_gop_len;
+            config.cfr_tolerance = cfr_tolerance;
+            config.normalize_timestamps = normalize_timestamps;
+            config.write_gop_index = write_gop_index;
+            config.movflags = movflags;
+            std::vector<RemuxResult> results;
+            {
+                py::gil_scoped_release release;
+                results = RemuxForRandomAccess(input_paths, output_paths, config);
+            }
+            py::list res;
+            for (const auto& result : results) {
+                res.append(ResultToDict(result));
+            }
+            return res;
+        },
+        py::arg("input_paths"), py::arg("output_paths") = std::vector<std::string>(),
+        py::arg("num_threads") = 4, py::arg("max_gop_len") = 64, py::arg("cfr_tolerance") = 0.25,
+        py::arg("normalize_timestamps") = true, py::arg("write_gop_index") = true,
+        py::arg("movflags") = RemuxConfig().movflags,
+        R"pbdoc(
+        Remuxes videos (without decoding) to fragmented MP4 files optimized for random access.
+
+        Only the video stream is kept and packets before the first keyframe are dropped. With the default
+        ``movflags``, each GOP is stored in its own fragment and a global ``sidx`` indexes all fragments, so
+        seeking to a GOP does not require scanning the file. With ``normalize_timestamps``, constant frame
+        rate timestamps are written whenever the source frame intervals are regular within ``cfr_tolerance``,
+        so the outputs are not treated as VFR by the decoders.
+
+        For each output, a GOP index sidecar (``<output>.gop_index.json``) with ``num_frames``,
+        ``keyframe_ids`` and ``gop_lens`` is written (see :class:`VideoDatasetBuilder`).
+
+        The GOP structure is taken from the keyframe flags of the source packets. Videos which remain
+        expensive to access after remuxing (GOPs longer than ``max_gop_len``, variable frame rate) are
+        flagged with ``needs_reencode``.
+
+        Args:
+            input_paths: Source videos
+            output_paths: Output file of each source video; empty to only analyze the sources
+            num_threads: Number of files processed in parallel
+            max_gop_len: Videos with longer GOPs are flagged for re-encoding; 0 disables the check
+            cfr_tolerance: Maximum deviation of a frame interval from the median interval (as a fraction
+                of it) for the timestamps to be considered constant frame rate
+            normalize_timestamps: Write constant frame rate timestamps if possible; otherwise, the source
+                timestamps are only shifted to start at 0
+            write_gop_index: Write the GOP index sidecar next to each output
+            movflags: Flags of the MP4 muxer
+
+        Returns:
+            List with one dict per input: ``input_path``, ``output_path``, ``ok``, ``error``, ``num_frames``,
+            ``num_dropped_frames``, ``num_gops``, ``min_gop_len``, ``max_gop_len``, ``mean_gop_len``,
+            ``is_cfr``, ``fps``, ``needs_reencode`` and ``reencode_reasons``. Failing files do not stop the
+            other files; they are reported with ``ok == False``.
+
+        Raises:
+            ValueError: If ``output_paths`` is not empty and has a different length than ``input_paths``,
+                or ``cfr_tolerance`` is negative
+
+        Example:
+            >>> results = RemuxForRandomAccess(["raw/cam0.mp4"], ["remuxed/cam0.mp4"])
+            >>> to_reencode = [r["input_path"] for r in results if r["needs_reencode"]]
+        )pbdoc");
+}
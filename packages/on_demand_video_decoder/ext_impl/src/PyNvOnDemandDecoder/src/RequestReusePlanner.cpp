@@ -0,0 +1,154 @@
+/*
+ * Copyright (c) 2025, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "RequestReusePlanner.hpp"
+
+#include <algorithm>
+#include <iterator>
+#include <set>
+#include <stdexcept>
+#include <utility>
+
+namespace {
+
+// FNV-1a
+uint64_t HashPath(const std::string& filepath) {
+    uint64_t hash = 0xcbf29ce484222325ull;
+    for (const unsigned char c : filepath) {
+        hash ^= c;
+        hash *= 0x100000001b3ull;
+    }
+    return hash;
+}
+
+// Finalizer of splitmix64
+uint64_t Mix64(uint64_t x) {
+    x ^= x >> 30;
+    x *= 0xbf58476d1ce4e5b9ull;
+    x ^= x >> 27;
+    x *= 0x94d049bb133111ebull;
+    x ^= x >> 31;
+    return x;
+}
+
+uint64_t CombineFingerprint(uint64_t path_hash, int frame_id, uint64_t variant) {
+    const uint64_t frame_key = static_cast<uint64_t>(static_cast<uint32_t>(frame_id)) ^ (variant << 32);
+    return Mix64(path_hash ^ Mix64(frame_key + 0x9e3779b97f4a7c15ull));
+}
+
+void CheckRequest(const std::vector<std::string>& filepaths, const std::vector<std::vector<int>>& frame_ids) {
+    if (filepaths.size() != frame_ids.size()) {
+        throw std::invalid_argument("[ERROR] filepaths and frame_ids must have the same length");
+    }
+}
+
+}  // namespace
+
+uint64_t FingerprintFrame(const std::string& filepath, int frame_id, uint64_t variant) {
+    return CombineFingerprint(HashPath(filepath), frame_id, variant);
+}
+
+RequestReusePlanner::RequestReusePlanner(int default_gop_length) : default_gop_length(default_gop_length) {
+    if (default_gop_length < 0) {
+        throw std::invalid_argument("[ERROR] default_gop_length must be >= 0");
+    }
+}
+
+void RequestReusePlanner::SetGopBoundaries(const std::string& filepath, std::vector<int> first_frame_ids) {
+    std::sort(first_frame_ids.begin(), first_frame_ids.end());
+    first_frame_ids.erase(std::unique(first_frame_ids.begin(), first_frame_ids.end()), first_frame_ids.end());
+    gop_boundaries[filepath] = std::move(first_frame_ids);
+}
+
+int RequestReusePlanner::GopStart(const std::string& filepath, int frame_id) const {
+    const auto it = gop_boundaries.find(filepath);
+    if (it != gop_boundaries.end() && !it->second.empty()) {
+        const std::vector<int>& starts = it->second;
+        auto next = std::upper_bound(starts.begin(), starts.end(), frame_id);
+        return next == starts.begin() ? starts.front() : *std::prev(next);
+    }
+    if (default_gop_length > 0) {
+        return frame_id - frame_id % default_gop_length;
+    }
+    return -1;
+}
+
+ReusePlan RequestReusePlanner::Plan(const std::vector<std::string>& filepaths,
+                                    const std::vector<std::vector<int>>& frame_ids, uint64_t variant) const {
+    CheckRequest(filepaths, frame_ids);
+    ReusePlan plan;
+    std::set<std::pair<std::string, int>> gops;
+    const bool can_reuse = !resident_index.empty() && variant == resident_variant;
+
+    for (size_t v = 0; v < filepaths.size(); ++v) {
+        const uint64_t path_hash = HashPath(filepaths[v]);
+        for (size_t f = 0; f < frame_ids[v].size(); ++f) {
+            const int frame_id = frame_ids[v][f];
+            const FrameSlot dst{static_cast<int>(v), static_cast<int>(f)};
+
+            bool reused = false;
+            if (can_reuse) {
+                const auto it = resident_index.find(CombineFingerprint(path_hash, frame_id, variant));
+                if (it != resident_index.end()) {
+                    const FrameSlot& src = it->second;
+                    reused = resident_filepaths[src.video] == filepaths[v] &&
+                             resident_frame_ids[src.video][src.frame] == frame_id;
+                    if (reused) {
+                        plan.reuse.push_back(FrameReuse{dst, src});
+                    }
+                }
+            }
+            if (!reused) {
+                plan.decode.push_back(dst);
+            }
+
+            const int gop_start = GopStart(filepaths[v], frame_id);
+            if (gop_start >= 0) {
+                gops.emplace(filepaths[v], gop_start);
+            }
+        }
+    }
+
+    plan.keep_resident.reserve(gops.size());
+    for (const auto& gop : gops) {
+        plan.keep_resident.push_back(ResidentGop{gop.first, gop.second});
+    }
+    return plan;
+}
+
+void RequestReusePlanner::SetResident(const std::vector<std::string>& filepaths,
+                                      const std::vector<std::vector<int>>& frame_ids, uint64_t variant) {
+    CheckRequest(filepaths, frame_ids);
+    resident_index.clear();
+    for (size_t v = 0; v < filepaths.size(); ++v) {
+        const uint64_t path_hash = HashPath(filepaths[v]);
+        for (size_t f = 0; f < frame_ids[v].size(); ++f) {
+            // Keep the first occurrence of duplicated frames
+            resident_index.emplace(CombineFingerprint(path_hash, frame_ids[v][f], variant),
+                                   FrameSlot{static_cast<int>(v), static_cast<int>(f)});
+        }
+    }
+    resident_filepaths = filepaths;
+    resident_frame_ids = frame_ids;
+    resident_variant = variant;
+}
+
+void RequestReusePlanner::Clear() {
+    resident_index.clear();
+    resident_filepaths.clear();
+    resident_frame_ids.clear();
+    resident_variant = 0;
+}
@@ -0,0 +1,705 @@
+/*
+ * Copyright (c) 2025, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "VideoDatasetBuilder.hpp"
+
+#include <algorithm>
+#include <condition_variable>
+#include <deque>
+#include <filesystem>
+#include <fstream>
+#include <future>
+#include <iomanip>
+#include <memory>
+#include <stdexcept>
+#include <thread>
+
+extern "C" {
+#include <libavcodec/avcodec.h>
+#include <libavformat/avformat.h>
+#include <libavutil/imgutils.h>
+#include <libavutil/opt.h>
+#include <libavutil/pixdesc.h>
+#include <libswscale/swscale.h>
+}
+
+#include "GopIndexSidecar.hpp"
+#include "Logger.h"
+#include "nvtx3/nvtx3.hpp"
+
+namespace fs = std::filesystem;
+
+namespace {
+
+// Thrown inside a sequence when Stop() was requested
+struct BuildStopped {};
+
+std::string AvErrorString(int error) {
+    char buf[AV_ERROR_MAX_STRING_SIZE] = {0};
+    av_strerror(error, buf, sizeof(buf));
+    return buf;
+}
+
+void CheckAv(int error, const std::string& what) {
+    if (error < 0) {
+        throw std::runtime_error("[ERROR] " + what + ": " + AvErrorString(error));
+    }
+}
+
+struct FrameDeleter {
+    void operator()(AVFrame* frame) const { av_frame_free(&frame); }
+};
+struct PacketDeleter {
+    void operator()(AVPacket* packet) const { av_packet_free(&packet); }
+};
+struct CodecContextDeleter {
+    void operator()(AVCodecContext* ctx) const { avcodec_free_context(&ctx); }
+};
+struct SwsContextDeleter {
+    void operator()(SwsContext* ctx) const { sws_freeContext(ctx); }
+};
+struct OutputContextDeleter {
+    void operator()(AVFormatContext* ctx) const {
+        if (ctx->pb && !(ctx->oformat->flags & AVFMT_NOFILE)) {
+            avio_closep(&ctx->pb);
+        }
+        avformat_free_context(ctx);
+    }
+};
+using FramePtr = std::unique_ptr<AVFrame, FrameDeleter>;
+using PacketPtr = std::unique_ptr<AVPacket, PacketDeleter>;
+using CodecContextPtr = std::unique_ptr<AVCodecContext, CodecContextDeleter>;
+using SwsContextPtr = std::unique_ptr<SwsContext, SwsContextDeleter>;
+using OutputContextPtr = std::unique_ptr<AVFormatContext, OutputContextDeleter>;
+
+FramePtr AllocFrame(int width, int height, AVPixelFormat pix_fmt) {
+    FramePtr frame(av_frame_alloc());
+    if (!frame) {
+        throw std::bad_alloc();
+    }
+    frame->width = width;
+    frame->height = height;
+    frame->format = pix_fmt;
+    CheckAv(av_frame_get_buffer(frame.get(), 0), "Failed to allocate frame");
+    return frame;
+}
+
+bool IsFullRange(AVPixelFormat pix_fmt, AVColorRange color_range) {
+    const AVPixFmtDescriptor* desc = av_pix_fmt_desc_get(pix_fmt);
+    if (desc->flags & AV_PIX_FMT_FLAG_RGB) {
+        return true;
+    }
+    switch (pix_fmt) {
+        case AV_PIX_FMT_YUVJ420P:
+        case AV_PIX_FMT_YUVJ422P:
+        case AV_PIX_FMT_YUVJ444P:
+        case AV_PIX_FMT_YUVJ440P:
+        case AV_PIX_FMT_YUVJ411P:
+            return true;
+        default:
+            return color_range == AVCOL_RANGE_JPEG;
+    }
+}
+
+// Whether frames of this pixel format can be interpolated component-wise
+void CheckBlendable(AVPixelFormat pix_fmt) {
+    const AVPixFmtDescriptor* desc = av_pix_fmt_desc_get(pix_fmt);
+    const bool unsupported_layout =
+        desc->flags & (AV_PIX_FMT_FLAG_PAL | AV_PIX_FMT_FLAG_BITSTREAM | AV_PIX_FMT_FLAG_FLOAT);
+    const bool wrong_endianness = desc->comp[0].depth > 8 && (desc->flags & AV_PIX_FMT_FLAG_BE);
+    if (unsupported_layout || wrong_endianness || desc->comp[0].depth > 16) {
+        throw std::invalid_argument(
+            std::string("[ERROR] Frame interpolation is not supported for pixel format ") + desc->name);
+    }
+}
+
+// out = a + (b - a) * weight for frames with the same size and pixel format
+void BlendFrames(const AVFrame* a, const AVFrame* b, double weight, AVFrame* out) {
+    const AVPixelFormat pix_fmt = static_cast<AVPixelFormat>(out->format);
+    const AVPixFmtDescriptor* desc = av_pix_fmt_desc_get(pix_fmt);
+    const bool is_16bit = desc->comp[0].depth > 8;
+    const bool is_rgb = desc->flags & AV_PIX_FMT_FLAG_RGB;
+    // 8 bit fixed point weights
+    const uint32_t weight_b = static_cast<uint32_t>(weight * 256.0 + 0.5);
+    const uint32_t weight_a = 256 - weight_b;
+    for (int plane = 0; plane < av_pix_fmt_count_planes(pix_fmt); ++plane) {
+        const bool is_chroma = !is_rgb && (plane == 1 || plane == 2);
+        const int rows = is_chroma ? AV_CEIL_RSHIFT(out->height, desc->log2_chroma_h) : out->height;
+        const int row_bytes = av_image_get_linesize(pix_fmt, out->width, plane);
+        for (int y = 0; y < rows; ++y) {
+            const uint8_t* row_a = a->data[plane] + static_cast<ptrdiff_t>(y) * a->linesize[plane];
+            const uint8_t* row_b = b->data[plane] + static_cast<ptrdiff_t>(y) * b->linesize[plane];
+            uint8_t* row_out = out->data[plane] + static_cast<ptrdiff_t>(y) * out->linesize[plane];
+            if (is_16bit) {
+                const uint16_t* src_a = reinterpret_cast<const uint16_t*>(row_a);
+                const uint16_t* src_b = reinterpret_cast<const uint16_t*>(row_b);
+                uint16_t* dst = reinterpret_cast<uint16_t*>(row_out);
+                for (int x = 0; x < row_bytes / 2; ++x) {
+                    dst[x] = static_cast<uint16_t>((src_a[x] * weight_a + src_b[x] * weight_b + 128) >> 8);
+                }
+            } else {
+                for (int x = 0; x < row_bytes; ++x) {
+                    row_out[x] = static_cast<uint8_t>((row_a[x] * weight_a + row_b[x] * weight_b + 128) >> 8);
+                }
+            }
+        }
+    }
+}
+
+AVCodecID DetectImageCodec(const uint8_t* data, size_t size) {
+    static const uint8_t kJpegMagic[] = {0xFF, 0xD8, 0xFF};
+    static const uint8_t kPngMagic[] = {0x89, 'P', 'N', 'G', 0x0D, 0x0A, 0x1A, 0x0A};
+    if (size >= sizeof(kJpegMagic) && std::equal(kJpegMagic, kJpegMagic + sizeof(kJpegMagic), data)) {
+        return AV_CODEC_ID_MJPEG;
+    }
+    if (size >= sizeof(kPngMagic) && std::equal(kPngMagic, kPngMagic + sizeof(kPngMagic), data)) {
+        return AV_CODEC_ID_PNG;
+    }
+    return AV_CODEC_ID_NONE;
+}
+
+/**
+ * Decodes images and converts them to the pixel format of the encoder. Not thread safe; each decode thread
+ * owns one instance, so decoder and conversion contexts are reused across images.
+ */
+class ImageDecoder {
+   public:
+    ImageDecoder() : packet(av_packet_alloc()), decoded(av_frame_alloc()) {
+        if (!packet || !decoded) {
+            throw std::bad_alloc();
+        }
+    }
+
+    // width / height <= 0 keep the size of the image
+    FramePtr Decode(const std::string& path, int width, int height, AVPixelFormat pix_fmt) {
+        av_packet_unref(packet.get());
+        av_frame_unref(decoded.get());
+
+        std::ifstream file(path, std::ios::binary | std::ios::ate);
+        if (!file) {
+            throw std::runtime_error("[ERROR] Failed to open image: " + path);
+        }
+        const std::streamsize size = file.tellg();
+        if (size <= 0) {
+            throw std::runtime_error("[ERROR] Empty image file: " + path);
+        }
+        file.seekg(0);
+        // av_new_packet() adds (zeroed) padding as required by the decoders
+        CheckAv(av_new_packet(packet.get(), static_cast<int>(size)), "Failed to allocate packet");
+        if (!file.read(reinterpret_cast<char*>(packet->data), size)) {
+            throw std::runtime_error("[ERROR] Failed to read image: " + path);
+        }
+
+        const AVCodecID codec_id = DetectImageCodec(packet->data, static_cast<size_t>(size));
+        if (codec_id == AV_CODEC_ID_NONE) {
+            throw std::runtime_error("[ERROR] Unsupported image format (expected JPEG or PNG): " + path);
+        }
+        AVCodecContext* ctx = GetDecoder(codec_id);
+        avcodec_flush_buffers(ctx);
+        CheckAv(avcodec_send_packet(ctx, packet.get()), "Failed to decode image " + path);
+        int error = avcodec_receive_frame(ctx, decoded.get());
+        if (error == AVERROR(EAGAIN)) {
+            CheckAv(avcodec_send_packet(ctx, nullptr), "Failed to decode image " + path);
+            error = avcodec_receive_frame(ctx, decoded.get());
+        }
+        CheckAv(error, "Failed to decode image " + path);
+
+        const AVPixelFormat src_fmt = static_cast<AVPixelFormat>(decoded->format);
+        const int dst_width = width > 0 ? width : decoded->width;
+        const int dst_height = height > 0 ? height : decoded->height;
+        SwsContext* sws =
+            sws_getCachedContext(converter.release(), decoded->width, decoded->height, src_fmt, dst_width,
+                                 dst_height, pix_fmt, SWS_BICUBIC, nullptr, nullptr, nullptr);
+        converter.reset(sws);
+        if (!sws) {
+            throw std::runtime_error(std::string("[ERROR] Unsupported conversion from ") +
+                                     av_get_pix_fmt_name(src_fmt) + " to " + av_get_pix_fmt_name(pix_fmt) +
+                                     " for image: " + path);
+        }
+        // JPEG images are full range, the encoded video uses the range of its pixel format
+        const int* coefficients = sws_getCoefficients(SWS_CS_ITU601);
+        sws_setColorspaceDetails(sws, coefficients, IsFullRange(src_fmt, decoded->color_range), coefficients,
+                                 IsFullRange(pix_fmt, AVCOL_RANGE_UNSPECIFIED), 0, 1 << 16, 1 << 16);
+
+        FramePtr frame = AllocFrame(dst_width, dst_height, pix_fmt);
+        sws_scale(sws, decoded->data, decoded->linesize, 0, decoded->height, frame->data, frame->linesize);
+        return frame;
+    }
+
+   private:
+    AVCodecContext* GetDecoder(AVCodecID codec_id) {
+        auto it = decoders.find(codec_id);
+        if (it != decoders.end()) {
+            return it->second.get();
+        }
+        const AVCodec* codec = avcodec_find_decoder(codec_id);
+        if (!codec) {
+            throw std::runtime_error(std::string("[ERROR] The linked FFmpeg build has no decoder for ") +
+                                     avcodec_get_name(codec_id));
+        }
+        CodecContextPtr ctx(avcodec_alloc_context3(codec));
+        if (!ctx) {
+            throw std::bad_alloc();
+        }
+        // Images are decoded in parallel by the decode threads
+        ctx->thread_count = 1;
+        CheckAv(avcodec_open2(ctx.get(), codec, nullptr),
+                std::string("Failed to open decoder ") + avcodec_get_name(codec_id));
+        return decoders.emplace(codec_id, std::move(ctx)).first->second.get();
+    }
+
+    std::map<AVCodecID, CodecContextPtr> decoders;
+    SwsContextPtr converter;
+    PacketPtr packet;
+    FramePtr decoded;
+};
+
+}  // namespace
+
+/**
+ * Pool of threads decoding source images for all sequences (FIFO, so sequences are served in the order in
+ * which they request images)
+ */
+class VideoDatasetBuilder::DecodePool {
+   public:
+    explicit DecodePool(int num_threads) {
+        threads.reserve(num_threads);
+        for (int i = 0; i < num_threads; ++i) {
+            threads.emplace_back(&DecodePool::ThreadLoop, this);
+        }
+    }
+
+    ~DecodePool() {
+        {
+            std::lock_guard<std::mutex> lock(mtx);
+            stopping = true;
+            tasks.clear();
+        }
+        cv.notify_all();
+        for (auto& thread : threads) {
+            thread.join();
+        }
+    }
+
+    std::future<FramePtr> Submit(const std::string& path, int width, int height, AVPixelFormat pix_fmt) {
+        Task task{path, width, height, pix_fmt, {}};
+        std::future<FramePtr> result = task.result.get_future();
+        {
+            std::lock_guard<std::mutex> lock(mtx);
+            tasks.push_back(std::move(task));
+        }
+        cv.notify_one();
+        return result;
+    }
+
+   private:
+    struct Task {
+        std::string path;
+        int width;
+        int height;
+        AVPixelFormat pix_fmt;
+        std::promise<FramePtr> result;
+    };
+
+    void ThreadLoop() {
+        std::unique_ptr<ImageDecoder> decoder;
+        while (true) {
+            Task task;
+            {
+                std::unique_lock<std::mutex> lock(mtx);
+                cv.wait(lock, [this]() { return stopping || !tasks.empty(); });
+                if (stopping) {
+                    return;
+                }
+                task = std::move(tasks.front());
+                tasks.pop_front();
+            }
+            try {
+                if (!decoder) {
+                    decoder = std::make_unique<ImageDecoder>();
+                }
+                task.result.set_value(decoder->Decode(task.path, task.width, task.height, task.pix_fmt));
+            } catch (...) {
+                task.result.set_exception(std::current_exception());
+            }
+        }
+    }
+
+    std::mutex mtx;
+    std::condition_variable cv;
+    std::deque<Task> tasks;
+    bool stopping = false;
+    std::vector<std::thread> threads;
+};
+
+VideoDatasetBuilder::VideoDatasetBuilder(const VideoDatasetBuilderConfig& config) : config(config) {
+    if (config.fps <= 0) {
+        throw std::invalid_argument("[ERROR] fps must be positive");
+    }
+    if (config.gop_size <= 0) {
+        throw std::invalid_argument("[ERROR] gop_size must be positive");
+    }
+    if (config.max_b_frames < 0 || config.interpolation_num_frames < 0 || config.encoder_threads < 0) {
+        throw std::invalid_argument(
+            "[ERROR] max_b_frames, interpolation_num_frames and encoder_threads must not be negative");
+    }
+    if (config.num_workers <= 0 || config.num_decode_threads <= 0 || config.max_frames_ahead <= 0) {
+        throw std::invalid_argument(
+            "[ERROR] num_workers, num_decode_threads and max_frames_ahead must be positive");
+    }
+
+    const AVCodec* codec = avcodec_find_encoder_by_name(config.encoder.c_str());
+    if (!codec || codec->type != AVMEDIA_TYPE_VIDEO) {
+        throw std::invalid_argument("[ERROR] Video encoder " + config.encoder +
+                                    " is not available in the linked FFmpeg build");
+    }
+    if (codec->capabilities & AV_CODEC_CAP_HARDWARE) {
+        throw std::invalid_argument("[ERROR] " + config.encoder +
+                                    " is a hardware encoder; use a CPU encoder");
+    }
+    // Catch misspelled options before encoding anything
+    const AVClass* codec_class = avcodec_get_class();
+    const AVClass* private_class = codec->priv_class;
+    for (const auto& option : config.encoder_options) {
+        const char* name = option.first.c_str();
+        if (!av_opt_find(&codec_class, name, nullptr, 0, AV_OPT_SEARCH_FAKE_OBJ) &&
+            !(private_class && av_opt_find(&private_class, name, nullptr, 0, AV_OPT_SEARCH_FAKE_OBJ))) {
+            throw std::invalid_argument("[ERROR] Unknown option for encoder " + config.encoder + ": " +
+                                        option.first);
+        }
+    }
+
+    const AVPixelFormat pix_fmt = av_get_pix_fmt(config.pix_fmt.c_str());
+    if (pix_fmt == AV_PIX_FMT_NONE) {
+        throw std::invalid_argument("[ERROR] Unknown pixel format: " + config.pix_fmt);
+    }
+    if (config.interpolation_num_frames > 0) {
+        CheckBlendable(pix_fmt);
+    }
+}
+
+VideoDatasetBuilderStats VideoDatasetBuilder::GetStats() const {
+    std::lock_guard<std::mutex> lock(stats_mtx);
+    VideoDatasetBuilderStats res = stats;
+    if (running) {
+        res.elapsed_s = std::chrono::duration<double>(std::chrono::steady_clock::now() - start_time).count();
+    }
+    return res;
+}
+
+std::vector<std::string> VideoDatasetBuilder::AvailableEncoders() {
+    std::vector<std::string> names;
+    void* iter = nullptr;
+    while (const AVCodec* codec = av_codec_iterate(&iter)) {
+        if (av_codec_is_encoder(codec) && codec->type == AVMEDIA_TYPE_VIDEO &&
+            !(codec->capabilities & AV_CODEC_CAP_HARDWARE)) {
+            names.push_back(codec->name);
+        }
+    }
+    std::sort(names.begin(), names.end());
+    return names;
+}
+
+std::vector<std::string> VideoDatasetBuilder::AvailableImageDecoders() {
+    std::vector<std::string> names;
+    for (AVCodecID codec_id : {AV_CODEC_ID_MJPEG, AV_CODEC_ID_PNG}) {
+        if (const AVCodec* codec = avcodec_find_decoder(codec_id)) {
+            names.push_back(codec->name);
+        }
+    }
+    return names;
+}
+
+void VideoDatasetBuilder::LogProgress() {
+    const VideoDatasetBuilderStats current = GetStats();
+    const double elapsed = std::max(current.elapsed_s, 1e-9);
+    const uint64_t num_finished =
+        current.num_sequences_done + current.num_sequences_skipped + current.num_sequences_failed;
+    LOG(INFO) << "[VideoDatasetBuilder] sequences " << num_finished << "/" << current.num_sequences
+              << " (skipped " << current.num_sequences_skipped << ", failed " << current.num_sequences_failed
+              << "), images " << current.num_images << ", frames " << current.num_frames << ", " << std::fixed
+              << std::setprecision(1) << current.num_images / elapsed << " images/s, "
+              << current.num_frames / elapsed << " frames/s";
+}
+
+VideoDatasetBuilderStats VideoDatasetBuilder::Build(const std::vector<std::vector<std::string>>& image_paths,
+                                                    const std::vector<std::string>& output_paths) {
+    if (image_paths.size() != output_paths.size()) {
+        throw std::invalid_argument("[ERROR] image_paths and output_paths must have the same length");
+    }
+    {
+        std::lock_guard<std::mutex> lock(stats_mtx);
+        if (running) {
+            throw std::runtime_error("[ERROR] VideoDatasetBuilder is already running");
+        }
+        stats = VideoDatasetBuilderStats();
+        stats.num_sequences = image_paths.size();
+        start_time = std::chrono::steady_clock::now();
+        running = true;
+    }
+    stop_requested = false;
+    nvtxRangePushA("VideoDatasetBuilder_Build");
+
+    {
+        DecodePool decode_pool(config.num_decode_threads);
+        std::atomic<uint64_t> next_sequence{0};
+        std::mutex finished_mtx;
+        std::condition_variable finished_cv;
+        const int num_workers =
+            static_cast<int>(std::min<size_t>(config.num_workers, std::max<size_t>(image_paths.size(), 1)));
+        int num_active_workers = num_workers;
+
+        auto worker_loop = [&]() {
+            while (!stop_requested) {
+                const uint64_t id = next_sequence++;
+                if (id >= image_paths.size()) {
+                    break;
+                }
+                const std::string& output_path = output_paths[id];
+                const std::string done_marker =
+                    config.write_gop_index ? GopIndexPath(output_path) : output_path;
+                if (config.skip_existing && fs::exists(done_marker)) {
+                    std::lock_guard<std::mutex> lock(stats_mtx);
+                    ++stats.num_sequences_skipped;
+                    continue;
+                }
+                try {
+                    const uint64_t num_bytes = EncodeSequence(decode_pool, image_paths[id], output_path);
+                    std::lock_guard<std::mutex> lock(stats_mtx);
+                    ++stats.num_sequences_done;
+                    stats.num_bytes += num_bytes;
+                } catch (const BuildStopped&) {
+                    break;
+                } catch (const std::exception& e) {
+                    LOG(ERROR) << "Failed to build " << output_path << ": " << e.what();
+                    std::lock_guard<std::mutex> lock(stats_mtx);
+                    ++stats.num_sequences_failed;
+                    stats.failed_sequences.emplace_back(id, e.what());
+                }
+            }
+            {
+                std::lock_guard<std::mutex> lock(finished_mtx);
+                --num_active_workers;
+            }
+            finished_cv.notify_all();
+        };
+
+        std::vector<std::thread> workers;
+        workers.reserve(num_workers);
+        for (int i = 0; i < num_workers; ++i) {
+            workers.emplace_back(worker_loop);
+        }
+        {
+            std::unique_lock<std::mutex> lock(finished_mtx);
+            const auto all_finished = [&]() { return num_active_workers == 0; };
+            if (config.progress_interval_s > 0) {
+                const auto interval = std::chrono::duration<double>(config.progress_interval_s);
+                while (!finished_cv.wait_for(lock, interval, all_finished)) {
+                    LogProgress();
+                }
+            } else {
+                finished_cv.wait(lock, all_finished);
+            }
+        }
+        for (auto& worker : workers) {
+            worker.join();
+        }
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(stats_mtx);
+        const auto now = std::chrono::steady_clock::now();
+        stats.elapsed_s = std::chrono::duration<double>(now - start_time).count();
+        running = false;
+    }
+    if (config.progress_interval_s > 0) {
+        LogProgress();
+    }
+    nvtxRangePop();  // VideoDatasetBuilder_Build
+    return GetStats();
+}
+
+uint64_t VideoDatasetBuilder::EncodeSequence(DecodePool& decode_pool,
+                                             const std::vector<std::string>& image_paths,
+                                             const std::string& output_path) {
+    if (image_paths.empty()) {
+        throw std::runtime_error("[ERROR] No images given for " + output_path);
+    }
+    nvtxRangePushA("VideoDatasetBuilder_EncodeSequence");
+    const AVPixelFormat pix_fmt = av_get_pix_fmt(config.pix_fmt.c_str());
+    const std::string tmp_path = output_path + ".tmp";
+    const fs::path parent_dir = fs::path(output_path).parent_path();
+    if (!parent_dir.empty()) {
+        fs::create_directories(parent_dir);
+    }
+
+    // Frame-level progress is published once per source image
+    auto add_progress = [this](uint64_t num_images, uint64_t num_frames) {
+        std::lock_guard<std::mutex> lock(stats_mtx);
+        stats.num_images += num_images;
+        stats.num_frames += num_frames;
+    };
+
+    try {
+        // The first image determines the size of the video; the following ones are decoded ahead
+        FramePtr current = decode_pool.Submit(image_paths[0], 0, 0, pix_fmt).get();
+        const int width = current->width;
+        const int height = current->height;
+        std::deque<std::future<FramePtr>> decoded_ahead;
+        size_t next_submit = 1;
+        auto submit_ahead = [&]() {
+            while (next_submit < image_paths.size() &&
+                   decoded_ahead.size() < static_cast<size_t>(config.max_frames_ahead)) {
+                decoded_ahead.push_back(
+                    decode_pool.Submit(image_paths[next_submit++], width, height, pix_fmt));
+            }
+        };
+        submit_ahead();
+
+        // The muxer is chosen by the extension of the final path, the data goes to the temporary file
+        auto* output_format = av_guess_format(nullptr, output_path.c_str(), nullptr);
+        if (!output_format) {
+            throw std::runtime_error("[ERROR] Cannot determine the container format of " + output_path);
+        }
+        AVFormatContext* output_ctx_raw = nullptr;
+        CheckAv(avformat_alloc_output_context2(&output_ctx_raw, output_format, nullptr, tmp_path.c_str()),
+                "Failed to create output context for " + output_path);
+        OutputContextPtr output_ctx(output_ctx_raw);
+
+        const AVCodec* codec = avcodec_find_encoder_by_name(config.encoder.c_str());
+        CodecContextPtr encoder(avcodec_alloc_context3(codec));
+        if (!encoder) {
+            throw std::bad_alloc();
+        }
+        encoder->width = width;
+        encoder->height = height;
+        encoder->pix_fmt = pix_fmt;
+        encoder->time_base = AVRational{1, config.fps};
+        encoder->framerate = AVRational{config.fps, 1};
+        encoder->gop_size = config.gop_size;
+        encoder->max_b_frames = config.max_b_frames;
+        encoder->thread_count = config.encoder_threads;
+        if (!(av_pix_fmt_desc_get(pix_fmt)->flags & AV_PIX_FMT_FLAG_RGB)) {
+            encoder->color_range =
+                IsFullRange(pix_fmt, AVCOL_RANGE_UNSPECIFIED) ? AVCOL_RANGE_JPEG : AVCOL_RANGE_MPEG;
+        }
+        if (output_ctx->oformat->flags & AVFMT_GLOBALHEADER) {
+            encoder->flags |= AV_CODEC_FLAG_GLOBAL_HEADER;
+        }
+        AVDictionary* options = nullptr;
+        for (const auto& option : config.encoder_options) {
+            av_dict_set(&options, option.first.c_str(), option.second.c_str(), 0);
+        }
+        const int open_error = avcodec_open2(encoder.get(), codec, &options);
+        av_dict_free(&options);
+        CheckAv(open_error, "Failed to open encoder " + config.encoder + " for " + output_path);
+
+        AVStream* stream = avformat_new_stream(output_ctx.get(), nullptr);
+        if (!stream) {
+            throw std::runtime_error("[ERROR] Failed to create video stream for " + output_path);
+        }
+        CheckAv(avcodec_parameters_from_context(stream->codecpar, encoder.get()),
+                "Failed to set stream parameters for " + output_path);
+        stream->time_base = encoder->time_base;
+        stream->avg_frame_rate = encoder->framerate;
+        if (!(output_ctx->oformat->flags & AVFMT_NOFILE)) {
+            CheckAv(avio_open(&output_ctx->pb, tmp_path.c_str(), AVIO_FLAG_WRITE),
+                    "Failed to open " + tmp_path);
+        }
+        CheckAv(avformat_write_header(output_ctx.get(), nullptr), "Failed to write header of " + output_path);
+
+        PacketPtr packet(av_packet_alloc());
+        if (!packet) {
+            throw std::bad_alloc();
+        }
+        std::vector<int> keyframe_ids;
+        int num_frames = 0;
+        auto write_packets = [&]() {
+            while (true) {
+                const int error = avcodec_receive_packet(encoder.get(), packet.get());
+                if (error == AVERROR(EAGAIN) || error == AVERROR_EOF) {
+                    return;
+                }
+                CheckAv(error, "Failed to encode " + output_path);
+                // Packet timestamps are frame ids in the encoder time base
+                if (packet->flags & AV_PKT_FLAG_KEY) {
+                    keyframe_ids.push_back(static_cast<int>(packet->pts));
+                }
+                av_packet_rescale_ts(packet.get(), encoder->time_base, stream->time_base);
+                packet->stream_index = stream->index;
+                CheckAv(av_interleaved_write_frame(output_ctx.get(), packet.get()),
+                        "Failed to write " + output_path);
+            }
+        };
+        auto encode = [&](AVFrame* frame) {
+            if (stop_requested) {
+                throw BuildStopped();
+            }
+            frame->pts = num_frames;
+            frame->pict_type = num_frames % config.gop_size == 0 ? AV_PICTURE_TYPE_I : AV_PICTURE_TYPE_NONE;
+            ++num_frames;
+            CheckAv(avcodec_send_frame(encoder.get(), frame), "Failed to encode " + output_path);
+            write_packets();
+        };
+
+        const int num_interpolated = config.interpolation_num_frames;
+        for (size_t i = 0; i < image_paths.size(); ++i) {
+            encode(current.get());
+            if (i + 1 == image_paths.size()) {
+                add_progress(1, 1);
+                break;
+            }
+            FramePtr next = decoded_ahead.front().get();
+            decoded_ahead.pop_front();
+            submit_ahead();
+            for (int j = 1; j <= num_interpolated; ++j) {
+                // The encoder may still reference `current`, so interpolated frames get their own buffers
+                FramePtr interpolated = AllocFrame(width, height, pix_fmt);
+                BlendFrames(current.get(), next.get(), static_cast<double>(j) / (num_interpolated + 1),
+                            interpolated.get());
+                encode(interpolated.get());
+            }
+            add_progress(1, 1 + num_interpolated);
+            current = std::move(next);
+        }
+        CheckAv(avcodec_send_frame(encoder.get(), nullptr), "Failed to flush encoder for " + output_path);
+        write_packets();
+        CheckAv(av_write_trailer(output_ctx.get()), "Failed to finalize " + output_path);
+        output_ctx.reset();
+
+        fs::rename(tmp_path, output_path);
+        if (config.write_gop_index) {
+            GopIndexSidecar sidecar;
+            sidecar.num_frames = num_frames;
+            sidecar.keyframe_ids = std::move(keyframe_ids);
+            sidecar.AddMetadata("num_source_frames", static_cast<int>(image_paths.size()));
+            sidecar.AddMetadata("interpolation_num_frames", config.interpolation_num_frames);
+            sidecar.AddMetadata("fps", config.fps);
+            sidecar.AddMetadata("width", width);
+            sidecar.AddMetadata("height", height);
+            sidecar.AddMetadata("encoder", config.encoder);
+            sidecar.AddMetadata("pix_fmt", config.pix_fmt);
+            sidecar.Write(output_path);
+        }
+    } catch (...) {
+        std::error_code ignored;
+        fs::remove(tmp_path, ignored);
+        nvtxRangePop();
+        throw;
+    }
+    nvtxRangePop();  // VideoDatasetBuilder_EncodeSequence
+    return fs::file_size(output_path);
+}
@@ -0,0 +1,423 @@
+/*
+ * Copyright (c) 2025, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "VideoRemuxer.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <filesystem>
+#include <memory>
+#include <numeric>
+#include <stdexcept>
+#include <thread>
+
+extern "C" {
+#include <libavcodec/avcodec.h>
+#include <libavformat/avformat.h>
+}
+
+#include "GopIndexSidecar.hpp"
+#include "nvtx3/nvtx3.hpp"
+
+namespace fs = std::filesystem;
+
+namespace {
+
+std::string AvErrorString(int error) {
+    char buf[AV_ERROR_MAX_STRING_SIZE] = {0};
+    av_strerror(error, buf, sizeof(buf));
+    return buf;
+}
+
+void CheckAv(int error, const std::string& what) {
+    if (error < 0) {
+        throw std::runtime_error("[ERROR] " + what + ": " + AvErrorString(error));
+    }
+}
+
+struct InputContextDeleter {
+    void operator()(AVFormatContext* ctx) const { avformat_close_input(&ctx); }
+};
+struct OutputContextDeleter {
+    void operator()(AVFormatContext* ctx) const {
+        if (ctx->pb && !(ctx->oformat->flags & AVFMT_NOFILE)) {
+            avio_closep(&ctx->pb);
+        }
+        avformat_free_context(ctx);
+    }
+};
+struct PacketDeleter {
+    void operator()(AVPacket* packet) const { av_packet_free(&packet); }
+};
+using InputContextPtr = std::unique_ptr<AVFormatContext, InputContextDeleter>;
+using OutputContextPtr = std::unique_ptr<AVFormatContext, OutputContextDeleter>;
+using PacketPtr = std::unique_ptr<AVPacket, PacketDeleter>;
+
+// Open the input and select its video stream; all other streams are discarded by the demuxer
+InputContextPtr OpenInput(const std::string& path, int& stream_index) {
+    AVFormatContext* ctx_raw = nullptr;
+    CheckAv(avformat_open_input(&ctx_raw, path.c_str(), nullptr, nullptr), "Failed to open " + path);
+    InputContextPtr ctx(ctx_raw);
+    CheckAv(avformat_find_stream_info(ctx.get(), nullptr), "Failed to read stream info of " + path);
+    stream_index = av_find_best_stream(ctx.get(), AVMEDIA_TYPE_VIDEO, -1, -1, nullptr, 0);
+    CheckAv(stream_index, "No video stream in " + path);
+    for (unsigned int i = 0; i < ctx->nb_streams; ++i) {
+        if (static_cast<int>(i) != stream_index) {
+            ctx->streams[i]->discard = AVDISCARD_ALL;
+        }
+    }
+    return ctx;
+}
+
+PacketPtr AllocPacket() {
+    PacketPtr packet(av_packet_alloc());
+    if (!packet) {
+        throw std::bad_alloc();
+    }
+    return packet;
+}
+
+struct PacketInfo {
+    int64_t pts;
+    int64_t dts;
+    int64_t duration;
+    bool key;
+};
+
+// Timestamps of the kept packets, indexed by the packet index (decode order) of the source
+struct RemuxPlan {
+    std::vector<bool> keep;
+    std::vector<int64_t> pts;
+    std::vector<int64_t> dts;
+    std::vector<int64_t> duration;
+    std::vector<int> keyframe_ids;
+    int num_frames = 0;
+    bool is_cfr = false;
+    AVRational frame_rate = {0, 1};
+};
+
+RemuxPlan PlanRemux(const std::vector<PacketInfo>& packets, AVRational time_base,
+                    AVRational stream_frame_rate, const RemuxConfig& config, RemuxResult& result) {
+    const size_t num_packets = packets.size();
+    const auto first_key =
+        std::find_if(packets.begin(), packets.end(), [](const PacketInfo& p) { return p.key; });
+    if (first_key == packets.end()) {
+        throw std::runtime_error("[ERROR] No keyframe in " + result.input_path);
+    }
+    const size_t first_key_idx = first_key - packets.begin();
+
+    auto ts = [&](size_t i) { return packets[i].pts != AV_NOPTS_VALUE ? packets[i].pts : packets[i].dts; };
+    bool has_timestamps = true;
+    for (size_t i = first_key_idx; i < num_packets; ++i) {
+        has_timestamps &= ts(i) != AV_NOPTS_VALUE;
+    }
+    if (!has_timestamps && !config.normalize_timestamps) {
+        throw std::runtime_error("[ERROR] Missing timestamps in " + result.input_path);
+    }
+
+    // Drop everything before the first keyframe, including leading pictures displayed before it (they
+    // reference frames which are not part of the output)
+    RemuxPlan plan;
+    plan.keep.assign(num_packets, false);
+    std::vector<size_t> kept;
+    for (size_t i = first_key_idx; i < num_packets; ++i) {
+        if (!has_timestamps || ts(i) >= ts(first_key_idx)) {
+            plan.keep[i] = true;
+            kept.push_back(i);
+        }
+    }
+    const int num_frames = static_cast<int>(kept.size());
+    plan.num_frames = num_frames;
+    result.num_dropped_frames = static_cast<int>(num_packets) - num_frames;
+
+    // Presentation order of the kept packets
+    std::vector<size_t> presentation = kept;
+    if (has_timestamps) {
+        std::stable_sort(presentation.begin(), presentation.end(),
+                         [&](size_t a, size_t b) { return ts(a) < ts(b); });
+    }
+    std::vector<int> frame_id(num_packets, -1);
+    for (int i = 0; i < num_frames; ++i) {
+        frame_id[presentation[i]] = i;
+    }
+
+    // Frame interval: median of the intervals between consecutive frames
+    int64_t interval = 0;
+    bool is_cfr = true;
+    if (has_timestamps && num_frames > 1) {
+        std::vector<int64_t> deltas(num_frames - 1);
+        for (int i = 1; i < num_frames; ++i) {
+            deltas[i - 1] = ts(presentation[i]) - ts(presentation[i - 1]);
+        }
+        std::vector<int64_t> sorted_deltas = deltas;
+        std::nth_element(sorted_deltas.begin(), sorted_deltas.begin() + sorted_deltas.size() / 2,
+                         sorted_deltas.end());
+        interval = sorted_deltas[sorted_deltas.size() / 2];
+        const double max_deviation = config.cfr_tolerance * static_cast<double>(interval);
+        is_cfr = interval > 0 && std::all_of(deltas.begin(), deltas.end(), [&](int64_t d) {
+                     return std::abs(static_cast<double>(d - interval)) <= max_deviation;
+                 });
+    } else if (has_timestamps) {
+        interval = packets[kept[0]].duration;
+    }
+    if (interval <= 0) {
+        // Single frame without duration, or no timestamps at all (1 / 25 s if the frame rate is unknown)
+        const AVRational frame_duration =
+            stream_frame_rate.num > 0 ? av_inv_q(stream_frame_rate) : AVRational{1, 25};
+        interval = std::max<int64_t>(1, av_rescale_q(1, frame_duration, time_base));
+    }
+    plan.is_cfr = is_cfr;
+
+    plan.pts.assign(num_packets, AV_NOPTS_VALUE);
+    plan.dts.assign(num_packets, AV_NOPTS_VALUE);
+    plan.duration.assign(num_packets, 0);
+    if (config.normalize_timestamps && is_cfr) {
+        // Frame `i` at `i * interval`; dts are shifted by the reorder delay so that dts <= pts
+        int delay = 0;
+        for (int i = 0; i < num_frames; ++i) {
+            delay = std::max(delay, i - frame_id[kept[i]]);
+        }
+        for (int i = 0; i < num_frames; ++i) {
+            const size_t p = kept[i];
+            plan.pts[p] = frame_id[p] * interval;
+            plan.dts[p] = static_cast<int64_t>(i - delay) * interval;
+            plan.duration[p] = interval;
+        }
+        av_reduce(&plan.frame_rate.num, &plan.frame_rate.den, time_base.den, time_base.num * interval,
+                  INT32_MAX);
+    } else {
+        // Keep the source timestamps, starting at 0
+        const int64_t start = ts(presentation[0]);
+        for (const size_t p : kept) {
+            plan.pts[p] = ts(p) - start;
+            plan.dts[p] = (packets[p].dts != AV_NOPTS_VALUE ? packets[p].dts : ts(p)) - start;
+            plan.duration[p] = packets[p].duration;
+        }
+    }
+
+    for (const size_t p : kept) {
+        if (packets[p].key) {
+            plan.keyframe_ids.push_back(frame_id[p]);
+        }
+    }
+    std::sort(plan.keyframe_ids.begin(), plan.keyframe_ids.end());
+
+    // Statistics
+    result.num_frames = num_frames;
+    result.is_cfr = is_cfr;
+    if (is_cfr || num_frames < 2) {
+        result.fps = 1.0 / (interval * av_q2d(time_base));
+    } else {
+        const int64_t span = ts(presentation[num_frames - 1]) - ts(presentation[0]);
+        result.fps = (num_frames - 1) / (span * av_q2d(time_base));
+    }
+    result.num_gops = static_cast<int>(plan.keyframe_ids.size());
+    for (size_t i = 0; i < plan.keyframe_ids.size(); ++i) {
+        const int gop_end = i + 1 < plan.keyframe_ids.size() ? plan.keyframe_ids[i + 1] : num_frames;
+        const int gop_len = gop_end - plan.keyframe_ids[i];
+        result.min_gop_len = i == 0 ? gop_len : std::min(result.min_gop_len, gop_len);
+        result.max_gop_len = std::max(result.max_gop_len, gop_len);
+    }
+    result.mean_gop_len = static_cast<double>(num_frames) / result.num_gops;
+    if (config.max_gop_len > 0 && result.max_gop_len > config.max_gop_len) {
+        result.reencode_reasons.push_back("GOP length " + std::to_string(result.max_gop_len) +
+                                          " exceeds max_gop_len " + std::to_string(config.max_gop_len));
+    }
+    if (!is_cfr) {
+        result.reencode_reasons.push_back("variable frame rate");
+    }
+    result.needs_reencode = !result.reencode_reasons.empty();
+    return plan;
+}
+
+void WriteOutput(const std::string& input_path, const std::string& output_path, const RemuxPlan& plan,
+                 size_t num_packets, const RemuxConfig& config) {
+    int stream_index = -1;
+    InputContextPtr input_ctx = OpenInput(input_path, stream_index);
+    const AVStream* input_stream = input_ctx->streams[stream_index];
+
+    // Always fragmented MP4, independent of the file extension
+    const std::string tmp_path = output_path + ".tmp";
+    AVFormatContext* output_ctx_raw = nullptr;
+    CheckAv(avformat_alloc_output_context2(&output_ctx_raw, nullptr, "mp4", tmp_path.c_str()),
+            "Failed to create output context for " + output_path);
+    OutputContextPtr output_ctx(output_ctx_raw);
+
+    AVStream* stream = avformat_new_stream(output_ctx.get(), nullptr);
+    if (!stream) {
+        throw std::bad_alloc();
+    }
+    CheckAv(avcodec_parameters_copy(stream->codecpar, input_stream->codecpar),
+            "Failed to copy codec parameters for " + output_path);
+    stream->codecpar->codec_tag = 0;
+    stream->time_base = input_stream->time_base;
+    if (plan.frame_rate.num > 0) {
+        stream->avg_frame_rate = plan.frame_rate;
+        stream->r_frame_rate = plan.frame_rate;
+    }
+
+    CheckAv(avio_open(&output_ctx->pb, tmp_path.c_str(), AVIO_FLAG_WRITE), "Failed to open " + tmp_path);
+    AVDictionary* options = nullptr;
+    av_dict_set(&options, "movflags", config.movflags.c_str(), 0);
+    const int header_error = avformat_write_header(output_ctx.get(), &options);
+    av_dict_free(&options);
+    CheckAv(header_error, "Failed to write header of " + output_path);
+
+    // The muxer may have changed the time base of the output stream
+    PacketPtr packet = AllocPacket();
+    size_t packet_idx = 0;
+    int error = 0;
+    while ((error = av_read_frame(input_ctx.get(), packet.get())) >= 0) {
+        if (packet->stream_index != stream_index) {
+            av_packet_unref(packet.get());
+            continue;
+        }
+        if (packet_idx >= num_packets) {
+            throw std::runtime_error("[ERROR] Packets of " + input_path + " changed while remuxing");
+        }
+        if (plan.keep[packet_idx]) {
+            packet->pts = plan.pts[packet_idx];
+            packet->dts = plan.dts[packet_idx];
+            packet->duration = plan.duration[packet_idx];
+            av_packet_rescale_ts(packet.get(), input_stream->time_base, stream->time_base);
+            packet->stream_index = 0;
+            packet->pos = -1;
+            CheckAv(av_interleaved_write_frame(output_ctx.get(), packet.get()),
+                    "Failed to write packet to " + output_path);
+        }
+        av_packet_unref(packet.get());
+        ++packet_idx;
+    }
+    if (error != AVERROR_EOF) {
+        CheckAv(error, "Failed to read " + input_path);
+    }
+    if (packet_idx != num_packets) {
+        throw std::runtime_error("[ERROR] Packets of " + input_path + " changed while remuxing");
+    }
+    CheckAv(av_write_trailer(output_ctx.get()), "Failed to finalize " + output_path);
+    output_ctx.reset();
+    fs::rename(tmp_path, output_path);
+}
+
+}  // namespace
+
+RemuxResult RemuxForRandomAccess(const std::string& input_path, const std::string& output_path,
+                                 const RemuxConfig& config) {
+    nvtxRangePushA("RemuxForRandomAccess");
+    RemuxResult result;
+    result.input_path = input_path;
+    result.output_path = output_path;
+    try {
+        // Pass 1: packet metadata only
+        std::vector<PacketInfo> packets;
+        AVRational time_base;
+        AVRational frame_rate;
+        AVCodecID codec_id;
+        int width = 0;
+        int height = 0;
+        {
+            int stream_index = -1;
+            InputContextPtr input_ctx = OpenInput(input_path, stream_index);
+            const AVStream* stream = input_ctx->streams[stream_index];
+            time_base = stream->time_base;
+            frame_rate = stream->avg_frame_rate;
+            codec_id = stream->codecpar->codec_id;
+            width = stream->codecpar->width;
+            height = stream->codecpar->height;
+            PacketPtr packet = AllocPacket();
+            int error = 0;
+            while ((error = av_read_frame(input_ctx.get(), packet.get())) >= 0) {
+                if (packet->stream_index == stream_index) {
+                    packets.push_back(
+                        {packet->pts, packet->dts, packet->duration, (packet->flags & AV_PKT_FLAG_KEY) != 0});
+                }
+                av_packet_unref(packet.get());
+            }
+            if (error != AVERROR_EOF) {
+                CheckAv(error, "Failed to read " + input_path);
+            }
+        }
+        if (packets.empty()) {
+            throw std::runtime_error("[ERROR] No video packets in " + input_path);
+        }
+        RemuxPlan plan = PlanRemux(packets, time_base, frame_rate, config, result);
+
+        // Pass 2: copy the packets with the new timestamps
+        if (!output_path.empty()) {
+            const fs::path parent = fs::path(output_path).parent_path();
+            if (!parent.empty()) {
+                fs::create_directories(parent);
+            }
+            try {
+                WriteOutput(input_path, output_path, plan, packets.size(), config);
+            } catch (...) {
+                std::error_code ignored;
+                fs::remove(output_path + ".tmp", ignored);
+                throw;
+            }
+            if (config.write_gop_index) {
+                GopIndexSidecar sidecar;
+                sidecar.num_frames = plan.num_frames;
+                sidecar.keyframe_ids = plan.keyframe_ids;
+                sidecar.AddMetadata("source", input_path);
+                sidecar.AddMetadata("codec", avcodec_get_name(codec_id));
+                sidecar.AddMetadata("width", width);
+                sidecar.AddMetadata("height", height);
+                sidecar.AddMetadata("fps", result.fps);
+                sidecar.AddMetadata("is_cfr", result.is_cfr);
+                sidecar.Write(output_path);
+            }
+        }
+        result.ok = true;
+    } catch (const std::exception& e) {
+        result.ok = false;
+        result.error = e.what();
+    }
+    nvtxRangePop();
+    return result;
+}
+
+std::vector<RemuxResult> RemuxForRandomAccess(const std::vector<std::string>& input_paths,
+                                              const std::vector<std::string>& output_paths,
+                                              const RemuxConfig& config) {
+    if (!output_paths.empty() && output_paths.size() != input_paths.size()) {
+        throw std::invalid_argument("[ERROR] output_paths must be empty or have the size of input_paths");
+    }
+    if (config.cfr_tolerance < 0.0) {
+        throw std::invalid_argument("[ERROR] cfr_tolerance must be non-negative");
+    }
+
+    std::vector<RemuxResult> results(input_paths.size());
+    std::atomic<size_t> next{0};
+    auto worker = [&]() {
+        for (size_t i = next++; i < input_paths.size(); i = next++) {
+            const std::string output_path = output_paths.empty() ? std::string() : output_paths[i];
+            results[i] = RemuxForRandomAccess(input_paths[i], output_path, config);
+        }
+    };
+    const size_t num_threads =
+        std::min(input_paths.size(), static_cast<size_t>(std::max(1, config.num_threads)));
+    std::vector<std::thread> threads;
+    for (size_t i = 1; i < num_threads; ++i) {
+        threads.emplace_back(worker);
+    }
+    worker();
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    return results;
+}
@@ -0,0 +1,338 @@
+/*
+ * Copyright (c) 2025, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "CrcHost.h"
+
+#include <algorithm>
+#include <cstring>
+#include <thread>
+#include <vector>
+
+#if (defined(__x86_64__) || defined(__i386__)) && (defined(__GNUC__) || defined(__clang__))
+#define CRC_HOST_HAS_X86_SIMD 1
+#include <immintrin.h>
+#endif
+
+namespace {
+
+constexpr uint32_t kPolyCrc32 = 0xEDB88320u;   // same polynomial as Crc32Table in crc.cu
+constexpr uint32_t kPolyCrc32C = 0x82F63B78u;
+
+// Below this many bytes per thread, spawning threads costs more than it saves.
+constexpr size_t kMinBytesPerThread = 1u << 20;
+
+/*
+ * Slice-by-8 tables. table[0] is the classic byte-wise table (identical to Crc32Table in crc.cu
+ * for kPolyCrc32), table[k][i] is the CRC of byte i followed by k zero bytes.
+ */
+struct SliceBy8Tables {
+    uint32_t table[8][256];
+
+    constexpr explicit SliceBy8Tables(uint32_t poly) : table{} {
+        for (uint32_t i = 0; i < 256; i++) {
+            uint32_t crc = i;
+            for (int j = 0; j < 8; j++) {
+                crc = (crc >> 1) ^ ((crc & 1) ? poly : 0);
+            }
+            table[0][i] = crc;
+        }
+        for (uint32_t i = 0; i < 256; i++) {
+            for (int k = 1; k < 8; k++) {
+                table[k][i] = (table[k - 1][i] >> 8) ^ table[0][table[k - 1][i] & 0xFF];
+            }
+        }
+    }
+};
+
+constexpr SliceBy8Tables kTablesCrc32(kPolyCrc32);
+constexpr SliceBy8Tables kTablesCrc32C(kPolyCrc32C);
+
+inline const SliceBy8Tables &GetTables(CrcVariant variant) {
+    return variant == CrcVariant::CRC32C ? kTablesCrc32C : kTablesCrc32;
+}
+
+inline uint32_t GetPoly(CrcVariant variant) { return variant == CrcVariant::CRC32C ? kPolyCrc32C : kPolyCrc32; }
+
+// All update functions work on the raw (non-inverted) CRC register.
+uint32_t UpdateSliceBy8(uint32_t crc, const uint8_t *p, size_t n, const SliceBy8Tables &t) {
+    while (n && (reinterpret_cast<uintptr_t>(p) & 7)) {
+        crc = (crc >> 8) ^ t.table[0][(crc ^ *p++) & 0xFF];
+        n--;
+    }
+    while (n >= 8) {
+        uint32_t lo, hi;
+        std::memcpy(&lo, p, 4);
+        std::memcpy(&hi, p + 4, 4);
+        // The tables are built for little-endian word loads.
+        lo ^= crc;
+        crc = t.table[7][lo & 0xFF] ^ t.table[6][(lo >> 8) & 0xFF] ^ t.table[5][(lo >> 16) & 0xFF] ^
+              t.table[4][lo >> 24] ^ t.table[3][hi & 0xFF] ^ t.table[2][(hi >> 8) & 0xFF] ^
+              t.table[1][(hi >> 16) & 0xFF] ^ t.table[0][hi >> 24];
+        p += 8;
+        n -= 8;
+    }
+    while (n--) {
+        crc = (crc >> 8) ^ t.table[0][(crc ^ *p++) & 0xFF];
+    }
+    return crc;
+}
+
+#ifdef CRC_HOST_HAS_X86_SIMD
+
+__attribute__((target("sse4.2"))) uint32_t UpdateCrc32CSse42(uint32_t crc, const uint8_t *p, size_t n) {
+    while (n && (reinterpret_cast<uintptr_t>(p) & 7)) {
+        crc = _mm_crc32_u8(crc, *p++);
+        n--;
+    }
+#if defined(__x86_64__)
+    uint64_t crc64 = crc;
+    while (n >= 8) {
+        uint64_t v;
+        std::memcpy(&v, p, 8);
+        crc64 = _mm_crc32_u64(crc64, v);
+        p += 8;
+        n -= 8;
+    }
+    crc = static_cast<uint32_t>(crc64);
+#endif
+    while (n >= 4) {
+        uint32_t v;
+        std::memcpy(&v, p, 4);
+        crc = _mm_crc32_u32(crc, v);
+        p += 4;
+        n -= 4;
+    }
+    while (n--) {
+        crc = _mm_crc32_u8(crc, *p++);
+    }
+    return crc;
+}
+
+/*
+ * Carry-less multiplication folding for the reflected IEEE polynomial, after Gopal et al.,
+ * "Fast CRC Computation for Generic Polynomials Using PCLMULQDQ Instruction" (Intel, 2009).
+ * Requires n >= 64 and n % 16 == 0.
+ */
+__attribute__((target("sse4.1,pclmul"))) uint32_t UpdateCrc32Pclmul(uint32_t crc, const uint8_t *p,
+                                                                     size_t n) {
+    alignas(16) static const uint64_t k1k2[] = {0x0154442bd4ull, 0x01c6e41596ull};
+    alignas(16) static const uint64_t k3k4[] = {0x01751997d0ull, 0x00ccaa009eull};
+    alignas(16) static const uint64_t k5k0[] = {0x0163cd6124ull, 0x0000000000ull};
+    alignas(16) static const uint64_t poly[] = {0x01db710641ull, 0x01f7011641ull};
+
+    __m128i x0, x1, x2, x3, x4, x5, x6, x7, x8, y5, y6, y7, y8;
+
+    x1 = _mm_loadu_si128(reinterpret_cast<const __m128i *>(p + 0x00));
+    x2 = _mm_loadu_si128(reinterpret_cast<const __m128i *>(p + 0x10));
+    x3 = _mm_loadu_si128(reinterpret_cast<const __m128i *>(p + 0x20));
+    x4 = _mm_loadu_si128(reinterpret_cast<const __m128i *>(p + 0x30));
+    x1 = _mm_xor_si128(x1, _mm_cvtsi32_si128(static_cast<int>(crc)));
+    x0 = _mm_load_si128(reinterpret_cast<const __m128i *>(k1k2));
+    p += 64;
+    n -= 64;
+
+    // Fold 4 x 128 bits in parallel.
+    while (n >= 64) {
+        x5 = _mm_clmulepi64_si128(x1, x0, 0x00);
+        x6 = _mm_clmulepi64_si128(x2, x0, 0x00);
+        x7 = _mm_clmulepi64_si128(x3, x0, 0x00);
+        x8 = _mm_clmulepi64_si128(x4, x0, 0x00);
+        x1 = _mm_clmulepi64_si128(x1, x0, 0x11);
+        x2 = _mm_clmulepi64_si128(x2, x0, 0x11);
+        x3 = _mm_clmulepi64_si128(x3, x0, 0x11);
+        x4 = _mm_clmulepi64_si128(x4, x0, 0x11);
+        y5 = _mm_loadu_si128(reinterpret_cast<const __m128i *>(p + 0x00));
+        y6 = _mm_loadu_si128(reinterpret_cast<const __m128i *>(p + 0x10));
+        y7 = _mm_loadu_si128(reinterpret_cast<const __m128i *>(p + 0x20));
+        y8 = _mm_loadu_si128(reinterpret_cast<const __m128i *>(p + 0x30));
+        x1 = _mm_xor_si128(_mm_xor_si128(x1, x5), y5);
+        x2 = _mm_xor_si128(_mm_xor_si128(x2, x6), y6);
+        x3 = _mm_xor_si128(_mm_xor_si128(x3, x7), y7);
+        x4 = _mm_xor_si128(_mm_xor_si128(x4, x8), y8);
+        p += 64;
+        n -= 64;
+    }
+
+    // Fold the four lanes into one.
+    x0 = _mm_load_si128(reinterpret_cast<const __m128i *>(k3k4));
+    x5 = _mm_clmulepi64_si128(x1, x0, 0x00);
+    x1 = _mm_clmulepi64_si128(x1, x0, 0x11);
+    x1 = _mm_xor_si128(_mm_xor_si128(x1, x2), x5);
+    x5 = _mm_clmulepi64_si128(x1, x0, 0x00);
+    x1 = _mm_clmulepi64_si128(x1, x0, 0x11);
+    x1 = _mm_xor_si128(_mm_xor_si128(x1, x3), x5);
+    x5 = _mm_clmulepi64_si128(x1, x0, 0x00);
+    x1 = _mm_clmulepi64_si128(x1, x0, 0x11);
+    x1 = _mm_xor_si128(_mm_xor_si128(x1, x4), x5);
+
+    // Fold the remaining 128-bit blocks.
+    while (n >= 16) {
+        x2 = _mm_loadu_si128(reinterpret_cast<const __m128i *>(p));
+        x5 = _mm_clmulepi64_si128(x1, x0, 0x00);
+        x1 = _mm_clmulepi64_si128(x1, x0, 0x11);
+        x1 = _mm_xor_si128(_mm_xor_si128(x1, x2), x5);
+        p += 16;
+        n -= 16;
+    }
+
+    // Fold 128 bits to 64 bits.
+    x2 = _mm_clmulepi64_si128(x1, x0, 0x10);
+    x3 = _mm_setr_epi32(~0, 0, ~0, 0);
+    x1 = _mm_srli_si128(x1, 8);
+    x1 = _mm_xor_si128(x1, x2);
+    x0 = _mm_loadl_epi64(reinterpret_cast<const __m128i *>(k5k0));
+    x2 = _mm_srli_si128(x1, 4);
+    x1 = _mm_and_si128(x1, x3);
+    x1 = _mm_clmulepi64_si128(x1, x0, 0x00);
+    x1 = _mm_xor_si128(x1, x2);
+
+    // Barrett reduction to 32 bits.
+    x0 = _mm_load_si128(reinterpret_cast<const __m128i *>(poly));
+    x2 = _mm_and_si128(x1, x3);
+    x2 = _mm_clmulepi64_si128(x2, x0, 0x10);
+    x2 = _mm_and_si128(x2, x3);
+    x2 = _mm_clmulepi64_si128(x2, x0, 0x00);
+    x1 = _mm_xor_si128(x1, x2);
+
+    return static_cast<uint32_t>(_mm_extract_epi32(x1, 1));
+}
+
+bool CpuHasSse42() {
+    static const bool has = __builtin_cpu_supports("sse4.2");
+    return has;
+}
+
+bool CpuHasPclmul() {
+    static const bool has = __builtin_cpu_supports("pclmul") && __builtin_cpu_supports("sse4.1");
+    return has;
+}
+
+#endif  // CRC_HOST_HAS_X86_SIMD
+
+uint32_t UpdateRaw(uint32_t crc, const uint8_t *p, size_t n, CrcVariant variant) {
+#ifdef CRC_HOST_HAS_X86_SIMD
+    if (variant == CrcVariant::CRC32C && CpuHasSse42()) {
+        return UpdateCrc32CSse42(crc, p, n);
+    }
+    if (variant == CrcVariant::CRC32 && n >= 64 && CpuHasPclmul()) {
+        const size_t nFolded = n & ~static_cast<size_t>(15);
+        crc = UpdateCrc32Pclmul(crc, p, nFolded);
+        p += nFolded;
+        n -= nFolded;
+    }
+#endif
+    return UpdateSliceBy8(crc, p, n, GetTables(variant));
+}
+
+// Multiply a and b modulo the (reflected) polynomial.
+uint32_t MultModP(uint32_t a, uint32_t b, uint32_t poly) {
+    uint32_t m = 1u << 31;
+    uint32_t p = 0;
+    for (;;) {
+        if (a & m) {
+            p ^= b;
+            if ((a & (m - 1)) == 0) {
+                break;
+            }
+        }
+        m >>= 1;
+        b = (b & 1) ? (b >> 1) ^ poly : b >> 1;
+    }
+    return p;
+}
+
+// x^(n * 2^k) modulo the polynomial.
+uint32_t X2nModP(size_t n, unsigned k, uint32_t poly) {
+    uint32_t x2n[32];
+    x2n[0] = 1u << 30;  // x^1
+    for (int i = 1; i < 32; i++) {
+        x2n[i] = MultModP(x2n[i - 1], x2n[i - 1], poly);
+    }
+    uint32_t p = 1u << 31;  // x^0
+    while (n) {
+        if (n & 1) {
+            p = MultModP(x2n[k & 31], p, poly);
+        }
+        n >>= 1;
+        k++;
+    }
+    return p;
+}
+
+}  // namespace
+
+uint32_t ComputeCRCHost(const void *pData, size_t nSize, uint32_t crc, CrcVariant variant) {
+    if (nSize == 0) {
+        return crc;
+    }
+    return ~UpdateRaw(~crc, static_cast<const uint8_t *>(pData), nSize, variant);
+}
+
+uint32_t CombineCRCHost(uint32_t crc1, uint32_t crc2, size_t nSize2, CrcVariant variant) {
+    // Appending nSize2 bytes multiplies crc1 by x^(8 * nSize2); the init/final inversions cancel.
+    return MultModP(X2nModP(nSize2, 3, GetPoly(variant)), crc1, GetPoly(variant)) ^ crc2;
+}
+
+uint32_t ComputeCRCHostParallel(const void *pData, size_t nSize, int nThreads, CrcVariant variant) {
+    if (nThreads <= 0) {
+        nThreads = static_cast<int>(std::max(1u, std::thread::hardware_concurrency()));
+    }
+    const size_t nMaxUseful = std::max<size_t>(1, nSize / kMinBytesPerThread);
+    const size_t nChunks = std::min(static_cast<size_t>(nThreads), nMaxUseful);
+    if (nChunks <= 1) {
+        return ComputeCRCHost(pData, nSize, 0, variant);
+    }
+
+    const uint8_t *p = static_cast<const uint8_t *>(pData);
+    // Keep chunk boundaries 64-byte aligned so every chunk stays on the folding fast path.
+    const size_t nChunkSize = ((nSize / nChunks) + 63) & ~static_cast<size_t>(63);
+    std::vector<uint32_t> crcs(nChunks, 0);
+    std::vector<size_t> sizes(nChunks, 0);
+    std::vector<std::thread> workers;
+    workers.reserve(nChunks - 1);
+    for (size_t i = 0; i < nChunks; i++) {
+        const size_t nOffset = std::min(nSize, i * nChunkSize);
+        sizes[i] = std::min(nChunkSize, nSize - nOffset);
+        if (i + 1 < nChunks) {
+            workers.emplace_back([&crcs, &sizes, p, nOffset, i, variant]() {
+                crcs[i] = ComputeCRCHost(p + nOffset, sizes[i], 0, variant);
+            });
+        } else {
+            crcs[i] = ComputeCRCHost(p + nOffset, sizes[i], 0, variant);
+        }
+    }
+    for (auto &worker : workers) {
+        worker.join();
+    }
+
+    uint32_t crc = crcs[0];
+    for (size_t i = 1; i < nChunks; i++) {
+        crc = CombineCRCHost(crc, crcs[i], sizes[i], variant);
+    }
+    return crc;
+}
+
+const char *GetCRCHostBackend(CrcVariant variant) {
+#ifdef CRC_HOST_HAS_X86_SIMD
+    if (variant == CrcVariant::CRC32C && CpuHasSse42()) {
+        return "sse4.2";
+    }
+    if (variant == CrcVariant::CRC32 && CpuHasPclmul()) {
+        return "pclmul";
+    }
+#endif
+    return "slice-by-8";
+}
@@ -0,0 +1,80 @@
+/*
+ * Copyright (c) 2025, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+/**
+ * @brief CRC polynomials supported by the host CRC engine.
+ *
+ * CRC32 is the reflected IEEE 802.3 polynomial 0xEDB88320 used by ComputeCRC() in crc.cu,
+ * so host and device results are bit-identical. CRC32C is the reflected Castagnoli polynomial
+ * 0x82F63B78, which can use the SSE4.2 crc32 instruction.
+ */
+enum class CrcVariant {
+    CRC32 = 0,
+    CRC32C = 1,
+};
+
+/**
+ * @brief Compute or continue a CRC over a host buffer.
+ *
+ * Uses PCLMUL folding (CRC32) or the SSE4.2 crc32 instruction (CRC32C) when the CPU supports
+ * them and falls back to slice-by-8 tables otherwise.
+ *
+ * @param pData Pointer to the data. May be nullptr if nSize is 0.
+ * @param nSize Number of bytes.
+ * @param crc Finalized CRC of the preceding bytes, 0 to start a new CRC.
+ * @param variant Polynomial to use.
+ * @return Finalized CRC (init ~0, final xor ~0), identical to zlib's crc32() for CRC32.
+ */
+uint32_t ComputeCRCHost(const void *pData, size_t nSize, uint32_t crc = 0,
+                        CrcVariant variant = CrcVariant::CRC32);
+
+/**
+ * @brief Combine the CRCs of two adjacent buffers.
+ *
+ * @param crc1 CRC of the first buffer.
+ * @param crc2 CRC of the second buffer.
+ * @param nSize2 Length of the second buffer in bytes.
+ * @param variant Polynomial used for both CRCs.
+ * @return CRC of the concatenation of both buffers.
+ */
+uint32_t CombineCRCHost(uint32_t crc1, uint32_t crc2, size_t nSize2, CrcVariant variant = CrcVariant::CRC32);
+
+/**
+ * @brief Compute a CRC over a large host buffer with multiple threads.
+ *
+ * The buffer is split into contiguous chunks which are processed concurrently and merged with
+ * CombineCRCHost(). Small buffers are processed on the calling thread.
+ *
+ * @param pData Pointer to the data.
+ * @param nSize Number of bytes.
+ * @param nThreads Maximum number of threads, 0 selects std::thread::hardware_concurrency().
+ * @param variant Polynomial to use.
+ * @return Same value as ComputeCRCHost(pData, nSize, 0, variant).
+ */
+uint32_t ComputeCRCHostParallel(const void *pData, size_t nSize, int nThreads = 0,
+                                CrcVariant variant = CrcVariant::CRC32);
+
+/**
+ * @brief Name of the implementation selected for a variant on this CPU.
+ *
+ * @return One of "pclmul", "sse4.2" or "slice-by-8".
+ */
+const char *GetCRCHostBackend(CrcVariant variant);
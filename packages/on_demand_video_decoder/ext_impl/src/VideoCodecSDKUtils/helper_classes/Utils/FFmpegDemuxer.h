@@ -1052,6 +1052,35 @@ class FFmpegDemuxer {
         return true;
     }
 
+    /* Reset the read position to the start of the stream and drop all buffered packet state, so that the
+     * demuxer behaves as if it was just opened. Used to reuse open demuxers instead of re-opening the file.
+     * Returns false if the input is not seekable or seeking fails. */
+    bool Rewind() {
+        ClearDemuxError();
+        if (!fmtc || !is_seekable) {
+            return false;
+        }
+        if (pkt && pkt->data) {
+            av_packet_unref(pkt);
+        }
+        if (pktFiltered && pktFiltered->data) {
+            av_packet_unref(pktFiltered);
+        }
+        if (bsfc) {
+            av_bsf_flush(bsfc);
+        }
+        const int64_t start_time = fmtc->streams[iVideoStream]->start_time;
+        const int ret = av_seek_frame(fmtc, iVideoStream, start_time == AV_NOPTS_VALUE ? 0 : start_time,
+                                      AVSEEK_FLAG_BACKWARD);
+        if (ret < 0) {
+            SetDemuxError("FFmpeg rewind failed for codec " + std::string(avcodec_get_name(eVideoCodec)) +
+                          ", ret=" + std::to_string(ret));
+            return false;
+        }
+        frameCount = 0;
+        return true;
+    }
+
     bool Seek(SeekContext& seekCtx, uint8_t** ppVideo, int* pnVideoBytes) {
         /* !!! IMPORTANT !!!
          * Across this function packet decode timestamp (DTS) values are used to
@@ -1061,14 +1090,12 @@ class FFmpegDemuxer {
          */
 
         if (!is_seekable) {
-            cerr << "Seek isn't supported for this input." << endl;
+            LOG(WARNING) << "Seek isn't supported for this input.";
             return false;
         }
 
         if (IsVFR() && (BY_NUMBER == seekCtx.crit)) {
-            cerr << "Can't seek by frame number in VFR sequences. Seek by timestamp "
-                    "instead."
-                 << endl;
+            LOG(WARNING) << "Can't seek by frame number in VFR sequences. Seek by timestamp instead.";
             return false;
         }
 
@@ -1214,14 +1241,12 @@ class FFmpegDemuxer {
          */
 
         if (!is_seekable) {
-            cerr << "Seek isn't supported for this input." << endl;
+            LOG(WARNING) << "Seek isn't supported for this input.";
             return false;
         }
 
         if (IsVFR() && (BY_NUMBER == seekCtx.crit)) {
-            cerr << "Can't seek by frame number in VFR sequences. Seek by timestamp "
-                    "instead."
-                 << endl;
+            LOG(WARNING) << "Can't seek by frame number in VFR sequences. Seek by timestamp instead.";
             return false;
         }
         // Seek for single frame;
@@ -21,11 +21,17 @@
 #include <string>
 #include <sstream>
 #include <mutex>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <new>
+#include <thread>
 #include <time.h>
 
 #ifdef _WIN32
 #include <winsock.h>
 #include <windows.h>
+#include <process.h>
 
 #pragma comment(lib, "ws2_32.lib")
 #undef ERROR
@@ -57,13 +63,16 @@ public:
         return l >= level;
     }
     char* GetLead(LogLevel l, const char *szFile, int nLine, const char *szFunc) {
+        return GetLead(l, time(NULL));
+    }
+    // Lead of a record created at time `t` (records may be written later by the async backend)
+    char* GetLead(LogLevel l, time_t t) {
         if (l < TRACE || l > FATAL) {
             sprintf(szLead, "[?????] ");
             return szLead;
         }
         const char *szLevels[] = {"TRACE", "INFO", "WARN", "ERROR", "FATAL"};
         if (bPrintTimeStamp) {
-            time_t t = time(NULL);
             struct tm *ptm = localtime(&t);
             sprintf(szLead, "[%-5s][%02d:%02d:%02d] ", 
                 szLevels[l], ptm->tm_hour, ptm->tm_min, ptm->tm_sec);
@@ -196,50 +205,403 @@ private:
     };
 };
 
-class LogTransaction {
+// Asynchronous logging
+//
+// LOG(...) formats the record on the calling thread and pushes it to a lock-free MPSC queue; a background
+// thread writes the records to the logger. This keeps slow streams (stderr, files, UDP) out of the decode
+// loops. Each LOG(...) call site is rate limited (records beyond the limit are not even formatted) and the
+// number of suppressed records is reported periodically. FATAL records are flushed before exiting.
+//
+// Key/value fields can be attached to a record:
+//     LOG(ERROR) << "Failed to open demuxer" << simplelogger::LogField("file", filepath);
+
+struct LogConfig {
+    std::atomic<bool> bAsync{true};
+    // Maximum number of records per call site and second (0: unlimited)
+    std::atomic<unsigned> nMaxPerSecond{20};
+    // Maximum number of queued records; further records are dropped and counted
+    std::atomic<unsigned> nMaxQueued{1u << 16};
+};
+
+inline LogConfig& GetLogConfig() {
+    static LogConfig config;
+    return config;
+}
+
+inline int64_t LogNowNs() {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+inline int LogProcessId() {
+#ifdef _WIN32
+    return _getpid();
+#else
+    return getpid();
+#endif
+}
+
+// Per call site state of LOG(...); one static instance per macro expansion
+struct LogCallSite {
+    LogCallSite(const char *szFile, int nLine) : szFile(szFile), nLine(nLine) {
+        // Register for the periodic summaries of suppressed records
+        pNext = GetHead().load(std::memory_order_relaxed);
+        while (!GetHead().compare_exchange_weak(pNext, this, std::memory_order_release,
+                                                std::memory_order_relaxed)) {
+        }
+    }
+
+    bool Admit() {
+        const unsigned nMax = GetLogConfig().nMaxPerSecond.load(std::memory_order_relaxed);
+        if (nMax == 0) {
+            return true;
+        }
+        const int64_t now = LogNowNs();
+        int64_t start = windowStartNs.load(std::memory_order_relaxed);
+        if (now - start >= 1000000000LL &&
+            windowStartNs.compare_exchange_strong(start, now, std::memory_order_relaxed)) {
+            countInWindow.store(0, std::memory_order_relaxed);
+        }
+        if (countInWindow.fetch_add(1, std::memory_order_relaxed) < nMax) {
+            return true;
+        }
+        nSuppressed.fetch_add(1, std::memory_order_relaxed);
+        return false;
+    }
+
+    static std::atomic<LogCallSite*>& GetHead() {
+        static std::atomic<LogCallSite*> head{nullptr};
+        return head;
+    }
+
+    const char *szFile;
+    int nLine;
+    std::atomic<int64_t> windowStartNs{0};
+    std::atomic<unsigned> countInWindow{0};
+    std::atomic<uint64_t> nSuppressed{0};
+    LogCallSite *pNext;
+};
+
+struct LogRecord {
+    std::atomic<LogRecord*> pNext{nullptr};
+    Logger *pLogger = nullptr;
+    LogLevel level = INFO;
+    time_t t = 0;
+    std::string text;
+};
+
+class AsyncLogBackend {
 public:
-    LogTransaction(Logger *pLogger, LogLevel level, const char *szFile, const int nLine, const char *szFunc) : pLogger(pLogger), level(level) {
-        if (!pLogger) {
-            std::cout << "[-----] ";
+    static AsyncLogBackend& Instance() {
+        static AsyncLogBackend backend;
+        return backend;
+    }
+
+    // Takes ownership of the record
+    void Push(LogRecord *pRecord) {
+        EnsureFlusherRunning();
+        if (nQueued.fetch_add(1, std::memory_order_relaxed) >= GetLogConfig().nMaxQueued.load()) {
+            nQueued.fetch_sub(1, std::memory_order_relaxed);
+            nDropped.fetch_add(1, std::memory_order_relaxed);
+            delete pRecord;
+            return;
+        }
+        pRecord->pNext.store(nullptr, std::memory_order_relaxed);
+        LogRecord *pPrev = pHead.exchange(pRecord, std::memory_order_acq_rel);
+        pPrev->pNext.store(pRecord, std::memory_order_release);
+        if (bFlusherIdle.load(std::memory_order_acquire)) {
+            cv.notify_one();
+        }
+    }
+
+    // Wait until all records pushed so far are written (bounded wait, e.g. if the flusher is not running)
+    void Flush() {
+        const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+        std::unique_lock<std::mutex> lock(mtx);
+        while (nQueued.load() > 0 && std::chrono::steady_clock::now() < deadline) {
+            cv.notify_one();
+            cvDrained.wait_for(lock, std::chrono::milliseconds(10));
+        }
+    }
+
+    ~AsyncLogBackend() {
+        if (pFlusher != nullptr && flusherPid == LogProcessId()) {
+            {
+                std::lock_guard<std::mutex> lock(mtx);
+                bStop = true;
+            }
+            cv.notify_one();
+            pFlusher->join();
+            delete pFlusher;
+        }
+        WriteQueued();
+        WriteSummaries();
+    }
+
+private:
+    AsyncLogBackend() : pHead(&stub), pTail(&stub) {}
+
+    // Starts the flusher thread on first use, and again in a forked child (threads do not survive fork)
+    void EnsureFlusherRunning() {
+        int pid = flusherPid.load(std::memory_order_acquire);
+        const int currentPid = LogProcessId();
+        if (pid == currentPid) {
             return;
         }
+        if (!flusherPid.compare_exchange_strong(pid, currentPid, std::memory_order_acq_rel)) {
+            return;
+        }
+        if (pid != 0) {
+            // Forked child: the synchronization objects may have been held by a thread of the parent
+            new (&mtx) std::mutex();
+            new (&cv) std::condition_variable();
+            new (&cvDrained) std::condition_variable();
+        }
+        // In a forked child, the thread object of the parent is leaked on purpose (it cannot be joined)
+        pFlusher = new std::thread(&AsyncLogBackend::Run, this);
+    }
+
+    // Single consumer pop (Vyukov intrusive MPSC queue)
+    LogRecord* Pop() {
+        LogRecord *pTailRecord = pTail;
+        LogRecord *pNextRecord = pTailRecord->pNext.load(std::memory_order_acquire);
+        if (pTailRecord == &stub) {
+            if (pNextRecord == nullptr) {
+                return nullptr;
+            }
+            pTail = pNextRecord;
+            pTailRecord = pNextRecord;
+            pNextRecord = pNextRecord->pNext.load(std::memory_order_acquire);
+        }
+        if (pNextRecord != nullptr) {
+            pTail = pNextRecord;
+            return pTailRecord;
+        }
+        if (pTailRecord != pHead.load(std::memory_order_acquire)) {
+            // A producer is between exchanging the head and linking its record
+            return nullptr;
+        }
+        stub.pNext.store(nullptr, std::memory_order_relaxed);
+        LogRecord *pPrev = pHead.exchange(&stub, std::memory_order_acq_rel);
+        pPrev->pNext.store(&stub, std::memory_order_release);
+        pNextRecord = pTailRecord->pNext.load(std::memory_order_acquire);
+        if (pNextRecord != nullptr) {
+            pTail = pNextRecord;
+            return pTailRecord;
+        }
+        return nullptr;
+    }
+
+    static void Write(Logger *pLogger, LogLevel level, time_t t, const std::string &text) {
         if (!pLogger->ShouldLogFor(level)) {
             return;
         }
         pLogger->EnterCriticalSection();
-        pLogger->GetStream() << pLogger->GetLead(level, szFile, nLine, szFunc);
+        pLogger->GetStream() << pLogger->GetLead(level, t) << text << '\n';
+        pLogger->FlushStream();
+        pLogger->LeaveCriticalSection();
     }
+
+    // Returns whether records were written
+    bool WriteQueued() {
+        bool bWritten = false;
+        while (LogRecord *pRecord = Pop()) {
+            Write(pRecord->pLogger, pRecord->level, pRecord->t, pRecord->text);
+            summaryLogger = pRecord->pLogger;
+            delete pRecord;
+            nQueued.fetch_sub(1, std::memory_order_release);
+            bWritten = true;
+        }
+        if (bWritten) {
+            summaryLogger->GetStream().flush();
+        }
+        return bWritten;
+    }
+
+    void WriteSummaries() {
+        if (summaryLogger == nullptr) {
+            return;
+        }
+        for (LogCallSite *pSite = LogCallSite::GetHead().load(std::memory_order_acquire); pSite != nullptr;
+             pSite = pSite->pNext) {
+            const uint64_t n = pSite->nSuppressed.exchange(0, std::memory_order_relaxed);
+            if (n > 0) {
+                std::ostringstream oss;
+                oss << "Suppressed " << n << " log records from " << pSite->szFile << ":" << pSite->nLine
+                    << " (rate limit)";
+                Write(summaryLogger, WARNING, time(NULL), oss.str());
+            }
+        }
+        const uint64_t nDroppedNow = nDropped.exchange(0, std::memory_order_relaxed);
+        if (nDroppedNow > 0) {
+            std::ostringstream oss;
+            oss << "Dropped " << nDroppedNow << " log records (queue full)";
+            Write(summaryLogger, WARNING, time(NULL), oss.str());
+        }
+        summaryLogger->GetStream().flush();
+    }
+
+    void Run() {
+        auto lastSummary = std::chrono::steady_clock::now();
+        while (true) {
+            const bool bWritten = WriteQueued();
+            if (std::chrono::steady_clock::now() - lastSummary >= std::chrono::seconds(1)) {
+                WriteSummaries();
+                lastSummary = std::chrono::steady_clock::now();
+            }
+            std::unique_lock<std::mutex> lock(mtx);
+            if (bWritten) {
+                cvDrained.notify_all();
+            }
+            if (bStop) {
+                return;
+            }
+            bFlusherIdle.store(true, std::memory_order_release);
+            cv.wait_for(lock, std::chrono::milliseconds(100));
+            bFlusherIdle.store(false, std::memory_order_release);
+        }
+    }
+
+    LogRecord stub;
+    std::atomic<LogRecord*> pHead;
+    LogRecord *pTail;
+    std::atomic<unsigned> nQueued{0};
+    std::atomic<uint64_t> nDropped{0};
+    Logger *summaryLogger = nullptr;  // Logger for the summaries (the one of the last written record)
+
+    std::mutex mtx;
+    std::condition_variable cv;
+    std::condition_variable cvDrained;
+    std::atomic<bool> bFlusherIdle{false};
+    bool bStop = false;
+    std::atomic<int> flusherPid{0};
+    std::thread *pFlusher = nullptr;
+};
+
+// Switch between asynchronous (default) and synchronous writing of the records
+inline void SetAsyncLogging(bool bAsync) {
+    if (!bAsync) {
+        AsyncLogBackend::Instance().Flush();
+    }
+    GetLogConfig().bAsync.store(bAsync);
+}
+
+// Maximum number of records per LOG(...) call site and second (0: unlimited)
+inline void SetLogRateLimit(unsigned nMaxPerSecond) {
+    GetLogConfig().nMaxPerSecond.store(nMaxPerSecond);
+}
+
+// Wait until the queued records are written
+inline void FlushLogs() {
+    AsyncLogBackend::Instance().Flush();
+}
+
+// Stream of a record, collecting the key/value fields separately from the message
+class LogRecordStream : public std::ostringstream {
+public:
+    std::string fields;
+};
+
+template <typename T>
+struct LogFieldValue {
+    const char *szKey;
+    const T &value;
+};
+
+template <typename T>
+LogFieldValue<T> LogField(const char *szKey, const T &value) {
+    return LogFieldValue<T>{szKey, value};
+}
+
+template <typename T>
+std::ostream& operator<<(std::ostream &os, const LogFieldValue<T> &field) {
+    std::ostringstream ossValue;
+    ossValue << field.value;
+    std::string value = ossValue.str();
+    if (value.empty() || value.find_first_of(" \t\n\"=") != std::string::npos) {
+        std::string quoted = "\"";
+        for (char c : value) {
+            if (c == '"' || c == '\\') {
+                quoted += '\\';
+            }
+            quoted += (c == '\n') ? ' ' : c;
+        }
+        value = quoted + "\"";
+    }
+    const std::string text = std::string(" ") + field.szKey + "=" + value;
+    // Fields are appended after the message, also if streamed in between message parts
+    if (LogRecordStream *pRecordStream = dynamic_cast<LogRecordStream*>(&os)) {
+        pRecordStream->fields += text;
+    } else {
+        os << text;
+    }
+    return os;
+}
+
+class LogTransaction {
+public:
+    LogTransaction(Logger *pLogger, LogLevel level, const char * /*szFile*/, const int /*nLine*/, const char * /*szFunc*/)
+        : pLogger(pLogger), level(level) {}
     ~LogTransaction() {
+        std::string text = oss.str();
+        while (!text.empty() && (text.back() == '\n' || text.back() == '\r')) {
+            text.pop_back();
+        }
+        text += oss.fields;
         if (!pLogger) {
-            std::cout << std::endl;
+            std::cout << "[-----] " << text << std::endl;
             return;
         }
         if (!pLogger->ShouldLogFor(level)) {
             return;
         }
-        pLogger->GetStream() << std::endl;
-        pLogger->FlushStream();
-        pLogger->LeaveCriticalSection();
+        if (GetLogConfig().bAsync.load(std::memory_order_relaxed)) {
+            LogRecord *pRecord = new LogRecord();
+            pRecord->pLogger = pLogger;
+            pRecord->level = level;
+            pRecord->t = time(NULL);
+            pRecord->text = std::move(text);
+            AsyncLogBackend::Instance().Push(pRecord);
+            if (level == FATAL) {
+                AsyncLogBackend::Instance().Flush();
+            }
+        } else {
+            pLogger->EnterCriticalSection();
+            pLogger->GetStream() << pLogger->GetLead(level, time(NULL)) << text << std::endl;
+            pLogger->FlushStream();
+            pLogger->LeaveCriticalSection();
+        }
         if (level == FATAL) {
             exit(1);
         }
     }
     std::ostream& GetStream() {
-        if (!pLogger) {
-            return std::cout;
-        }
-        if (!pLogger->ShouldLogFor(level)) {
-            return ossNull;
-        }
-        return pLogger->GetStream();
+        return oss;
     }
 private:
     Logger *pLogger;
     LogLevel level;
-    std::ostringstream ossNull;
+    LogRecordStream oss;
+};
+
+// Level and rate limit check before the record is formatted
+inline bool LogEnabled(Logger *pLogger, LogLevel level, LogCallSite &site) {
+    if (pLogger && !pLogger->ShouldLogFor(level)) {
+        return false;
+    }
+    return level == FATAL || site.Admit();
+}
+
+// Turns `LOG(...) << ...` into a void expression, so that it can be skipped as a whole
+struct LogVoidify {
+    void operator&(std::ostream&) {}
 };
 
 }
 
 extern simplelogger::Logger *logger;
-#define LOG(level) simplelogger::LogTransaction(logger, level, __FILE__, __LINE__, __FUNCTION__).GetStream()
+#define LOG_CALL_SITE() \
+    ([]() -> simplelogger::LogCallSite& { static simplelogger::LogCallSite site(__FILE__, __LINE__); return site; }())
+#define LOG(level) \
+    !simplelogger::LogEnabled(logger, level, LOG_CALL_SITE()) ? (void)0 : simplelogger::LogVoidify() & \
+        simplelogger::LogTransaction(logger, level, __FILE__, __LINE__, __FUNCTION__).GetStream()
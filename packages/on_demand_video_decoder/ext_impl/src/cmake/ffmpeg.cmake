@@ -29,6 +29,7 @@ endmacro()
 link_av_component(VideoCodecSDKUtils avformat)
 link_av_component(VideoCodecSDKUtils avcodec)
 link_av_component(VideoCodecSDKUtils swresample)
+link_av_component(VideoCodecSDKUtils swscale)
 link_av_component(VideoCodecSDKUtils avutil)
 
 find_path(
@@ -16,15 +16,27 @@
 
 import os
 import subprocess as sp
-import cv2
-from tqdm import tqdm
-import numpy as np
 import argparse
 from collections import defaultdict
 import json
 
+import accvlab.on_demand_video_decoder as nvc
+
 
 # -----------  environment checks -----------
+def get_missing_native_components(encoder):
+    """
+    Get the components missing in the FFmpeg build linked into the decoder package for encoding in-process,
+    i.e. the requested (CPU) encoder and the JPEG / PNG decoders for the source images.
+    """
+    missing = []
+    if encoder not in nvc.VideoDatasetBuilder.available_encoders():
+        missing.append(f'encoder "{encoder}"')
+    available_decoders = nvc.VideoDatasetBuilder.available_image_decoders()
+    missing.extend(f'decoder "{dec}"' for dec in ('mjpeg', 'png') if dec not in available_decoders)
+    return missing
+
+
 def assert_ffmpeg_has_required_encoders(required_encoders=('libx265',)):
     """
     Ensure that the locally available FFmpeg binary supports the required encoders.
@@ -63,17 +75,28 @@ def assert_ffmpeg_has_required_encoders(required_encoders=('libx265',)):
         )
 
 
-# -----------  tool: FFmpeg write frame -----------
-def images_to_video_ffmpeg(img_paths, out_mp4, fps, gop_size, interpolation_num_additional_frames):
+# -----------  fallback: FFmpeg executable, one sequence at a time -----------
+def images_to_video_ffmpeg(
+    img_paths, out_mp4, fps, gop_size, interpolation_num_additional_frames, encoder, encoder_options
+):
     if not img_paths:
         return
-    # read first frame to get resolution
+    # The fallback additionally needs the imaging libraries (the native backend decodes the images itself)
+    import cv2
+    import numpy as np
     from PIL import Image
+    from tqdm import tqdm
+
+    # read first frame to get resolution
 
     w, h = Image.open(img_paths[0]).size
 
+    # Write to a temporary file first, so that an interrupted run does not leave a partial video behind
+    out_root, out_ext = os.path.splitext(out_mp4)
+    tmp_mp4 = f'{out_root}.tmp{out_ext}'
     cmd = [
         'ffmpeg',
+        '-y',
         '-f',
         'rawvideo',
         '-vcodec',
@@ -87,19 +110,11 @@ def images_to_video_ffmpeg(img_paths, out_mp4, fps, gop_size, interpolation_num_
         '-i',
         '-',
         '-c:v',
-        'libx265',
-        '-x265-params',
-        "lowdelay=1",
-        '-g',
-        str(gop_size),
-        '-bf',
-        '0',
-        '-pix_fmt',
-        'yuv420p',
-        '-color_range',
-        'mpeg',
-        out_mp4,
+        encoder,
     ]
+    for key, value in encoder_options.items():
+        cmd.extend([f'-{key}', value])
+    cmd.extend(['-g', str(gop_size), '-bf', '0', '-pix_fmt', 'yuv420p', '-color_range', 'mpeg', tmp_mp4])
     print(cmd)
 
     next_image = None
@@ -124,7 +139,46 @@ def images_to_video_ffmpeg(img_paths, out_mp4, fps, gop_size, interpolation_num_
                 pipe.stdin.write(bgr)
 
     pipe.stdin.close()
-    pipe.wait()
+    if pipe.wait() != 0:
+        if os.path.exists(tmp_mp4):
+            os.remove(tmp_mp4)
+        raise RuntimeError(f'ffmpeg exited with code {pipe.returncode}')
+    os.replace(tmp_mp4, out_mp4)
+
+
+def build_with_ffmpeg(sequences, args, encoder_options):
+    """Encode the sequences with the FFmpeg executable. Returns the failed sequences (index -> message)."""
+    failed = {}
+    for seq_idx, (img_paths, out_mp4, _seg_items) in enumerate(sequences):
+        if args.skip_existing and os.path.exists(out_mp4):
+            continue
+        os.makedirs(os.path.dirname(out_mp4), exist_ok=True)
+        try:
+            images_to_video_ffmpeg(
+                img_paths,
+                out_mp4,
+                fps=args.fps,
+                gop_size=args.gop_size,
+                interpolation_num_additional_frames=args.interpolation_num_frames,
+                encoder=args.encoder,
+                encoder_options=encoder_options,
+            )
+        except RuntimeError as e:
+            failed[seq_idx] = str(e)
+    return failed
+
+
+def parse_encoder_options(encoder, options):
+    """Parse ``KEY=VALUE`` encoder options. Defaults to the low-delay x265 setup for libx265."""
+    if options is None:
+        return {'x265-params': 'lowdelay=1'} if encoder == 'libx265' else {}
+    parsed = {}
+    for option in options:
+        key, sep, value = option.partition('=')
+        if not sep:
+            raise ValueError(f'Encoder options must have the form KEY=VALUE, got: {option}')
+        parsed[key] = value
+    return parsed
 
 
 def main():
@@ -133,8 +187,23 @@ def main():
     NUSCENES_ROOT = args.nuscenes_root
 
     # -----------  validate environment -----------
-    # Encoder requirement is driven by how videos are written below (libx265).
-    assert_ffmpeg_has_required_encoders(('libx265',))
+    encoder_options = parse_encoder_options(args.encoder, args.encoder_options)
+    missing = get_missing_native_components(args.encoder)
+    if args.backend == 'native' and missing:
+        raise RuntimeError(
+            'The FFmpeg build linked into accvlab.on_demand_video_decoder is missing the '
+            f'{", ".join(missing)}. Either use --backend ffmpeg, or rebuild the package against an FFmpeg '
+            'build with these components enabled (e.g., built with --enable-libx265 and the mjpeg & png '
+            'decoders).'
+        )
+    use_native = args.backend == 'native' or (args.backend == 'auto' and not missing)
+    if not use_native:
+        if missing:
+            print(
+                f'The linked FFmpeg build is missing the {", ".join(missing)}; falling back to the ffmpeg '
+                'executable'
+            )
+        assert_ffmpeg_has_required_encoders((args.encoder,))
 
     # Output directory inside nuscenes root
     OUTPUT_DIR = os.path.join(NUSCENES_ROOT, args.video_sub_dir)
@@ -163,8 +232,8 @@ def main():
                 results.append((abs_p, rel_p))
         return results
 
-    # mapping: relative image path (from nuscenes_root) -> { video_path (relative to OUTPUT_DIR), frame_index }
-    image_to_video_map = {}
+    # Sequences to encode: (image paths, output video path, (sort key, abs path, rel path) items)
+    sequences = []
 
     for cam in cam_list:
         # Gather from samples and sweeps
@@ -234,25 +303,46 @@ def main():
                     if multi_segments
                     else os.path.join(OUTPUT_DIR, base_key)
                 )
-                os.makedirs(seq_dir, exist_ok=True)
                 # Store camera video within the sequence directory using only camera name
                 out_mp4 = os.path.join(seq_dir, f"{cam}.mp4")
+                sequences.append((img_paths_sorted, out_mp4, seg_items))
+
+    # -----------  encode all sequences (in parallel & in-process, or with the ffmpeg executable) -----------
+    if use_native:
+        builder = nvc.VideoDatasetBuilder(
+            encoder=args.encoder,
+            encoder_options=encoder_options,
+            fps=args.fps,
+            gop_size=args.gop_size,
+            interpolation_num_frames=args.interpolation_num_frames,
+            num_workers=args.num_workers,
+            num_decode_threads=args.num_decode_threads,
+            skip_existing=args.skip_existing,
+        )
+        stats = builder.build([seq[0] for seq in sequences], [seq[1] for seq in sequences])
+        print(
+            f"Encoded {stats['num_sequences_done']} videos ({stats['num_sequences_skipped']} skipped) from "
+            f"{stats['num_images']} images in {stats['elapsed_s']:.1f} s "
+            f"({stats['images_per_s']:.1f} images/s)"
+        )
+        failed = dict(stats['failed_sequences'])
+    else:
+        failed = build_with_ffmpeg(sequences, args, encoder_options)
+    for seq_idx, message in failed.items():
+        print(f'Failed to encode {sequences[seq_idx][1]}: {message}')
 
-                images_to_video_ffmpeg(
-                    img_paths_sorted,
-                    out_mp4,
-                    fps=args.fps,
-                    gop_size=args.gop_size,
-                    interpolation_num_additional_frames=args.interpolation_num_frames,
-                )
-
-                rel_video_path = os.path.relpath(out_mp4, OUTPUT_DIR)
-                for frame_index_orig, (_sk, _abs_p, rel_p) in enumerate(seg_items):
-                    frame_index = frame_index_orig * (args.interpolation_num_frames + 1)
-                    image_to_video_map[rel_p] = {
-                        'video_path': rel_video_path,
-                        'frame_index': frame_index,
-                    }
+    # mapping: relative image path (from nuscenes_root) -> { video_path (relative to OUTPUT_DIR), frame_index }
+    image_to_video_map = {}
+    for seq_idx, (_img_paths, out_mp4, seg_items) in enumerate(sequences):
+        if seq_idx in failed:
+            continue
+        rel_video_path = os.path.relpath(out_mp4, OUTPUT_DIR)
+        for frame_index_orig, (_sk, _abs_p, rel_p) in enumerate(seg_items):
+            frame_index = frame_index_orig * (args.interpolation_num_frames + 1)
+            image_to_video_map[rel_p] = {
+                'video_path': rel_video_path,
+                'frame_index': frame_index,
+            }
 
     # Write mapping JSON under OUTPUT_DIR
     mapping_path = os.path.join(OUTPUT_DIR, 'image_to_video_mapping.json')
@@ -295,6 +385,56 @@ def parse_args():
             'interpolation. A value of 0 means no additional frames are added.'
         ),
     )
+    parser.add_argument(
+        '--encoder',
+        type=str,
+        required=False,
+        default='libx265',
+        help='CPU video encoder of the FFmpeg build used for encoding. Default is "libx265"',
+    )
+    parser.add_argument(
+        '--backend',
+        type=str,
+        required=False,
+        choices=['auto', 'native', 'ffmpeg'],
+        default='auto',
+        help=(
+            'How the videos are encoded: "native" encodes in-process with the FFmpeg build linked into the '
+            'decoder package (parallel; needs the encoder and the mjpeg & png decoders in this build), '
+            '"ffmpeg" pipes the frames to the ffmpeg executable (one video at a time), "auto" uses "native" '
+            'if possible and "ffmpeg" otherwise. Default is "auto"'
+        ),
+    )
+    parser.add_argument(
+        '--encoder_options',
+        type=str,
+        nargs='*',
+        required=False,
+        default=None,
+        help=(
+            'Encoder options as KEY=VALUE pairs, e.g. "preset=fast" "crf=23". Default for libx265 is '
+            '"x265-params=lowdelay=1", no options otherwise'
+        ),
+    )
+    parser.add_argument(
+        '--num_workers',
+        type=int,
+        required=False,
+        default=4,
+        help='Number of videos encoded in parallel (native backend only)',
+    )
+    parser.add_argument(
+        '--num_decode_threads',
+        type=int,
+        required=False,
+        default=8,
+        help='Number of threads decoding the source images (native backend only)',
+    )
+    parser.add_argument(
+        '--skip_existing',
+        action='store_true',
+        help='Skip videos which were completed by a previous (interrupted) run',
+    )
     return parser.parse_args()
 
 
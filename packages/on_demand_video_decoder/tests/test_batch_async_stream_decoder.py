@@ -22,6 +22,7 @@ Layout:
     Section D — functional 2D decode
     Section E — precision: 2D output must bit-match sequential 1D calls
     Section F — async behavior: in-flight slot, request validation, error paths
+    Section G — frame reuse across Decode() calls (sliding windows)
 """
 
 import pytest
@@ -414,3 +415,67 @@ def test_invalid_file_propagates_exception():
     r.Decode(bad_files, frame_ids_2d, False)
     with pytest.raises(RuntimeError):
         r.GetBuffer(bad_files, frame_ids_2d, False)
+
+
+# ===========================================================================
+# Section G — frame reuse across Decode() calls (sliding windows)
+# ===========================================================================
+
+
+@pytest.mark.parametrize("as_bgr", [False, True])
+def test_sliding_window_reuse_matches_1d_reference(as_bgr):
+    """Overlapping windows decode only the new frames and still bit-match 1D."""
+    files = _select_sample_videos()
+    V = len(files)
+    F = 4
+    windows = [[[t + i for i in range(F)]] * V for t in range(3)]
+
+    r2d = nvc.CreateBatchAsyncStreamReader(
+        num_of_set=1, num_of_file=V, max_frames_per_decode_call=F, iGpu=0, reuse_frames=True
+    )
+    for window in windows:
+        r2d.Decode(files, window, as_bgr=as_bgr)
+        out_2d = r2d.GetBuffer(files, window, as_bgr=as_bgr)
+        ref = _reference_decode_via_1d(files, window, as_bgr)
+        for v in range(V):
+            for f in range(F):
+                actual = torch.as_tensor(out_2d[v][f], device="cuda")
+                torch.testing.assert_close(actual, ref[v][f], atol=0, rtol=0)
+
+    # First window fully decoded, then one new frame per video and window
+    stats = r2d.get_reuse_stats()
+    assert stats["num_decoded_frames"] == V * F + 2 * V
+    assert stats["num_reused_frames"] == 2 * V * (F - 1)
+
+
+def test_reuse_requires_same_output_format():
+    """Frames are not reused across RGB / BGR requests."""
+    files = _select_sample_videos()
+    V = len(files)
+    frame_ids_2d = [[0, 1]] * V
+
+    r2d = nvc.CreateBatchAsyncStreamReader(
+        num_of_set=1, num_of_file=V, max_frames_per_decode_call=2, iGpu=0, reuse_frames=True
+    )
+    r2d.Decode(files, frame_ids_2d, as_bgr=False)
+    r2d.GetBuffer(files, frame_ids_2d, as_bgr=False)
+    r2d.Decode(files, frame_ids_2d, as_bgr=True)
+    r2d.GetBuffer(files, frame_ids_2d, as_bgr=True)
+    assert r2d.get_reuse_stats()["num_reused_frames"] == 0
+
+
+def test_release_device_memory_drops_reusable_frames():
+    """After releasing the pools, the next request is decoded from scratch."""
+    files = _select_sample_videos()
+    V = len(files)
+    frame_ids_2d = [[0, 1]] * V
+
+    r2d = nvc.CreateBatchAsyncStreamReader(
+        num_of_set=1, num_of_file=V, max_frames_per_decode_call=2, iGpu=0, reuse_frames=True
+    )
+    r2d.Decode(files, frame_ids_2d, as_bgr=False)
+    r2d.GetBuffer(files, frame_ids_2d, as_bgr=False)
+    r2d.release_device_memory()
+    r2d.Decode(files, frame_ids_2d, as_bgr=False)
+    r2d.GetBuffer(files, frame_ids_2d, as_bgr=False)
+    assert r2d.get_reuse_stats() == {"num_decoded_frames": 4 * V, "num_reused_frames": 0}
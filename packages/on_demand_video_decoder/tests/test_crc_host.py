@@ -0,0 +1,91 @@
+# Copyright (c) 2025, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+"""
+Tests for the host CRC engine (ComputeCRC / CombineCRC).
+
+CRC32 must match zlib (and therefore the GPU ComputeCRC kernel, which uses the
+same table and init/final inversion). CRC32C is checked against a bit-wise
+reference implementation. No GPU or video files required.
+"""
+
+import zlib
+
+import numpy as np
+import pytest
+
+import accvlab.on_demand_video_decoder as nvc
+
+
+def _crc32c_reference(data: bytes) -> int:
+    crc = 0xFFFFFFFF
+    for byte in data:
+        crc ^= byte
+        for _ in range(8):
+            crc = (crc >> 1) ^ (0x82F63B78 if crc & 1 else 0)
+    return crc ^ 0xFFFFFFFF
+
+
+def _random_bytes(size: int, seed: int = 7) -> np.ndarray:
+    rng = np.random.RandomState(seed)
+    return rng.randint(0, 256, size=size, dtype=np.uint8)
+
+
+def test_check_values():
+    assert nvc.ComputeCRC(b"123456789") == 0xCBF43926
+    assert nvc.ComputeCRC(b"123456789", variant=nvc.CrcVariant.CRC32C) == 0xE3069283
+    assert nvc.ComputeCRC(b"") == 0
+
+
+@pytest.mark.parametrize("size", [1, 7, 15, 63, 64, 65, 127, 128, 129, 1000, 4099])
+@pytest.mark.parametrize("offset", [0, 1, 5])
+def test_matches_reference(size, offset):
+    data = _random_bytes(size + offset)[offset:]
+    assert nvc.ComputeCRC(data) == zlib.crc32(data.tobytes())
+    assert nvc.ComputeCRC(data, variant=nvc.CrcVariant.CRC32C) == _crc32c_reference(data.tobytes())
+
+
+@pytest.mark.parametrize("variant", [nvc.CrcVariant.CRC32, nvc.CrcVariant.CRC32C])
+def test_running_crc_and_combine(variant):
+    data = _random_bytes(10_000)
+    full = nvc.ComputeCRC(data, variant=variant)
+    head, tail = data[:3333], data[3333:]
+    crc_head = nvc.ComputeCRC(head, variant=variant)
+    crc_tail = nvc.ComputeCRC(tail, variant=variant)
+    assert nvc.ComputeCRC(tail, crc=crc_head, variant=variant) == full
+    assert nvc.CombineCRC(crc_head, crc_tail, tail.nbytes, variant=variant) == full
+
+
+@pytest.mark.parametrize("variant", [nvc.CrcVariant.CRC32, nvc.CrcVariant.CRC32C])
+@pytest.mark.parametrize("num_threads", [0, 2, 3, 8])
+def test_parallel_matches_serial(variant, num_threads):
+    data = _random_bytes((8 << 20) + 13)
+    serial = nvc.ComputeCRC(data, variant=variant)
+    assert nvc.ComputeCRC(data, variant=variant, num_threads=num_threads) == serial
+    seed = nvc.ComputeCRC(b"prefix", variant=variant)
+    assert nvc.ComputeCRC(data, crc=seed, variant=variant, num_threads=num_threads) == nvc.ComputeCRC(
+        data, crc=seed, variant=variant
+    )
+
+
+def test_multi_byte_dtype_and_non_contiguous():
+    data = _random_bytes(4096).view(np.uint32).reshape(32, 32)
+    assert nvc.ComputeCRC(data) == zlib.crc32(data.tobytes())
+    with pytest.raises(RuntimeError):
+        nvc.ComputeCRC(data[:, ::2])
+
+
+def test_backend_name():
+    assert nvc.GetCRCBackend(nvc.CrcVariant.CRC32) in ("pclmul", "slice-by-8")
+    assert nvc.GetCRCBackend(nvc.CrcVariant.CRC32C) in ("sse4.2", "slice-by-8")
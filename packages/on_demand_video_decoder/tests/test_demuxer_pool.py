@@ -0,0 +1,81 @@
+# Copyright (c) 2025, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+import pytest
+
+import accvlab.on_demand_video_decoder as nvc
+import utils
+
+
+def test_demuxer_pool_reuse():
+    path_base = utils.get_data_dir()
+    files = utils.select_random_clip(path_base)
+    if files is None:
+        pytest.skip("No test video files available")
+    if len(files) < 2:
+        pytest.skip("Need at least 2 files for demuxer pool test")
+    files = files[:2]
+
+    decoder = nvc.CreateGopDecoder(maxfiles=6, iGpu=0)
+
+    packets_first, first_ids_first, gop_lens_first = decoder.GetGOP(files, [10, 10])
+    stats = decoder.get_demuxer_pool_stats()
+    assert stats["capacity"] == 6
+    assert stats["num_opened"] == 2
+    assert stats["num_reused"] == 0
+    assert stats["num_idle"] == 2
+
+    # The second request must be served by the pooled (rewound) demuxers and yield identical results
+    packets_second, first_ids_second, gop_lens_second = decoder.GetGOP(files, [10, 10])
+    stats = decoder.get_demuxer_pool_stats()
+    assert stats["num_opened"] == 2
+    assert stats["num_reused"] == 2
+    assert list(first_ids_first) == list(first_ids_second)
+    assert list(gop_lens_first) == list(gop_lens_second)
+    assert bytes(packets_first) == bytes(packets_second)
+
+
+def test_demuxer_pool_capacity():
+    path_base = utils.get_data_dir()
+    files = utils.select_random_clip(path_base)
+    if files is None:
+        pytest.skip("No test video files available")
+    if len(files) < 3:
+        pytest.skip("Need at least 3 files for demuxer pool capacity test")
+    files = files[:3]
+
+    decoder = nvc.CreateGopDecoder(maxfiles=6, iGpu=0)
+    decoder.set_demuxer_pool_capacity(1)
+
+    decoder.GetGOP(files, [10, 10, 10])
+    stats = decoder.get_demuxer_pool_stats()
+    assert stats["capacity"] == 1
+    assert stats["num_idle"] == 1
+    assert stats["num_evicted"] == 2
+
+    decoder.clear_demuxer_pool()
+    assert decoder.get_demuxer_pool_stats()["num_idle"] == 0
+
+    # Capacity 0 disables pooling
+    decoder.set_demuxer_pool_capacity(0)
+    decoder.GetGOP(files, [10, 10, 10])
+    decoder.GetGOP(files, [10, 10, 10])
+    stats = decoder.get_demuxer_pool_stats()
+    assert stats["num_idle"] == 0
+    assert stats["num_reused"] == 0
+    assert stats["num_opened"] == 9
+
+
+if __name__ == "__main__":
+    pytest.main([__file__])
@@ -0,0 +1,83 @@
+# Copyright (c) 2025, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+
+import pytest
+
+import accvlab.on_demand_video_decoder as nvc
+
+
+def test_decode_cost():
+    gop = nvc.GopStructure(keyframe_ids=[0, 30, 60], num_frames=90)
+    assert gop.decode_cost(0) == 1
+    assert gop.decode_cost(29) == 30
+    assert gop.decode_cost(31) == 2
+
+    # Only every second frame is a reference frame
+    is_reference = [i % 2 == 0 for i in range(90)]
+    gop = nvc.GopStructure(keyframe_ids=[0, 30, 60], num_frames=90, is_reference=is_reference)
+    assert gop.decode_cost(4) == 3
+    assert gop.decode_cost(5) == 4
+    assert gop.gop_cost(0, [3, 5]) == 5
+
+
+def test_snap_frames_independent():
+    gops = {"a.mp4": nvc.GopStructure(keyframe_ids=[0, 30, 60], num_frames=90)}
+    res = nvc.snap_frames(["a.mp4"] * 3, [28, 40, 89], [3, 0, 5], gops, batch_aware=False)
+    assert res.frame_ids == [30, 40, 84]
+    assert res.costs == [1, 11, 25]
+    # Frames 30 and 40 share the prefix of the second GOP
+    assert res.total_cost == 11 + 25
+
+
+def test_snap_frames_batch_shares_gop_prefix():
+    gops = {"a.mp4": nvc.GopStructure(keyframe_ids=[0, 30, 60], num_frames=90)}
+    independent = nvc.snap_frames(["a.mp4"] * 2, [40, 44], 2, gops, batch_aware=False)
+    assert independent.frame_ids == [38, 42]
+
+    # Frame 40 is inside the prefix needed for frame 42, so the target itself is free
+    res = nvc.snap_frames(["a.mp4"] * 2, [40, 44], 2, gops)
+    assert res.frame_ids == [40, 42]
+    assert res.total_cost == 13
+    assert res.total_cost <= independent.total_cost
+
+
+def test_snap_frames_stays_within_tolerance():
+    gops = {
+        "a.mp4": nvc.GopStructure(keyframe_ids=[5, 17, 40], num_frames=50),
+        "b.mp4": nvc.GopStructure(
+            keyframe_ids=[0, 8], num_frames=20, is_reference=[True] * 10 + [False] * 10
+        ),
+    }
+    filepaths = ["a.mp4", "b.mp4", "a.mp4", "b.mp4", "a.mp4"]
+    frame_ids = [6, 12, 20, 19, 49]
+    tolerances = [4, 3, 2, 1, 6]
+    for batch_aware in (False, True):
+        res = nvc.snap_frames(filepaths, frame_ids, tolerances, gops, batch_aware=batch_aware)
+        for selected, target, tolerance in zip(res.frame_ids, frame_ids, tolerances):
+            assert abs(selected - target) <= tolerance
+
+
+def test_snap_frames_invalid_input():
+    gops = {"a.mp4": nvc.GopStructure(keyframe_ids=[10], num_frames=20)}
+    with pytest.raises(ValueError):
+        nvc.snap_frames(["a.mp4"], [2], 3, gops)
+    with pytest.raises(ValueError):
+        nvc.snap_frames(["b.mp4"], [12], 3, gops)
+    with pytest.raises(ValueError):
+        nvc.snap_frames(["a.mp4"], [12], -1, gops)
+
+
+if __name__ == "__main__":
+    pytest.main([__file__])
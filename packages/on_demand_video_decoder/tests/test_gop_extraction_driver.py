@@ -0,0 +1,102 @@
+# Copyright (c) 2025, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+
+import numpy as np
+import pytest
+
+import accvlab.on_demand_video_decoder as nvc
+import utils
+
+
+@pytest.fixture
+def files():
+    path_base = utils.get_data_dir()
+    files = utils.select_random_clip(path_base)
+    if files is None:
+        pytest.skip("No test video files available")
+    return files[:3]
+
+
+def test_gop_extraction_matches_get_gop_list(files, tmp_path):
+    # Frames 0 and 1 lie in the same GOP, so every file yields exactly one bundle
+    frame_ids = [[0, 1] for _ in files]
+    driver = nvc.GopExtractionDriver(str(tmp_path), num_workers=2, progress_interval_s=0)
+    stats = driver.run(files, frame_ids)
+    assert stats["num_jobs"] == len(files)
+    assert stats["num_jobs_done"] == len(files)
+    assert stats["num_jobs_failed"] == 0
+    assert stats["num_gops"] == len(files)
+
+    index = nvc.GopExtractionDriver.read_index(str(tmp_path))
+    assert sorted(index["job_ids"]) == list(range(len(files)))
+    assert sum(index["sizes"]) == stats["num_bytes"]
+
+    decoder = nvc.CreateGopDecoder(maxfiles=6, iGpu=0)
+    for i, job_id in enumerate(index["job_ids"]):
+        assert index["filepaths"][i] == files[job_id]
+        data = np.fromfile(
+            index["shards"][i], dtype=np.uint8, count=index["sizes"][i], offset=index["offsets"][i]
+        )
+        packets, first_ids, gop_lens = decoder.GetGOPList([files[job_id]], [0])[0]
+        assert np.array_equal(data, np.asarray(packets))
+        assert index["first_frame_ids"][i] == first_ids[0]
+        assert index["gop_lens"][i] == gop_lens[0]
+
+    # The extracted bundles can be decoded directly
+    data = np.fromfile(
+        index["shards"][0], dtype=np.uint8, count=index["sizes"][0], offset=index["offsets"][0]
+    )
+    frames = decoder.DecodeFromGOPRGB(data, [index["filepaths"][0]], [1], as_bgr=True)
+    assert len(frames) == 1
+
+
+def test_gop_extraction_resume(files, tmp_path):
+    frame_ids = [[0] for _ in files]
+    stats = nvc.GopExtractionDriver(str(tmp_path), progress_interval_s=0).run(files[:1], frame_ids[:1])
+    assert stats["num_jobs_done"] == 1
+
+    # A different manifest is rejected
+    with pytest.raises(ValueError):
+        nvc.GopExtractionDriver(str(tmp_path), progress_interval_s=0).run(files, frame_ids)
+
+    other_dir = tmp_path / "other"
+    driver = nvc.GopExtractionDriver(str(other_dir), progress_interval_s=0)
+    stats = driver.run(files, frame_ids)
+    assert stats["num_jobs_done"] == len(files)
+    index_before = nvc.GopExtractionDriver.read_index(str(other_dir))
+
+    # Rerunning resumes all completed jobs and does not write anything
+    stats = driver.run(files, frame_ids)
+    assert stats["num_jobs_resumed"] == len(files)
+    assert stats["num_jobs_done"] == 0
+    assert stats["num_bytes"] == 0
+    assert nvc.GopExtractionDriver.read_index(str(other_dir)) == index_before
+
+
+def test_gop_extraction_failed_job_is_retried(files, tmp_path):
+    filepaths = [files[0], str(tmp_path / "missing.mp4")]
+    driver = nvc.GopExtractionDriver(str(tmp_path / "out"), progress_interval_s=0)
+    stats = driver.run(filepaths, [[0], [0]])
+    assert stats["num_jobs_done"] == 1
+    assert stats["num_jobs_failed"] == 1
+    assert stats["failed_jobs"][0][0] == 1
+
+    stats = driver.run(filepaths, [[0], [0]])
+    assert stats["num_jobs_resumed"] == 1
+    assert stats["num_jobs_failed"] == 1
+
+
+if __name__ == "__main__":
+    pytest.main([__file__])
@@ -0,0 +1,99 @@
+# Copyright (c) 2025, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+import os
+
+import pytest
+import torch
+
+import accvlab.on_demand_video_decoder as nvc
+import utils
+
+MAX_FILES = 4
+
+
+def _many_files(tmp_path, num_files):
+    '''Create `num_files` distinct paths (symlinks) to the available test clips.'''
+    files = utils.select_random_clip(utils.get_data_dir())
+    if files is None:
+        pytest.skip("No test video files available")
+    paths = []
+    for i in range(num_files):
+        path = tmp_path / f"clip_{i:04d}{os.path.splitext(files[i % len(files)])[1]}"
+        os.symlink(os.path.abspath(files[i % len(files)]), path)
+        paths.append(str(path))
+    return paths
+
+
+@pytest.mark.parametrize("kwargs", [{}, {"max_files_per_wave": 3}, {"memory_budget": 1}])
+def test_get_gop_list_more_files_than_maxfiles(tmp_path, kwargs):
+    files = _many_files(tmp_path, 50)
+    frames = [(7 * i) % 30 for i in range(len(files))]
+
+    decoder = nvc.CreateGopDecoder(maxfiles=MAX_FILES, iGpu=0)
+    results = decoder.GetGOPList(files, frames, **kwargs)
+
+    # Each bundle has to match the bundle of a call within the file limit
+    reference_decoder = nvc.CreateGopDecoder(maxfiles=MAX_FILES, iGpu=0)
+    utils.assert_gop_list_matches_per_wave(results, reference_decoder, files, frames, MAX_FILES)
+
+
+@pytest.mark.parametrize("kwargs", [{}, {"max_files_per_wave": 7}, {"memory_budget": 1}])
+def test_get_gop_list_hundreds_of_small_files_cpu_only(tmp_path, kwargs):
+    # GetGOPList only demuxes and serializes (no CUDA context is created), so no GPU is needed
+    files = utils.make_small_videos(str(tmp_path), 300)
+    if files is None:
+        pytest.skip("No H.264/HEVC encoder or PNG decoder available in the linked FFmpeg build")
+    frames = [(3 * i) % 12 for i in range(len(files))]
+
+    decoder = nvc.CreateGopDecoder(maxfiles=MAX_FILES, iGpu=0)
+    results = decoder.GetGOPList(files, frames, **kwargs)
+
+    reference_decoder = nvc.CreateGopDecoder(maxfiles=MAX_FILES, iGpu=0)
+    utils.assert_gop_list_matches_per_wave(results, reference_decoder, files, frames, MAX_FILES)
+
+
+def test_get_gop_list_wave_error_is_raised(tmp_path):
+    files = _many_files(tmp_path, 10)
+    files[6] = str(tmp_path / "missing.mp4")
+
+    decoder = nvc.CreateGopDecoder(maxfiles=MAX_FILES, iGpu=0)
+    with pytest.raises(RuntimeError):
+        decoder.GetGOPList(files, [0] * len(files))
+    # The decoder stays usable
+    assert len(decoder.GetGOPList(files[:3], [0, 0, 0])) == 3
+
+
+def test_decode_from_gop_list_more_frames_than_maxfiles(tmp_path):
+    files = _many_files(tmp_path, 3 * MAX_FILES + 1)
+    frames = [(5 * i) % 30 for i in range(len(files))]
+
+    decoder = nvc.CreateGopDecoder(maxfiles=MAX_FILES, iGpu=0)
+    gop_datas = [data for data, _, _ in decoder.GetGOPList(files, frames)]
+    decoded = decoder.DecodeFromGOPListRGB(gop_datas, files, frames, as_bgr=True)
+    assert len(decoded) == len(files)
+    # Frames of earlier waves have to stay valid until all waves are decoded
+    decoded = [torch.as_tensor(frame).clone() for frame in decoded]
+
+    reference_decoder = nvc.CreateGopDecoder(maxfiles=MAX_FILES, iGpu=0)
+    for i in range(0, len(files), MAX_FILES):
+        expected = reference_decoder.DecodeFromGOPListRGB(
+            gop_datas[i : i + MAX_FILES], files[i : i + MAX_FILES], frames[i : i + MAX_FILES], as_bgr=True
+        )
+        for frame, exp_frame in zip(decoded[i : i + MAX_FILES], expected):
+            assert torch.equal(frame, torch.as_tensor(exp_frame))
+
+
+if __name__ == "__main__":
+    pytest.main([__file__])
@@ -0,0 +1,133 @@
+# Copyright (c) 2025, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+"""
+CPU bit-depth / colour conversion parity tests.
+
+The host kernels (ConvertBitDepth16To8, ConvertBitDepth8To16, ConvertNV12ToRGBHost,
+ConvertP016ToRGBHost) are run on the GPU decode output of the bundled pix_fmt_variants
+clips: NV12 -> RGB must match DecodeFromGOPRGB. The GPU decoder has no P016 -> RGB path,
+so for the 10-bit clips the 16 -> 8 bit truncation is checked against the high byte of
+the decoded P016 planes (BitDepth.cu semantics) and the fused P016 -> RGB path against
+the two-step host path.
+"""
+
+import os
+
+import numpy as np
+import pytest
+import torch
+
+import accvlab.on_demand_video_decoder as nvc
+import utils
+
+VARIANTS_DIR = os.path.join(utils.get_data_dir(), "pix_fmt_variants")
+
+
+def _video_path(name):
+    path = os.path.join(VARIANTS_DIR, name)
+    if not os.path.exists(path):
+        pytest.skip(f"test asset missing: {path}")
+    return path
+
+
+class _Plane:
+    """Contiguous CAI wrapper with byte strides derived from the element type."""
+
+    def __init__(self, view, typestr, shape):
+        self.__cuda_array_interface__ = {
+            "version": 3,
+            "shape": shape,
+            "strides": None,
+            "typestr": typestr,
+            "data": (view.dataptr, False),
+        }
+
+
+def _decode_planes_to_host(path, typestr):
+    demuxer = nvc.CreateGopDecoder(maxfiles=1, iGpu=0)
+    decoder = nvc.CreateGopDecoder(maxfiles=1, iGpu=0)
+    gop_data, _, _ = demuxer.GetGOPList([path], [0], useGOPCache=True)[0]
+    frames = decoder.DecodeFromGOP(gop_data, [path], [0])
+    y_view, uv_view = frames[0].cuda()[:2]
+    height, width = y_view.shape[0], y_view.shape[1]
+    y = torch.as_tensor(_Plane(y_view, typestr, (height, width)), device="cuda").cpu().numpy()
+    uv = torch.as_tensor(_Plane(uv_view, typestr, (height // 2, width)), device="cuda").cpu().numpy()
+    return decoder, gop_data, frames[0], y, uv
+
+
+def test_bit_depth_round_trip():
+    rng = np.random.default_rng(0)
+    src = rng.integers(0, 256, size=(37, 53), dtype=np.uint8)
+    expanded = nvc.ConvertBitDepth8To16(src)
+    assert expanded.dtype == np.uint16
+    np.testing.assert_array_equal(expanded, src.astype(np.uint16) << 8)
+    for rounding in (nvc.BitDepthRounding.Truncate, nvc.BitDepthRounding.Round, nvc.BitDepthRounding.Dither):
+        np.testing.assert_array_equal(nvc.ConvertBitDepth16To8(expanded, rounding=rounding), src)
+
+
+def test_rounding_modes():
+    rng = np.random.default_rng(1)
+    src = rng.integers(0, 65536, size=(64, 80), dtype=np.uint16)
+    src[0, :4] = [0xFFFF, 0xFF80, 0xFF7F, 0x0080]
+    exact = src.astype(np.float64) / 256.0
+
+    truncated = nvc.ConvertBitDepth16To8(src, rounding=nvc.BitDepthRounding.Truncate)
+    np.testing.assert_array_equal(truncated, src >> 8)
+
+    rounded = nvc.ConvertBitDepth16To8(src, rounding=nvc.BitDepthRounding.Round)
+    np.testing.assert_array_equal(rounded, np.minimum((src.astype(np.uint32) + 128) >> 8, 255))
+    assert np.abs(rounded - exact).max() <= 0.5 + 1e-9
+
+    dithered = nvc.ConvertBitDepth16To8(src, rounding=nvc.BitDepthRounding.Dither)
+    assert np.abs(dithered - exact).max() < 1.0
+    # Dithering is unbiased on a flat mid-level field.
+    flat = np.full((64, 64), 0x4080, dtype=np.uint16)
+    assert abs(nvc.ConvertBitDepth16To8(flat, rounding=nvc.BitDepthRounding.Dither).mean() - 0x4080 / 256) < 0.05
+
+
+@pytest.mark.parametrize("filename", ["h264_avc1_yuv420p.mp4", "hevc_hev1_yuv420p.mp4"])
+def test_nv12_to_rgb_matches_gpu(filename):
+    path = _video_path(filename)
+    decoder, gop_data, frame, y, uv = _decode_planes_to_host(path, "|u1")
+    gpu_rgb = decoder.DecodeFromGOPRGB(gop_data, [path], [0], as_bgr=False)
+    gpu_rgb = torch.as_tensor(gpu_rgb[0], device="cuda").cpu().numpy()
+
+    is_full_range = frame.color_range == nvc.VideoColorRange.FULL
+    host_rgb = nvc.ConvertNV12ToRGBHost(y, uv, is_full_range=is_full_range, as_bgr=False)
+    assert host_rgb.shape == gpu_rgb.shape
+    in_range, max_diff, _ = utils.is_diff_in_range(host_rgb, gpu_rgb, 1)
+    assert in_range, f"host/GPU RGB mismatch for {filename}: max_diff={max_diff}"
+
+
+@pytest.mark.parametrize("filename", ["hevc_hev1_yuv420p10le.mp4", "hevc_hvc1_yuv420p10le.mp4"])
+def test_p016_host_conversion_of_decoded_planes(filename):
+    path = _video_path(filename)
+    _, _, frame, y16, uv16 = _decode_planes_to_host(path, "<u2")
+
+    y8 = nvc.ConvertBitDepth16To8(y16)
+    uv8 = nvc.ConvertBitDepth16To8(uv16)
+    np.testing.assert_array_equal(y8, (y16 >> 8).astype(np.uint8))
+    np.testing.assert_array_equal(uv8, (uv16 >> 8).astype(np.uint8))
+
+    # The fused path must equal the two-step path with the same rounding.
+    is_full_range = frame.color_range == nvc.VideoColorRange.FULL
+    for rounding in (nvc.BitDepthRounding.Truncate, nvc.BitDepthRounding.Round):
+        fused = nvc.ConvertP016ToRGBHost(y16, uv16, is_full_range=is_full_range, rounding=rounding)
+        two_step = nvc.ConvertNV12ToRGBHost(
+            nvc.ConvertBitDepth16To8(y16, rounding=rounding),
+            nvc.ConvertBitDepth16To8(uv16, rounding=rounding),
+            is_full_range=is_full_range,
+        )
+        np.testing.assert_array_equal(fused, two_step)
@@ -0,0 +1,129 @@
+# Copyright (c) 2025, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+"""
+Tests for host-memory frame containers (CAIMemoryView / RGBFrame with a CPU device type).
+
+Host frames must be wrappable zero-copy by numpy (``__array_interface__`` and the buffer
+protocol) and torch (``__dlpack__`` with kDLCPU). No GPU or video files required.
+"""
+
+import numpy as np
+import pytest
+import torch
+
+import accvlab.on_demand_video_decoder as nvc
+
+K_DL_CPU = 1
+K_DL_CUDA = 2
+
+
+def _host_rgb_frame(array):
+    return nvc.RGBFrame(
+        list(array.shape),
+        list(array.strides),
+        "|u1",
+        0,
+        array.ctypes.data,
+        False,
+        False,
+        device_type=nvc.MemoryDeviceType.CPU,
+    )
+
+
+def test_host_view_array_interface_and_buffer():
+    array = np.arange(6 * 4 * 2, dtype=np.uint16).reshape(6, 4, 2)
+    view = nvc.CAIMemoryView(
+        list(array.shape), list(array.strides), "<u2", 0, array.ctypes.data, False, nvc.MemoryDeviceType.CPU
+    )
+    assert view.device_type == nvc.MemoryDeviceType.CPU
+    assert not hasattr(view, "__cuda_array_interface__")
+
+    wrapped = np.asarray(view)
+    assert wrapped.dtype == np.uint16
+    np.testing.assert_array_equal(wrapped, array)
+    # Zero-copy: writes through the view are visible in the source.
+    wrapped[0, 0, 0] = 1234
+    assert array[0, 0, 0] == 1234
+
+    mv = memoryview(view)
+    assert mv.format == "H"
+    assert mv.shape == array.shape
+    assert mv.strides == array.strides
+
+
+def test_host_view_dlpack():
+    array = np.arange(12, dtype=np.uint8).reshape(3, 4, 1)
+    view = nvc.CAIMemoryView(
+        list(array.shape), list(array.strides), "|u1", 0, array.ctypes.data, False, nvc.MemoryDeviceType.CPU
+    )
+    assert view.__dlpack_device__() == (K_DL_CPU, 0)
+    tensor = torch.from_dlpack(view)
+    assert tensor.device.type == "cpu"
+    assert tensor.data_ptr() == array.ctypes.data
+    np.testing.assert_array_equal(tensor.numpy(), array)
+
+
+def test_host_rgb_frame():
+    array = np.random.default_rng(0).integers(0, 256, size=(8, 10, 3), dtype=np.uint8)
+    frame = _host_rgb_frame(array)
+    assert frame.device_type == nvc.MemoryDeviceType.CPU
+    assert not hasattr(frame, "__cuda_array_interface__")
+    np.testing.assert_array_equal(np.asarray(frame), array)
+    np.testing.assert_array_equal(np.frombuffer(memoryview(frame).tobytes(), np.uint8).reshape(8, 10, 3), array)
+
+    tensor = torch.from_dlpack(frame)
+    assert tensor.data_ptr() == array.ctypes.data
+    np.testing.assert_array_equal(tensor.numpy(), array)
+
+
+def test_host_rgb_frame_non_contiguous_strides():
+    base = np.zeros((8, 16, 3), dtype=np.uint8)
+    array = base[:, ::2, :]
+    array[...] = 7
+    frame = _host_rgb_frame(array)
+    wrapped = np.asarray(frame)
+    assert wrapped.strides == array.strides
+    np.testing.assert_array_equal(wrapped, array)
+    assert torch.from_dlpack(frame).stride() == (48, 6, 1)
+
+
+def test_dlpack_stream_argument():
+    array = np.arange(24, dtype=np.uint8).reshape(2, 4, 3)
+    frame = _host_rgb_frame(array)
+    # Host memory is read without a stream: only None and -1 (no synchronization) are valid.
+    for stream in (None, -1):
+        tensor = torch.utils.dlpack.from_dlpack(frame.__dlpack__(stream=stream))
+        assert tensor.data_ptr() == array.ctypes.data
+    for stream in (1, 2, 0x1234):
+        with pytest.raises(BufferError):
+            frame.__dlpack__(stream=stream)
+
+    # A device view written on the legacy default stream needs no synchronization for a consumer on the
+    # legacy default stream; -1 skips the synchronization. Neither touches the (fake) device memory.
+    view = nvc.CAIMemoryView([4, 4, 1], [4, 1, 1], "|u1", 0, 0x1000, True)
+    for stream in (None, 1, -1):
+        assert view.__dlpack__(stream=stream) is not None
+    with pytest.raises(BufferError):
+        view.__dlpack__(stream=0)
+
+
+def test_device_view_has_no_host_interfaces():
+    view = nvc.CAIMemoryView([4, 4, 1], [4, 1, 1], "|u1", 0, 0x1000, True)
+    assert view.device_type == nvc.MemoryDeviceType.CUDA
+    assert view.__dlpack_device__() == (K_DL_CUDA, 0)
+    assert view.__cuda_array_interface__["gpuIdx"] == 0
+    assert not hasattr(view, "__array_interface__")
+    with pytest.raises(Exception):
+        memoryview(view)
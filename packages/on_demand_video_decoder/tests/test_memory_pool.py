@@ -0,0 +1,116 @@
+# Copyright (c) 2025, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+
+import ctypes
+
+import pytest
+
+import accvlab.on_demand_video_decoder as nvc
+
+
+def _fill(address, value, size):
+    ctypes.memset(address, value, size)
+
+
+def _check(address, value, size):
+    return ctypes.string_at(address, size) == bytes([value]) * size
+
+
+def test_growth_does_not_move_allocations():
+    pool = nvc.HostMemoryPool(initial_segment_size=1024, alignment=64)
+    first = pool.allocate(1000)
+    _fill(first, 1, 1000)
+    assert first % 64 == 0
+
+    # Does not fit into the first segment: a second segment is chained
+    second = pool.allocate(4000)
+    _fill(second, 2, 4000)
+    stats = pool.get_stats()
+    assert stats["num_segments"] == 2
+    assert stats["capacity"] >= 1024 + 4000
+    assert _check(first, 1, 1000)
+    assert _check(second, 2, 4000)
+
+
+def test_rollback_releases_later_allocations_only():
+    pool = nvc.HostMemoryPool(alignment=64)
+    first = pool.allocate(100)
+    _fill(first, 7, 100)
+    mark = pool.get_mark()
+    used_at_mark = pool.get_stats()["used"]
+
+    second = pool.allocate(300)
+    pool.allocate(5000)
+    pool.rollback(mark)
+    assert pool.get_stats()["used"] == used_at_mark
+    assert pool.allocate(300) == second
+    assert _check(first, 7, 100)
+
+    pool.rewind()
+    with pytest.raises(ValueError):
+        pool.rollback(mark)
+
+
+def test_reset_coalesces_and_trims_to_high_water_mark():
+    pool = nvc.HostMemoryPool(alignment=1, trim_interval=4, trim_slack=1.0)
+    pool.allocate(1000)
+    pool.allocate(3000)
+    assert pool.get_stats()["num_segments"] == 2
+
+    pool.reset()
+    stats = pool.get_stats()
+    assert stats["num_segments"] == 1
+    assert stats["capacity"] == 4000
+    # Steady state: allocations fit into the coalesced segment
+    pool.allocate(1000)
+    pool.allocate(3000)
+    assert pool.get_stats()["num_segments"] == 1
+    assert pool.get_stats()["peak_used"] == 4000
+
+    # Trim interval of 4 resets: the first interval contains the peak, the second one does not
+    for _ in range(3):
+        pool.reset()
+    assert pool.get_stats()["capacity"] == 4000
+    for _ in range(4):
+        pool.allocate(500)
+        pool.reset()
+    stats = pool.get_stats()
+    assert stats["capacity"] == 500
+    assert stats["peak_used"] == 4000
+    assert stats["num_segment_allocs"] - stats["num_segment_frees"] == 1
+
+
+def test_reset_and_reserve():
+    pool = nvc.HostMemoryPool(alignment=1)
+    pool.allocate(10)
+    pool.reset_and_reserve(10000)
+    assert pool.get_stats()["capacity"] == 10000
+    pool.allocate(6000)
+    pool.allocate(4000)
+    assert pool.get_stats()["num_segments"] == 1
+
+    pool.release()
+    stats = pool.get_stats()
+    assert stats["capacity"] == 0
+    assert stats["num_segment_allocs"] == stats["num_segment_frees"]
+
+
+def test_invalid_alignment():
+    with pytest.raises(ValueError):
+        nvc.HostMemoryPool(alignment=3)
+
+
+if __name__ == "__main__":
+    pytest.main([__file__, "-v"])
@@ -0,0 +1,106 @@
+# Copyright (c) 2025, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+import pytest
+
+import accvlab.on_demand_video_decoder as nvc
+
+FILES = ["cam_front.mp4", "cam_back.mp4"]
+
+
+def test_fingerprints_distinguish_file_frame_and_variant():
+    fingerprints = {
+        nvc.FingerprintFrame(path, frame_id, variant)
+        for path in FILES
+        for frame_id in range(1000)
+        for variant in (0, 1)
+    }
+    assert len(fingerprints) == len(FILES) * 1000 * 2
+    assert nvc.FingerprintFrame("a.mp4", 5) == nvc.FingerprintFrame("a.mp4", 5)
+    assert all(0 <= fp < 2**64 for fp in fingerprints)
+
+
+def test_no_resident_request_decodes_everything():
+    planner = nvc.RequestReusePlanner()
+    plan = planner.plan(FILES, [[0, 1], [0, 1]])
+    assert plan["reuse"] == []
+    assert plan["decode"] == [(0, 0), (0, 1), (1, 0), (1, 1)]
+    assert plan["keep_resident"] == []
+
+
+def test_sliding_window_only_decodes_delta():
+    planner = nvc.RequestReusePlanner()
+    planner.set_resident(FILES, [[10, 11, 12, 13], [20, 21, 22, 23]])
+    assert planner.num_resident_frames == 8
+
+    plan = planner.plan(FILES, [[11, 12, 13, 14], [21, 22, 23, 24]])
+    assert plan["decode"] == [(0, 3), (1, 3)]
+    assert sorted(plan["reuse"]) == [((v, f), (v, f + 1)) for v in range(2) for f in range(3)]
+
+
+def test_reuse_across_reordered_videos():
+    planner = nvc.RequestReusePlanner()
+    planner.set_resident(FILES, [[0, 1], [5, 6]])
+    plan = planner.plan([FILES[1], FILES[0]], [[6, 7], [1, 2]])
+    assert sorted(plan["reuse"]) == [((0, 0), (1, 1)), ((1, 0), (0, 1))]
+    assert plan["decode"] == [(0, 1), (1, 1)]
+
+
+def test_variant_and_clear_disable_reuse():
+    planner = nvc.RequestReusePlanner()
+    planner.set_resident(FILES, [[0], [0]], variant=1)
+    assert planner.plan(FILES, [[0], [0]], variant=0)["reuse"] == []
+    assert len(planner.plan(FILES, [[0], [0]], variant=1)["reuse"]) == 2
+
+    planner.clear()
+    assert planner.num_resident_frames == 0
+    assert planner.plan(FILES, [[0], [0]], variant=1)["reuse"] == []
+
+
+def test_duplicate_frames_reuse_first_occurrence():
+    planner = nvc.RequestReusePlanner()
+    planner.set_resident([FILES[0], FILES[0]], [[3, 4], [4, 5]])
+    plan = planner.plan([FILES[0]], [[4]])
+    assert plan["reuse"] == [((0, 0), (0, 1))]
+
+
+def test_keep_resident_gops():
+    planner = nvc.RequestReusePlanner(default_gop_length=30)
+    planner.set_gop_boundaries(FILES[1], [0, 12, 40])
+    plan = planner.plan(FILES, [[29, 30], [11, 12, 45]])
+    # Ordered by file, then by first frame id
+    assert plan["keep_resident"] == [
+        (FILES[1], 0),
+        (FILES[1], 12),
+        (FILES[1], 40),
+        (FILES[0], 0),
+        (FILES[0], 30),
+    ]
+
+    # Without GOP information, no GOPs are reported
+    assert nvc.RequestReusePlanner().plan(FILES, [[1], [2]])["keep_resident"] == []
+
+
+def test_mismatched_request_is_rejected():
+    planner = nvc.RequestReusePlanner()
+    with pytest.raises(ValueError):
+        planner.plan(FILES, [[0]])
+    with pytest.raises(ValueError):
+        planner.set_resident(FILES, [[0]])
+    with pytest.raises(ValueError):
+        nvc.RequestReusePlanner(default_gop_length=-1)
+
+
+if __name__ == "__main__":
+    pytest.main([__file__, "-v"])
@@ -0,0 +1,82 @@
+# Copyright (c) 2025, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+
+import numpy as np
+import pytest
+
+import accvlab.on_demand_video_decoder as nvc
+import utils
+
+
+def test_timestamp_index_nearest_and_range():
+    index = nvc.MultiStreamTimestampIndex()
+    # Stream 1 is not sorted by frame id (e.g. a pts table with B-frames), stream 2 has an offset
+    assert index.add_stream("cam0.mp4", [0.0, 0.1, 0.2, 0.3]) == 0
+    assert index.add_stream("cam1.mp4", [0.05, 0.25, 0.15]) == 1
+    assert index.add_stream("cam2.mp4", np.array([0.0, 0.1, 0.2]), offset=1.0) == 2
+    assert index.num_streams == 3
+    assert index.filepaths == ["cam0.mp4", "cam1.mp4", "cam2.mp4"]
+    assert index.get_num_frames(1) == 3
+    assert index.get_timestamps(2) == pytest.approx([1.0, 1.1, 1.2])
+
+    filepaths, frame_ids, stream_ids = index.find_nearest(0.16)
+    assert filepaths == ["cam0.mp4", "cam1.mp4", "cam2.mp4"]
+    assert frame_ids == [2, 2, 0]
+    assert stream_ids == [0, 1, 2]
+
+    filepaths, frame_ids, stream_ids = index.find_nearest(0.16, max_distance=0.05)
+    assert frame_ids == [2, 2]
+    assert stream_ids == [0, 1]
+
+    # At 1.2, streams 0 and 1 are too far from their nearest frames and omitted
+    filepaths, frame_ids, stream_ids = index.find_nearest_batch([0.0, 1.2], max_distance=0.06)
+    assert frame_ids == [0, 0, 2]
+    assert stream_ids == [0, 1, 2]
+
+    filepaths, frame_ids, stream_ids = index.find_range(0.1, 0.26)
+    assert filepaths == ["cam0.mp4", "cam0.mp4", "cam1.mp4", "cam1.mp4"]
+    assert frame_ids == [1, 2, 2, 1]
+    assert stream_ids == [0, 0, 1, 1]
+
+    assert index.find_range(0.5, 0.4) == ([], [], [])
+
+
+def test_timestamp_index_from_file_feeds_decoder():
+    path_base = utils.get_data_dir()
+    files = utils.select_random_clip(path_base)
+    if files is None:
+        pytest.skip("No test video files available")
+    files = files[:3]
+
+    index = nvc.MultiStreamTimestampIndex()
+    for file in files:
+        index.add_stream_from_file(file)
+        timestamps = nvc.MultiStreamTimestampIndex.scan_frame_timestamps(file)
+        assert index.get_timestamps(index.num_streams - 1) == pytest.approx(timestamps)
+        assert timestamps[0] == 0.0
+        assert all(t0 < t1 for t0, t1 in zip(timestamps[:-1], timestamps[1:]))
+
+    query_time = index.get_timestamps(0)[10]
+    filepaths, frame_ids, _ = index.find_nearest(query_time)
+    assert filepaths == files
+    assert frame_ids[0] == 10
+
+    decoder = nvc.CreateGopDecoder(maxfiles=6, iGpu=0)
+    frames = decoder.DecodeN12ToRGB(filepaths, frame_ids, True)
+    assert len(frames) == len(files)
+
+
+if __name__ == "__main__":
+    pytest.main([__file__])
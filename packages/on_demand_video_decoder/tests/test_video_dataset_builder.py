@@ -0,0 +1,96 @@
+# Copyright (c) 2025, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+
+import json
+import os
+
+import pytest
+
+import accvlab.on_demand_video_decoder as nvc
+from utils import make_sequence
+
+
+@pytest.fixture
+def encoder():
+    if "png" not in nvc.VideoDatasetBuilder.available_image_decoders():
+        pytest.skip("No PNG decoder available in the linked FFmpeg build")
+    available = nvc.VideoDatasetBuilder.available_encoders()
+    for name in ["libx264", "libx265", "mpeg4"]:
+        if name in available:
+            return name
+    pytest.skip("No suitable video encoder available in the linked FFmpeg build")
+
+
+def test_build_with_interpolation_and_gop_index(encoder, tmp_path):
+    sequences = [make_sequence(str(tmp_path / f"images{i}"), 10) for i in range(2)]
+    outputs = [str(tmp_path / f"videos/seq{i}/CAM_FRONT.mp4") for i in range(2)]
+    builder = nvc.VideoDatasetBuilder(
+        encoder=encoder, fps=12, gop_size=4, interpolation_num_frames=1, num_workers=2, progress_interval_s=0
+    )
+    stats = builder.build(sequences, outputs)
+    assert stats["num_sequences_done"] == 2
+    assert stats["num_sequences_failed"] == 0
+    assert stats["num_images"] == 20
+    assert stats["num_frames"] == 2 * 19
+
+    for output in outputs:
+        assert os.path.getsize(output) > 0
+        assert not os.path.exists(output + ".tmp")
+        with open(nvc.VideoDatasetBuilder.gop_index_path(output)) as f:
+            gop_index = json.load(f)
+        assert gop_index["num_frames"] == 19
+        assert gop_index["num_source_frames"] == 10
+        assert (gop_index["width"], gop_index["height"]) == (64, 48)
+        # Keyframes are forced every gop_size frames
+        assert set(range(0, 19, 4)) <= set(gop_index["keyframe_ids"])
+        assert sum(gop_index["gop_lens"]) == 19
+        assert len(nvc.MultiStreamTimestampIndex.scan_frame_timestamps(output)) == 19
+
+        # The sidecar can be used directly for decode-cost-aware frame selection
+        gops = nvc.GopStructure(gop_index["keyframe_ids"], gop_index["num_frames"])
+        assert gops.decode_cost(8) == 1
+
+
+def test_failed_and_skipped_sequences(encoder, tmp_path):
+    good = make_sequence(str(tmp_path / "images"), 5)
+    bad = good[:2] + [str(tmp_path / "missing.png")] + good[2:]
+    outputs = [str(tmp_path / "good.mp4"), str(tmp_path / "bad.mp4")]
+    builder = nvc.VideoDatasetBuilder(encoder=encoder, gop_size=4, skip_existing=True, progress_interval_s=0)
+
+    stats = builder.build([good, bad], outputs)
+    assert stats["num_sequences_done"] == 1
+    assert stats["num_sequences_failed"] == 1
+    assert stats["failed_sequences"][0][0] == 1
+    assert not os.path.exists(outputs[1])
+    assert not os.path.exists(outputs[1] + ".tmp")
+
+    stats = builder.build([good, bad], outputs)
+    assert stats["num_sequences_skipped"] == 1
+    assert stats["num_sequences_failed"] == 1
+
+
+def test_invalid_configuration():
+    with pytest.raises(ValueError):
+        nvc.VideoDatasetBuilder(encoder="no_such_encoder")
+    encoders = nvc.VideoDatasetBuilder.available_encoders()
+    if encoders:
+        with pytest.raises(ValueError):
+            nvc.VideoDatasetBuilder(encoder=encoders[0], encoder_options={"no_such_option": "1"})
+        with pytest.raises(ValueError):
+            nvc.VideoDatasetBuilder(encoder=encoders[0], pix_fmt="no_such_format")
+
+
+if __name__ == "__main__":
+    pytest.main([__file__])
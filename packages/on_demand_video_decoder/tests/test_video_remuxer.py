@@ -0,0 +1,93 @@
+# Copyright (c) 2025, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+
+import json
+import os
+
+import numpy as np
+import pytest
+
+import accvlab.on_demand_video_decoder as nvc
+import utils
+
+
+def select_files():
+    path_base = utils.get_data_dir()
+    files = utils.select_random_clip(path_base)
+    if files is None:
+        pytest.skip("No test video files available")
+    return files[:2]
+
+
+def test_remux_writes_cfr_fragmented_mp4_and_gop_index(tmp_path):
+    files = select_files()
+    outputs = [str(tmp_path / f"remuxed/cam{i}.mp4") for i in range(len(files))]
+    results = nvc.RemuxForRandomAccess(files, outputs, num_threads=2)
+    assert len(results) == len(files)
+
+    for result, output in zip(results, outputs):
+        assert result["ok"], result["error"]
+        assert result["output_path"] == output
+        assert not os.path.exists(output + ".tmp")
+        assert result["num_gops"] >= 1
+        assert result["min_gop_len"] <= result["mean_gop_len"] <= result["max_gop_len"]
+        assert result["needs_reencode"] == bool(result["reencode_reasons"])
+
+        with open(output + ".gop_index.json") as f:
+            gop_index = json.load(f)
+        assert gop_index["num_frames"] == result["num_frames"]
+        assert gop_index["keyframe_ids"][0] == 0
+        assert len(gop_index["keyframe_ids"]) == result["num_gops"]
+        assert sum(gop_index["gop_lens"]) == result["num_frames"]
+        assert max(gop_index["gop_lens"]) == result["max_gop_len"]
+
+        timestamps = nvc.MultiStreamTimestampIndex.scan_frame_timestamps(output)
+        assert len(timestamps) == result["num_frames"]
+        assert timestamps[0] == 0.0
+        if result["is_cfr"]:
+            intervals = np.diff(timestamps)
+            assert intervals == pytest.approx(np.full_like(intervals, 1.0 / result["fps"]))
+
+    # The remuxed videos are decoded like the sources (frame ids only shift by the dropped leading frames)
+    frame_ids = [min(10, result["num_frames"] - 1) for result in results]
+    source_frame_ids = [
+        frame_id + result["num_dropped_frames"] for frame_id, result in zip(frame_ids, results)
+    ]
+    decoder = nvc.CreateGopDecoder(maxfiles=4, iGpu=0)
+    remuxed_frames = decoder.DecodeN12ToRGB(outputs, frame_ids, True)
+    source_frames = decoder.DecodeN12ToRGB(files, source_frame_ids, True)
+    for remuxed, source in zip(remuxed_frames, source_frames):
+        assert np.array_equal(np.asarray(remuxed), np.asarray(source))
+
+
+def test_remux_analysis_only_and_errors(tmp_path):
+    files = select_files()
+    missing = str(tmp_path / "missing.mp4")
+    results = nvc.RemuxForRandomAccess(files + [missing], max_gop_len=1)
+    for result in results[:-1]:
+        assert result["ok"], result["error"]
+        assert result["output_path"] == ""
+        if result["max_gop_len"] > 1:
+            assert result["needs_reencode"]
+    assert not results[-1]["ok"]
+    assert results[-1]["error"]
+    assert not os.listdir(tmp_path)
+
+    with pytest.raises(ValueError):
+        nvc.RemuxForRandomAccess(files, [str(tmp_path / "out.mp4")])
+
+
+if __name__ == "__main__":
+    pytest.main([__file__])
@@ -16,6 +16,9 @@ import torch
 import numpy as np
 import os
 import random
+import shutil
+import struct
+import zlib
 
 
 def is_diff_in_range(to_comp_1, to_comp_2, tolerance):
@@ -155,3 +158,79 @@ def select_random_clip(path_base):
     video_names = os.listdir(clip_dir)
     files = [os.path.join(clip_dir, file) for file in video_names]
     return files
+
+
+def write_png(path, rgb):
+    """Write an RGB uint8 image as PNG (without depending on an imaging library)."""
+
+    def chunk(tag, data):
+        return struct.pack(">I", len(data)) + tag + data + struct.pack(">I", zlib.crc32(tag + data))
+
+    height, width, _ = rgb.shape
+    raw = b"".join(b"\x00" + rgb[y].tobytes() for y in range(height))
+    with open(path, "wb") as f:
+        f.write(b"\x89PNG\r\n\x1a\n")
+        f.write(chunk(b"IHDR", struct.pack(">IIBBBBB", width, height, 8, 2, 0, 0, 0)))
+        f.write(chunk(b"IDAT", zlib.compress(raw)))
+        f.write(chunk(b"IEND", b""))
+
+
+def make_sequence(directory, num_images, width=64, height=48):
+    """Write a sequence of `num_images` synthetic PNG images (with a moving box) to `directory`."""
+    os.makedirs(directory, exist_ok=True)
+    paths = []
+    for i in range(num_images):
+        rgb = np.zeros((height, width, 3), dtype=np.uint8)
+        rgb[..., 0] = np.arange(width, dtype=np.uint8)[None, :] * 4
+        rgb[8:24, 2 * i : 2 * i + 16, 1] = 255
+        path = os.path.join(directory, f"{i:04d}.png")
+        write_png(path, rgb)
+        paths.append(path)
+    return paths
+
+
+def make_small_videos(directory, num_files, num_distinct=8, num_frames=12):
+    """
+    Create `num_files` small H.264/HEVC videos in `directory` (copies of `num_distinct` encoded image
+    sequences with `num_frames` to `num_frames + num_distinct - 1` frames).
+
+    Returns None if the linked FFmpeg build has no H.264/HEVC encoder or PNG decoder.
+    """
+    import accvlab.on_demand_video_decoder as nvc
+
+    available = nvc.VideoDatasetBuilder.available_encoders()
+    encoder = next((name for name in ["libx264", "libx265"] if name in available), None)
+    if encoder is None or "png" not in nvc.VideoDatasetBuilder.available_image_decoders():
+        return None
+    sequences = [
+        make_sequence(os.path.join(directory, f"images{i}"), num_frames + i) for i in range(num_distinct)
+    ]
+    sources = [os.path.join(directory, "sources", f"clip_{i}.mp4") for i in range(num_distinct)]
+    builder = nvc.VideoDatasetBuilder(encoder=encoder, gop_size=4, num_workers=4, progress_interval_s=0)
+    if builder.build(sequences, sources)["num_sequences_done"] != num_distinct:
+        raise RuntimeError("Failed to encode the test videos")
+    os.makedirs(os.path.join(directory, "videos"), exist_ok=True)
+    paths = []
+    for i in range(num_files):
+        path = os.path.join(directory, "videos", f"clip_{i:04d}.mp4")
+        shutil.copyfile(sources[i % num_distinct], path)
+        paths.append(path)
+    return paths
+
+
+def assert_gop_list_matches_per_wave(results, reference_decoder, file_path_list, frame_id_list, wave_size):
+    """
+    Check that the GetGOPList `results` for all files match the results of `reference_decoder` for calls with
+    at most `wave_size` files each.
+    """
+    assert len(results) == len(file_path_list)
+    for i in range(0, len(file_path_list), wave_size):
+        expected = reference_decoder.GetGOPList(
+            file_path_list[i : i + wave_size], frame_id_list[i : i + wave_size]
+        )
+        for (data, first_ids, gop_lens), (exp_data, exp_first_ids, exp_gop_lens) in zip(
+            results[i : i + wave_size], expected
+        ):
+            assert bytes(data) == bytes(exp_data)
+            assert list(first_ids) == list(exp_first_ids)
+            assert list(gop_lens) == list(exp_gop_lens)